@@ -4,8 +4,13 @@
 
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/App.hpp"
+
+#include <thread>
+
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BatchNoise.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/GenerationBenchmark.hpp"
 #include "Game/Framework/WorldGenConfig.hpp"
 #include "Game/Gameplay/Game.hpp"
 //----------------------------------------------------------------------------------------------------
@@ -54,11 +59,15 @@ void App::Startup()
 
     g_eventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnCloseButtonClicked);
     g_eventSystem->SubscribeEventCallbackFunction("quit", OnCloseButtonClicked);
+    g_eventSystem->SubscribeEventCallbackFunction("benchgen", OnBenchmarkGeneration);
 
     // Initialize world generation config system (Assignment 4: Phase 5B.4)
     g_worldGenConfig = new WorldGenConfig();
     g_worldGenConfig->LoadFromXML("Data/GameConfig.xml");  // Load saved config if exists
 
+    // Pick the batch noise path before any chunk generation job can run
+    ValidateBatchNoise();
+
     g_game = new Game();
 }
 
@@ -138,6 +147,21 @@ STATIC bool App::OnCloseButtonClicked(EventArgs& args)
     return false;
 }
 
+//----------------------------------------------------------------------------------------------------
+// OnBenchmarkGeneration - Run RunGenerationBenchmark() on a fixed chunk square; results go to the debugger output
+//----------------------------------------------------------------------------------------------------
+STATIC bool App::OnBenchmarkGeneration(EventArgs& args)
+{
+    GenerationBenchmarkSettings settings;
+    settings.m_chunkRadius       = args.GetValue("radius", settings.m_chunkRadius);
+    settings.m_workerCount       = args.GetValue("workers", (int)std::thread::hardware_concurrency());
+    settings.m_centerChunkCoords = IntVec2(args.GetValue("x", 0), args.GetValue("y", 0));
+
+    RunGenerationBenchmark(settings);
+
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------
 STATIC void App::RequestQuit()
 {
@@ -26,6 +26,7 @@ public:
     void DeleteAndCreateNewGame();
 
     static bool OnCloseButtonClicked(EventArgs& args);
+    static bool OnBenchmarkGeneration(EventArgs& args);     // Dev console: benchgen radius=4 workers=8 x=0 y=0
     static void RequestQuit();
     static bool m_isQuitting;
 
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------------------------------
+// BakedCurve1D.cpp - Fixed-size lookup table for a PiecewiseCurve1D terrain shaping curve
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BakedCurve1D.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void BakedCurve1D::Bake(PiecewiseCurve1D const& curve, float const minInput, float const maxInput)
+{
+    GUARANTEE_OR_DIE(maxInput > minInput, "BakedCurve1D::Bake: empty input domain");
+
+    float const cellWidth = (maxInput - minInput) / (float)BAKED_CURVE_CELL_COUNT;
+    m_minInput      = minInput;
+    m_maxInput      = maxInput;
+    m_cellsPerInput = (float)BAKED_CURVE_CELL_COUNT / (maxInput - minInput);
+
+    // --- Samples at every cell boundary (the last one exactly at maxInput) ---
+    float cellStartValue = curve.Evaluate(minInput);
+    for (int cellIndex = 0; cellIndex < BAKED_CURVE_CELL_COUNT; ++cellIndex)
+    {
+        float const cellEnd      = (cellIndex + 1 == BAKED_CURVE_CELL_COUNT) ? maxInput : minInput + (float)(cellIndex + 1) * cellWidth;
+        float const cellEndValue = curve.Evaluate(cellEnd);
+
+        m_cellValues[cellIndex] = cellStartValue;
+        m_cellDeltas[cellIndex] = cellEndValue - cellStartValue;
+        cellStartValue          = cellEndValue;
+    }
+    m_lastValue = cellStartValue;
+
+    // --- Maximum error: inside every cell, and at every control point (where linear segments bend) ---
+    float maxError = 0.f;
+    for (int cellIndex = 0; cellIndex < BAKED_CURVE_CELL_COUNT; ++cellIndex)
+    {
+        for (int sampleIndex = 1; sampleIndex < BAKED_CURVE_SAMPLES_PER_CELL; ++sampleIndex)
+        {
+            float const input = minInput + ((float)cellIndex + (float)sampleIndex / (float)BAKED_CURVE_SAMPLES_PER_CELL) * cellWidth;
+            maxError = (std::max)(maxError, fabsf(Evaluate(input) - curve.Evaluate(input)));
+        }
+    }
+
+    m_bakedPoints.clear();
+    for (int pointIndex = 0; pointIndex < curve.GetNumPoints(); ++pointIndex)
+    {
+        PiecewiseCurve1D::ControlPoint const point = curve.GetPoint(pointIndex);
+        m_bakedPoints.push_back(point);
+
+        if (point.t > minInput && point.t < maxInput)
+        {
+            maxError = (std::max)(maxError, fabsf(Evaluate(point.t) - curve.Evaluate(point.t)));
+        }
+    }
+
+    m_maxError = maxError;
+    m_isBaked  = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// BakeIfChanged - Bake only if the control points or the domain differ from the current table
+// Cheap enough to call every frame from the curve editor
+//----------------------------------------------------------------------------------------------------
+bool BakedCurve1D::BakeIfChanged(PiecewiseCurve1D const& curve, float const minInput, float const maxInput)
+{
+    bool isUnchanged = m_isBaked && m_minInput == minInput && m_maxInput == maxInput &&
+                       (int)m_bakedPoints.size() == curve.GetNumPoints();
+
+    for (int pointIndex = 0; isUnchanged && pointIndex < curve.GetNumPoints(); ++pointIndex)
+    {
+        PiecewiseCurve1D::ControlPoint const point = curve.GetPoint(pointIndex);
+        isUnchanged = (point.t == m_bakedPoints[pointIndex].t && point.value == m_bakedPoints[pointIndex].value);
+    }
+
+    if (isUnchanged)
+    {
+        return false;
+    }
+
+    Bake(curve, minInput, maxInput);
+    return true;
+}
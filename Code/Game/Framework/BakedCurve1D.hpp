@@ -0,0 +1,66 @@
+//----------------------------------------------------------------------------------------------------
+// BakedCurve1D.hpp - Fixed-size lookup table for a PiecewiseCurve1D terrain shaping curve
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <vector>
+
+#include "Engine/Math/Curve1D.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr BAKED_CURVE_CELL_COUNT       = 1024;     // Table cells over the input domain (power of two)
+int constexpr BAKED_CURVE_SAMPLES_PER_CELL = 8;        // Extra exact evaluations per cell when measuring the error
+
+//----------------------------------------------------------------------------------------------------
+// BakedCurve1D - PiecewiseCurve1D sampled at BAKED_CURVE_CELL_COUNT + 1 evenly spaced inputs
+//
+// Evaluate() clamps the input to the baked domain and interpolates linearly between the two nearest
+// samples: one multiply-add from two flat float arrays (cell start value, delta to the next), with no
+// search over control points. The arrays are 16-byte aligned and fixed size, so a batch of inputs maps
+// onto SIMD lanes with a gather and one fma.
+//
+// Bake() also records GetMaxError(), the largest |Evaluate() - curve.Evaluate()| over the domain:
+// - Between samples the table is linear, so on piecewise-linear segments its error is largest where the
+//   curve bends, i.e. at a control point. Bake() evaluates every control point, which makes the bound
+//   exact for piecewise-linear curves (at most cellWidth / 4 * |slope change| per control point)
+// - BAKED_CURVE_SAMPLES_PER_CELL samples inside every cell cover any curvature between control points
+//
+// Thread Safety:
+// - Bake() / BakeIfChanged() mutate the table and run on the main thread
+// - Evaluate() is const and safe from any thread while no bake is running
+//----------------------------------------------------------------------------------------------------
+class BakedCurve1D
+{
+public:
+    BakedCurve1D() = default;
+
+    void  Bake(PiecewiseCurve1D const& curve, float minInput, float maxInput);
+    bool  BakeIfChanged(PiecewiseCurve1D const& curve, float minInput, float maxInput);     // true if it re-baked
+    float Evaluate(float input) const
+    {
+        float const cellPosition = (input - m_minInput) * m_cellsPerInput;
+        if (!(cellPosition > 0.f)) return m_cellValues[0];
+        if (cellPosition >= (float)BAKED_CURVE_CELL_COUNT) return m_lastValue;
+
+        int const cellIndex = (int)cellPosition;
+        return m_cellValues[cellIndex] + m_cellDeltas[cellIndex] * (cellPosition - (float)cellIndex);
+    }
+
+    bool  IsBaked() const { return m_isBaked; }
+    float GetMinInput() const { return m_minInput; }
+    float GetMaxInput() const { return m_maxInput; }
+    float GetMaxError() const { return m_maxError; }
+
+private:
+    alignas(16) float m_cellValues[BAKED_CURVE_CELL_COUNT] = {};     // Curve at the start of each cell
+    alignas(16) float m_cellDeltas[BAKED_CURVE_CELL_COUNT] = {};     // Next cell start minus this one
+    float             m_lastValue     = 0.f;                          // Curve at maxInput
+    float             m_minInput      = 0.f;
+    float             m_maxInput      = 0.f;
+    float             m_cellsPerInput = 0.f;
+    float             m_maxError      = 0.f;
+    bool              m_isBaked       = false;
+
+    std::vector<PiecewiseCurve1D::ControlPoint> m_bakedPoints;        // Source of the current table, for BakeIfChanged()
+};
@@ -0,0 +1,588 @@
+//----------------------------------------------------------------------------------------------------
+// BatchNoise.cpp - Grid-at-a-time Perlin noise matching ThirdParty/Noise/SmoothNoise
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BatchNoise.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define BATCH_NOISE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "ThirdParty/Noise/RawNoise.hpp"
+#include "ThirdParty/Noise/SmoothNoise.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static BatchNoiseValidation s_batchNoiseValidation;     // Written once by ValidateBatchNoise(), read-only afterwards
+
+//----------------------------------------------------------------------------------------------------
+// Reference path: one SmoothNoise call per sample
+//----------------------------------------------------------------------------------------------------
+static void ComputeBatch2dPerlinNoiseScalar(float* const outValues, int const originX, int const originY, int const countX, int const countY,
+                                            int const step, float const scale, unsigned int const numOctaves, float const octavePersistence,
+                                            float const octaveScale, bool const renormalize, unsigned int const seed)
+{
+    for (int y = 0; y < countY; y++)
+    {
+        for (int x = 0; x < countX; x++)
+        {
+            outValues[x + countX * y] = Compute2dPerlinNoise((float)(originX + x * step), (float)(originY + y * step),
+                                                             scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static void ComputeBatch3dPerlinNoiseScalar(float* const outValues, int const originX, int const originY, int const originZ,
+                                            int const countX, int const countY, int const countZ, int const stepXY, int const stepZ,
+                                            float const scale, unsigned int const numOctaves, float const octavePersistence,
+                                            float const octaveScale, bool const renormalize, unsigned int const seed)
+{
+    for (int z = 0; z < countZ; z++)
+    {
+        for (int y = 0; y < countY; y++)
+        {
+            for (int x = 0; x < countX; x++)
+            {
+                outValues[x + countX * (y + countY * z)] = Compute3dPerlinNoise((float)(originX + x * stepXY), (float)(originY + y * stepXY),
+                                                                                (float)(originZ + z * stepZ), scale, numOctaves,
+                                                                                octavePersistence, octaveScale, renormalize, seed);
+            }
+        }
+    }
+}
+
+#if defined(BATCH_NOISE_SSE2)
+//----------------------------------------------------------------------------------------------------
+// SSE2 path - Same operations in the same order as SmoothNoise, four x positions per register
+//----------------------------------------------------------------------------------------------------
+float constexpr PERLIN_OCTAVE_OFFSET    = 0.636764989593174f;          // Irrational per-octave offset, de-aligns octave grids
+float constexpr PERLIN_2D_RANGE_INVERSE = 1.f / 0.662578106f;          // 2D Perlin is in [-.662578106, .662578106]
+float constexpr PERLIN_3D_RANGE_INVERSE = 1.f / 0.793856621f;          // 3D Perlin is in [-.793856621, .793856621]
+float constexpr PERLIN_GRADIENT_3D      = 0.5773502691896257645091f;   // sqrt(3)/3: unit vectors toward cube corners
+
+// Unit vectors in 8 quarter-cardinal directions (22.5, 67.5, ... 337.5 degrees)
+static float const s_gradients2d[8][2] =
+{
+    { +0.923879533f, +0.382683432f }, { +0.382683432f, +0.923879533f },
+    { -0.382683432f, +0.923879533f }, { -0.923879533f, +0.382683432f },
+    { -0.923879533f, -0.382683432f }, { -0.382683432f, -0.923879533f },
+    { +0.382683432f, -0.923879533f }, { +0.923879533f, -0.382683432f }
+};
+
+static float const s_gradients3d[8][3] =
+{
+    { +PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D }, { -PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D },
+    { +PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D }, { -PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D },
+    { +PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D }, { -PERLIN_GRADIENT_3D, +PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D },
+    { +PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D }, { -PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D, -PERLIN_GRADIENT_3D }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Corner gradients of the last cell seen by one octave; consecutive samples mostly share a cell
+//----------------------------------------------------------------------------------------------------
+struct CellGradients2d
+{
+    int   m_cellX   = 0;
+    int   m_cellY   = 0;
+    bool  m_isValid = false;
+    float m_corners[4][2];      // SW, SE, NW, NE
+};
+
+struct CellGradients3d
+{
+    int   m_cellX   = 0;
+    int   m_cellY   = 0;
+    int   m_cellZ   = 0;
+    bool  m_isValid = false;
+    float m_corners[8][3];      // Below SW, SE, NW, NE, then above SW, SE, NW, NE
+};
+
+//----------------------------------------------------------------------------------------------------
+// SmoothNoise FastFloor: truncate, then subtract one for negative values
+static __m128 FastFloor4(__m128 const value)
+{
+    __m128 const truncated  = _mm_cvtepi32_ps(_mm_cvttps_epi32(value));
+    __m128 const isNegative = _mm_cmplt_ps(value, _mm_setzero_ps());
+    return _mm_sub_ps(truncated, _mm_and_ps(isNegative, _mm_set1_ps(1.f)));
+}
+
+//----------------------------------------------------------------------------------------------------
+static __m128 SmoothStep4(__m128 const t)
+{
+    return _mm_mul_ps(_mm_mul_ps(t, t), _mm_sub_ps(_mm_set1_ps(3.f), _mm_mul_ps(_mm_set1_ps(2.f), t)));
+}
+
+//----------------------------------------------------------------------------------------------------
+static __m128 Renormalize4(__m128 totalNoise, float const totalAmplitude)
+{
+    totalNoise = _mm_div_ps(totalNoise, _mm_set1_ps(totalAmplitude));
+    totalNoise = _mm_add_ps(_mm_mul_ps(totalNoise, _mm_set1_ps(0.5f)), _mm_set1_ps(0.5f));
+    totalNoise = SmoothStep4(totalNoise);
+    return _mm_sub_ps(_mm_mul_ps(totalNoise, _mm_set1_ps(2.f)), _mm_set1_ps(1.f));
+}
+
+//----------------------------------------------------------------------------------------------------
+static void ComputeBatch2dPerlinNoiseSse2(float* const outValues, int const originX, int const originY, int const countX, int const countY,
+                                          int const step, float const scale, unsigned int const numOctaves, float const octavePersistence,
+                                          float const octaveScale, bool const renormalize, unsigned int const seed)
+{
+    std::vector<CellGradients2d> octaveCells(numOctaves);
+    float const                  invScale = 1.f / scale;
+
+    for (int y = 0; y < countY; y++)
+    {
+        for (int firstX = 0; firstX < countX; firstX += 4)
+        {
+            // Pad the last group by repeating the final sample
+            int laneX[4];
+            for (int lane = 0; lane < 4; lane++)
+            {
+                int const x = (firstX + lane < countX) ? (firstX + lane) : (countX - 1);
+                laneX[lane] = originX + x * step;
+            }
+
+            __m128 currentX = _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(laneX[0], laneX[1], laneX[2], laneX[3])), _mm_set1_ps(invScale));
+            __m128 currentY = _mm_mul_ps(_mm_set1_ps((float)(originY + y * step)), _mm_set1_ps(invScale));
+
+            __m128 totalNoise       = _mm_setzero_ps();
+            float  totalAmplitude   = 0.f;
+            float  currentAmplitude = 1.f;
+
+            for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+            {
+                __m128 const cellMinsX = FastFloor4(currentX);
+                __m128 const cellMinsY = FastFloor4(currentY);
+                __m128 const cellMaxsX = _mm_add_ps(cellMinsX, _mm_set1_ps(1.f));
+                __m128 const cellMaxsY = _mm_add_ps(cellMinsY, _mm_set1_ps(1.f));
+
+                alignas(16) int cellX[4];
+                alignas(16) int cellY[4];
+                _mm_store_si128((__m128i*)cellX, _mm_cvttps_epi32(cellMinsX));
+                _mm_store_si128((__m128i*)cellY, _mm_cvttps_epi32(cellMinsY));
+
+                // Gather corner gradients, hashing only when a lane enters a new cell
+                alignas(16) float gradientX[4][4];      // [corner][lane]
+                alignas(16) float gradientY[4][4];
+                CellGradients2d&  cell = octaveCells[octaveNum];
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    if (!cell.m_isValid || cell.m_cellX != cellX[lane] || cell.m_cellY != cellY[lane])
+                    {
+                        unsigned int const octaveSeed = seed + octaveNum;
+                        unsigned int const noiseSW    = Get2dNoiseUint(cellX[lane], cellY[lane], octaveSeed);
+                        unsigned int const noiseSE    = Get2dNoiseUint(cellX[lane] + 1, cellY[lane], octaveSeed);
+                        unsigned int const noiseNW    = Get2dNoiseUint(cellX[lane], cellY[lane] + 1, octaveSeed);
+                        unsigned int const noiseNE    = Get2dNoiseUint(cellX[lane] + 1, cellY[lane] + 1, octaveSeed);
+                        unsigned int const noises[4]  = { noiseSW, noiseSE, noiseNW, noiseNE };
+
+                        for (int corner = 0; corner < 4; corner++)
+                        {
+                            cell.m_corners[corner][0] = s_gradients2d[noises[corner] & 0x00000007][0];
+                            cell.m_corners[corner][1] = s_gradients2d[noises[corner] & 0x00000007][1];
+                        }
+                        cell.m_cellX   = cellX[lane];
+                        cell.m_cellY   = cellY[lane];
+                        cell.m_isValid = true;
+                    }
+
+                    for (int corner = 0; corner < 4; corner++)
+                    {
+                        gradientX[corner][lane] = cell.m_corners[corner][0];
+                        gradientY[corner][lane] = cell.m_corners[corner][1];
+                    }
+                }
+
+                // Dot each corner's gradient with displacement from corner to position
+                __m128 const displacementWestX  = _mm_sub_ps(currentX, cellMinsX);
+                __m128 const displacementSouthY = _mm_sub_ps(currentY, cellMinsY);
+                __m128 const displacementEastX  = _mm_sub_ps(currentX, cellMaxsX);
+                __m128 const displacementNorthY = _mm_sub_ps(currentY, cellMaxsY);
+
+                __m128 const dotSouthWest = _mm_add_ps(_mm_mul_ps(_mm_load_ps(gradientX[0]), displacementWestX), _mm_mul_ps(_mm_load_ps(gradientY[0]), displacementSouthY));
+                __m128 const dotSouthEast = _mm_add_ps(_mm_mul_ps(_mm_load_ps(gradientX[1]), displacementEastX), _mm_mul_ps(_mm_load_ps(gradientY[1]), displacementSouthY));
+                __m128 const dotNorthWest = _mm_add_ps(_mm_mul_ps(_mm_load_ps(gradientX[2]), displacementWestX), _mm_mul_ps(_mm_load_ps(gradientY[2]), displacementNorthY));
+                __m128 const dotNorthEast = _mm_add_ps(_mm_mul_ps(_mm_load_ps(gradientX[3]), displacementEastX), _mm_mul_ps(_mm_load_ps(gradientY[3]), displacementNorthY));
+
+                // Smoothed (nonlinear) weighted average of dot results
+                __m128 const weightEast  = SmoothStep4(displacementWestX);
+                __m128 const weightNorth = SmoothStep4(displacementSouthY);
+                __m128 const weightWest  = _mm_sub_ps(_mm_set1_ps(1.f), weightEast);
+                __m128 const weightSouth = _mm_sub_ps(_mm_set1_ps(1.f), weightNorth);
+
+                __m128 const blendSouth = _mm_add_ps(_mm_mul_ps(weightEast, dotSouthEast), _mm_mul_ps(weightWest, dotSouthWest));
+                __m128 const blendNorth = _mm_add_ps(_mm_mul_ps(weightEast, dotNorthEast), _mm_mul_ps(weightWest, dotNorthWest));
+                __m128 const blendTotal = _mm_add_ps(_mm_mul_ps(weightSouth, blendSouth), _mm_mul_ps(weightNorth, blendNorth));
+                __m128 const noise      = _mm_mul_ps(blendTotal, _mm_set1_ps(PERLIN_2D_RANGE_INVERSE));
+
+                // Accumulate and prepare for the next octave
+                totalNoise       = _mm_add_ps(totalNoise, _mm_mul_ps(noise, _mm_set1_ps(currentAmplitude)));
+                totalAmplitude   += currentAmplitude;
+                currentAmplitude *= octavePersistence;
+                currentX         = _mm_add_ps(_mm_mul_ps(currentX, _mm_set1_ps(octaveScale)), _mm_set1_ps(PERLIN_OCTAVE_OFFSET));
+                currentY         = _mm_add_ps(_mm_mul_ps(currentY, _mm_set1_ps(octaveScale)), _mm_set1_ps(PERLIN_OCTAVE_OFFSET));
+            }
+
+            if (renormalize && totalAmplitude > 0.f)
+            {
+                totalNoise = Renormalize4(totalNoise, totalAmplitude);
+            }
+
+            alignas(16) float laneNoise[4];
+            _mm_store_ps(laneNoise, totalNoise);
+            for (int lane = 0; lane < 4 && firstX + lane < countX; lane++)
+            {
+                outValues[firstX + lane + countX * y] = laneNoise[lane];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static void ComputeBatch3dPerlinNoiseSse2(float* const outValues, int const originX, int const originY, int const originZ,
+                                          int const countX, int const countY, int const countZ, int const stepXY, int const stepZ,
+                                          float const scale, unsigned int const numOctaves, float const octavePersistence,
+                                          float const octaveScale, bool const renormalize, unsigned int const seed)
+{
+    std::vector<CellGradients3d> octaveCells(numOctaves);
+    float const                  invScale = 1.f / scale;
+
+    for (int z = 0; z < countZ; z++)
+    {
+        for (int y = 0; y < countY; y++)
+        {
+            for (int firstX = 0; firstX < countX; firstX += 4)
+            {
+                int laneX[4];
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    int const x = (firstX + lane < countX) ? (firstX + lane) : (countX - 1);
+                    laneX[lane] = originX + x * stepXY;
+                }
+
+                __m128 currentX = _mm_mul_ps(_mm_cvtepi32_ps(_mm_setr_epi32(laneX[0], laneX[1], laneX[2], laneX[3])), _mm_set1_ps(invScale));
+                __m128 currentY = _mm_mul_ps(_mm_set1_ps((float)(originY + y * stepXY)), _mm_set1_ps(invScale));
+                __m128 currentZ = _mm_mul_ps(_mm_set1_ps((float)(originZ + z * stepZ)), _mm_set1_ps(invScale));
+
+                __m128 totalNoise       = _mm_setzero_ps();
+                float  totalAmplitude   = 0.f;
+                float  currentAmplitude = 1.f;
+
+                for (unsigned int octaveNum = 0; octaveNum < numOctaves; ++octaveNum)
+                {
+                    __m128 const cellMinsX = FastFloor4(currentX);
+                    __m128 const cellMinsY = FastFloor4(currentY);
+                    __m128 const cellMinsZ = FastFloor4(currentZ);
+                    __m128 const cellMaxsX = _mm_add_ps(cellMinsX, _mm_set1_ps(1.f));
+                    __m128 const cellMaxsY = _mm_add_ps(cellMinsY, _mm_set1_ps(1.f));
+                    __m128 const cellMaxsZ = _mm_add_ps(cellMinsZ, _mm_set1_ps(1.f));
+
+                    alignas(16) int cellX[4];
+                    alignas(16) int cellY[4];
+                    alignas(16) int cellZ[4];
+                    _mm_store_si128((__m128i*)cellX, _mm_cvttps_epi32(cellMinsX));
+                    _mm_store_si128((__m128i*)cellY, _mm_cvttps_epi32(cellMinsY));
+                    _mm_store_si128((__m128i*)cellZ, _mm_cvttps_epi32(cellMinsZ));
+
+                    alignas(16) float gradientX[8][4];      // [corner][lane]
+                    alignas(16) float gradientY[8][4];
+                    alignas(16) float gradientZ[8][4];
+                    CellGradients3d&  cell = octaveCells[octaveNum];
+                    for (int lane = 0; lane < 4; lane++)
+                    {
+                        if (!cell.m_isValid || cell.m_cellX != cellX[lane] || cell.m_cellY != cellY[lane] || cell.m_cellZ != cellZ[lane])
+                        {
+                            unsigned int const octaveSeed = seed + octaveNum;
+                            for (int corner = 0; corner < 8; corner++)
+                            {
+                                int const          cornerX = cellX[lane] + (corner & 1);
+                                int const          cornerY = cellY[lane] + ((corner >> 1) & 1);
+                                int const          cornerZ = cellZ[lane] + ((corner >> 2) & 1);
+                                unsigned int const noise   = Get3dNoiseUint(cornerX, cornerY, cornerZ, octaveSeed);
+
+                                cell.m_corners[corner][0] = s_gradients3d[noise & 0x00000007][0];
+                                cell.m_corners[corner][1] = s_gradients3d[noise & 0x00000007][1];
+                                cell.m_corners[corner][2] = s_gradients3d[noise & 0x00000007][2];
+                            }
+                            cell.m_cellX   = cellX[lane];
+                            cell.m_cellY   = cellY[lane];
+                            cell.m_cellZ   = cellZ[lane];
+                            cell.m_isValid = true;
+                        }
+
+                        for (int corner = 0; corner < 8; corner++)
+                        {
+                            gradientX[corner][lane] = cell.m_corners[corner][0];
+                            gradientY[corner][lane] = cell.m_corners[corner][1];
+                            gradientZ[corner][lane] = cell.m_corners[corner][2];
+                        }
+                    }
+
+                    // Displacements from the min (west/south/below) and max (east/north/above) corners
+                    __m128 const displacementX[2] = { _mm_sub_ps(currentX, cellMinsX), _mm_sub_ps(currentX, cellMaxsX) };
+                    __m128 const displacementY[2] = { _mm_sub_ps(currentY, cellMinsY), _mm_sub_ps(currentY, cellMaxsY) };
+                    __m128 const displacementZ[2] = { _mm_sub_ps(currentZ, cellMinsZ), _mm_sub_ps(currentZ, cellMaxsZ) };
+
+                    __m128 dots[8];
+                    for (int corner = 0; corner < 8; corner++)
+                    {
+                        __m128 const dotXY = _mm_add_ps(_mm_mul_ps(_mm_load_ps(gradientX[corner]), displacementX[corner & 1]),
+                                                        _mm_mul_ps(_mm_load_ps(gradientY[corner]), displacementY[(corner >> 1) & 1]));
+                        dots[corner]       = _mm_add_ps(dotXY, _mm_mul_ps(_mm_load_ps(gradientZ[corner]), displacementZ[(corner >> 2) & 1]));
+                    }
+
+                    __m128 const weightEast  = SmoothStep4(displacementX[0]);
+                    __m128 const weightNorth = SmoothStep4(displacementY[0]);
+                    __m128 const weightAbove = SmoothStep4(displacementZ[0]);
+                    __m128 const weightWest  = _mm_sub_ps(_mm_set1_ps(1.f), weightEast);
+                    __m128 const weightSouth = _mm_sub_ps(_mm_set1_ps(1.f), weightNorth);
+                    __m128 const weightBelow = _mm_sub_ps(_mm_set1_ps(1.f), weightAbove);
+
+                    // 8-way blend (8 -> 4 -> 2 -> 1)
+                    __m128 const blendBelowSouth = _mm_add_ps(_mm_mul_ps(weightEast, dots[1]), _mm_mul_ps(weightWest, dots[0]));
+                    __m128 const blendBelowNorth = _mm_add_ps(_mm_mul_ps(weightEast, dots[3]), _mm_mul_ps(weightWest, dots[2]));
+                    __m128 const blendAboveSouth = _mm_add_ps(_mm_mul_ps(weightEast, dots[5]), _mm_mul_ps(weightWest, dots[4]));
+                    __m128 const blendAboveNorth = _mm_add_ps(_mm_mul_ps(weightEast, dots[7]), _mm_mul_ps(weightWest, dots[6]));
+                    __m128 const blendBelow      = _mm_add_ps(_mm_mul_ps(weightSouth, blendBelowSouth), _mm_mul_ps(weightNorth, blendBelowNorth));
+                    __m128 const blendAbove      = _mm_add_ps(_mm_mul_ps(weightSouth, blendAboveSouth), _mm_mul_ps(weightNorth, blendAboveNorth));
+                    __m128 const blendTotal      = _mm_add_ps(_mm_mul_ps(weightBelow, blendBelow), _mm_mul_ps(weightAbove, blendAbove));
+                    __m128 const noise           = _mm_mul_ps(blendTotal, _mm_set1_ps(PERLIN_3D_RANGE_INVERSE));
+
+                    totalNoise       = _mm_add_ps(totalNoise, _mm_mul_ps(noise, _mm_set1_ps(currentAmplitude)));
+                    totalAmplitude   += currentAmplitude;
+                    currentAmplitude *= octavePersistence;
+                    currentX         = _mm_add_ps(_mm_mul_ps(currentX, _mm_set1_ps(octaveScale)), _mm_set1_ps(PERLIN_OCTAVE_OFFSET));
+                    currentY         = _mm_add_ps(_mm_mul_ps(currentY, _mm_set1_ps(octaveScale)), _mm_set1_ps(PERLIN_OCTAVE_OFFSET));
+                    currentZ         = _mm_add_ps(_mm_mul_ps(currentZ, _mm_set1_ps(octaveScale)), _mm_set1_ps(PERLIN_OCTAVE_OFFSET));
+                }
+
+                if (renormalize && totalAmplitude > 0.f)
+                {
+                    totalNoise = Renormalize4(totalNoise, totalAmplitude);
+                }
+
+                alignas(16) float laneNoise[4];
+                _mm_store_ps(laneNoise, totalNoise);
+                for (int lane = 0; lane < 4 && firstX + lane < countX; lane++)
+                {
+                    outValues[firstX + lane + countX * (y + countY * z)] = laneNoise[lane];
+                }
+            }
+        }
+    }
+}
+#endif // BATCH_NOISE_SSE2
+
+//----------------------------------------------------------------------------------------------------
+void ComputeBatch2dPerlinNoise(float* const       outValues,
+                               int const          originX,
+                               int const          originY,
+                               int const          countX,
+                               int const          countY,
+                               int const          step,
+                               float const        scale,
+                               unsigned int const numOctaves,
+                               float const        octavePersistence,
+                               float const        octaveScale,
+                               bool const         renormalize,
+                               unsigned int const seed)
+{
+#if defined(BATCH_NOISE_SSE2)
+    if (s_batchNoiseValidation.m_isSimdEnabled)
+    {
+        ComputeBatch2dPerlinNoiseSse2(outValues, originX, originY, countX, countY, step, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+        return;
+    }
+#endif
+    ComputeBatch2dPerlinNoiseScalar(outValues, originX, originY, countX, countY, step, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ComputeBatch3dPerlinNoise(float* const       outValues,
+                               int const          originX,
+                               int const          originY,
+                               int const          originZ,
+                               int const          countX,
+                               int const          countY,
+                               int const          countZ,
+                               int const          stepXY,
+                               int const          stepZ,
+                               float const        scale,
+                               unsigned int const numOctaves,
+                               float const        octavePersistence,
+                               float const        octaveScale,
+                               bool const         renormalize,
+                               unsigned int const seed)
+{
+#if defined(BATCH_NOISE_SSE2)
+    if (s_batchNoiseValidation.m_isSimdEnabled)
+    {
+        ComputeBatch3dPerlinNoiseSse2(outValues, originX, originY, originZ, countX, countY, countZ, stepXY, stepZ,
+                                      scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+        return;
+    }
+#endif
+    ComputeBatch3dPerlinNoiseScalar(outValues, originX, originY, originZ, countX, countY, countZ, stepXY, stepZ,
+                                    scale, numOctaves, octavePersistence, octaveScale, renormalize, seed);
+}
+
+//----------------------------------------------------------------------------------------------------
+// ValidateBatchNoise - Compare the SSE2 path against SmoothNoise and enable it if within tolerance
+//
+// Covers both coordinate signs, padded groups (counts not a multiple of 4), several scales and octave
+// counts, and both renormalize modes. The SSE2 path mirrors SmoothNoise operation for operation, so it
+// is normally bit-identical; the tolerance absorbs compilers contracting the scalar code into FMAs.
+//----------------------------------------------------------------------------------------------------
+void ValidateBatchNoise()
+{
+    s_batchNoiseValidation = BatchNoiseValidation();
+
+#if defined(BATCH_NOISE_SSE2)
+    s_batchNoiseValidation.m_isSimdAvailable = true;
+
+    struct NoiseCase
+    {
+        float        m_scale;
+        unsigned int m_numOctaves;
+        float        m_persistence;
+        bool         m_renormalize;
+        unsigned int m_seed;
+    };
+    NoiseCase const cases[] =
+    {
+        { 200.f, 3, 0.5f, true, 11u },
+        { 37.5f, 5, 0.5f, true, 12345u },
+        { 800.f, 4, 0.6f, false, 7u },
+        { 7.f, 1, 0.5f, true, 0u }
+    };
+
+    int constexpr COUNT_X   = 37;
+    int constexpr COUNT_Y   = 19;
+    int constexpr COUNT_Z   = 11;
+    int constexpr ORIGIN_XY = -300;
+    int constexpr ORIGIN_Z  = -40;
+
+    std::vector<float> batchValues(COUNT_X * COUNT_Y * COUNT_Z);
+
+    for (NoiseCase const& noiseCase : cases)
+    {
+        ComputeBatch2dPerlinNoiseSse2(batchValues.data(), ORIGIN_XY, ORIGIN_XY, COUNT_X, COUNT_Y, 17, noiseCase.m_scale, noiseCase.m_numOctaves,
+                                      noiseCase.m_persistence, 2.f, noiseCase.m_renormalize, noiseCase.m_seed);
+        for (int y = 0; y < COUNT_Y; y++)
+        {
+            for (int x = 0; x < COUNT_X; x++)
+            {
+                float const reference = Compute2dPerlinNoise((float)(ORIGIN_XY + x * 17), (float)(ORIGIN_XY + y * 17), noiseCase.m_scale,
+                                                             noiseCase.m_numOctaves, noiseCase.m_persistence, 2.f, noiseCase.m_renormalize, noiseCase.m_seed);
+                float const batch     = batchValues[x + COUNT_X * y];
+                s_batchNoiseValidation.m_maxError2d        = (std::max)(s_batchNoiseValidation.m_maxError2d, fabsf(batch - reference));
+                s_batchNoiseValidation.m_exactSampleCount += (batch == reference) ? 1 : 0;
+                ++s_batchNoiseValidation.m_sampleCount;
+            }
+        }
+
+        ComputeBatch3dPerlinNoiseSse2(batchValues.data(), ORIGIN_XY, ORIGIN_XY, ORIGIN_Z, COUNT_X, COUNT_Y, COUNT_Z, 13, 9, noiseCase.m_scale,
+                                      noiseCase.m_numOctaves, noiseCase.m_persistence, 2.f, noiseCase.m_renormalize, noiseCase.m_seed);
+        for (int z = 0; z < COUNT_Z; z++)
+        {
+            for (int y = 0; y < COUNT_Y; y++)
+            {
+                for (int x = 0; x < COUNT_X; x++)
+                {
+                    float const reference = Compute3dPerlinNoise((float)(ORIGIN_XY + x * 13), (float)(ORIGIN_XY + y * 13), (float)(ORIGIN_Z + z * 9),
+                                                                 noiseCase.m_scale, noiseCase.m_numOctaves, noiseCase.m_persistence, 2.f,
+                                                                 noiseCase.m_renormalize, noiseCase.m_seed);
+                    float const batch     = batchValues[x + COUNT_X * (y + COUNT_Y * z)];
+                    s_batchNoiseValidation.m_maxError3d        = (std::max)(s_batchNoiseValidation.m_maxError3d, fabsf(batch - reference));
+                    s_batchNoiseValidation.m_exactSampleCount += (batch == reference) ? 1 : 0;
+                    ++s_batchNoiseValidation.m_sampleCount;
+                }
+            }
+        }
+    }
+
+    s_batchNoiseValidation.m_isSimdEnabled = (s_batchNoiseValidation.m_maxError2d <= BATCH_NOISE_TOLERANCE &&
+                                              s_batchNoiseValidation.m_maxError3d <= BATCH_NOISE_TOLERANCE);
+#endif
+
+    DebuggerPrintf("[BATCH NOISE] SSE2 %s: %d/%d samples bit-identical, max error 2D %g, 3D %g (tolerance %g)\n",
+                   s_batchNoiseValidation.m_isSimdEnabled ? "enabled" : (s_batchNoiseValidation.m_isSimdAvailable ? "DISABLED, out of tolerance" : "not compiled"),
+                   s_batchNoiseValidation.m_exactSampleCount, s_batchNoiseValidation.m_sampleCount,
+                   (double)s_batchNoiseValidation.m_maxError2d, (double)s_batchNoiseValidation.m_maxError3d, (double)BATCH_NOISE_TOLERANCE);
+}
+
+//----------------------------------------------------------------------------------------------------
+BatchNoiseValidation const& GetBatchNoiseValidation()
+{
+    return s_batchNoiseValidation;
+}
+
+//----------------------------------------------------------------------------------------------------
+// RunBatchNoiseBenchmark - Per-sample SmoothNoise calls vs the active batch path
+//
+// 2D: one 32x32 column grid at biome-layer parameters. 3D: 32x32x64 density samples at the terrain
+// density parameters. Each is repeated so the timings cover a few milliseconds.
+//----------------------------------------------------------------------------------------------------
+BatchNoiseBenchmarkResult RunBatchNoiseBenchmark()
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    int constexpr REPEAT_COUNT = 8;
+    int constexpr SIZE_XY      = 32;
+    int constexpr SIZE_Z       = 64;
+
+    BatchNoiseBenchmarkResult result;
+    std::vector<float>        values(SIZE_XY * SIZE_XY * SIZE_Z);
+    float                     checksum = 0.f;      // Keeps the scalar loops from being optimized away
+
+    BenchmarkClock::time_point start = BenchmarkClock::now();
+    for (int repeat = 0; repeat < REPEAT_COUNT; repeat++)
+    {
+        ComputeBatch2dPerlinNoiseScalar(values.data(), repeat * SIZE_XY, 0, SIZE_XY, SIZE_XY, 1, 1000.f, 4, 0.5f, 2.f, true, 7u);
+        checksum += values[0];
+    }
+    double const scalarSeconds2d = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+    start = BenchmarkClock::now();
+    for (int repeat = 0; repeat < REPEAT_COUNT; repeat++)
+    {
+        ComputeBatch2dPerlinNoise(values.data(), repeat * SIZE_XY, 0, SIZE_XY, SIZE_XY, 1, 1000.f, 4, 0.5f, 2.f, true, 7u);
+        checksum += values[0];
+    }
+    double const batchSeconds2d = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+    start = BenchmarkClock::now();
+    for (int repeat = 0; repeat < REPEAT_COUNT; repeat++)
+    {
+        ComputeBatch3dPerlinNoiseScalar(values.data(), repeat * SIZE_XY, 0, 0, SIZE_XY, SIZE_XY, SIZE_Z, 1, 1, 200.f, 3, 0.5f, 2.f, true, 10u);
+        checksum += values[0];
+    }
+    double const scalarSeconds3d = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+    start = BenchmarkClock::now();
+    for (int repeat = 0; repeat < REPEAT_COUNT; repeat++)
+    {
+        ComputeBatch3dPerlinNoise(values.data(), repeat * SIZE_XY, 0, 0, SIZE_XY, SIZE_XY, SIZE_Z, 1, 1, 200.f, 3, 0.5f, 2.f, true, 10u);
+        checksum += values[0];
+    }
+    double const batchSeconds3d = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+    double const sampleCount2d = (double)(REPEAT_COUNT * SIZE_XY * SIZE_XY);
+    double const sampleCount3d = (double)(REPEAT_COUNT * SIZE_XY * SIZE_XY * SIZE_Z);
+    result.m_scalarNsPerSample2d = scalarSeconds2d * 1e9 / sampleCount2d;
+    result.m_batchNsPerSample2d  = batchSeconds2d * 1e9 / sampleCount2d;
+    result.m_scalarNsPerSample3d = scalarSeconds3d * 1e9 / sampleCount3d;
+    result.m_batchNsPerSample3d  = batchSeconds3d * 1e9 / sampleCount3d;
+
+    DebuggerPrintf("[BATCH NOISE BENCHMARK] 2D: scalar %.1f ns, batch %.1f ns per sample; 3D: scalar %.1f ns, batch %.1f ns per sample (%s, checksum %g)\n",
+                   result.m_scalarNsPerSample2d, result.m_batchNsPerSample2d, result.m_scalarNsPerSample3d, result.m_batchNsPerSample3d,
+                   s_batchNoiseValidation.m_isSimdEnabled ? "SSE2" : "scalar", (double)checksum);
+    return result;
+}
@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------------------------------
+// BatchNoise.hpp - Grid-at-a-time Perlin noise matching ThirdParty/Noise/SmoothNoise
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+
+//----------------------------------------------------------------------------------------------------
+float constexpr BATCH_NOISE_TOLERANCE = 1e-5f;     // Max |SIMD - SmoothNoise| accepted by ValidateBatchNoise()
+
+//----------------------------------------------------------------------------------------------------
+// Outcome of the startup check of the SIMD path against the SmoothNoise functions
+//----------------------------------------------------------------------------------------------------
+struct BatchNoiseValidation
+{
+    bool  m_isSimdAvailable  = false;   // Compiled with the SSE2 path
+    bool  m_isSimdEnabled    = false;   // Available and within BATCH_NOISE_TOLERANCE
+    int   m_sampleCount      = 0;
+    int   m_exactSampleCount = 0;       // Bit-identical to SmoothNoise
+    float m_maxError2d       = 0.f;
+    float m_maxError3d       = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct BatchNoiseBenchmarkResult
+{
+    double m_scalarNsPerSample2d = 0.0;     // Per-sample SmoothNoise calls
+    double m_batchNsPerSample2d  = 0.0;     // Active batch path (SSE2 if validated)
+    double m_scalarNsPerSample3d = 0.0;
+    double m_batchNsPerSample3d  = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Batch noise - Evaluate Compute2dPerlinNoise / Compute3dPerlinNoise over a regular integer grid
+//
+// Samples are written x fastest, then y, then z: outValues[x + countX * (y + countY * z)] is the noise at
+// (originX + x * step, originY + y * step, originZ + z * stepZ), with the same parameters as the
+// SmoothNoise functions. The SSE2 path evaluates four x positions at once and hashes each lattice cell
+// once per row and octave instead of once per sample (at terrain scales a 32-sample row spans one or two
+// cells), so it is faster even though the hash itself stays scalar.
+//
+// Results are within BATCH_NOISE_TOLERANCE of SmoothNoise; ValidateBatchNoise() measures this at startup
+// and falls back to per-sample SmoothNoise calls (bit-identical by construction) if the SIMD path drifts.
+//
+// Thread Safety:
+// - ValidateBatchNoise() is main thread only and must run before any worker generates terrain
+// - The Compute functions are safe from any thread afterwards
+//----------------------------------------------------------------------------------------------------
+void ComputeBatch2dPerlinNoise(float*       outValues,
+                               int          originX,
+                               int          originY,
+                               int          countX,
+                               int          countY,
+                               int          step,
+                               float        scale,
+                               unsigned int numOctaves,
+                               float        octavePersistence,
+                               float        octaveScale,
+                               bool         renormalize,
+                               unsigned int seed);
+
+void ComputeBatch3dPerlinNoise(float*       outValues,
+                               int          originX,
+                               int          originY,
+                               int          originZ,
+                               int          countX,
+                               int          countY,
+                               int          countZ,
+                               int          stepXY,
+                               int          stepZ,
+                               float        scale,
+                               unsigned int numOctaves,
+                               float        octavePersistence,
+                               float        octaveScale,
+                               bool         renormalize,
+                               unsigned int seed);
+
+void                        ValidateBatchNoise();
+BatchNoiseValidation const& GetBatchNoiseValidation();
+BatchNoiseBenchmarkResult   RunBatchNoiseBenchmark();     // One chunk's worth of 2D columns and 3D density samples
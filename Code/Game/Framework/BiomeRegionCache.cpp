@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------------------------------
+// BiomeRegionCache.cpp - Shared LRU cache of the low-frequency climate noise over 8x8 chunk regions
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BiomeRegionCache.hpp"
+
+#include "Game/Framework/BatchNoise.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/WorldGenConfig.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Same seed derivation as Chunk::GenerateTerrain
+unsigned int constexpr HUMIDITY_SEED        = GAME_SEED + 1;
+unsigned int constexpr TEMPERATURE_SEED     = GAME_SEED + 2;
+unsigned int constexpr CONTINENTALNESS_SEED = GAME_SEED + 6;
+unsigned int constexpr EROSION_SEED         = GAME_SEED + 7;
+unsigned int constexpr WEIRDNESS_SEED       = GAME_SEED + 8;
+
+//----------------------------------------------------------------------------------------------------
+// ComputeClimateLayers - Evaluate the five climate layers on a countX x countY grid, step blocks apart
+//----------------------------------------------------------------------------------------------------
+static void ComputeClimateLayers(float*    outHumidityNoise,
+                                 float*    outTemperatureNoise,
+                                 float*    outContinentalness,
+                                 float*    outErosion,
+                                 float*    outWeirdness,
+                                 int const originX,
+                                 int const originY,
+                                 int const countX,
+                                 int const countY,
+                                 int const step)
+{
+    WorldGenConfig::BiomeNoiseParams const& params = g_worldGenConfig->biomeNoise;
+
+    ComputeBatch2dPerlinNoise(outHumidityNoise, originX, originY, countX, countY, step,
+                              params.humidityScale, params.humidityOctaves,
+                              params.humidityPersistence, DEFAULT_NOISE_OCTAVE_SCALE, true, HUMIDITY_SEED);
+    ComputeBatch2dPerlinNoise(outTemperatureNoise, originX, originY, countX, countY, step,
+                              params.temperatureScale, params.temperatureOctaves,
+                              params.temperaturePersistence, DEFAULT_NOISE_OCTAVE_SCALE, true, TEMPERATURE_SEED);
+    ComputeBatch2dPerlinNoise(outContinentalness, originX, originY, countX, countY, step,
+                              params.continentalnessScale, params.continentalnessOctaves,
+                              params.continentalnessPersistence, DEFAULT_NOISE_OCTAVE_SCALE, true, CONTINENTALNESS_SEED);
+    ComputeBatch2dPerlinNoise(outErosion, originX, originY, countX, countY, step,
+                              params.erosionScale, params.erosionOctaves,
+                              params.erosionPersistence, DEFAULT_NOISE_OCTAVE_SCALE, true, EROSION_SEED);
+    ComputeBatch2dPerlinNoise(outWeirdness, originX, originY, countX, countY, step,
+                              params.weirdnessScale, params.weirdnessOctaves,
+                              params.weirdnessPersistence, DEFAULT_NOISE_OCTAVE_SCALE, true, WEIRDNESS_SEED);
+}
+
+//----------------------------------------------------------------------------------------------------
+// UpsampleLayer - Bilinearly interpolate one chunk's 32x32 columns from a region sample grid
+//
+// regionLocalX/Y is the chunk's minimum corner in blocks from the region corner. With a step of 1 every
+// weight is zero and the samples are copied unchanged.
+//----------------------------------------------------------------------------------------------------
+static void UpsampleLayer(std::vector<float> const& samples,
+                          int const                 sampleCount,
+                          int const                 sampleStep,
+                          int const                 regionLocalX,
+                          int const                 regionLocalY,
+                          float*                    outColumns)
+{
+    float const inverseStep = 1.f / (float)sampleStep;
+
+    for (int y = 0; y < CHUNK_SIZE_Y; ++y)
+    {
+        int const   blockY  = regionLocalY + y;
+        int const   sampleY = blockY / sampleStep;
+        float const weightY = (float)(blockY - sampleY * sampleStep) * inverseStep;
+
+        float const* rowBelow = samples.data() + sampleY * sampleCount;
+        float const* rowAbove = rowBelow + ((weightY > 0.f) ? sampleCount : 0);
+
+        for (int x = 0; x < CHUNK_SIZE_X; ++x)
+        {
+            int const   blockX  = regionLocalX + x;
+            int const   sampleX = blockX / sampleStep;
+            float const weightX = (float)(blockX - sampleX * sampleStep) * inverseStep;
+            int const   nextX   = sampleX + ((weightX > 0.f) ? 1 : 0);
+
+            float const below = rowBelow[sampleX] + (rowBelow[nextX] - rowBelow[sampleX]) * weightX;
+            float const above = rowAbove[sampleX] + (rowAbove[nextX] - rowAbove[sampleX]) * weightX;
+
+            outColumns[y * CHUNK_SIZE_X + x] = below + (above - below) * weightY;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ComputeBiomeClimateColumns(IntVec2 const& chunkCoords, BiomeClimateColumns& outColumns)
+{
+    ComputeClimateLayers(outColumns.m_humidityNoise, outColumns.m_temperatureNoise, outColumns.m_continentalness,
+                         outColumns.m_erosion, outColumns.m_weirdness,
+                         chunkCoords.x * CHUNK_SIZE_X, chunkCoords.y * CHUNK_SIZE_Y, CHUNK_SIZE_X, CHUNK_SIZE_Y, 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+BiomeRegionCache::BiomeRegionCache(int const capacity)
+    : m_capacity(capacity)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void BiomeRegionCache::SampleChunk(IntVec2 const& chunkCoords, int const sampleStep, BiomeClimateColumns& outColumns)
+{
+    IntVec2 const                 regionCoords = GetRegionCoords(chunkCoords);
+    std::shared_ptr<Region> const region       = AcquireRegion(regionCoords, GetEffectiveSampleStep(sampleStep));
+
+    int const regionLocalX = (chunkCoords.x - regionCoords.x * BIOME_REGION_SIZE_CHUNKS) * CHUNK_SIZE_X;
+    int const regionLocalY = (chunkCoords.y - regionCoords.y * BIOME_REGION_SIZE_CHUNKS) * CHUNK_SIZE_Y;
+
+    UpsampleLayer(region->m_humidityNoise, region->m_sampleCount, region->m_sampleStep, regionLocalX, regionLocalY, outColumns.m_humidityNoise);
+    UpsampleLayer(region->m_temperatureNoise, region->m_sampleCount, region->m_sampleStep, regionLocalX, regionLocalY, outColumns.m_temperatureNoise);
+    UpsampleLayer(region->m_continentalness, region->m_sampleCount, region->m_sampleStep, regionLocalX, regionLocalY, outColumns.m_continentalness);
+    UpsampleLayer(region->m_erosion, region->m_sampleCount, region->m_sampleStep, regionLocalX, regionLocalY, outColumns.m_erosion);
+    UpsampleLayer(region->m_weirdness, region->m_sampleCount, region->m_sampleStep, regionLocalX, regionLocalY, outColumns.m_weirdness);
+}
+
+//----------------------------------------------------------------------------------------------------
+void BiomeRegionCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+    m_lruOrder.clear();
+    m_residentBytes = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+BiomeRegionCacheStats BiomeRegionCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    BiomeRegionCacheStats stats;
+    stats.m_regionCount   = (int)m_entries.size();
+    stats.m_hitCount      = m_hitCount;
+    stats.m_missCount     = m_missCount;
+    stats.m_evictionCount = m_evictionCount;
+    stats.m_residentBytes = m_residentBytes;
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 BiomeRegionCache::GetRegionCoords(IntVec2 const& chunkCoords)
+{
+    // Floor division, so chunks -8..-1 share region -1
+    int const regionX = (chunkCoords.x >= 0) ? chunkCoords.x / BIOME_REGION_SIZE_CHUNKS : (chunkCoords.x + 1) / BIOME_REGION_SIZE_CHUNKS - 1;
+    int const regionY = (chunkCoords.y >= 0) ? chunkCoords.y / BIOME_REGION_SIZE_CHUNKS : (chunkCoords.y + 1) / BIOME_REGION_SIZE_CHUNKS - 1;
+
+    return IntVec2(regionX, regionY);
+}
+
+//----------------------------------------------------------------------------------------------------
+int BiomeRegionCache::GetEffectiveSampleStep(int const requestedStep)
+{
+    int step = 1;
+    while (step * 2 <= requestedStep && step * 2 <= BIOME_REGION_MAX_SAMPLE_STEP)
+    {
+        step *= 2;
+    }
+    return step;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t BiomeRegionCache::GetKey(IntVec2 const& regionCoords)
+{
+    return ((uint64_t)(uint32_t)regionCoords.x << 32) | (uint64_t)(uint32_t)regionCoords.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void BiomeRegionCache::BuildRegion(Region& region, IntVec2 const& regionCoords)
+{
+    int const sampleCount = BIOME_REGION_SIZE_BLOCKS / region.m_sampleStep + 1;     // +1: the far edge for interpolation
+    int const gridSize    = sampleCount * sampleCount;
+
+    region.m_sampleCount = sampleCount;
+    region.m_humidityNoise.resize(gridSize);
+    region.m_temperatureNoise.resize(gridSize);
+    region.m_continentalness.resize(gridSize);
+    region.m_erosion.resize(gridSize);
+    region.m_weirdness.resize(gridSize);
+
+    ComputeClimateLayers(region.m_humidityNoise.data(), region.m_temperatureNoise.data(), region.m_continentalness.data(),
+                         region.m_erosion.data(), region.m_weirdness.data(),
+                         regionCoords.x * BIOME_REGION_SIZE_BLOCKS, regionCoords.y * BIOME_REGION_SIZE_BLOCKS,
+                         sampleCount, sampleCount, region.m_sampleStep);
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t BiomeRegionCache::GetRegionBytes(int const sampleStep)
+{
+    size_t const sampleCount = (size_t)(BIOME_REGION_SIZE_BLOCKS / sampleStep + 1);
+    return sizeof(Region) + 5 * sampleCount * sampleCount * sizeof(float);
+}
+
+//----------------------------------------------------------------------------------------------------
+// AcquireRegion - Look up (or insert) the region under the lock, then build it outside the lock
+//
+// A region stored with a different sample step is replaced. Jobs still holding the old one finish with it.
+//----------------------------------------------------------------------------------------------------
+std::shared_ptr<BiomeRegionCache::Region> BiomeRegionCache::AcquireRegion(IntVec2 const& regionCoords, int const sampleStep)
+{
+    uint64_t const          key = GetKey(regionCoords);
+    std::shared_ptr<Region> region;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto found = m_entries.find(key);
+        if (found != m_entries.end() && found->second.m_region->m_sampleStep != sampleStep)
+        {
+            m_residentBytes -= GetRegionBytes(found->second.m_region->m_sampleStep);
+            m_lruOrder.erase(found->second.m_lruPosition);
+            m_entries.erase(found);
+            found = m_entries.end();
+        }
+
+        if (found != m_entries.end())
+        {
+            m_lruOrder.splice(m_lruOrder.begin(), m_lruOrder, found->second.m_lruPosition);
+            region = found->second.m_region;
+            ++m_hitCount;
+        }
+        else
+        {
+            region               = std::make_shared<Region>();
+            region->m_sampleStep = sampleStep;
+
+            m_lruOrder.push_front(key);
+            Entry& entry        = m_entries[key];
+            entry.m_region      = region;
+            entry.m_lruPosition = m_lruOrder.begin();
+            m_residentBytes    += GetRegionBytes(sampleStep);
+            ++m_missCount;
+
+            while ((int)m_entries.size() > m_capacity && !m_lruOrder.empty())
+            {
+                auto const evicted = m_entries.find(m_lruOrder.back());
+                m_residentBytes -= GetRegionBytes(evicted->second.m_region->m_sampleStep);
+                m_entries.erase(evicted);
+                m_lruOrder.pop_back();
+                ++m_evictionCount;
+            }
+        }
+    }
+
+    // The first caller builds; concurrent callers for the same region block here until it is done
+    std::call_once(region->m_buildOnce, [&region, &regionCoords]()
+    {
+        BuildRegion(*region, regionCoords);
+    });
+
+    return region;
+}
@@ -0,0 +1,115 @@
+//----------------------------------------------------------------------------------------------------
+// BiomeRegionCache.hpp - Shared LRU cache of the low-frequency climate noise over 8x8 chunk regions
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr BIOME_REGION_BITS              = 3;                                           // Region = 8x8 chunks
+int constexpr BIOME_REGION_SIZE_CHUNKS       = 1 << BIOME_REGION_BITS;
+int constexpr BIOME_REGION_SIZE_BLOCKS       = BIOME_REGION_SIZE_CHUNKS * CHUNK_SIZE_X;      // 256 blocks (chunks are square)
+int constexpr BIOME_REGION_MAX_SAMPLE_STEP   = 32;                                          // One sample per chunk corner
+int constexpr DEFAULT_BIOME_REGION_CAPACITY  = 64;                                          // Activation range spans ~5x5 regions
+
+//----------------------------------------------------------------------------------------------------
+// BiomeClimateColumns - The climate layers of one chunk, one value per column (index y * CHUNK_SIZE_X + x)
+//
+// Raw Perlin values, before Pass 1 maps humidity / temperature to [0,1]. Peaks & valleys is not stored:
+// Pass 1 derives it per column from weirdness, which keeps the |W| creases sharp after upsampling.
+//----------------------------------------------------------------------------------------------------
+struct BiomeClimateColumns
+{
+    float m_humidityNoise[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float m_temperatureNoise[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float m_continentalness[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float m_erosion[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float m_weirdness[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+};
+
+//----------------------------------------------------------------------------------------------------
+struct BiomeRegionCacheStats
+{
+    int    m_regionCount   = 0;
+    int    m_hitCount      = 0;
+    int    m_missCount     = 0;     // Regions built (one per region, however many chunks asked at once)
+    int    m_evictionCount = 0;
+    size_t m_residentBytes = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Exact per-column climate layers for one chunk, with the BiomeNoiseParams in g_worldGenConfig
+//----------------------------------------------------------------------------------------------------
+void ComputeBiomeClimateColumns(IntVec2 const& chunkCoords, BiomeClimateColumns& outColumns);
+
+//----------------------------------------------------------------------------------------------------
+// BiomeRegionCache - Climate layers sampled every sampleStep blocks over 8x8 chunk regions
+//
+// The biome layers have scales of 300-8192 blocks, so neighboring chunks were evaluating nearly the same
+// smooth surfaces 1024 columns at a time. A region samples each layer on a (256 / step + 1)^2 grid once,
+// and SampleChunk() bilinearly upsamples the 32x32 columns of any chunk inside it. A step of 1 reproduces
+// ComputeBiomeClimateColumns() exactly. Regions are kept in LRU order up to the capacity; World clears the
+// cache whenever terrain is regenerated, since the regions bake in the BiomeNoiseParams of their build.
+//
+// Thread Safety:
+// - SampleChunk() and GetStats() are safe from any thread; the map is locked only for the lookup
+// - Concurrent misses on one region build it once: later callers wait for the first build
+// - Clear() may run while jobs sample: they keep the regions they hold until they are done
+//----------------------------------------------------------------------------------------------------
+class BiomeRegionCache
+{
+public:
+    explicit BiomeRegionCache(int capacity);
+
+    void SampleChunk(IntVec2 const& chunkCoords, int sampleStep, BiomeClimateColumns& outColumns);
+    void Clear();
+
+    BiomeRegionCacheStats GetStats() const;
+    int                   GetCapacity() const { return m_capacity; }
+
+    static IntVec2 GetRegionCoords(IntVec2 const& chunkCoords);
+    static int     GetEffectiveSampleStep(int requestedStep);     // Power of two in [1, BIOME_REGION_MAX_SAMPLE_STEP]
+
+private:
+    struct Region
+    {
+        int                m_sampleStep  = 1;
+        int                m_sampleCount = 0;     // Samples per side, BIOME_REGION_SIZE_BLOCKS / step + 1
+        std::vector<float> m_humidityNoise;
+        std::vector<float> m_temperatureNoise;
+        std::vector<float> m_continentalness;
+        std::vector<float> m_erosion;
+        std::vector<float> m_weirdness;
+        std::once_flag     m_buildOnce;
+    };
+
+    struct Entry
+    {
+        std::shared_ptr<Region>       m_region;
+        std::list<uint64_t>::iterator m_lruPosition;
+    };
+
+    static uint64_t GetKey(IntVec2 const& regionCoords);
+    static void     BuildRegion(Region& region, IntVec2 const& regionCoords);
+    static size_t   GetRegionBytes(int sampleStep);
+
+    std::shared_ptr<Region> AcquireRegion(IntVec2 const& regionCoords, int sampleStep);
+
+    mutable std::mutex                  m_mutex;
+    std::unordered_map<uint64_t, Entry> m_entries;
+    std::list<uint64_t>                 m_lruOrder;           // Front = most recently sampled
+    int                                 m_capacity      = 0;
+    size_t                              m_residentBytes = 0;
+    int                                 m_hitCount      = 0;
+    int                                 m_missCount     = 0;
+    int                                 m_evictionCount = 0;
+};
@@ -4,12 +4,17 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <cstddef>
 #include <cstdint>
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 
 // DebuggerPrintf is provided by ErrorWarningAssert.hpp for both Debug and Release
 
+//----------------------------------------------------------------------------------------------------
+// m_bitFlags bit 1: the block is waiting in World's DirtyLightQueue (set on push, cleared on pop)
+uint8_t constexpr BLOCK_FLAG_LIGHT_QUEUED = 0x02;
+
 //----------------------------------------------------------------------------------------------------
 //1. An ultra-flyweight voxel (volumetric element); one unit (1x1x1) of world-stuff.
 //2. Each block knows its type, which is an index (stored as an unsigned char / uint8_t) into a global table of block definitions (see below).
@@ -21,7 +26,7 @@ class Block
 public:
     uint8_t m_typeIndex = 0;    // Block type index into BlockDefinition table - 1 byte
     uint8_t m_lightingData = 0; // High nibble: outdoor light (0-15), Low nibble: indoor light (0-15) - 1 byte
-    uint8_t m_bitFlags = 0;     // Boolean flags (bit 0: isSkyVisible, bits 1-7: reserved) - 1 byte
+    uint8_t m_bitFlags = 0;     // Boolean flags (bit 0: isSkyVisible, bit 1: BLOCK_FLAG_LIGHT_QUEUED, bits 2-7: reserved) - 1 byte
 
     // Inline accessors for outdoor light (high nibble)
     inline uint8_t GetOutdoorLight() const { return (m_lightingData >> 4) & 0x0F; }
@@ -59,3 +64,80 @@ public:
 
     // All other data lives in BlockDefinition
 };
+
+//----------------------------------------------------------------------------------------------------
+// BlockRef - Reference to one block stored as separate type / light / flag arrays (see Chunk SoA storage)
+//
+// Chunks keep m_typeIndex, m_lightingData and m_bitFlags in three contiguous byte arrays so scans that
+// only read one of them touch a third of the cache lines. BlockRef exposes the same members and
+// accessors as Block, bound by reference to the three array slots, so per-block code reads the same.
+//----------------------------------------------------------------------------------------------------
+class BlockRef
+{
+public:
+    BlockRef(uint8_t& typeIndex, uint8_t& lightingData, uint8_t& bitFlags)
+        : m_typeIndex(typeIndex), m_lightingData(lightingData), m_bitFlags(bitFlags)
+    {
+    }
+
+    uint8_t& m_typeIndex;
+    uint8_t& m_lightingData;
+    uint8_t& m_bitFlags;
+
+    inline uint8_t GetOutdoorLight() const { return (m_lightingData >> 4) & 0x0F; }
+    inline void SetOutdoorLight(uint8_t value) { m_lightingData = (m_lightingData & 0x0F) | ((value & 0x0F) << 4); }
+
+    inline uint8_t GetIndoorLight() const { return m_lightingData & 0x0F; }
+    inline void SetIndoorLight(uint8_t value) { m_lightingData = (m_lightingData & 0xF0) | (value & 0x0F); }
+
+    inline bool IsSkyVisible() const { return (m_bitFlags & 0x01) != 0; }
+    inline void SetIsSkyVisible(bool visible) { m_bitFlags = visible ? (m_bitFlags | 0x01) : (m_bitFlags & ~0x01); }
+
+    // Value copy in the interleaved layout (palettes, snapshots)
+    Block ToBlock() const
+    {
+        Block block;
+        block.m_typeIndex    = m_typeIndex;
+        block.m_lightingData = m_lightingData;
+        block.m_bitFlags     = m_bitFlags;
+        return block;
+    }
+};
+
+//----------------------------------------------------------------------------------------------------
+// BlockPtr - Nullable handle returned where Block* used to be (Chunk::GetBlock, BlockIterator::GetBlock)
+//
+// Supports the pointer idioms existing callers rely on: null checks, comparison with nullptr,
+// block->m_typeIndex and block->SetOutdoorLight(). Hot loops should use the chunk's raw arrays instead.
+//----------------------------------------------------------------------------------------------------
+class BlockPtr
+{
+public:
+    // operator-> must yield a pointer, so the BlockRef is held in a temporary for the full expression
+    struct Arrow
+    {
+        BlockRef  m_ref;
+        BlockRef* operator->() { return &m_ref; }
+    };
+
+    BlockPtr() = default;
+    BlockPtr(std::nullptr_t) {}
+    BlockPtr(uint8_t* typeIndex, uint8_t* lightingData, uint8_t* bitFlags)
+        : m_typeIndex(typeIndex), m_lightingData(lightingData), m_bitFlags(bitFlags)
+    {
+    }
+
+    BlockRef operator*() const { return BlockRef(*m_typeIndex, *m_lightingData, *m_bitFlags); }
+    Arrow    operator->() const { return Arrow{**this}; }
+
+    explicit operator bool() const { return m_typeIndex != nullptr; }
+    bool     operator==(std::nullptr_t) const { return m_typeIndex == nullptr; }
+    bool     operator!=(std::nullptr_t) const { return m_typeIndex != nullptr; }
+    bool     operator==(BlockPtr const& other) const { return m_typeIndex == other.m_typeIndex; }
+    bool     operator!=(BlockPtr const& other) const { return m_typeIndex != other.m_typeIndex; }
+
+private:
+    uint8_t* m_typeIndex    = nullptr;
+    uint8_t* m_lightingData = nullptr;
+    uint8_t* m_bitFlags     = nullptr;
+};
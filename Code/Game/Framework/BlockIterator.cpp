@@ -19,7 +19,7 @@ BlockIterator::BlockIterator(Chunk*    chunk,
 }
 
 //----------------------------------------------------------------------------------------------------
-Block* BlockIterator::GetBlock() const
+BlockPtr BlockIterator::GetBlock() const
 {
     if (!IsValid()) return nullptr;
 
@@ -10,7 +10,7 @@
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Chunk;
-class Block;
+class BlockPtr;
 class World;
 
 //----------------------------------------------------------------------------------------------------
@@ -24,11 +24,11 @@ public:
     explicit BlockIterator(Chunk* chunk, int blockIndex = 0, World* world = nullptr);
 
     // Basic access
-    Block*  GetBlock() const;
-    Chunk*  GetChunk() const { return m_chunk; }
-    int     GetBlockIndex() const { return m_blockIndex; }
-    IntVec3 GetLocalCoords() const;
-    bool    IsValid() const;
+    BlockPtr GetBlock() const;
+    Chunk*   GetChunk() const { return m_chunk; }
+    int      GetBlockIndex() const { return m_blockIndex; }
+    IntVec3  GetLocalCoords() const;
+    bool     IsValid() const;
 
     // Directional movement (returns true if movement was successful)
     bool MoveNorth();   // +Y direction
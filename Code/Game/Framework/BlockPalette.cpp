@@ -0,0 +1,164 @@
+//----------------------------------------------------------------------------------------------------
+// BlockPalette.cpp - Palette-compressed block storage implementation
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BlockPalette.hpp"
+
+#include <cstring>
+#include <unordered_map>
+
+//----------------------------------------------------------------------------------------------------
+// Pack all three Block bytes into one key so palette entries compare type, light and flags together
+//----------------------------------------------------------------------------------------------------
+static uint32_t GetBlockPaletteKey(uint8_t const typeIndex, uint8_t const lightingData, uint8_t const bitFlags)
+{
+    return (uint32_t)typeIndex | ((uint32_t)lightingData << 8) | ((uint32_t)bitFlags << 16);
+}
+
+//----------------------------------------------------------------------------------------------------
+void PalettedBlockSection::Pack(uint8_t const* typeIndices,
+                                uint8_t const* lightingData,
+                                uint8_t const* bitFlags,
+                                int const      blockCount)
+{
+    GUARANTEE_OR_DIE(typeIndices != nullptr && lightingData != nullptr && bitFlags != nullptr && blockCount > 0,
+                     "PalettedBlockSection::Pack requires non-empty block arrays");
+
+    Clear();
+    m_blockCount = blockCount;
+
+    // Pass 1: Build palette and remember each block's palette slot
+    // Runs of identical blocks are very common (air above surface, stone below), so the previous
+    // key is checked before falling back to the hash map lookup
+    std::vector<uint16_t>                  paletteIndices((size_t)blockCount);
+    std::unordered_map<uint32_t, uint16_t> keyToPaletteIndex;
+    uint32_t                               previousKey          = 0xFFFFFFFF;
+    uint16_t                               previousPaletteIndex = 0;
+
+    for (int i = 0; i < blockCount; ++i)
+    {
+        uint32_t const key = GetBlockPaletteKey(typeIndices[i], lightingData[i], bitFlags[i]);
+        if (key != previousKey)
+        {
+            auto const found = keyToPaletteIndex.find(key);
+            if (found != keyToPaletteIndex.end())
+            {
+                previousPaletteIndex = found->second;
+            }
+            else
+            {
+                previousPaletteIndex = (uint16_t)m_palette.size();
+                keyToPaletteIndex.emplace(key, previousPaletteIndex);
+                Block paletteEntry;
+                paletteEntry.m_typeIndex    = typeIndices[i];
+                paletteEntry.m_lightingData = lightingData[i];
+                paletteEntry.m_bitFlags     = bitFlags[i];
+                m_palette.push_back(paletteEntry);
+            }
+            previousKey = key;
+        }
+        paletteIndices[i] = previousPaletteIndex;
+    }
+
+    m_palette.shrink_to_fit();
+
+    // Pass 2: Bit-pack indices (uniform sections need no index storage at all)
+    m_bitsPerIndex = GetBitsForPaletteSize((int)m_palette.size());
+    if (m_bitsPerIndex == 0)
+    {
+        return;
+    }
+
+    int const indicesPerWord = 64 / m_bitsPerIndex;
+    m_packedIndices.assign((size_t)((blockCount + indicesPerWord - 1) / indicesPerWord), 0);
+
+    for (int i = 0; i < blockCount; ++i)
+    {
+        int const wordIndex = i / indicesPerWord;
+        int const bitOffset = (i % indicesPerWord) * m_bitsPerIndex;
+        m_packedIndices[wordIndex] |= (uint64_t)paletteIndices[i] << bitOffset;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void PalettedBlockSection::Unpack(uint8_t* outTypeIndices, uint8_t* outLightingData, uint8_t* outBitFlags) const
+{
+    GUARANTEE_OR_DIE(outTypeIndices != nullptr && outLightingData != nullptr && outBitFlags != nullptr,
+                     "PalettedBlockSection::Unpack requires output arrays");
+
+    if (m_palette.empty())
+    {
+        return;
+    }
+
+    if (m_bitsPerIndex == 0)
+    {
+        memset(outTypeIndices, m_palette[0].m_typeIndex, (size_t)m_blockCount);
+        memset(outLightingData, m_palette[0].m_lightingData, (size_t)m_blockCount);
+        memset(outBitFlags, m_palette[0].m_bitFlags, (size_t)m_blockCount);
+        return;
+    }
+
+    int const      indicesPerWord = 64 / m_bitsPerIndex;
+    uint64_t const indexMask      = (1ull << m_bitsPerIndex) - 1ull;
+    int            blockIndex     = 0;
+
+    for (uint64_t const word : m_packedIndices)
+    {
+        uint64_t bits = word;
+        for (int slot = 0; slot < indicesPerWord && blockIndex < m_blockCount; ++slot)
+        {
+            Block const& paletteEntry = m_palette[(size_t)(bits & indexMask)];
+            outTypeIndices[blockIndex]  = paletteEntry.m_typeIndex;
+            outLightingData[blockIndex] = paletteEntry.m_lightingData;
+            outBitFlags[blockIndex]     = paletteEntry.m_bitFlags;
+            ++blockIndex;
+            bits >>= m_bitsPerIndex;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Block PalettedBlockSection::GetBlockAt(int const blockIndex) const
+{
+    if (m_bitsPerIndex == 0)
+    {
+        return m_palette.empty() ? Block() : m_palette[0];
+    }
+
+    int const      indicesPerWord = 64 / m_bitsPerIndex;
+    uint64_t const indexMask      = (1ull << m_bitsPerIndex) - 1ull;
+    uint64_t const word           = m_packedIndices[blockIndex / indicesPerWord];
+    int const      bitOffset      = (blockIndex % indicesPerWord) * m_bitsPerIndex;
+
+    return m_palette[(size_t)((word >> bitOffset) & indexMask)];
+}
+
+//----------------------------------------------------------------------------------------------------
+void PalettedBlockSection::Clear()
+{
+    m_palette.clear();
+    m_palette.shrink_to_fit();
+    m_packedIndices.clear();
+    m_packedIndices.shrink_to_fit();
+    m_blockCount   = 0;
+    m_bitsPerIndex = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t PalettedBlockSection::GetResidentBytes() const
+{
+    return m_palette.capacity() * sizeof(Block) + m_packedIndices.capacity() * sizeof(uint64_t);
+}
+
+//----------------------------------------------------------------------------------------------------
+int PalettedBlockSection::GetBitsForPaletteSize(int const paletteSize)
+{
+    if (paletteSize <= 1) return 0;
+    if (paletteSize <= 2) return 1;
+    if (paletteSize <= 4) return 2;
+    if (paletteSize <= 16) return 4;
+    if (paletteSize <= 256) return 8;
+    return 16;
+}
@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------------------------------
+// BlockPalette.hpp - Palette-compressed block storage for idle chunk sections
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Game/Framework/Block.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// PalettedBlockSection - One vertical chunk section stored as palette + bit-packed indices
+//
+// A section holds every distinct Block value (type, light nibbles and flags, 3 bytes) once in a
+// palette, and each block position stores only an index into that palette. Index width is the
+// smallest power of two that fits the palette (0, 1, 2, 4, 8 or 16 bits), so indices never straddle
+// a 64-bit word and lookup is a shift and a mask.
+//
+// Typical sizes for a 16384-block section:
+// - Uniform air / uniform stone: 1 palette entry, 0-bit indices -> 3 bytes (vs 48 KB flat)
+// - Surface band (~10 types x light levels): 16-64 entries, 4-8 bit indices -> 8-16 KB
+//
+// Thread Safety:
+// - Pack() / Clear() mutate the section and must not run concurrently with readers
+// - Unpack() / GetBlockAt() are const and safe to call from multiple threads at once
+//----------------------------------------------------------------------------------------------------
+class PalettedBlockSection
+{
+public:
+    PalettedBlockSection() = default;
+
+    // Encode blockCount blocks from structure-of-arrays storage (replaces any previous contents)
+    void  Pack(uint8_t const* typeIndices, uint8_t const* lightingData, uint8_t const* bitFlags, int blockCount);
+
+    // Decode all blocks back into structure-of-arrays storage of the same blockCount used in Pack()
+    void  Unpack(uint8_t* outTypeIndices, uint8_t* outLightingData, uint8_t* outBitFlags) const;
+
+    // Random access without decoding the whole section
+    Block GetBlockAt(int blockIndex) const;
+
+    void   Clear();
+    bool   IsEmpty() const { return m_palette.empty(); }
+    bool   IsUniform() const { return m_palette.size() == 1; }
+    int    GetPaletteSize() const { return (int)m_palette.size(); }
+    int    GetBitsPerIndex() const { return m_bitsPerIndex; }
+    size_t GetResidentBytes() const;
+
+private:
+    static int GetBitsForPaletteSize(int paletteSize);
+
+    std::vector<Block>    m_palette;
+    std::vector<uint64_t> m_packedIndices;
+    int                   m_blockCount   = 0;
+    int                   m_bitsPerIndex = 0;
+};
@@ -5,6 +5,9 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/Chunk.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
 #include <filesystem>
 #include <unordered_map>
 
@@ -21,9 +24,12 @@
 #include "Engine/Renderer/VertexUtils.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Game/Definition/BlockDefinition.hpp"
+#include "Game/Framework/BatchNoise.hpp"
+#include "Game/Framework/BiomeRegionCache.hpp"
 #include "Game/Framework/GameCommon.hpp"
 #include "Game/Framework/WorldGenConfig.hpp"  // For g_worldGenConfig (Assignment 4: Phase 5B.4)
 #include "Game/Framework/BlockIterator.hpp"
+#include "Game/Framework/ChunkCache.hpp"
 #include "Game/Gameplay/Game.hpp"  // For g_game and visualization mode access
 #include "Game/Gameplay/World.hpp"  // Assignment 5 Phase 6: For OnActivate() method
 #include "ThirdParty/Noise/RawNoise.hpp"
@@ -911,16 +917,23 @@ Chunk::Chunk(IntVec2 const& chunkCoords)
     Vec3 worldMaxs = worldMins + Vec3((float)CHUNK_SIZE_X, (float)CHUNK_SIZE_Y, (float)CHUNK_SIZE_Z);
     m_worldBounds  = AABB3(worldMins, worldMaxs);
 
+    // Block storage lives on the heap so idle chunks can release it once palette-compressed
     // Initialize all blocks to air (terrain generation happens asynchronously)
     // CRITICAL FIX (2025-11-16): Initialize ALL Block members to prevent garbage memory values
     // BUG WAS: Only m_typeIndex initialized, m_lightingData and m_bitFlags contained random values
     // This caused underground blocks to appear bright if garbage data had high outdoor light bits
-    for (int i = 0; i < BLOCKS_PER_CHUNK; ++i)
+    // AllocateBlockStorage() zeroes all three arrays: BLOCK_AIR, outdoor=0/indoor=0, isSkyVisible=false
+    AllocateBlockStorage();
+
+    // Every section starts uniformly air
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        m_blocks[i].m_typeIndex = 0;      // BLOCK_AIR
-        m_blocks[i].m_lightingData = 0;   // outdoor=0, indoor=0 (both nibbles zero)
-        m_blocks[i].m_bitFlags = 0;       // isSkyVisible=false, all flags clear
+        m_sectionAirCount[sectionIndex] = (uint16_t)BLOCKS_PER_CHUNK_SECTION;
     }
+
+    // ...and so does every column
+    std::fill_n(m_highestNonAirZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, (int16_t)-1);
+    std::fill_n(m_highestOpaqueZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, (int16_t)-1);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -937,10 +950,86 @@ Chunk::~Chunk()
     GAME_SAFE_RELEASE(m_debugVertexBuffer);
     // GAME_SAFE_RELEASE(m_debugBuffer);
 
+    FreeBlockStorage();
+
     // DebuggerPrintf("[CHUNK DESTRUCTOR] Chunk(%d,%d) buffers released\n",
     //               m_chunkCoords.x, m_chunkCoords.y);
 }
 
+//----------------------------------------------------------------------------------------------------
+// ResetForReuse - Cheap replacement for delete + new Chunk (see World::AcquireChunk)
+//
+// Only called by World on the main thread for chunks no job or container references anymore.
+// Biome data and surface heights are left as-is, same as the constructor: generation overwrites
+// both, and InitializeLighting rewrites surface heights after a disk load.
+//----------------------------------------------------------------------------------------------------
+void Chunk::ResetForReuse(IntVec2 const& chunkCoords)
+{
+    m_chunkCoords = chunkCoords;
+
+    Vec3 worldMins((float)(chunkCoords.x) * CHUNK_SIZE_X, (float)(chunkCoords.y) * CHUNK_SIZE_Y, 0.f);
+    Vec3 worldMaxs = worldMins + Vec3((float)CHUNK_SIZE_X, (float)CHUNK_SIZE_Y, (float)CHUNK_SIZE_Z);
+    m_worldBounds  = AABB3(worldMins, worldMaxs);
+
+    // Block storage back to all-air with zeroed lighting and flags (same as the constructor)
+    {
+        std::lock_guard<std::mutex> lock(m_blockStorageMutex);
+        if (m_isPacked.load(std::memory_order_acquire))
+        {
+            for (PalettedBlockSection& section : m_packedSections)
+            {
+                section.Clear();
+            }
+            AllocateBlockStorage();
+            m_isPacked.store(false, std::memory_order_release);
+        }
+        else
+        {
+            memset(m_blockTypeIndices, 0, (size_t)BLOCKS_PER_CHUNK * sizeof(Block));   // All three arrays share one allocation
+        }
+    }
+
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+    {
+        m_sectionAirCount[sectionIndex]   = (uint16_t)BLOCKS_PER_CHUNK_SECTION;
+        m_sectionStoneCount[sectionIndex] = 0;
+    }
+    std::fill_n(m_highestNonAirZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, (int16_t)-1);
+    std::fill_n(m_highestOpaqueZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, (int16_t)-1);
+    std::fill_n(m_opaqueMask, CHUNK_ROW_COUNT, 0u);
+    std::fill_n(m_solidMask, CHUNK_ROW_COUNT, 0u);
+
+    m_generationContext.reset();
+    m_nextGenerationStage = ChunkGenerationStage::BIOME;
+    m_surfaceSnapshot.clear();
+    m_surfaceSnapshotHeights.clear();
+
+    // Keep vector capacity so the next SetMeshData() copy does not reallocate
+    m_vertices.clear();
+    m_indices.clear();
+    m_debugVertices.clear();
+    m_debugIndices.clear();
+    ReleaseRenderBuffers();
+
+    m_drawDebug   = false;
+    m_needsSaving = false;
+    m_isMeshDirty = true;
+    m_state.store(ChunkState::CONSTRUCTING);
+
+    m_northNeighbor = nullptr;
+    m_southNeighbor = nullptr;
+    m_eastNeighbor  = nullptr;
+    m_westNeighbor  = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Chunk::ReleaseRenderBuffers()
+{
+    GAME_SAFE_RELEASE(m_vertexBuffer);
+    GAME_SAFE_RELEASE(m_indexBuffer);
+    GAME_SAFE_RELEASE(m_debugVertexBuffer);
+}
+
 //----------------------------------------------------------------------------------------------------
 void Chunk::Update(float const deltaSeconds)
 {
@@ -953,13 +1042,7 @@ void Chunk::Update(float const deltaSeconds)
     // NOTE: F2 debug key handling is now managed by World class to ensure consistent behavior
     // across all chunks including newly activated ones
 
-    // Cross-Chunk Tree Placement (Option 1: Post-Processing Pass)
-    // Place trees that extend into neighboring chunks after this chunk is complete
-    // and neighbors are available. This ensures thread-safe cross-chunk operations.
-    if (GetState() == ChunkState::COMPLETE && !m_crossChunkTrees.empty())
-    {
-        PlaceCrossChunkTrees();
-    }
+    // NOTE: Trees that cross chunk edges are stamped by each chunk's own generation job (see RunTreeStage)
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1208,456 +1291,1094 @@ static BiomeType SelectBiome(float temperature, float humidity, float continenta
 }
 
 //----------------------------------------------------------------------------------------------------
-void Chunk::GenerateTerrain()
+// Largest power of two <= requestedStep that divides the chunk extent, so lattice points land on the
+// same global coordinates in every chunk (neighbors share their boundary samples exactly)
+//----------------------------------------------------------------------------------------------------
+static int GetDensityLatticeStep(int const requestedStep, int const chunkExtent)
 {
-    // Establish world-space position and bounds of this chunk
-    Vec3 chunkPosition((float)(m_chunkCoords.x) * CHUNK_SIZE_X, (float)(m_chunkCoords.y) * CHUNK_SIZE_Y, 0.f);
-    Vec3 chunkBounds = chunkPosition + Vec3((float)CHUNK_SIZE_X, (float)CHUNK_SIZE_Y, (float)CHUNK_SIZE_Z);
+    int step = 1;
+    while (step * 2 <= requestedStep && chunkExtent % (step * 2) == 0)
+    {
+        step *= 2;
+    }
+    return step;
+}
 
-    // Phase 0, Task 0.4: Check for debug visualization mode
-    // If in visualization mode, generate simple flat terrain showing noise values as colored blocks
-    DebugVisualizationMode vizMode = DebugVisualizationMode::NORMAL_TERRAIN;
-    if (g_game && g_game->GetWorld())
+//----------------------------------------------------------------------------------------------------
+// 2D path-noise carver (ravines, rivers): the carve span of every column in a chunk
+//----------------------------------------------------------------------------------------------------
+struct CarverPathParams
+{
+    unsigned int m_pathSeed          = 0;
+    float        m_pathNoiseScale    = 0.f;
+    int          m_pathNoiseOctaves  = 1;
+    float        m_pathThreshold     = 1.f;
+    float        m_widthNoiseScale   = 0.f;
+    int          m_widthNoiseOctaves = 1;
+    int          m_widthMin          = 0;
+    int          m_widthMax          = 0;
+    int          m_depthMin          = 0;
+    int          m_depthMax          = 0;
+    float        m_edgeFalloff       = 0.f;
+    int          m_minBottomZ        = 0;
+};
+
+struct CarverColumnSpan
+{
+    int m_bottomZ = 1;      // Carve z in [m_bottomZ, m_topZ]; empty when m_bottomZ > m_topZ
+    int m_topZ    = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// BuildCarverColumnSpans - Distance to the path centerline per column, turned into a carve span
+//
+// Path noise is 2D, so it is sampled once per column over the chunk plus a halo as wide as the largest
+// center search, instead of over a (2r+1)^2 neighborhood for every solid block of every column. The
+// halo is only filled when some column of the chunk is on the path. A column's center is the strongest
+// path sample within its search radius, found in the same order with the same values as the old
+// per-block search, so the spans match it exactly.
+//----------------------------------------------------------------------------------------------------
+static void BuildCarverColumnSpans(IntVec2 const&          chunkCoords,
+                                   BiomeData const*        biomeData,
+                                   CarverPathParams const& params,
+                                   CarverColumnSpan*       outSpans)
+{
+    int const haloSize    = (std::max)(params.m_widthMin, params.m_widthMax) / 2 + 2;
+    int const fieldSizeX  = CHUNK_SIZE_X + 2 * haloSize;
+    int const fieldSizeY  = CHUNK_SIZE_Y + 2 * haloSize;
+    int const chunkMinX   = chunkCoords.x * CHUNK_SIZE_X;
+    int const chunkMinY   = chunkCoords.y * CHUNK_SIZE_Y;
+    bool      isAnyOnPath = false;
+
+    // Path values in [0, 1], indexed by (x + haloSize) + (y + haloSize) * fieldSizeX for local x, y
+    std::vector<float> pathField((size_t)fieldSizeX * fieldSizeY);
+
+    for (int fieldY = 0; fieldY < fieldSizeY; fieldY++)
+    {
+        for (int fieldX = 0; fieldX < fieldSizeX; fieldX++)
+        {
+            bool const isCore = (fieldX >= haloSize && fieldX < haloSize + CHUNK_SIZE_X && fieldY >= haloSize && fieldY < haloSize + CHUNK_SIZE_Y);
+            if (!isCore)
+            {
+                continue;
+            }
+
+            float const pathNoise = Compute2dPerlinNoise((float)(chunkMinX + fieldX - haloSize), (float)(chunkMinY + fieldY - haloSize),
+                                                         params.m_pathNoiseScale, params.m_pathNoiseOctaves,
+                                                         DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, params.m_pathSeed);
+            pathField[fieldX + fieldY * fieldSizeX] = (pathNoise + 1.0f) * 0.5f;
+            isAnyOnPath |= (pathField[fieldX + fieldY * fieldSizeX] > params.m_pathThreshold);
+        }
+    }
+
+    for (int columnIndex = 0; columnIndex < CHUNK_SIZE_X * CHUNK_SIZE_Y; columnIndex++)
     {
-        vizMode = g_game->GetWorld()->GetDebugVisualizationMode();
+        outSpans[columnIndex] = CarverColumnSpan();
     }
 
-    if (vizMode != DebugVisualizationMode::NORMAL_TERRAIN)
+    if (!isAnyOnPath)
     {
-        // Generate debug visualization terrain
-        // Create a flat layer at Y=80 (sea level) showing the selected noise layer as colored blocks
+        return;
+    }
 
-        // Derive seed for the noise layer being visualized
-        unsigned int visualizationSeed = GAME_SEED;
-        switch (vizMode)
+    for (int fieldY = 0; fieldY < fieldSizeY; fieldY++)
+    {
+        for (int fieldX = 0; fieldX < fieldSizeX; fieldX++)
         {
-            case DebugVisualizationMode::TEMPERATURE:    visualizationSeed = GAME_SEED + 2; break;
-            case DebugVisualizationMode::HUMIDITY:       visualizationSeed = GAME_SEED + 1; break;
-            case DebugVisualizationMode::CONTINENTALNESS: visualizationSeed = GAME_SEED + 5; break;
-            case DebugVisualizationMode::EROSION:        visualizationSeed = GAME_SEED + 6; break;
-            case DebugVisualizationMode::WEIRDNESS:      visualizationSeed = GAME_SEED + 7; break;
-            case DebugVisualizationMode::PEAKS_VALLEYS:  visualizationSeed = GAME_SEED + 8; break;
-            case DebugVisualizationMode::BIOME_TYPE:     visualizationSeed = GAME_SEED + 9; break;  // Phase 1, Task 1.4
-            default: break;
+            bool const isCore = (fieldX >= haloSize && fieldX < haloSize + CHUNK_SIZE_X && fieldY >= haloSize && fieldY < haloSize + CHUNK_SIZE_Y);
+            if (isCore)
+            {
+                continue;
+            }
+
+            float const pathNoise = Compute2dPerlinNoise((float)(chunkMinX + fieldX - haloSize), (float)(chunkMinY + fieldY - haloSize),
+                                                         params.m_pathNoiseScale, params.m_pathNoiseOctaves,
+                                                         DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, params.m_pathSeed);
+            pathField[fieldX + fieldY * fieldSizeX] = (pathNoise + 1.0f) * 0.5f;
         }
+    }
 
-        // Fill blocks with visualization data
-        for (int y = 0; y < CHUNK_SIZE_Y; y++)
+    for (int y = 0; y < CHUNK_SIZE_Y; y++)
+    {
+        for (int x = 0; x < CHUNK_SIZE_X; x++)
         {
-            for (int x = 0; x < CHUNK_SIZE_X; x++)
+            float const* pathCenter = &pathField[(x + haloSize) + (y + haloSize) * fieldSizeX];
+            float const  pathValue  = pathCenter[0];
+            if (pathValue <= params.m_pathThreshold)
             {
-                int globalX = m_chunkCoords.x * CHUNK_SIZE_X + x;
-                int globalY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+                continue;
+            }
 
-                // Sample the appropriate noise layer based on visualization mode
-                float noiseValue = 0.f;
-                switch (vizMode)
+            // Secondary width noise for variable carve width
+            float const widthNoise = Compute2dPerlinNoise((float)(chunkMinX + x), (float)(chunkMinY + y),
+                                                          params.m_widthNoiseScale, params.m_widthNoiseOctaves,
+                                                          DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, params.m_pathSeed + 10);
+            float const widthNoiseNormalized = (widthNoise + 1.0f) * 0.5f;
+            int const   fullWidth            = (int)(params.m_widthMin + widthNoiseNormalized * (params.m_widthMax - params.m_widthMin));
+            int const   halfWidth            = fullWidth / 2;
+
+            // Centerline = local maximum of the path value within the search radius
+            int const searchRadius  = (std::min)(halfWidth + 2, haloSize);
+            float     maxPathValue  = pathValue;
+            int       centerOffsetX = 0;
+            int       centerOffsetY = 0;
+            for (int dy = -searchRadius; dy <= searchRadius; ++dy)
+            {
+                for (int dx = -searchRadius; dx <= searchRadius; ++dx)
                 {
-                    case DebugVisualizationMode::TEMPERATURE:
-                    {
-                        float rawTemp = Get2dNoiseNegOneToOne(globalX, globalY, visualizationSeed) * TEMPERATURE_RAW_NOISE_SCALE;
-                        noiseValue = rawTemp + 0.5f + 0.5f * Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.temperatureScale,
-                            g_worldGenConfig->biomeNoise.temperatureOctaves,
-                            g_worldGenConfig->biomeNoise.temperaturePersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        // Remap from [0,1] to [-1,1]
-                        noiseValue = (noiseValue * 2.f) - 1.f;
-                        break;
-                    }
-
-                    case DebugVisualizationMode::HUMIDITY:
-                        noiseValue = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.humidityScale,
-                            g_worldGenConfig->biomeNoise.humidityOctaves,
-                            g_worldGenConfig->biomeNoise.humidityPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        break;
-
-                    case DebugVisualizationMode::CONTINENTALNESS:
-                        noiseValue = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.continentalnessScale,
-                            g_worldGenConfig->biomeNoise.continentalnessOctaves,
-                            g_worldGenConfig->biomeNoise.continentalnessPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        break;
-
-                    case DebugVisualizationMode::EROSION:
-                        noiseValue = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.erosionScale,
-                            g_worldGenConfig->biomeNoise.erosionOctaves,
-                            g_worldGenConfig->biomeNoise.erosionPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        break;
-
-                    case DebugVisualizationMode::WEIRDNESS:
-                        noiseValue = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.weirdnessScale,
-                            g_worldGenConfig->biomeNoise.weirdnessOctaves,
-                            g_worldGenConfig->biomeNoise.weirdnessPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        break;
-
-                    case DebugVisualizationMode::PEAKS_VALLEYS:
+                    float const samplePathValue = pathCenter[dx + dy * fieldSizeX];
+                    if (samplePathValue > maxPathValue)
                     {
-                        // PV is derived from weirdness: PV = 1 - |( 3 * abs(W) ) - 2|
-                        float weirdness = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.weirdnessScale,
-                            g_worldGenConfig->biomeNoise.weirdnessOctaves,
-                            g_worldGenConfig->biomeNoise.weirdnessPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            visualizationSeed
-                        );
-                        noiseValue = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
-                        break;
-                    }
-
-                    case DebugVisualizationMode::BIOME_TYPE:
-                    {
-                        // Phase 1, Task 1.4: Sample all 6 biome noise layers and determine biome type
-                        // CRITICAL FIX: Use the SAME seeds as normal terrain generation (lines 599-610)
-                        // Otherwise visualization shows different biomes than actual terrain!
-
-                        // Derive seeds matching normal terrain generation
-                        unsigned int humiditySeed = GAME_SEED + 1;
-                        unsigned int temperatureSeed = GAME_SEED + 2;
-                        unsigned int continentalnessSeed = GAME_SEED + 6;
-                        unsigned int erosionSeed = GAME_SEED + 7;
-                        unsigned int weirdnessSeed = GAME_SEED + 8;
-
-                        // Sample Temperature (matches Pass 1 lines 638-647)
-                        float rawTemp = Get2dNoiseNegOneToOne(globalX, globalY, temperatureSeed) * TEMPERATURE_RAW_NOISE_SCALE;
-                        float temperature = rawTemp + 0.5f + 0.5f * Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.temperatureScale,
-                            g_worldGenConfig->biomeNoise.temperatureOctaves,
-                            g_worldGenConfig->biomeNoise.temperaturePersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            temperatureSeed
-                        );
-                        // Normalize temperature from [0,1] to [-1,1] for biome selection
-                        float temperatureNormalized = RangeMap(temperature, 0.f, 1.f, -1.f, 1.f);
-
-                        // Sample Humidity (matches Pass 1 lines 627-635)
-                        float humidity = 0.5f + 0.5f * Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.humidityScale,
-                            g_worldGenConfig->biomeNoise.humidityOctaves,
-                            g_worldGenConfig->biomeNoise.humidityPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            humiditySeed
-                        );
-                        // Normalize humidity from [0,1] to [-1,1] for biome selection
-                        float humidityNormalized = RangeMap(humidity, 0.f, 1.f, -1.f, 1.f);
-
-                        // Sample Continentalness (matches Pass 1 lines 653-661)
-                        float continentalness = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.continentalnessScale,
-                            g_worldGenConfig->biomeNoise.continentalnessOctaves,
-                            g_worldGenConfig->biomeNoise.continentalnessPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            continentalnessSeed
-                        );
-
-                        // Sample Erosion (matches Pass 1 lines 664-672)
-                        float erosion = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.erosionScale,
-                            g_worldGenConfig->biomeNoise.erosionOctaves,
-                            g_worldGenConfig->biomeNoise.erosionPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            erosionSeed
-                        );
-
-                        // Sample Weirdness (matches Pass 1 lines 675-683)
-                        float weirdness = Compute2dPerlinNoise(
-                            (float)globalX, (float)globalY,
-                            g_worldGenConfig->biomeNoise.weirdnessScale,
-                            g_worldGenConfig->biomeNoise.weirdnessOctaves,
-                            g_worldGenConfig->biomeNoise.weirdnessPersistence,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            weirdnessSeed
-                        );
-
-                        // Calculate Peaks & Valleys from Weirdness (matches Pass 1 line 687)
-                        float peaksValleys = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
-
-                        // Determine biome type using lookup table (from Task 1.3)
-                        BiomeType biome = SelectBiome(temperatureNormalized, humidityNormalized,
-                                                       continentalness, erosion, peaksValleys);
-
-                        // DEBUG: Log detailed biome noise values for investigation
-                        if (globalX % 16 == 0 && globalY % 16 == 0)  // Log every 16th position to reduce spam
-                        {
-                            const char* biomeName = "UNKNOWN";
-                            switch (biome) {
-                                case BiomeType::OCEAN: biomeName = "OCEAN"; break;
-                                case BiomeType::DEEP_OCEAN: biomeName = "DEEP_OCEAN"; break;
-                                case BiomeType::FROZEN_OCEAN: biomeName = "FROZEN_OCEAN"; break;
-                                case BiomeType::BEACH: biomeName = "BEACH"; break;
-                                case BiomeType::SNOWY_BEACH: biomeName = "SNOWY_BEACH"; break;
-                                case BiomeType::DESERT: biomeName = "DESERT"; break;
-                                case BiomeType::SAVANNA: biomeName = "SAVANNA"; break;
-                                case BiomeType::PLAINS: biomeName = "PLAINS"; break;
-                                case BiomeType::SNOWY_PLAINS: biomeName = "SNOWY_PLAINS"; break;
-                                case BiomeType::FOREST: biomeName = "FOREST"; break;
-                                case BiomeType::JUNGLE: biomeName = "JUNGLE"; break;
-                                case BiomeType::TAIGA: biomeName = "TAIGA"; break;
-                                case BiomeType::SNOWY_TAIGA: biomeName = "SNOWY_TAIGA"; break;
-                                case BiomeType::STONY_PEAKS: biomeName = "STONY_PEAKS"; break;
-                                case BiomeType::SNOWY_PEAKS: biomeName = "SNOWY_PEAKS"; break;
-                            }
-
-
-                        }
-
-                        // Cast biome enum to float for color mapping
-                        noiseValue = static_cast<float>(static_cast<int>(biome));
-                        break;
+                        maxPathValue  = samplePathValue;
+                        centerOffsetX = dx;
+                        centerOffsetY = dy;
                     }
-
-                    default: break;
                 }
+            }
 
-                // Get the appropriate colored block for this noise value
-                uint8_t visualizationBlock = GetDebugVisualizationBlock(noiseValue, vizMode);
-
-                // Create a flat visualization surface at Y=80 (sea level)
-                // Phase 0, Task 0.5: Updated to match new sea level (was Y=64 for 128-block chunks)
-                constexpr int VISUALIZATION_HEIGHT = 80;
+            float const distanceToCenter = sqrtf((float)(centerOffsetX * centerOffsetX + centerOffsetY * centerOffsetY));
+            if (distanceToCenter > (float)halfWidth)
+            {
+                continue;
+            }
 
-                // BUGFIX: Use direct array assignment instead of SetBlock() to avoid triggering saves
-                // Debug visualization is temporary and should NOT mark chunks as needing save
-                // Fill bottom with stone (foundation)
-                for (int z = 0; z < VISUALIZATION_HEIGHT; z++)
-                {
-                    int blockIdx = LocalCoordsToIndex(x, y, z);
-                    m_blocks[blockIdx].m_typeIndex = BLOCK_STONE;
-                }
+            // Deeper at the centerline, shallower toward the edges
+            float const radialFalloff   = GetClamped(1.0f - (distanceToCenter / (float)halfWidth), 0.0f, 1.0f);
+            float const depthMultiplier = radialFalloff * (1.0f - params.m_edgeFalloff) + params.m_edgeFalloff;
+            int const   depth           = (int)(params.m_depthMin + depthMultiplier * (params.m_depthMax - params.m_depthMin));
 
-                // Place the visualization block on top
-                int topBlockIdx = LocalCoordsToIndex(x, y, VISUALIZATION_HEIGHT);
-                m_blocks[topBlockIdx].m_typeIndex = visualizationBlock;
+            // Estimate surface height using biome parameters
+            BiomeData const& columnBiome            = biomeData[y * CHUNK_SIZE_X + x];
+            float const      continentalnessOffset  = RangeMap(columnBiome.continentalness, -1.2f, 1.0f,
+                                                               CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
+            float const      pvOffset               = RangeMap(columnBiome.peaksValleys, -1.0f, 1.0f,
+                                                               PV_HEIGHT_MIN, PV_HEIGHT_MAX);
+            float const      estimatedSurfaceHeight = (float)DEFAULT_TERRAIN_HEIGHT + continentalnessOffset + pvOffset;
 
-                // Leave everything above as air
-                for (int z = VISUALIZATION_HEIGHT + 1; z < CHUNK_SIZE_Z; z++)
-                {
-                    int blockIdx = LocalCoordsToIndex(x, y, z);
-                    m_blocks[blockIdx].m_typeIndex = BLOCK_AIR;
-                }
-            }
+            CarverColumnSpan& span = outSpans[y * CHUNK_SIZE_X + x];
+            span.m_bottomZ         = (std::max)((int)(estimatedSurfaceHeight - depth), params.m_minBottomZ);
+            span.m_topZ            = (int)estimatedSurfaceHeight;
         }
-
-        // Mark chunk as needing mesh rebuild (but NOT save - debug visualization is temporary)
-        // BUGFIX: Debug visualization is NOT a player modification, so don't save to disk
-        // Saving debug visualization would write temporary colored blocks to .chunk files
-        SetIsMeshDirty(true);
-        // NOTE: Do NOT call SetNeedsSaving(true) - debug viz is temporary and shouldn't persist
-        return;  // Skip normal terrain generation
     }
+}
 
-    // Derive deterministic seeds for each noise channel
-    unsigned int terrainSeed     = GAME_SEED;
-    unsigned int humiditySeed    = GAME_SEED + 1;
-    unsigned int temperatureSeed = humiditySeed + 1;
-    unsigned int hillSeed        = temperatureSeed + 1;
-    unsigned int oceanSeed       = hillSeed + 1;
-    unsigned int dirtSeed        = oceanSeed + 1;
+//----------------------------------------------------------------------------------------------------
+uint8_t constexpr PROFILE_NEAR_SURFACE = 0x01;     // Cave-check density >= 0 within MIN_CAVE_DEPTH_FROM_SURFACE above
+uint8_t constexpr PROFILE_AIR_ABOVE    = 0x02;     // Full density (with slides) >= 0 directly above
 
-    // Assignment 4: Biome noise seeds (Phase 1, Task 1.3)
-    unsigned int continentalnessSeed = dirtSeed + 1;
-    unsigned int erosionSeed         = continentalnessSeed + 1;
-    unsigned int weirdnessSeed       = erosionSeed + 1;
+//----------------------------------------------------------------------------------------------------
+// ChunkGenerationContext - Intermediates handed from one generation stage to the next
+//
+// Lives from BeginGeneration() until LIGHTING completes. The density volume and column profile are only
+// read by TERRAIN, which frees them; the per-column arrays are small and stay until the context is dropped.
+// With m_retainIntermediates the context outlives LIGHTING (~32 KB), so a restage can start at DENSITY:
+// the biome columns stay in the chunk, and DENSITY reuses the lattice and carver spans whose inputs match.
+//----------------------------------------------------------------------------------------------------
+struct ChunkGenerationContext
+{
+    ChunkGenerationSettings      m_settings;
+    DebugVisualizationMode       m_vizMode = DebugVisualizationMode::NORMAL_TERRAIN;
+    float                        m_temperatureMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y] = {};     // BIOME -> TERRAIN (ice on water)
+    std::vector<float>           m_densityNoise;                                           // DENSITY -> TERRAIN, one value per block
+    std::vector<uint8_t>         m_columnProfile;                                          // DENSITY -> TERRAIN, PROFILE_* flags per block
+    CarverColumnSpan             m_ravineSpans[CHUNK_SIZE_X * CHUNK_SIZE_Y];               // DENSITY -> TERRAIN
+    CarverColumnSpan             m_riverSpans[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    bool                         m_hasCarverSpans = false;                                 // Spans were built with m_carverParams
+    WorldGenConfig::CarverParams m_carverParams;
+    std::vector<float>           m_densityLattice;                                         // DENSITY noise lattice (empty for exact noise)
+    float                        m_densityLatticeScale   = 0.f;                            // Inputs m_densityLattice was sampled with
+    int                          m_densityLatticeOctaves = 0;
+    int                          m_densityLatticeStepXY  = 0;
+    int                          m_densityLatticeStepZ   = 0;
+    bool                         m_isColumnMasked = false;                                 // Tree probes: DENSITY..SURFACE only where masked
+    uint8_t                      m_columnMask[CHUNK_SIZE_X * CHUNK_SIZE_Y] = {};
+
+    bool IsColumnGenerated(int const columnIdx) const { return !m_isColumnMasked || m_columnMask[columnIdx] != 0; }
+};
 
-    // Allocate per-(x,y) maps
-    int   heightMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
-    int   dirtDepthXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
-    float humidityMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
-    float temperatureMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+//----------------------------------------------------------------------------------------------------
+char const* GetChunkGenerationStageName(ChunkGenerationStage const stage)
+{
+    switch (stage)
+    {
+        case ChunkGenerationStage::BIOME:    return "Biome";
+        case ChunkGenerationStage::DENSITY:  return "Density";
+        case ChunkGenerationStage::TERRAIN:  return "Terrain";
+        case ChunkGenerationStage::SURFACE:  return "Surface";
+        case ChunkGenerationStage::TREES:    return "Trees";
+        case ChunkGenerationStage::LIGHTING: return "Lighting";
+        default:                             return "Unknown";
+    }
+}
 
-    // --- Pass 1: compute surface & biome fields per (x,y) pillar ---
-    for (int y = 0; y < CHUNK_SIZE_Y; y++)
+//----------------------------------------------------------------------------------------------------
+double ChunkGenerationTimings::GetTerrainSeconds() const
+{
+    double terrainSeconds = 0.0;
+    for (int stageIndex = 0; stageIndex < (int)ChunkGenerationStage::LIGHTING; ++stageIndex)
     {
-        for (int x = 0; x < CHUNK_SIZE_X; x++)
-        {
-            int globalX = m_chunkCoords.x * CHUNK_SIZE_X + x;
-            int globalY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+        terrainSeconds += m_stageSeconds[stageIndex];
+    }
+    return terrainSeconds;
+}
 
-            // Humidity calculation (0.5 + 0.5 * Perlin2D(...))
-            float humidity = 0.5f + 0.5f * Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->biomeNoise.humidityScale,
-                g_worldGenConfig->biomeNoise.humidityOctaves,
-                g_worldGenConfig->biomeNoise.humidityPersistence,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize
-                humiditySeed
-            );
+//----------------------------------------------------------------------------------------------------
+// GetStageConfigSections - WORLDGEN_SECTION_* groups a stage reads directly (not through earlier stages)
+//----------------------------------------------------------------------------------------------------
+uint32_t GetStageConfigSections(ChunkGenerationStage const stage)
+{
+    switch (stage)
+    {
+        case ChunkGenerationStage::BIOME:   return WORLDGEN_SECTION_BIOME_NOISE;
+        case ChunkGenerationStage::DENSITY: return WORLDGEN_SECTION_DENSITY | WORLDGEN_SECTION_CARVERS;
+        case ChunkGenerationStage::TERRAIN: return WORLDGEN_SECTION_DENSITY | WORLDGEN_SECTION_CURVES | WORLDGEN_SECTION_CAVES;
+        case ChunkGenerationStage::TREES:   return WORLDGEN_SECTION_TREES;
+        default:                            return 0;                                   // SURFACE and LIGHTING use constants only
+    }
+}
 
-            // Temperature calculation (raw noise + Perlin)
-            float temperature = Get2dNoiseNegOneToOne(globalX, globalY, temperatureSeed) * TEMPERATURE_RAW_NOISE_SCALE;
-            temperature       = temperature + 0.5f + 0.5f * Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->biomeNoise.temperatureScale,
-                g_worldGenConfig->biomeNoise.temperatureOctaves,
-                g_worldGenConfig->biomeNoise.temperaturePersistence,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize
-                temperatureSeed
-            );
+//----------------------------------------------------------------------------------------------------
+ChunkGenerationStage GetFirstAffectedStage(uint32_t const changedSections)
+{
+    for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+    {
+        if ((GetStageConfigSections((ChunkGenerationStage)stageIndex) & changedSections) != 0)
+        {
+            return (ChunkGenerationStage)stageIndex;
+        }
+    }
+    return ChunkGenerationStage::COUNT;
+}
 
-            // Assignment 4: Biome noise sampling (Phase 1, Task 1.3)
-            // Sample 4 additional noise layers for biome determination
+//----------------------------------------------------------------------------------------------------
+ChunkGenerationSettings Chunk::GetDefaultGenerationSettings()
+{
+    ChunkGenerationSettings settings;
+    settings.m_densityLatticeStepXY    = g_worldGenConfig->density.densityLatticeStepXY;
+    settings.m_densityLatticeStepZ     = g_worldGenConfig->density.densityLatticeStepZ;
+    settings.m_useColumnSurfaceProfile = true;
+    settings.m_retainSurfaceSnapshot   = g_worldGenConfig->pipeline.retainSurfaceSnapshots;
+    settings.m_retainIntermediates     = g_worldGenConfig->pipeline.retainStageIntermediates;
+
+    if (g_worldGenConfig->biomeNoise.useRegionCache && g_game != nullptr && g_game->GetWorld() != nullptr)
+    {
+        settings.m_biomeRegionCache = &g_game->GetWorld()->GetBiomeRegionCache();
+    }
 
-            // Continentalness - Ocean to inland distance (C: [-1.2, 1.0])
-            float continentalness = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->biomeNoise.continentalnessScale,
-                g_worldGenConfig->biomeNoise.continentalnessOctaves,
-                g_worldGenConfig->biomeNoise.continentalnessPersistence,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to [-1, 1]
-                continentalnessSeed
-            );
+    return settings;
+}
 
-            // Erosion - Flat to mountainous (E: [-1, 1])
-            float erosion = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->biomeNoise.erosionScale,
-                g_worldGenConfig->biomeNoise.erosionOctaves,
-                g_worldGenConfig->biomeNoise.erosionPersistence,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to [-1, 1]
-                erosionSeed
-            );
+//----------------------------------------------------------------------------------------------------
+void Chunk::GenerateTerrain()
+{
+    BeginGeneration(GetDefaultGenerationSettings());
+    RunGenerationStages(ChunkGenerationStage::LIGHTING);
+}
 
-            // Weirdness - Terrain variation (W: [-1, 1])
-            float weirdness = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->biomeNoise.weirdnessScale,
-                g_worldGenConfig->biomeNoise.weirdnessOctaves,
-                g_worldGenConfig->biomeNoise.weirdnessPersistence,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to [-1, 1]
-                weirdnessSeed
-            );
+//----------------------------------------------------------------------------------------------------
+void Chunk::GenerateTerrain(int const         densityLatticeStepXY,
+                            int const         densityLatticeStepZ,
+                            bool const        useColumnSurfaceProfile,
+                            BiomeRegionCache* biomeRegionCache)
+{
+    ChunkGenerationSettings settings;
+    settings.m_densityLatticeStepXY    = densityLatticeStepXY;
+    settings.m_densityLatticeStepZ     = densityLatticeStepZ;
+    settings.m_useColumnSurfaceProfile = useColumnSurfaceProfile;
+    settings.m_biomeRegionCache        = biomeRegionCache;
+
+    BeginGeneration(settings);
+    RunGenerationStages(ChunkGenerationStage::LIGHTING);
+}
 
-            // Peaks & Valleys - Calculated from Weirdness (PV: [-1, 1])
-            // Formula: PV = 1 - |(3 * abs(W)) - 2|
-            float peaksValleys = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
+//----------------------------------------------------------------------------------------------------
+// BeginGeneration - Start a fresh run at BIOME (on the thread that will run the stages)
+//
+// The debug visualization mode is read once here, so every stage of the run agrees on it.
+//----------------------------------------------------------------------------------------------------
+void Chunk::BeginGeneration(ChunkGenerationSettings const& settings)
+{
+    m_generationContext             = std::make_unique<ChunkGenerationContext>();
+    m_generationContext->m_settings = settings;
+    m_generationTimings             = ChunkGenerationTimings();
+    m_nextGenerationStage           = ChunkGenerationStage::BIOME;
 
-            // Hilliness calculation
-            float rawHill = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                HILLINESS_NOISE_SCALE,
-                HILLINESS_NOISE_OCTAVES,
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize
-                hillSeed
-            );
-            float hill = SmoothStep3(RangeMap(rawHill, -1.f, 1.f, 0.f, 1.f));
+    // Phase 0, Task 0.4: Check for debug visualization mode
+    if (g_game && g_game->GetWorld())
+    {
+        m_generationContext->m_vizMode = g_game->GetWorld()->GetDebugVisualizationMode();
+    }
+}
 
-            // Ocean calculation
-            float ocean = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                OCEANESS_NOISE_SCALE,
-                OCEANESS_NOISE_OCTAVES,
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize
-                oceanSeed
-            );
+//----------------------------------------------------------------------------------------------------
+// RunGenerationStages - Run every stage from GetNextGenerationStage() through lastStage, timing each
+//
+// Stages before TREES need the context from BeginGeneration(); TREES and LIGHTING only need the chunk, so
+// a restage from TREES (see PrepareRestage) runs without one, probing neighbors with the default settings. The context is released after LIGHTING.
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunGenerationStages(ChunkGenerationStage const lastStage)
+{
+    using GenerationClock = std::chrono::high_resolution_clock;
 
-            // Terrain height calculation
-            float rawTerrain = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                TERRAIN_NOISE_SCALE,
-                TERRAIN_NOISE_OCTAVES,
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize
-                terrainSeed
-            );
+    for (int stageIndex = (int)m_nextGenerationStage; stageIndex <= (int)lastStage; ++stageIndex)
+    {
+        ChunkGenerationStage const stage = (ChunkGenerationStage)stageIndex;
+        GUARANTEE_OR_DIE(stage >= ChunkGenerationStage::TREES || m_generationContext != nullptr,
+                         "Chunk::RunGenerationStages: stage needs a context from BeginGeneration()");
 
-            // Base terrain height with river/hill shaping
-            float terrainHeightF = DEFAULT_TERRAIN_HEIGHT + hill * RangeMap(fabsf(rawTerrain), 0.f, 1.f, -RIVER_DEPTH, DEFAULT_TERRAIN_HEIGHT);
+        GenerationClock::time_point const stageStart = GenerationClock::now();
 
-            // Ocean depressions
-            if (ocean > OCEAN_START_THRESHOLD)
+        if (m_generationContext != nullptr && m_generationContext->m_vizMode != DebugVisualizationMode::NORMAL_TERRAIN)
+        {
+            // Flat noise preview instead of terrain: BIOME writes it and the other stages (lighting included) skip
+            if (stage == ChunkGenerationStage::BIOME)
             {
-                float oceanBlend = RangeMapClamped(ocean, OCEAN_START_THRESHOLD, OCEAN_END_THRESHOLD, 0.f, 1.f);
-                terrainHeightF   = terrainHeightF - Interpolate(0.f, OCEAN_DEPTH, oceanBlend);
+                GenerateDebugVisualizationTerrain(m_generationContext->m_vizMode);
+            }
+        }
+        else
+        {
+            switch (stage)
+            {
+                case ChunkGenerationStage::BIOME:    RunBiomeStage(*m_generationContext);   break;
+                case ChunkGenerationStage::DENSITY:  RunDensityStage(*m_generationContext); break;
+                case ChunkGenerationStage::TERRAIN:  RunTerrainStage(*m_generationContext); break;
+                case ChunkGenerationStage::SURFACE:  RunSurfaceStage(*m_generationContext); break;
+                case ChunkGenerationStage::TREES:
+                    // Tree probes of neighbor columns regenerate them with this run's settings
+                    RunTreeStage(m_generationContext != nullptr ? m_generationContext->m_settings : GetDefaultGenerationSettings());
+                    break;
+                case ChunkGenerationStage::LIGHTING: RunLightingStage();                    break;
+                default:                                                                    break;
             }
-
-            // Dirt layer thickness driven by noise
-            float dirtDepthPct = Get2dNoiseZeroToOne(globalX, globalY, dirtSeed);
-            int   dirtDepth    = MIN_DIRT_OFFSET_Z + (int)roundf(dirtDepthPct * (float)(MAX_DIRT_OFFSET_Z - MIN_DIRT_OFFSET_Z));
-
-            int idxXY               = y * CHUNK_SIZE_X + x;
-            humidityMapXY[idxXY]    = humidity;
-            temperatureMapXY[idxXY] = temperature;
-            heightMapXY[idxXY]      = (int)floorf(terrainHeightF);
-            dirtDepthXY[idxXY]      = dirtDepth;
-
-            // Assignment 4: Store biome data for this column (Phase 1, Task 1.3)
-            // Note: Temperature and Humidity ranges need adjustment from [0,1] to [-1,1]
-            // Current calculation produces [0,1], but biome selection expects [-1,1]
-            float temperatureNormalized = RangeMap(temperature, 0.f, 1.f, -1.f, 1.f);
-            float humidityNormalized    = RangeMap(humidity, 0.f, 1.f, -1.f, 1.f);
-
-            // Select biome type using lookup table approach
-            BiomeType biomeType = SelectBiome(temperatureNormalized, humidityNormalized,
-                                             continentalness, erosion, peaksValleys);
-
-            // Store all biome data
-            m_biomeData[idxXY].temperature     = temperatureNormalized;
-            m_biomeData[idxXY].humidity        = humidityNormalized;
-            m_biomeData[idxXY].continentalness = continentalness;
-            m_biomeData[idxXY].erosion         = erosion;
-            m_biomeData[idxXY].weirdness       = weirdness;
-            m_biomeData[idxXY].peaksValleys    = peaksValleys;
-            m_biomeData[idxXY].biomeType       = biomeType;
         }
-    }
 
-    // --- Pass 2: assign block types for every (x,y,z) using 3D density formula ---
-    // Assignment 4: Phase 2, Task 2.1 - Replace heightmap with 3D density terrain
-    // Formula: D(x,y,z) = N(x,y,z,s) + B(z)
-    // where N = 3D Perlin noise, B = vertical bias
-    // CRITICAL: Negative density = MORE dense (solid blocks), positive = air
+        m_generationTimings.m_stageSeconds[stageIndex] = std::chrono::duration<double>(GenerationClock::now() - stageStart).count();
+    }
 
-    for (int z = 0; z < CHUNK_SIZE_Z; z++)
+    if (lastStage == ChunkGenerationStage::LIGHTING)
     {
-        for (int y = 0; y < CHUNK_SIZE_Y; y++)
+        // Debug visualization runs skip the noise stages, so they have nothing worth keeping
+        if (m_generationContext != nullptr && m_generationContext->m_settings.m_retainIntermediates &&
+            m_generationContext->m_vizMode == DebugVisualizationMode::NORMAL_TERRAIN)
+        {
+            m_generationContext->m_settings.m_biomeRegionCache = nullptr;
+        }
+        else
+        {
+            m_generationContext.reset();
+        }
+        m_nextGenerationStage = ChunkGenerationStage::BIOME;
+    }
+    else if (lastStage >= m_nextGenerationStage)
+    {
+        m_nextGenerationStage = (ChunkGenerationStage)((int)lastStage + 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Chunk::CanRestageFrom(ChunkGenerationStage const stage) const
+{
+    switch (stage)
+    {
+        case ChunkGenerationStage::BIOME:    return true;                               // Full regeneration needs nothing retained
+        case ChunkGenerationStage::DENSITY:  return m_generationContext != nullptr;     // Retained BIOME outputs
+        case ChunkGenerationStage::TREES:    return !m_surfaceSnapshot.empty();
+        case ChunkGenerationStage::LIGHTING: return true;                               // Relights the current blocks
+        default:                             return false;                              // Density volume is not retained
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// PrepareRestage - Rewind a COMPLETE chunk so the next run starts at firstStage
+//
+// Called on the main thread before the chunk goes back to a worker. From TREES the blocks return to the
+// post-SURFACE snapshot, which drops every tree (this chunk's and its neighbors') and every player edit,
+// the same way Regenerate Chunks does. A BIOME restage still needs BeginGeneration() on the worker.
+// Later restages keep the retained context with fresh settings, so they pick up the current config.
+//----------------------------------------------------------------------------------------------------
+void Chunk::PrepareRestage(ChunkGenerationStage const firstStage)
+{
+    GUARANTEE_OR_DIE(CanRestageFrom(firstStage), "Chunk::PrepareRestage: no retained data to restart at this stage");
+
+    EnsureBlocksUnpacked();
+
+    if (firstStage == ChunkGenerationStage::TREES)
+    {
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+        {
+            int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+            m_surfaceSnapshot[sectionIndex].Unpack(m_blockTypeIndices + sectionBase, m_blockLightingData + sectionBase, m_blockBitFlags + sectionBase);
+        }
+        std::copy(m_surfaceSnapshotHeights.begin(), m_surfaceSnapshotHeights.end(), m_surfaceHeight);
+    }
+    else if (firstStage <= ChunkGenerationStage::TERRAIN)
+    {
+        // As after construction: TERRAIN writes block types only
+        memset(m_blockLightingData, 0, BLOCKS_PER_CHUNK);
+        memset(m_blockBitFlags, 0, BLOCKS_PER_CHUNK);
+    }
+
+    for (int stageIndex = (int)firstStage; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+    {
+        m_generationTimings.m_stageSeconds[stageIndex] = 0.0;
+    }
+
+    if (firstStage == ChunkGenerationStage::BIOME)
+    {
+        m_generationContext.reset();
+    }
+    else if (m_generationContext != nullptr)
+    {
+        m_generationContext->m_settings = GetDefaultGenerationSettings();
+    }
+    m_nextGenerationStage = firstStage;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t Chunk::GetSurfaceSnapshotBytes() const
+{
+    size_t residentBytes = m_surfaceSnapshotHeights.size() * sizeof(int);
+    for (PalettedBlockSection const& section : m_surfaceSnapshot)
+    {
+        residentBytes += section.GetResidentBytes();
+    }
+    return residentBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t Chunk::GetRetainedIntermediateBytes() const
+{
+    if (m_generationContext == nullptr)
+    {
+        return 0;
+    }
+    return sizeof(ChunkGenerationContext) + m_generationContext->m_densityLattice.capacity() * sizeof(float);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Phase 0, Task 0.4: Debug visualization terrain, written in place of every generation stage
+//----------------------------------------------------------------------------------------------------
+void Chunk::GenerateDebugVisualizationTerrain(DebugVisualizationMode const vizMode)
+{
+    // Generate debug visualization terrain
+    // Create a flat layer at Y=80 (sea level) showing the selected noise layer as colored blocks
+
+    // Derive seed for the noise layer being visualized
+    unsigned int visualizationSeed = GAME_SEED;
+    switch (vizMode)
+    {
+        case DebugVisualizationMode::TEMPERATURE:    visualizationSeed = GAME_SEED + 2; break;
+        case DebugVisualizationMode::HUMIDITY:       visualizationSeed = GAME_SEED + 1; break;
+        case DebugVisualizationMode::CONTINENTALNESS: visualizationSeed = GAME_SEED + 5; break;
+        case DebugVisualizationMode::EROSION:        visualizationSeed = GAME_SEED + 6; break;
+        case DebugVisualizationMode::WEIRDNESS:      visualizationSeed = GAME_SEED + 7; break;
+        case DebugVisualizationMode::PEAKS_VALLEYS:  visualizationSeed = GAME_SEED + 8; break;
+        case DebugVisualizationMode::BIOME_TYPE:     visualizationSeed = GAME_SEED + 9; break;  // Phase 1, Task 1.4
+        default: break;
+    }
+
+    // Fill blocks with visualization data
+    for (int y = 0; y < CHUNK_SIZE_Y; y++)
+    {
+        for (int x = 0; x < CHUNK_SIZE_X; x++)
+        {
+            int globalX = m_chunkCoords.x * CHUNK_SIZE_X + x;
+            int globalY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+
+            // Sample the appropriate noise layer based on visualization mode
+            float noiseValue = 0.f;
+            switch (vizMode)
+            {
+                case DebugVisualizationMode::TEMPERATURE:
+                {
+                    float rawTemp = Get2dNoiseNegOneToOne(globalX, globalY, visualizationSeed) * TEMPERATURE_RAW_NOISE_SCALE;
+                    noiseValue = rawTemp + 0.5f + 0.5f * Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.temperatureScale,
+                        g_worldGenConfig->biomeNoise.temperatureOctaves,
+                        g_worldGenConfig->biomeNoise.temperaturePersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    // Remap from [0,1] to [-1,1]
+                    noiseValue = (noiseValue * 2.f) - 1.f;
+                    break;
+                }
+
+                case DebugVisualizationMode::HUMIDITY:
+                    noiseValue = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.humidityScale,
+                        g_worldGenConfig->biomeNoise.humidityOctaves,
+                        g_worldGenConfig->biomeNoise.humidityPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    break;
+
+                case DebugVisualizationMode::CONTINENTALNESS:
+                    noiseValue = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.continentalnessScale,
+                        g_worldGenConfig->biomeNoise.continentalnessOctaves,
+                        g_worldGenConfig->biomeNoise.continentalnessPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    break;
+
+                case DebugVisualizationMode::EROSION:
+                    noiseValue = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.erosionScale,
+                        g_worldGenConfig->biomeNoise.erosionOctaves,
+                        g_worldGenConfig->biomeNoise.erosionPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    break;
+
+                case DebugVisualizationMode::WEIRDNESS:
+                    noiseValue = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.weirdnessScale,
+                        g_worldGenConfig->biomeNoise.weirdnessOctaves,
+                        g_worldGenConfig->biomeNoise.weirdnessPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    break;
+
+                case DebugVisualizationMode::PEAKS_VALLEYS:
+                {
+                    // PV is derived from weirdness: PV = 1 - |( 3 * abs(W) ) - 2|
+                    float weirdness = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.weirdnessScale,
+                        g_worldGenConfig->biomeNoise.weirdnessOctaves,
+                        g_worldGenConfig->biomeNoise.weirdnessPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        visualizationSeed
+                    );
+                    noiseValue = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
+                    break;
+                }
+
+                case DebugVisualizationMode::BIOME_TYPE:
+                {
+                    // Phase 1, Task 1.4: Sample all 6 biome noise layers and determine biome type
+                    // CRITICAL FIX: Use the SAME seeds as normal terrain generation (lines 599-610)
+                    // Otherwise visualization shows different biomes than actual terrain!
+
+                    // Derive seeds matching normal terrain generation
+                    unsigned int humiditySeed = GAME_SEED + 1;
+                    unsigned int temperatureSeed = GAME_SEED + 2;
+                    unsigned int continentalnessSeed = GAME_SEED + 6;
+                    unsigned int erosionSeed = GAME_SEED + 7;
+                    unsigned int weirdnessSeed = GAME_SEED + 8;
+
+                    // Sample Temperature (matches Pass 1 lines 638-647)
+                    float rawTemp = Get2dNoiseNegOneToOne(globalX, globalY, temperatureSeed) * TEMPERATURE_RAW_NOISE_SCALE;
+                    float temperature = rawTemp + 0.5f + 0.5f * Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.temperatureScale,
+                        g_worldGenConfig->biomeNoise.temperatureOctaves,
+                        g_worldGenConfig->biomeNoise.temperaturePersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        temperatureSeed
+                    );
+                    // Normalize temperature from [0,1] to [-1,1] for biome selection
+                    float temperatureNormalized = RangeMap(temperature, 0.f, 1.f, -1.f, 1.f);
+
+                    // Sample Humidity (matches Pass 1 lines 627-635)
+                    float humidity = 0.5f + 0.5f * Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.humidityScale,
+                        g_worldGenConfig->biomeNoise.humidityOctaves,
+                        g_worldGenConfig->biomeNoise.humidityPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        humiditySeed
+                    );
+                    // Normalize humidity from [0,1] to [-1,1] for biome selection
+                    float humidityNormalized = RangeMap(humidity, 0.f, 1.f, -1.f, 1.f);
+
+                    // Sample Continentalness (matches Pass 1 lines 653-661)
+                    float continentalness = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.continentalnessScale,
+                        g_worldGenConfig->biomeNoise.continentalnessOctaves,
+                        g_worldGenConfig->biomeNoise.continentalnessPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        continentalnessSeed
+                    );
+
+                    // Sample Erosion (matches Pass 1 lines 664-672)
+                    float erosion = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.erosionScale,
+                        g_worldGenConfig->biomeNoise.erosionOctaves,
+                        g_worldGenConfig->biomeNoise.erosionPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        erosionSeed
+                    );
+
+                    // Sample Weirdness (matches Pass 1 lines 675-683)
+                    float weirdness = Compute2dPerlinNoise(
+                        (float)globalX, (float)globalY,
+                        g_worldGenConfig->biomeNoise.weirdnessScale,
+                        g_worldGenConfig->biomeNoise.weirdnessOctaves,
+                        g_worldGenConfig->biomeNoise.weirdnessPersistence,
+                        DEFAULT_NOISE_OCTAVE_SCALE,
+                        true,
+                        weirdnessSeed
+                    );
+
+                    // Calculate Peaks & Valleys from Weirdness (matches Pass 1 line 687)
+                    float peaksValleys = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
+
+                    // Determine biome type using lookup table (from Task 1.3)
+                    BiomeType biome = SelectBiome(temperatureNormalized, humidityNormalized,
+                                                   continentalness, erosion, peaksValleys);
+
+                    // DEBUG: Log detailed biome noise values for investigation
+                    if (globalX % 16 == 0 && globalY % 16 == 0)  // Log every 16th position to reduce spam
+                    {
+                        const char* biomeName = "UNKNOWN";
+                        switch (biome) {
+                            case BiomeType::OCEAN: biomeName = "OCEAN"; break;
+                            case BiomeType::DEEP_OCEAN: biomeName = "DEEP_OCEAN"; break;
+                            case BiomeType::FROZEN_OCEAN: biomeName = "FROZEN_OCEAN"; break;
+                            case BiomeType::BEACH: biomeName = "BEACH"; break;
+                            case BiomeType::SNOWY_BEACH: biomeName = "SNOWY_BEACH"; break;
+                            case BiomeType::DESERT: biomeName = "DESERT"; break;
+                            case BiomeType::SAVANNA: biomeName = "SAVANNA"; break;
+                            case BiomeType::PLAINS: biomeName = "PLAINS"; break;
+                            case BiomeType::SNOWY_PLAINS: biomeName = "SNOWY_PLAINS"; break;
+                            case BiomeType::FOREST: biomeName = "FOREST"; break;
+                            case BiomeType::JUNGLE: biomeName = "JUNGLE"; break;
+                            case BiomeType::TAIGA: biomeName = "TAIGA"; break;
+                            case BiomeType::SNOWY_TAIGA: biomeName = "SNOWY_TAIGA"; break;
+                            case BiomeType::STONY_PEAKS: biomeName = "STONY_PEAKS"; break;
+                            case BiomeType::SNOWY_PEAKS: biomeName = "SNOWY_PEAKS"; break;
+                        }
+
+
+                    }
+
+                    // Cast biome enum to float for color mapping
+                    noiseValue = static_cast<float>(static_cast<int>(biome));
+                    break;
+                }
+
+                default: break;
+            }
+
+            // Get the appropriate colored block for this noise value
+            uint8_t visualizationBlock = GetDebugVisualizationBlock(noiseValue, vizMode);
+
+            // Create a flat visualization surface at Y=80 (sea level)
+            // Phase 0, Task 0.5: Updated to match new sea level (was Y=64 for 128-block chunks)
+            constexpr int VISUALIZATION_HEIGHT = 80;
+
+            // BUGFIX: Use direct array assignment instead of SetBlock() to avoid triggering saves
+            // Debug visualization is temporary and should NOT mark chunks as needing save
+            // Fill bottom with stone (foundation)
+            for (int z = 0; z < VISUALIZATION_HEIGHT; z++)
+            {
+                int blockIdx = LocalCoordsToIndex(x, y, z);
+                m_blockTypeIndices[blockIdx] = BLOCK_STONE;
+            }
+
+            // Place the visualization block on top
+            int topBlockIdx = LocalCoordsToIndex(x, y, VISUALIZATION_HEIGHT);
+            m_blockTypeIndices[topBlockIdx] = visualizationBlock;
+
+            // Leave everything above as air
+            for (int z = VISUALIZATION_HEIGHT + 1; z < CHUNK_SIZE_Z; z++)
+            {
+                int blockIdx = LocalCoordsToIndex(x, y, z);
+                m_blockTypeIndices[blockIdx] = BLOCK_AIR;
+            }
+        }
+    }
+
+    // Mark chunk as needing mesh rebuild (but NOT save - debug visualization is temporary)
+    // BUGFIX: Debug visualization is NOT a player modification, so don't save to disk
+    // Saving debug visualization would write temporary colored blocks to .chunk files
+    SetIsMeshDirty(true);
+    // NOTE: Do NOT call SetNeedsSaving(true) - debug viz is temporary and shouldn't persist
+}
+
+//----------------------------------------------------------------------------------------------------
+// BIOME stage - Climate layers, biome selection and per-column temperature (Pass 1)
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunBiomeStage(ChunkGenerationContext& context)
+{
+    // Derive deterministic seeds for each noise channel
+    // Humidity (GAME_SEED + 1) and the biome layers (+6..+8) are seeded in BiomeRegionCache.cpp
+    unsigned int terrainSeed     = GAME_SEED;
+    unsigned int temperatureSeed = GAME_SEED + 2;
+    unsigned int hillSeed        = temperatureSeed + 1;
+    unsigned int oceanSeed       = hillSeed + 1;
+    unsigned int dirtSeed        = oceanSeed + 1;
+
+    // Allocate per-(x,y) maps
+    int   heightMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    int   dirtDepthXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float humidityMapXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+
+    // Perlin layers for every column, evaluated a whole 32x32 grid at a time (see BatchNoise.hpp)
+    int const chunkMinX = m_chunkCoords.x * CHUNK_SIZE_X;
+    int const chunkMinY = m_chunkCoords.y * CHUNK_SIZE_Y;
+    float     rawHillXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float     oceanXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    float     rawTerrainXY[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+
+    // Climate layers (T/H/C/E/W): upsampled from the shared region samples when a cache is given
+    BiomeClimateColumns climate;
+    if (context.m_settings.m_biomeRegionCache != nullptr)
+    {
+        context.m_settings.m_biomeRegionCache->SampleChunk(m_chunkCoords, g_worldGenConfig->biomeNoise.regionSampleStep, climate);
+    }
+    else
+    {
+        ComputeBiomeClimateColumns(m_chunkCoords, climate);
+    }
+
+    ComputeBatch2dPerlinNoise(rawHillXY, chunkMinX, chunkMinY, CHUNK_SIZE_X, CHUNK_SIZE_Y, 1,
+                              HILLINESS_NOISE_SCALE, HILLINESS_NOISE_OCTAVES, DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, hillSeed);
+    ComputeBatch2dPerlinNoise(oceanXY, chunkMinX, chunkMinY, CHUNK_SIZE_X, CHUNK_SIZE_Y, 1,
+                              OCEANESS_NOISE_SCALE, OCEANESS_NOISE_OCTAVES, DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, oceanSeed);
+    ComputeBatch2dPerlinNoise(rawTerrainXY, chunkMinX, chunkMinY, CHUNK_SIZE_X, CHUNK_SIZE_Y, 1,
+                              TERRAIN_NOISE_SCALE, TERRAIN_NOISE_OCTAVES, DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE, true, terrainSeed);
+
+    // --- Pass 1: compute surface & biome fields per (x,y) pillar ---
+    for (int y = 0; y < CHUNK_SIZE_Y; y++)
+    {
+        for (int x = 0; x < CHUNK_SIZE_X; x++)
+        {
+            int globalX = m_chunkCoords.x * CHUNK_SIZE_X + x;
+            int globalY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+            int idxXY   = y * CHUNK_SIZE_X + x;
+
+            // Humidity calculation (0.5 + 0.5 * Perlin2D(...))
+            float humidity = 0.5f + 0.5f * climate.m_humidityNoise[idxXY];
+
+            // Temperature calculation (raw noise + Perlin)
+            float temperature = Get2dNoiseNegOneToOne(globalX, globalY, temperatureSeed) * TEMPERATURE_RAW_NOISE_SCALE;
+            temperature       = temperature + 0.5f + 0.5f * climate.m_temperatureNoise[idxXY];
+
+            // Assignment 4: Biome noise sampling (Phase 1, Task 1.3)
+            // Sample 4 additional noise layers for biome determination
+
+            // Continentalness - Ocean to inland distance (C: [-1.2, 1.0])
+            float continentalness = climate.m_continentalness[idxXY];
+
+            // Erosion - Flat to mountainous (E: [-1, 1])
+            float erosion = climate.m_erosion[idxXY];
+
+            // Weirdness - Terrain variation (W: [-1, 1])
+            float weirdness = climate.m_weirdness[idxXY];
+
+            // Peaks & Valleys - Calculated from Weirdness (PV: [-1, 1])
+            // Formula: PV = 1 - |(3 * abs(W)) - 2|
+            float peaksValleys = 1.f - fabsf((3.f * fabsf(weirdness)) - 2.f);
+
+            // Hilliness calculation
+            float rawHill = rawHillXY[idxXY];
+            float hill = SmoothStep3(RangeMap(rawHill, -1.f, 1.f, 0.f, 1.f));
+
+            // Ocean calculation
+            float ocean = oceanXY[idxXY];
+
+            // Terrain height calculation
+            float rawTerrain = rawTerrainXY[idxXY];
+
+            // Base terrain height with river/hill shaping
+            float terrainHeightF = DEFAULT_TERRAIN_HEIGHT + hill * RangeMap(fabsf(rawTerrain), 0.f, 1.f, -RIVER_DEPTH, DEFAULT_TERRAIN_HEIGHT);
+
+            // Ocean depressions
+            if (ocean > OCEAN_START_THRESHOLD)
+            {
+                float oceanBlend = RangeMapClamped(ocean, OCEAN_START_THRESHOLD, OCEAN_END_THRESHOLD, 0.f, 1.f);
+                terrainHeightF   = terrainHeightF - Interpolate(0.f, OCEAN_DEPTH, oceanBlend);
+            }
+
+            // Dirt layer thickness driven by noise
+            float dirtDepthPct = Get2dNoiseZeroToOne(globalX, globalY, dirtSeed);
+            int   dirtDepth    = MIN_DIRT_OFFSET_Z + (int)roundf(dirtDepthPct * (float)(MAX_DIRT_OFFSET_Z - MIN_DIRT_OFFSET_Z));
+
+            humidityMapXY[idxXY]    = humidity;
+            context.m_temperatureMapXY[idxXY] = temperature;
+            heightMapXY[idxXY]      = (int)floorf(terrainHeightF);
+            dirtDepthXY[idxXY]      = dirtDepth;
+
+            // Assignment 4: Store biome data for this column (Phase 1, Task 1.3)
+            // Note: Temperature and Humidity ranges need adjustment from [0,1] to [-1,1]
+            // Current calculation produces [0,1], but biome selection expects [-1,1]
+            float temperatureNormalized = RangeMap(temperature, 0.f, 1.f, -1.f, 1.f);
+            float humidityNormalized    = RangeMap(humidity, 0.f, 1.f, -1.f, 1.f);
+
+            // Select biome type using lookup table approach
+            BiomeType biomeType = SelectBiome(temperatureNormalized, humidityNormalized,
+                                             continentalness, erosion, peaksValleys);
+
+            // Store all biome data
+            m_biomeData[idxXY].temperature     = temperatureNormalized;
+            m_biomeData[idxXY].humidity        = humidityNormalized;
+            m_biomeData[idxXY].continentalness = continentalness;
+            m_biomeData[idxXY].erosion         = erosion;
+            m_biomeData[idxXY].weirdness       = weirdness;
+            m_biomeData[idxXY].peaksValleys    = peaksValleys;
+            m_biomeData[idxXY].biomeType       = biomeType;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// DENSITY stage - Density noise volume, column surface profile and carver spans
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunDensityStage(ChunkGenerationContext& context)
+{
+    int const chunkMinX = m_chunkCoords.x * CHUNK_SIZE_X;
+    int const chunkMinY = m_chunkCoords.y * CHUNK_SIZE_Y;
+
+    // --- Density noise lattice ---
+    // N(x,y,z) is low frequency (scale 200), so sample it every stepXY x stepXY x stepZ blocks and
+    // interpolate trilinearly in Pass 2: ~2,700 noise calls per chunk instead of 262,144 at 4x4x8.
+    // Only the noise is interpolated; bias, slides and shaping curves stay exact per block.
+    // Steps of 1 take the exact per-block path.
+    unsigned int const densitySeed    = GAME_SEED + 10; // Separate seed for density noise
+    int const          latticeStepXY  = GetDensityLatticeStep(context.m_settings.m_densityLatticeStepXY, CHUNK_SIZE_X);
+    int const          latticeStepZ   = GetDensityLatticeStep(context.m_settings.m_densityLatticeStepZ, CHUNK_SIZE_Z);
+    bool const         useLattice     = (latticeStepXY > 1 || latticeStepZ > 1);
+    int const          latticeCountXY = CHUNK_SIZE_X / latticeStepXY + 1;
+    int const          latticeCountZ  = CHUNK_SIZE_Z / latticeStepZ + 1;
+    std::vector<float>& densityLattice = context.m_densityLattice;
+
+    // A restaged chunk keeps the lattice of its last run; it is still valid while the noise inputs match
+    bool const isLatticeRetained = useLattice && !densityLattice.empty() &&
+                                   context.m_densityLatticeScale   == g_worldGenConfig->density.densityNoiseScale &&
+                                   context.m_densityLatticeOctaves == g_worldGenConfig->density.densityNoiseOctaves &&
+                                   context.m_densityLatticeStepXY  == latticeStepXY &&
+                                   context.m_densityLatticeStepZ   == latticeStepZ;
+
+    if (!useLattice)
+    {
+        densityLattice.clear();
+    }
+    else if (!isLatticeRetained)
+    {
+        context.m_densityLatticeScale   = g_worldGenConfig->density.densityNoiseScale;
+        context.m_densityLatticeOctaves = g_worldGenConfig->density.densityNoiseOctaves;
+        context.m_densityLatticeStepXY  = latticeStepXY;
+        context.m_densityLatticeStepZ   = latticeStepZ;
+        densityLattice.resize((size_t)latticeCountXY * latticeCountXY * latticeCountZ);
+        ComputeBatch3dPerlinNoise(densityLattice.data(), chunkMinX, chunkMinY, 0, latticeCountXY, latticeCountXY, latticeCountZ,
+                                  latticeStepXY, latticeStepZ, g_worldGenConfig->density.densityNoiseScale,
+                                  g_worldGenConfig->density.densityNoiseOctaves, DEFAULT_OCTAVE_PERSISTANCE,
+                                  DEFAULT_NOISE_OCTAVE_SCALE, true, densitySeed);
+    }
+
+    // --- Density noise volume ---
+    // N(x,y,z) for every block, read by Pass 2 and by the column surface profile below
+    // CRITICAL: Use global coordinates for cross-chunk consistency
+    // Exact: one batch over every block (LocalCoordsToIndex order is x fastest, then y, then z)
+    std::vector<float>& densityNoise = context.m_densityNoise;
+    densityNoise.resize(BLOCKS_PER_CHUNK);
+
+    if (!useLattice)
+    {
+        ComputeBatch3dPerlinNoise(densityNoise.data(), chunkMinX, chunkMinY, 0, CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z, 1, 1,
+                                  g_worldGenConfig->density.densityNoiseScale,           // Scale: 200.0 (lower freq = smoother terrain)
+                                  g_worldGenConfig->density.densityNoiseOctaves,         // Octaves: 3 (adds fractal detail)
+                                  DEFAULT_OCTAVE_PERSISTANCE,    // Persistence: 0.5 (amplitude falloff)
+                                  DEFAULT_NOISE_OCTAVE_SCALE,    // Octave scale: 2.0 (frequency multiplier)
+                                  true,                          // Renormalize to [-1, 1]
+                                  densitySeed);
+    }
+    else
+    {
+        for (int z = 0; z < CHUNK_SIZE_Z; z++)
+        {
+            for (int y = 0; y < CHUNK_SIZE_Y; y++)
+            {
+                for (int x = 0; x < CHUNK_SIZE_X; x++)
+                {
+                    if (!context.IsColumnGenerated(x + y * CHUNK_SIZE_X)) continue;
+
+                    // Trilinear interpolation between the 8 lattice samples around this block
+                    int const   cellX = x / latticeStepXY;
+                    int const   cellY = y / latticeStepXY;
+                    int const   cellZ = z / latticeStepZ;
+                    float const tx    = (float)(x - cellX * latticeStepXY) / (float)latticeStepXY;
+                    float const ty    = (float)(y - cellY * latticeStepXY) / (float)latticeStepXY;
+                    float const tz    = (float)(z - cellZ * latticeStepZ) / (float)latticeStepZ;
+
+                    float const* corner  = &densityLattice[cellX + latticeCountXY * (cellY + latticeCountXY * cellZ)];
+                    int const    strideY = latticeCountXY;
+                    int const    strideZ = latticeCountXY * latticeCountXY;
+
+                    float const bottom = Interpolate(Interpolate(corner[0], corner[1], tx),
+                                                     Interpolate(corner[strideY], corner[strideY + 1], tx), ty);
+                    float const top    = Interpolate(Interpolate(corner[strideZ], corner[strideZ + 1], tx),
+                                                     Interpolate(corner[strideZ + strideY], corner[strideZ + strideY + 1], tx), ty);
+                    densityNoise[LocalCoordsToIndex(x, y, z)] = Interpolate(bottom, top, tz);
+                }
+            }
+        }
+    }
+
+    // --- Column surface profile ---
+    // Cave carving must stay MIN_CAVE_DEPTH_FROM_SURFACE blocks below air, and surface replacement needs
+    // to know whether the block above is air. Both used to re-evaluate the density noise upward from every
+    // solid block (up to 6 noise calls each). One top-down sweep per column answers both from the noise
+    // volume: it carries the nearest air z seen so far, so each block's cave test is a subtraction.
+    // The two tests keep their original (different) density formulas, so results match the search exactly.
+    std::vector<uint8_t>& columnProfile = context.m_columnProfile;
+
+    if (context.m_settings.m_useColumnSurfaceProfile)
+    {
+        columnProfile.resize(BLOCKS_PER_CHUNK);
+
+        for (int y = 0; y < CHUNK_SIZE_Y; y++)
+        {
+            for (int x = 0; x < CHUNK_SIZE_X; x++)
+            {
+                if (!context.IsColumnGenerated(y * CHUNK_SIZE_X + x)) continue;
+
+                BiomeData const& biomeData = m_biomeData[y * CHUNK_SIZE_X + x];
+
+                float const continentalnessOffset = RangeMap(biomeData.continentalness, -1.2f, 1.0f,
+                                                             CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
+                float const erosionScale          = RangeMap(biomeData.erosion, -1.0f, 1.0f,
+                                                             EROSION_SCALE_MIN, EROSION_SCALE_MAX);
+                float const pvOffset              = RangeMap(biomeData.peaksValleys, -1.0f, 1.0f,
+                                                             PV_HEIGHT_MIN, PV_HEIGHT_MAX);
+                float const caveCheckHeight       = (float)DEFAULT_TERRAIN_HEIGHT + continentalnessOffset + pvOffset;
+                float const surfaceCheckHeight    = (float)DEFAULT_TERRAIN_HEIGHT + (continentalnessOffset + pvOffset);
+
+                int  nearestAirZ = CHUNK_SIZE_Z + MIN_CAVE_DEPTH_FROM_SURFACE;   // No air above the world top
+                bool isAirAbove  = false;
+
+                for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+                {
+                    int const   idx   = LocalCoordsToIndex(x, y, z);
+                    float const noise = densityNoise[idx];
+
+                    uint8_t flags = 0;
+                    if (nearestAirZ - z <= MIN_CAVE_DEPTH_FROM_SURFACE)
+                    {
+                        flags |= PROFILE_NEAR_SURFACE;
+                    }
+                    if (isAirAbove)
+                    {
+                        flags |= PROFILE_AIR_ABOVE;
+                    }
+                    columnProfile[idx] = flags;
+
+                    // This block as seen from below, by each test
+                    float const caveCheckDensity = (noise * erosionScale) + g_worldGenConfig->density.densityBiasPerBlock * ((float)z - caveCheckHeight);
+                    if (caveCheckDensity >= 0.0f)
+                    {
+                        nearestAirZ = z;
+                    }
+
+                    float topSlide = 0.0f;
+                    if (z >= g_worldGenConfig->density.topSlideStart && z <= g_worldGenConfig->density.topSlideEnd)
+                    {
+                        float slideProgress = (float)(z - g_worldGenConfig->density.topSlideStart) / (float)(g_worldGenConfig->density.topSlideEnd - g_worldGenConfig->density.topSlideStart);
+                        topSlide = SmoothStep3(slideProgress) * 2.0f;
+                    }
+
+                    float bottomSlide = 0.0f;
+                    if (z >= g_worldGenConfig->density.bottomSlideStart && z <= g_worldGenConfig->density.bottomSlideEnd)
+                    {
+                        float slideProgress = 1.0f - ((float)(z - g_worldGenConfig->density.bottomSlideStart) / (float)(g_worldGenConfig->density.bottomSlideEnd - g_worldGenConfig->density.bottomSlideStart));
+                        bottomSlide = -SmoothStep3(slideProgress) * 3.0f;
+                    }
+
+                    float const surfaceShapedBias = g_worldGenConfig->density.densityBiasPerBlock * (float)((float)z - surfaceCheckHeight);
+                    isAirAbove = ((noise * erosionScale) + surfaceShapedBias + topSlide + bottomSlide >= 0.0f);
+                }
+            }
+        }
+    }
+
+    // --- Ravine and river distance fields ---
+    // Assignment 4: Phase 5, Tasks 5A.1 / 5A.2 - carve spans per column, read by Pass 2
+    // Ravines: VERY RARE (threshold 0.85), deep vertical slices; rivers: more common (0.70), shallow water channels
+    CarverPathParams ravineParams;
+    ravineParams.m_pathSeed          = GAME_SEED + RAVINE_NOISE_SEED_OFFSET;
+    ravineParams.m_pathNoiseScale    = g_worldGenConfig->carvers.ravinePathNoiseScale;
+    ravineParams.m_pathNoiseOctaves  = g_worldGenConfig->carvers.ravinePathNoiseOctaves;
+    ravineParams.m_pathThreshold     = g_worldGenConfig->carvers.ravinePathThreshold;
+    ravineParams.m_widthNoiseScale   = g_worldGenConfig->carvers.ravineWidthNoiseScale;
+    ravineParams.m_widthNoiseOctaves = g_worldGenConfig->carvers.ravineWidthNoiseOctaves;
+    ravineParams.m_widthMin          = g_worldGenConfig->carvers.ravineWidthMin;
+    ravineParams.m_widthMax          = g_worldGenConfig->carvers.ravineWidthMax;
+    ravineParams.m_depthMin          = g_worldGenConfig->carvers.ravineDepthMin;
+    ravineParams.m_depthMax          = g_worldGenConfig->carvers.ravineDepthMax;
+    ravineParams.m_edgeFalloff       = g_worldGenConfig->carvers.ravineEdgeFalloff;
+    ravineParams.m_minBottomZ        = LAVA_Z + 1;          // Don't carve below lava
+
+    CarverPathParams riverParams;
+    riverParams.m_pathSeed          = GAME_SEED + RIVER_NOISE_SEED_OFFSET;
+    riverParams.m_pathNoiseScale    = g_worldGenConfig->carvers.riverPathNoiseScale;
+    riverParams.m_pathNoiseOctaves  = g_worldGenConfig->carvers.riverPathNoiseOctaves;
+    riverParams.m_pathThreshold     = g_worldGenConfig->carvers.riverPathThreshold;
+    riverParams.m_widthNoiseScale   = g_worldGenConfig->carvers.riverWidthNoiseScale;
+    riverParams.m_widthNoiseOctaves = g_worldGenConfig->carvers.riverWidthNoiseOctaves;
+    riverParams.m_widthMin          = g_worldGenConfig->carvers.riverWidthMin;
+    riverParams.m_widthMax          = g_worldGenConfig->carvers.riverWidthMax;
+    riverParams.m_depthMin          = g_worldGenConfig->carvers.riverDepthMin;
+    riverParams.m_depthMax          = g_worldGenConfig->carvers.riverDepthMax;
+    riverParams.m_edgeFalloff       = g_worldGenConfig->carvers.riverEdgeFalloff;
+    riverParams.m_minBottomZ        = SEA_LEVEL_Z - 5;      // Don't carve too far below sea level
+
+    // Spans read only the biome columns and the carver parameters, so a restage keeps them while those match
+    if (!context.m_hasCarverSpans || !(context.m_carverParams == g_worldGenConfig->carvers))
+    {
+        BuildCarverColumnSpans(m_chunkCoords, m_biomeData, ravineParams, context.m_ravineSpans);
+        BuildCarverColumnSpans(m_chunkCoords, m_biomeData, riverParams, context.m_riverSpans);
+        context.m_carverParams   = g_worldGenConfig->carvers;
+        context.m_hasCarverSpans = true;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// TERRAIN stage - Block types from density, caves and carvers (Pass 2)
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunTerrainStage(ChunkGenerationContext& context)
+{
+    // Intermediates of the BIOME and DENSITY stages
+    bool const                  useColumnSurfaceProfile = context.m_settings.m_useColumnSurfaceProfile;
+    float const*                temperatureMapXY        = context.m_temperatureMapXY;
+    std::vector<float> const&   densityNoise            = context.m_densityNoise;
+    std::vector<uint8_t> const& columnProfile           = context.m_columnProfile;
+    CarverColumnSpan const*     ravineSpans             = context.m_ravineSpans;
+    CarverColumnSpan const*     riverSpans              = context.m_riverSpans;
+
+    // --- Pass 2: assign block types for every (x,y,z) using 3D density formula ---
+    // Assignment 4: Phase 2, Task 2.1 - Replace heightmap with 3D density terrain
+    // Formula: D(x,y,z) = N(x,y,z,s) + B(z)
+    // where N = 3D Perlin noise, B = vertical bias
+    // CRITICAL: Negative density = MORE dense (solid blocks), positive = air
+
+    for (int z = 0; z < CHUNK_SIZE_Z; z++)
+    {
+        for (int y = 0; y < CHUNK_SIZE_Y; y++)
         {
             for (int x = 0; x < CHUNK_SIZE_X; x++)
             {
@@ -1666,27 +2387,15 @@ void Chunk::GenerateTerrain()
                 int     idx          = LocalCoordsToIndex(localCoords);
                 int     idxXY        = y * CHUNK_SIZE_X + x;
 
+                if (!context.IsColumnGenerated(idxXY)) continue;
+
                 // Retrieve cached per-column data from Pass 1
                 float temperature   = temperatureMapXY[idxXY]; // Used in ice formation logic
 
                 // --- Assignment 4: 3D Density Formula (Phase 2, Task 2.1) ---
 
-                // Sample 3D noise at this global position
-                // CRITICAL: Use global coordinates for cross-chunk consistency
-                // Use Compute3dPerlinNoise for smooth continuous interpolated noise
-                // Returns [-1, 1], scale controls frequency, octaves add detail
-                unsigned int densitySeed = GAME_SEED + 10; // Separate seed for density noise
-                float noise = Compute3dPerlinNoise(
-                    (float)globalCoords.x,
-                    (float)globalCoords.y,
-                    (float)globalCoords.z,
-                    g_worldGenConfig->density.densityNoiseScale,           // Scale: 200.0 (lower freq = smoother terrain)
-                    g_worldGenConfig->density.densityNoiseOctaves,         // Octaves: 3 (adds fractal detail)
-                    DEFAULT_OCTAVE_PERSISTANCE,    // Persistence: 0.5 (amplitude falloff)
-                    DEFAULT_NOISE_OCTAVE_SCALE,    // Octave scale: 2.0 (frequency multiplier)
-                    true,                          // Renormalize to [-1, 1]
-                    densitySeed
-                ); // Returns N(x,y,z,s) in [-1, 1]
+                // 3D noise N(x,y,z,s) in [-1, 1] from the density noise volume (exact or lattice-interpolated)
+                float noise = densityNoise[idx];
 
                 // Note: Original bias calculation is now unused because we use shaped bias
                 // This is kept for reference and potential future modifications
@@ -1732,11 +2441,11 @@ void Chunk::GenerateTerrain()
                 BiomeData& biomeData = m_biomeData[idxXY];
 
                 // Continentalness Curve: Height offset based on ocean/inland distance
-                // Uses PiecewiseCurve1D for non-linear terrain shaping (Assignment 4: Phase 5B.4)
+                // Uses PiecewiseCurve1D for non-linear terrain shaping (Assignment 4: Phase 5B.4), via its baked table
                 // Input: C noise [-1.2, 1.0], Output: normalized [-1, 1] from curve
                 // Scale output by [continentalnessHeightMin, continentalnessHeightMax]
                 // Ocean areas get negative offset (deeper), inland gets positive (higher)
-                float continentalnessNormalized = g_worldGenConfig->continentalnessCurve.Evaluate(biomeData.continentalness);
+                float continentalnessNormalized = g_worldGenConfig->continentalnessTable.Evaluate(biomeData.continentalness);
                 float continentalnessOffset = RangeMap(continentalnessNormalized,
                                                        -1.0f, 1.0f,
                                                        g_worldGenConfig->curves.continentalnessHeightMin,
@@ -1748,14 +2457,14 @@ void Chunk::GenerateTerrain()
                 // Curve output range: [erosionScaleMin, erosionScaleMax] = [0.3, 2.5]
                 // Flat terrain (low E) gets less noise amplification
                 // Mountainous (high E) gets more noise amplification
-                float erosionScale = g_worldGenConfig->erosionCurve.Evaluate(biomeData.erosion);
+                float erosionScale = g_worldGenConfig->erosionTable.Evaluate(biomeData.erosion);
 
                 // Peaks & Valleys Curve: Additional height variation
                 // Uses PiecewiseCurve1D for non-linear terrain shaping (Assignment 4: Phase 5B.4)
                 // Input: PV noise [-1, 1], Output: normalized [-1, 1] from curve
                 // Scale output by [pvHeightMin, pvHeightMax]
                 // Valleys (low PV) get negative modifier, peaks (high PV) get positive
-                float pvNormalized = g_worldGenConfig->peaksValleysCurve.Evaluate(biomeData.peaksValleys);
+                float pvNormalized = g_worldGenConfig->peaksValleysTable.Evaluate(biomeData.peaksValleys);
                 float pvOffset = RangeMap(pvNormalized,
                                          -1.0f, 1.0f,
                                          g_worldGenConfig->curves.pvHeightMin,
@@ -1801,44 +2510,51 @@ void Chunk::GenerateTerrain()
                 if (isSolid) // Only check caves for solid blocks (no need to carve air)
                 {
                     // CRITICAL FIX: m_surfaceHeight[] is calculated AFTER this loop
-                    // We need to check surface height dynamically by looking upward
-                    // Find the surface by checking if the block above has positive density (is air)
+                    // Air within MIN_CAVE_DEPTH_FROM_SURFACE above comes from the column surface profile;
+                    // the legacy path finds it by evaluating the density upward from this block
 
                     bool isNearSurface = false;
 
-                    // Check blocks above this position (up to MIN_CAVE_DEPTH_FROM_SURFACE blocks)
-                    for (int checkZ = globalCoords.z + 1;
-                         checkZ <= globalCoords.z + MIN_CAVE_DEPTH_FROM_SURFACE && checkZ < CHUNK_SIZE_Z;
-                         checkZ++)
+                    if (useColumnSurfaceProfile)
                     {
-                        // Calculate density at check position
-                        IntVec3 checkCoords(globalCoords.x, globalCoords.y, checkZ);
-
-                        float checkNoise = Compute3dPerlinNoise(
-                            (float)checkCoords.x, (float)checkCoords.y, (float)checkCoords.z,
-                            g_worldGenConfig->density.densityNoiseScale, g_worldGenConfig->density.densityNoiseOctaves,
-                            DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE,
-                            true, GAME_SEED + 10
-                        );
-
-                        // Get biome data for shaping
-                        BiomeData& checkBiomeData = m_biomeData[idxXY];
-                        float checkContinentalnessOffset = RangeMap(checkBiomeData.continentalness, -1.2f, 1.0f,
-                                                                    CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
-                        float checkErosionScale = RangeMap(checkBiomeData.erosion, -1.0f, 1.0f,
-                                                           EROSION_SCALE_MIN, EROSION_SCALE_MAX);
-                        float checkPvOffset = RangeMap(checkBiomeData.peaksValleys, -1.0f, 1.0f,
-                                                       PV_HEIGHT_MIN, PV_HEIGHT_MAX);
-
-                        float checkEffectiveHeight = (float)DEFAULT_TERRAIN_HEIGHT + checkContinentalnessOffset + checkPvOffset;
-                        float checkShapedBias = g_worldGenConfig->density.densityBiasPerBlock * ((float)checkCoords.z - checkEffectiveHeight);
-                        float checkDensity = (checkNoise * checkErosionScale) + checkShapedBias;
-
-                        // If we found air above us within MIN_CAVE_DEPTH_FROM_SURFACE, we're too close to surface
-                        if (checkDensity >= 0.0f) // Positive density = air
+                        isNearSurface = (columnProfile[idx] & PROFILE_NEAR_SURFACE) != 0;
+                    }
+                    else
+                    {
+                        // Check blocks above this position (up to MIN_CAVE_DEPTH_FROM_SURFACE blocks)
+                        for (int checkZ = globalCoords.z + 1;
+                             checkZ <= globalCoords.z + MIN_CAVE_DEPTH_FROM_SURFACE && checkZ < CHUNK_SIZE_Z;
+                             checkZ++)
                         {
-                            isNearSurface = true;
-                            break;
+                            // Calculate density at check position
+                            IntVec3 checkCoords(globalCoords.x, globalCoords.y, checkZ);
+
+                            float checkNoise = Compute3dPerlinNoise(
+                                (float)checkCoords.x, (float)checkCoords.y, (float)checkCoords.z,
+                                g_worldGenConfig->density.densityNoiseScale, g_worldGenConfig->density.densityNoiseOctaves,
+                                DEFAULT_OCTAVE_PERSISTANCE, DEFAULT_NOISE_OCTAVE_SCALE,
+                                true, GAME_SEED + 10
+                            );
+
+                            // Get biome data for shaping
+                            BiomeData& checkBiomeData = m_biomeData[idxXY];
+                            float checkContinentalnessOffset = RangeMap(checkBiomeData.continentalness, -1.2f, 1.0f,
+                                                                        CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
+                            float checkErosionScale = RangeMap(checkBiomeData.erosion, -1.0f, 1.0f,
+                                                               EROSION_SCALE_MIN, EROSION_SCALE_MAX);
+                            float checkPvOffset = RangeMap(checkBiomeData.peaksValleys, -1.0f, 1.0f,
+                                                           PV_HEIGHT_MIN, PV_HEIGHT_MAX);
+
+                            float checkEffectiveHeight = (float)DEFAULT_TERRAIN_HEIGHT + checkContinentalnessOffset + checkPvOffset;
+                            float checkShapedBias = g_worldGenConfig->density.densityBiasPerBlock * ((float)checkCoords.z - checkEffectiveHeight);
+                            float checkDensity = (checkNoise * checkErosionScale) + checkShapedBias;
+
+                            // If we found air above us within MIN_CAVE_DEPTH_FROM_SURFACE, we're too close to surface
+                            if (checkDensity >= 0.0f) // Positive density = air
+                            {
+                                isNearSurface = true;
+                                break;
+                            }
                         }
                     }
 
@@ -1918,129 +2634,24 @@ void Chunk::GenerateTerrain()
 
                 // --- Assignment 4: Phase 5, Task 5A.1 - Ravine Carver ---
                 //
-                // Carve dramatic vertical slices through terrain using 2D noise paths.
-                // Ravines are VERY RARE (threshold 0.85) but create impressive geological features.
-                //
-                // Algorithm:
-                // 1. Sample 2D ravine path noise at (x,y) to determine if on ravine path
-                // 2. If on ravine path, sample secondary width noise for variable width
-                // 3. Calculate distance from ravine center (0 = center, 1 = edge)
-                // 4. Use distance to determine depth (deeper at center, shallower at edges)
-                // 5. Carve vertical slice from surface down to calculated depth
-
-                if (isSolid) // Only carve ravines through solid terrain
-                {
-                    // Sample 2D ravine path noise at this (x,y) column position
-                    unsigned int ravineSeed = GAME_SEED + RAVINE_NOISE_SEED_OFFSET;
-
-                    float ravinePathNoise = Compute2dPerlinNoise(
-                        (float)globalCoords.x,
-                        (float)globalCoords.y,
-                        g_worldGenConfig->carvers.ravinePathNoiseScale,        // Very large scale (800) for rare, long ravines
-                        g_worldGenConfig->carvers.ravinePathNoiseOctaves,      // Multiple octaves (3) for natural meandering
-                        DEFAULT_OCTAVE_PERSISTANCE,     // 0.5
-                        DEFAULT_NOISE_OCTAVE_SCALE,     // 2.0
-                        true,                           // Renormalize to [-1, 1]
-                        ravineSeed
-                    ); // Returns [-1, 1]
-
-                    // Convert to [0, 1] range for threshold comparison
-                    float ravinePathValue = (ravinePathNoise + 1.0f) * 0.5f; // Maps [-1,1] → [0,1]
-
-                    // Check if this (x,y) position is on a ravine path
-                    // Very high threshold (0.85) means ravines are rare (1-2 per ~10 chunks)
-                    if (ravinePathValue > g_worldGenConfig->carvers.ravinePathThreshold)
-                    {
-                        // We're on a ravine path! Now determine width and depth
-
-                        // Sample secondary width noise for variable ravine width (3-7 blocks)
-                        unsigned int widthSeed = ravineSeed + 10; // Offset seed for width variation
-
-                        float widthNoise = Compute2dPerlinNoise(
-                            (float)globalCoords.x,
-                            (float)globalCoords.y,
-                            g_worldGenConfig->carvers.ravineWidthNoiseScale,       // Smaller scale (50) for local variation
-                            g_worldGenConfig->carvers.ravineWidthNoiseOctaves,     // Low octaves (2) for smooth changes
-                            DEFAULT_OCTAVE_PERSISTANCE,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            widthSeed
-                        ); // Returns [-1, 1]
-
-                        // Convert width noise to [0, 1] and map to width range [3, 7]
-                        float widthNoiseNormalized = (widthNoise + 1.0f) * 0.5f;
-                        int ravineFullWidth = (int)(g_worldGenConfig->carvers.ravineWidthMin + widthNoiseNormalized * (g_worldGenConfig->carvers.ravineWidthMax - g_worldGenConfig->carvers.ravineWidthMin));
-                        int ravineHalfWidth = ravineFullWidth / 2;
-
-                        // Option A: Radius-based carving with center finding
-                        // Sample nearby positions to find ravine center (highest pathValue = center)
-                        float maxPathValue = ravinePathValue;
-                        int centerOffsetX = 0;
-                        int centerOffsetY = 0;
-
-                        // Sample in a small radius to find local maximum (ravine center)
-                        int searchRadius = ravineHalfWidth + 2; // Search slightly beyond half-width
-                        for (int dy = -searchRadius; dy <= searchRadius; ++dy)
-                        {
-                            for (int dx = -searchRadius; dx <= searchRadius; ++dx)
-                            {
-                                if (dx == 0 && dy == 0) continue; // Skip current position
-
-                                float samplePathNoise = Compute2dPerlinNoise(
-                                    (float)(globalCoords.x + dx),
-                                    (float)(globalCoords.y + dy),
-                                    g_worldGenConfig->carvers.ravinePathNoiseScale,
-                                    g_worldGenConfig->carvers.ravinePathNoiseOctaves,
-                                    DEFAULT_OCTAVE_PERSISTANCE,
-                                    DEFAULT_NOISE_OCTAVE_SCALE,
-                                    true,
-                                    ravineSeed
-                                );
-                                float samplePathValue = (samplePathNoise + 1.0f) * 0.5f;
-
-                                if (samplePathValue > maxPathValue)
-                                {
-                                    maxPathValue = samplePathValue;
-                                    centerOffsetX = dx;
-                                    centerOffsetY = dy;
-                                }
-                            }
-                        }
-
-                        // Calculate distance from current position to estimated ravine center
-                        float distanceToCenter = sqrtf((float)(centerOffsetX * centerOffsetX + centerOffsetY * centerOffsetY));
+                // Carve dramatic vertical slices through terrain using 2D noise paths.
+                // Ravines are VERY RARE (threshold 0.85) but create impressive geological features.
+                //
+                // Algorithm:
+                // 1. Sample 2D ravine path noise at (x,y) to determine if on ravine path
+                // 2. If on ravine path, sample secondary width noise for variable width
+                // 3. Calculate distance from ravine center (0 = center, 1 = edge)
+                // 4. Use distance to determine depth (deeper at center, shallower at edges)
+                // 5. Carve vertical slice from surface down to calculated depth
+                // Steps 1-4 depend only on (x,y) and run once per column in BuildCarverColumnSpans()
 
-                        // Only carve if within ravine half-width radius
-                        if (distanceToCenter <= (float)ravineHalfWidth)
-                        {
-                            // Calculate falloff based on distance from center
-                            float radialFalloff = 1.0f - (distanceToCenter / (float)ravineHalfWidth);
-                            radialFalloff = GetClamped(radialFalloff, 0.0f, 1.0f);
-
-                            // Apply edge falloff for smooth transitions
-                            float depthMultiplier = radialFalloff * (1.0f - g_worldGenConfig->carvers.ravineEdgeFalloff) + g_worldGenConfig->carvers.ravineEdgeFalloff;
-
-                            // Calculate ravine depth: deeper at center, shallower at edges
-                            int ravineDepth = (int)(g_worldGenConfig->carvers.ravineDepthMin + depthMultiplier * (g_worldGenConfig->carvers.ravineDepthMax - g_worldGenConfig->carvers.ravineDepthMin));
-
-                            // Estimate surface height using biome parameters
-                            BiomeData& ravBiomeData = m_biomeData[idxXY];
-                            float ravContinentalnessOffset = RangeMap(ravBiomeData.continentalness, -1.2f, 1.0f,
-                                                                      CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
-                            float ravPvOffset = RangeMap(ravBiomeData.peaksValleys, -1.0f, 1.0f,
-                                                         PV_HEIGHT_MIN, PV_HEIGHT_MAX);
-                            float estimatedSurfaceHeight = (float)DEFAULT_TERRAIN_HEIGHT + ravContinentalnessOffset + ravPvOffset;
-
-                            // Calculate ravine bottom Z coordinate
-                            int ravineBottomZ = (int)(estimatedSurfaceHeight - ravineDepth);
-                            ravineBottomZ = (std::max)(ravineBottomZ, LAVA_Z + 1); // Don't carve below lava
-
-                            // Carve this block if we're between surface and ravine bottom
-                            if (globalCoords.z >= ravineBottomZ && globalCoords.z <= (int)estimatedSurfaceHeight)
-                            {
-                                isSolid = false; // Carve out this block (convert to air)
-                            }
-                        }
+                if (isSolid) // Only carve ravines through solid terrain
+                {
+                    // Carve this block if we're between surface and ravine bottom (span from the ravine distance field)
+                    CarverColumnSpan const& ravineSpan = ravineSpans[idxXY];
+                    if (globalCoords.z >= ravineSpan.m_bottomZ && globalCoords.z <= ravineSpan.m_topZ)
+                    {
+                        isSolid = false; // Carve out this block (convert to air)
                     }
                 }
 
@@ -2060,135 +2671,30 @@ void Chunk::GenerateTerrain()
                 // 3. Calculate shallow channel depth (3-8 blocks from surface)
                 // 4. Carve channel and fill with water
                 // 5. Use sand/gravel for riverbed
+                // Steps 1-3 depend only on (x,y) and run once per column in BuildCarverColumnSpans()
 
                 if (isSolid) // Only carve rivers through solid terrain
                 {
-                    // Sample 2D river path noise at this (x,y) column position
-                    unsigned int riverSeed = GAME_SEED + RIVER_NOISE_SEED_OFFSET;
-
-                    float riverPathNoise = Compute2dPerlinNoise(
-                        (float)globalCoords.x,
-                        (float)globalCoords.y,
-                        g_worldGenConfig->carvers.riverPathNoiseScale,         // Large scale (600) for long, winding rivers
-                        g_worldGenConfig->carvers.riverPathNoiseOctaves,       // Multiple octaves (3) for natural meandering
-                        DEFAULT_OCTAVE_PERSISTANCE,     // 0.5
-                        DEFAULT_NOISE_OCTAVE_SCALE,     // 2.0
-                        true,                           // Renormalize to [-1, 1]
-                        riverSeed
-                    ); // Returns [-1, 1]
-
-                    // Convert to [0, 1] range for threshold comparison
-                    float riverPathValue = (riverPathNoise + 1.0f) * 0.5f; // Maps [-1,1] → [0,1]
-
-                    // Check if this (x,y) position is on a river path
-                    // Moderate threshold (0.70) means rivers are more common than ravines
-                    if (riverPathValue > g_worldGenConfig->carvers.riverPathThreshold)
+                    // Determine if this block should be carved out or filled with water (span from the river distance field)
+                    CarverColumnSpan const& riverSpan = riverSpans[idxXY];
+                    if (globalCoords.z >= riverSpan.m_bottomZ && globalCoords.z <= riverSpan.m_topZ)
                     {
-                        // We're on a river path! Now determine width and depth
-
-                        // Sample secondary width noise for variable river width (5-12 blocks)
-                        unsigned int widthSeed = riverSeed + 10; // Offset seed for width variation
-
-                        float widthNoise = Compute2dPerlinNoise(
-                            (float)globalCoords.x,
-                            (float)globalCoords.y,
-                            g_worldGenConfig->carvers.riverWidthNoiseScale,        // Smaller scale (40) for local variation
-                            g_worldGenConfig->carvers.riverWidthNoiseOctaves,      // Low octaves (2) for smooth changes
-                            DEFAULT_OCTAVE_PERSISTANCE,
-                            DEFAULT_NOISE_OCTAVE_SCALE,
-                            true,
-                            widthSeed
-                        ); // Returns [-1, 1]
-
-                        // Convert width noise to [0, 1] and map to width range [5, 12]
-                        float widthNoiseNormalized = (widthNoise + 1.0f) * 0.5f;
-                        int riverFullWidth = (int)(g_worldGenConfig->carvers.riverWidthMin + widthNoiseNormalized * (g_worldGenConfig->carvers.riverWidthMax - g_worldGenConfig->carvers.riverWidthMin));
-                        int riverHalfWidth = riverFullWidth / 2;
-
-                        // Option A: Radius-based carving with center finding
-                        // Sample nearby positions to find river center (highest pathValue = center)
-                        float maxPathValue = riverPathValue;
-                        int centerOffsetX = 0;
-                        int centerOffsetY = 0;
+                        // Carve the channel
+                        isSolid = false;
 
-                        // Sample in a small radius to find local maximum (river center)
-                        int searchRadius = riverHalfWidth + 2; // Search slightly beyond half-width
-                        for (int dy = -searchRadius; dy <= searchRadius; ++dy)
+                        // Fill with water above the riverbed
+                        // Leave bottom 1-2 blocks as carved terrain (will become sand/gravel in block assignment)
+                        if (globalCoords.z > riverSpan.m_bottomZ + 1)
                         {
-                            for (int dx = -searchRadius; dx <= searchRadius; ++dx)
-                            {
-                                if (dx == 0 && dy == 0) continue; // Skip current position
-
-                                float samplePathNoise = Compute2dPerlinNoise(
-                                    (float)(globalCoords.x + dx),
-                                    (float)(globalCoords.y + dy),
-                                    g_worldGenConfig->carvers.riverPathNoiseScale,
-                                    g_worldGenConfig->carvers.riverPathNoiseOctaves,
-                                    DEFAULT_OCTAVE_PERSISTANCE,
-                                    DEFAULT_NOISE_OCTAVE_SCALE,
-                                    true,
-                                    riverSeed
-                                );
-                                float samplePathValue = (samplePathNoise + 1.0f) * 0.5f;
-
-                                if (samplePathValue > maxPathValue)
-                                {
-                                    maxPathValue = samplePathValue;
-                                    centerOffsetX = dx;
-                                    centerOffsetY = dy;
-                                }
-                            }
+                            // This block should be water
+                            blockType = BLOCK_WATER;
+                            isRiverWater = true;
                         }
-
-                        // Calculate distance from current position to estimated river center
-                        float distanceToCenter = sqrtf((float)(centerOffsetX * centerOffsetX + centerOffsetY * centerOffsetY));
-
-                        // Only carve if within river half-width radius
-                        if (distanceToCenter <= (float)riverHalfWidth)
+                        else
                         {
-                            // Calculate falloff based on distance from center
-                            float radialFalloff = 1.0f - (distanceToCenter / (float)riverHalfWidth);
-                            radialFalloff = GetClamped(radialFalloff, 0.0f, 1.0f);
-
-                            // Apply edge falloff for smooth transitions
-                            float depthMultiplier = radialFalloff * (1.0f - g_worldGenConfig->carvers.riverEdgeFalloff) + g_worldGenConfig->carvers.riverEdgeFalloff;
-
-                            // Calculate river depth: shallow channels (3-8 blocks from surface)
-                            int riverDepth = (int)(g_worldGenConfig->carvers.riverDepthMin + depthMultiplier * (g_worldGenConfig->carvers.riverDepthMax - g_worldGenConfig->carvers.riverDepthMin));
-
-                            // Estimate surface height using biome parameters
-                            BiomeData& rivBiomeData = m_biomeData[idxXY];
-                            float rivContinentalnessOffset = RangeMap(rivBiomeData.continentalness, -1.2f, 1.0f,
-                                                                      CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
-                            float rivPvOffset = RangeMap(rivBiomeData.peaksValleys, -1.0f, 1.0f,
-                                                         PV_HEIGHT_MIN, PV_HEIGHT_MAX);
-                            float estimatedSurfaceHeight = (float)DEFAULT_TERRAIN_HEIGHT + rivContinentalnessOffset + rivPvOffset;
-
-                            // Calculate river bottom Z coordinate
-                            int riverBottomZ = (int)(estimatedSurfaceHeight - riverDepth);
-                            riverBottomZ = (std::max)(riverBottomZ, SEA_LEVEL_Z - 5); // Don't carve too far below sea level
-
-                            // Determine if this block should be carved out or filled with water
-                            if (globalCoords.z >= riverBottomZ && globalCoords.z <= (int)estimatedSurfaceHeight)
-                            {
-                                // Carve the channel
-                                isSolid = false;
-
-                                // Fill with water above the riverbed
-                                // Leave bottom 1-2 blocks as carved terrain (will become sand/gravel in block assignment)
-                                if (globalCoords.z > riverBottomZ + 1)
-                                {
-                                    // This block should be water
-                                    blockType = BLOCK_WATER;
-                                    isRiverWater = true;
-                                }
-                                else
-                                {
-                                    // Riverbed - will be assigned sand or gravel later
-                                    blockType = BLOCK_SAND; // Default riverbed material
-                                    isRiverWater = false;
-                                }
-                            }
+                            // Riverbed - will be assigned sand or gravel later
+                            blockType = BLOCK_SAND; // Default riverbed material
+                            isRiverWater = false;
                         }
                     }
                 }
@@ -2233,67 +2739,74 @@ void Chunk::GenerateTerrain()
                             // --- Assignment 4: Phase 2, Task 2.4 - Surface Block Replacement ---
                             // Check if this block is at the surface (has air above it)
                             bool isSurface = false;
-                            if (globalCoords.z < CHUNK_SIZE_Z - 1) // Not at world top
+                            if (useColumnSurfaceProfile)
+                            {
+                                isSurface = (columnProfile[idx] & PROFILE_AIR_ABOVE) != 0;
+                            }
+                            else
                             {
-                                // Calculate density of block above this one
-                                IntVec3 aboveCoords(globalCoords.x, globalCoords.y, globalCoords.z + 1);
-                                unsigned int aboveDensitySeed = GAME_SEED + 10;
-                                float aboveNoise = Compute3dPerlinNoise(
-                                    (float)aboveCoords.x,
-                                    (float)aboveCoords.y,
-                                    (float)aboveCoords.z,
-                                    g_worldGenConfig->density.densityNoiseScale,
-                                    g_worldGenConfig->density.densityNoiseOctaves,
-                                    DEFAULT_OCTAVE_PERSISTANCE,
-                                    DEFAULT_NOISE_OCTAVE_SCALE,
-                                    true,
-                                    aboveDensitySeed
-                                );
-
-                                // Get biome data for this column (same as current block)
-                                BiomeData& aboveBiomeData = m_biomeData[idxXY];
-
-                                // Apply terrain shaping to above block
-                                float aboveContinentalnessOffset = RangeMap(aboveBiomeData.continentalness,
-                                                                           -1.2f, 1.0f,
-                                                                           CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
-                                float aboveErosionScale = RangeMap(aboveBiomeData.erosion,
+                                if (globalCoords.z < CHUNK_SIZE_Z - 1) // Not at world top
+                                {
+                                    // Calculate density of block above this one
+                                    IntVec3 aboveCoords(globalCoords.x, globalCoords.y, globalCoords.z + 1);
+                                    unsigned int aboveDensitySeed = GAME_SEED + 10;
+                                    float aboveNoise = Compute3dPerlinNoise(
+                                        (float)aboveCoords.x,
+                                        (float)aboveCoords.y,
+                                        (float)aboveCoords.z,
+                                        g_worldGenConfig->density.densityNoiseScale,
+                                        g_worldGenConfig->density.densityNoiseOctaves,
+                                        DEFAULT_OCTAVE_PERSISTANCE,
+                                        DEFAULT_NOISE_OCTAVE_SCALE,
+                                        true,
+                                        aboveDensitySeed
+                                    );
+
+                                    // Get biome data for this column (same as current block)
+                                    BiomeData& aboveBiomeData = m_biomeData[idxXY];
+
+                                    // Apply terrain shaping to above block
+                                    float aboveContinentalnessOffset = RangeMap(aboveBiomeData.continentalness,
+                                                                               -1.2f, 1.0f,
+                                                                               CONTINENTALNESS_HEIGHT_MIN, CONTINENTALNESS_HEIGHT_MAX);
+                                    float aboveErosionScale = RangeMap(aboveBiomeData.erosion,
+                                                                       -1.0f, 1.0f,
+                                                                       EROSION_SCALE_MIN, EROSION_SCALE_MAX);
+                                    float abovePvOffset = RangeMap(aboveBiomeData.peaksValleys,
                                                                    -1.0f, 1.0f,
-                                                                   EROSION_SCALE_MIN, EROSION_SCALE_MAX);
-                                float abovePvOffset = RangeMap(aboveBiomeData.peaksValleys,
-                                                               -1.0f, 1.0f,
-                                                               PV_HEIGHT_MIN, PV_HEIGHT_MAX);
+                                                                   PV_HEIGHT_MIN, PV_HEIGHT_MAX);
 
-                                // Calculate effective terrain height for above block (same as current block)
-                                float aboveHeightOffset = aboveContinentalnessOffset + abovePvOffset;
-                                float aboveEffectiveTerrainHeight = (float)DEFAULT_TERRAIN_HEIGHT + aboveHeightOffset;
+                                    // Calculate effective terrain height for above block (same as current block)
+                                    float aboveHeightOffset = aboveContinentalnessOffset + abovePvOffset;
+                                    float aboveEffectiveTerrainHeight = (float)DEFAULT_TERRAIN_HEIGHT + aboveHeightOffset;
 
-                                // Calculate shaped bias relative to effective terrain height
-                                float aboveShapedBias = g_worldGenConfig->density.densityBiasPerBlock * (float)((float)aboveCoords.z - aboveEffectiveTerrainHeight);
+                                    // Calculate shaped bias relative to effective terrain height
+                                    float aboveShapedBias = g_worldGenConfig->density.densityBiasPerBlock * (float)((float)aboveCoords.z - aboveEffectiveTerrainHeight);
 
-                                // Scale noise by erosion factor
-                                float aboveShapedNoise = aboveNoise * aboveErosionScale;
+                                    // Scale noise by erosion factor
+                                    float aboveShapedNoise = aboveNoise * aboveErosionScale;
 
-                                // Apply slides to above block
-                                float aboveTopSlide = 0.0f;
-                                if (aboveCoords.z >= g_worldGenConfig->density.topSlideStart && aboveCoords.z <= g_worldGenConfig->density.topSlideEnd)
-                                {
-                                    float slideProgress = (float)(aboveCoords.z - g_worldGenConfig->density.topSlideStart) / (float)(g_worldGenConfig->density.topSlideEnd - g_worldGenConfig->density.topSlideStart);
-                                    float smoothedProgress = SmoothStep3(slideProgress);
-                                    aboveTopSlide = smoothedProgress * 2.0f;
-                                }
+                                    // Apply slides to above block
+                                    float aboveTopSlide = 0.0f;
+                                    if (aboveCoords.z >= g_worldGenConfig->density.topSlideStart && aboveCoords.z <= g_worldGenConfig->density.topSlideEnd)
+                                    {
+                                        float slideProgress = (float)(aboveCoords.z - g_worldGenConfig->density.topSlideStart) / (float)(g_worldGenConfig->density.topSlideEnd - g_worldGenConfig->density.topSlideStart);
+                                        float smoothedProgress = SmoothStep3(slideProgress);
+                                        aboveTopSlide = smoothedProgress * 2.0f;
+                                    }
 
-                                float aboveBottomSlide = 0.0f;
-                                if (aboveCoords.z >= g_worldGenConfig->density.bottomSlideStart && aboveCoords.z <= g_worldGenConfig->density.bottomSlideEnd)
-                                {
-                                    float slideProgress = 1.0f - ((float)(aboveCoords.z - g_worldGenConfig->density.bottomSlideStart) / (float)(g_worldGenConfig->density.bottomSlideEnd - g_worldGenConfig->density.bottomSlideStart));
-                                    float smoothedProgress = SmoothStep3(slideProgress);
-                                    aboveBottomSlide = -smoothedProgress * 3.0f;
-                                }
+                                    float aboveBottomSlide = 0.0f;
+                                    if (aboveCoords.z >= g_worldGenConfig->density.bottomSlideStart && aboveCoords.z <= g_worldGenConfig->density.bottomSlideEnd)
+                                    {
+                                        float slideProgress = 1.0f - ((float)(aboveCoords.z - g_worldGenConfig->density.bottomSlideStart) / (float)(g_worldGenConfig->density.bottomSlideEnd - g_worldGenConfig->density.bottomSlideStart));
+                                        float smoothedProgress = SmoothStep3(slideProgress);
+                                        aboveBottomSlide = -smoothedProgress * 3.0f;
+                                    }
 
-                                // Combine components for above block density
-                                float aboveDensity = aboveShapedNoise + aboveShapedBias + aboveTopSlide + aboveBottomSlide;
-                                isSurface = (aboveDensity >= 0.0f); // Above block is air/water
+                                    // Combine components for above block density
+                                    float aboveDensity = aboveShapedNoise + aboveShapedBias + aboveTopSlide + aboveBottomSlide;
+                                    isSurface = (aboveDensity >= 0.0f); // Above block is air/water
+                                }
                             }
 
                             // Apply biome-specific surface blocks
@@ -2403,11 +2916,21 @@ void Chunk::GenerateTerrain()
                     // else: remains BLOCK_AIR
                 }
 
-                m_blocks[idx].m_typeIndex = blockType;
+                m_blockTypeIndices[idx] = blockType;
             }
         }
     }
 
+    // Last reader of the noise volume and column profile: release them before the later stages run
+    std::vector<float>().swap(context.m_densityNoise);
+    std::vector<uint8_t>().swap(context.m_columnProfile);
+}
+
+//----------------------------------------------------------------------------------------------------
+// SURFACE stage - Surface heights and biome surface layers
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunSurfaceStage(ChunkGenerationContext& context)
+{
     // --- Assignment 4: Find Surface Blocks (Phase 3, Task 3A.1) ---
     //
     // After terrain generation is complete, identify the top solid block in each (x,y) column.
@@ -2426,6 +2949,7 @@ void Chunk::GenerateTerrain()
         for (int x = 0; x < CHUNK_SIZE_X; x++)
         {
             int columnIdx = x + y * CHUNK_SIZE_X;
+            if (!context.IsColumnGenerated(columnIdx)) continue;
 
             // Find surface: scan from top down for first solid block
             int surfaceZ = -1; // -1 indicates no solid surface found (all air/water column)
@@ -2433,7 +2957,7 @@ void Chunk::GenerateTerrain()
             for (int searchZ = CHUNK_SIZE_Z - 1; searchZ >= 0; searchZ--)
             {
                 int blockIdx = x + y * CHUNK_SIZE_X + searchZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
-                uint8_t blockType = m_blocks[blockIdx].m_typeIndex;
+                uint8_t blockType = m_blockTypeIndices[blockIdx];
 
                 // Check if this block is solid (not air or water)
                 // Surface blocks are the top-most solid blocks that can have grass, sand, etc.
@@ -2465,6 +2989,8 @@ void Chunk::GenerateTerrain()
         for (int x = 0; x < CHUNK_SIZE_X; x++)
         {
             int columnIdx = x + y * CHUNK_SIZE_X;
+            if (!context.IsColumnGenerated(columnIdx)) continue;
+
             int surfaceZ = m_surfaceHeight[columnIdx];
 
             // Skip columns with no surface (all air/water)
@@ -2596,7 +3122,7 @@ void Chunk::GenerateTerrain()
 
             // Apply surface block replacement
             int surfaceBlockIdx = x + y * CHUNK_SIZE_X + surfaceZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
-            m_blocks[surfaceBlockIdx].m_typeIndex = surfaceBlock;
+            m_blockTypeIndices[surfaceBlockIdx] = surfaceBlock;
 
             // Apply subsurface layers (if biome allows)
             if (hasSubsurfaceLayers)
@@ -2612,9 +3138,9 @@ void Chunk::GenerateTerrain()
 
                     // Only replace if this block is currently stone (from density generation)
                     // Don't replace ore blocks or other special blocks
-                    if (m_blocks[subsurfaceBlockIdx].m_typeIndex == BLOCK_STONE)
+                    if (m_blockTypeIndices[subsurfaceBlockIdx] == BLOCK_STONE)
                     {
-                        m_blocks[subsurfaceBlockIdx].m_typeIndex = subsurfaceBlock;
+                        m_blockTypeIndices[subsurfaceBlockIdx] = subsurfaceBlock;
                     }
                 }
 
@@ -2624,6 +3150,322 @@ void Chunk::GenerateTerrain()
         }
     }
 
+    // Post-SURFACE block types and surface heights, so tree changes can restart at TREES (see PrepareRestage)
+    // Lighting and flags are still zero here; InitializeLighting() later rewrites m_surfaceHeight
+    if (context.m_settings.m_retainSurfaceSnapshot)
+    {
+        m_surfaceSnapshot.resize(CHUNK_SECTION_COUNT);
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+        {
+            int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+            m_surfaceSnapshot[sectionIndex].Pack(m_blockTypeIndices + sectionBase, m_blockLightingData + sectionBase,
+                                                 m_blockBitFlags + sectionBase, BLOCKS_PER_CHUNK_SECTION);
+        }
+        m_surfaceSnapshotHeights.assign(m_surfaceHeight, m_surfaceHeight + CHUNK_SIZE_X * CHUNK_SIZE_Y);
+    }
+    else
+    {
+        m_surfaceSnapshot.clear();
+        m_surfaceSnapshotHeights.clear();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Tree features - Trees as seeded records, so every chunk a tree overlaps can stamp its own part
+//----------------------------------------------------------------------------------------------------
+int constexpr TREE_ROOT_EDGE_MARGIN = 1;     // Trunks keep one column from the chunk edge (see CollectTreeFeatures)
+
+struct TreeFeature
+{
+    int              m_rootX;     // Global trunk column
+    int              m_rootY;
+    int              m_baseZ;     // Lowest trunk block, one above the surface
+    TreeStamp const* m_stamp;
+};
+
+//----------------------------------------------------------------------------------------------------
+// SelectTreeStamp - Stamp of the tree rooted at a column, or nullptr if the column grows none
+//
+// Depends only on the column's biome and global position, so any chunk can evaluate it for any column.
+// The surface checks that also depend on terrain are in CollectTreeFeatures().
+//----------------------------------------------------------------------------------------------------
+static TreeStamp* SelectTreeStamp(BiomeType const biome, int const globalX, int const globalY)
+{
+    // Check if this biome should have trees
+    TreeStamp* treeStamp = nullptr;
+
+    switch (biome)
+    {
+        case BiomeType::PLAINS:
+            treeStamp = &g_oakTreeSmall;  // Oak trees in plains
+            break;
+
+        case BiomeType::FOREST:
+            treeStamp = &g_oakTreeSmall;  // Oak trees in forests
+            break;
+
+        case BiomeType::TAIGA:
+            treeStamp = &g_spruceTreeSmall;  // Regular spruce in taiga
+            break;
+
+        case BiomeType::SNOWY_TAIGA:
+            treeStamp = &g_snowySpruceTree;  // Snowy spruce in snowy taiga
+            break;
+
+        case BiomeType::JUNGLE:
+            treeStamp = &g_jungleTreeBush;  // Jungle bushes in jungle
+            break;
+
+        case BiomeType::DESERT:
+            treeStamp = &g_cactus;  // Cactus in desert
+            break;
+
+        case BiomeType::SAVANNA:
+            treeStamp = &g_acaciaTree;  // Acacia in savanna
+            break;
+
+        case BiomeType::SNOWY_PLAINS:
+            treeStamp = &g_snowySpruceTree;  // Snowy spruce in snowy plains
+            break;
+
+        // Other biomes don't have trees
+        case BiomeType::OCEAN:
+        case BiomeType::DEEP_OCEAN:
+        case BiomeType::FROZEN_OCEAN:
+        case BiomeType::BEACH:
+        case BiomeType::SNOWY_BEACH:
+        case BiomeType::STONY_PEAKS:
+        case BiomeType::SNOWY_PEAKS:
+        default:
+            return nullptr;  // No trees in these biomes
+    }
+
+    // Check if tree stamp is valid
+    if (treeStamp == nullptr) return nullptr;
+
+
+    // DEBUG: Log ALL biome types to understand distribution
+    const char* biomeName = "UNKNOWN";
+    switch (biome) {
+        case BiomeType::OCEAN: biomeName = "OCEAN"; break;
+        case BiomeType::DEEP_OCEAN: biomeName = "DEEP_OCEAN"; break;
+        case BiomeType::FROZEN_OCEAN: biomeName = "FROZEN_OCEAN"; break;
+        case BiomeType::BEACH: biomeName = "BEACH"; break;
+        case BiomeType::SNOWY_BEACH: biomeName = "SNOWY_BEACH"; break;
+        case BiomeType::DESERT: biomeName = "DESERT"; break;
+        case BiomeType::SAVANNA: biomeName = "SAVANNA"; break;
+        case BiomeType::PLAINS: biomeName = "PLAINS"; break;
+        case BiomeType::SNOWY_PLAINS: biomeName = "SNOWY_PLAINS"; break;
+        case BiomeType::FOREST: biomeName = "FOREST"; break;
+        case BiomeType::JUNGLE: biomeName = "JUNGLE"; break;
+        case BiomeType::TAIGA: biomeName = "TAIGA"; break;
+        case BiomeType::SNOWY_TAIGA: biomeName = "SNOWY_TAIGA"; break;
+        case BiomeType::STONY_PEAKS: biomeName = "STONY_PEAKS"; break;
+        case BiomeType::SNOWY_PEAKS: biomeName = "SNOWY_PEAKS"; break;
+    }
+
+    // Sample tree noise at this location
+    // Use deterministic seed based on GAME_SEED for consistent trees
+    unsigned int treeSeed = GAME_SEED + 12345;  // Different seed from terrain noise
+    float treeNoise = Compute2dPerlinNoise(
+        (float)globalX, (float)globalY,
+        g_worldGenConfig->trees.treeNoiseScale,
+        g_worldGenConfig->trees.treeNoiseOctaves,
+        DEFAULT_OCTAVE_PERSISTANCE,
+        DEFAULT_NOISE_OCTAVE_SCALE,
+        true,  // renormalize to -1..1
+        treeSeed
+    );
+
+    // Convert noise from [-1, 1] to [0, 1] for threshold comparison
+    float treeNoise01 = (treeNoise + 1.0f) * 0.5f;
+
+    // Assignment 5 Phase 12: Tree Height/Radius Variation using Perlin noise
+    // Generate height variation noise (scale 0.05, 3 octaves)
+    unsigned int heightNoiseSeed = GAME_SEED + 54321;
+    float heightNoise = Compute2dPerlinNoise(
+        (float)globalX * 0.05f, (float)globalY * 0.05f,
+        1.0f,  // scale
+        3,     // octaves
+        DEFAULT_OCTAVE_PERSISTANCE,
+        DEFAULT_NOISE_OCTAVE_SCALE,
+        true,  // renormalize to -1..1
+        heightNoiseSeed
+    );
+    // Normalize to [0, 1] for range mapping
+    float heightNoise01 = (heightNoise + 1.0f) * 0.5f;
+
+    // Generate radius variation noise (scale 0.07, different channel via offset)
+    unsigned int radiusNoiseSeed = GAME_SEED + 98765;
+    float radiusNoise = Compute2dPerlinNoise(
+        (float)globalX * 0.07f + 1000.0f, (float)globalY * 0.07f + 1000.0f,
+        1.0f,  // scale
+        3,     // octaves
+        DEFAULT_OCTAVE_PERSISTANCE,
+        DEFAULT_NOISE_OCTAVE_SCALE,
+        true,  // renormalize to -1..1
+        radiusNoiseSeed
+    );
+    // Normalize to [0, 1] for range mapping
+    float radiusNoise01 = (radiusNoise + 1.0f) * 0.5f;
+
+    // Calculate biome-specific height and radius ranges using noise
+    // These values represent what the tree WOULD be if procedurally generated
+    // Current TreeStamp system uses hardcoded sizes, but noise is calculated
+    // for future procedural tree generation implementation.
+    //
+    // Biome-specific tree variation ranges:
+    // - FOREST/PLAINS (Oak): height 4-7 blocks, radius 2-4 blocks
+    // - TAIGA/SNOWY_TAIGA (Spruce): height 6-10 blocks, radius 1-3 blocks
+    // - JUNGLE (Jungle Bush): height 3-5 blocks, radius 2-3 blocks
+    // - DESERT (Cactus): height 2-5 blocks, no canopy
+    // - SAVANNA (Acacia): height 5-8 blocks, radius 2-4 blocks
+    //
+    // NOTE: TreeStamp system currently uses fixed sizes.
+    // This noise-based variation is ready for integration when procedural
+    // tree generation is implemented (e.g., dynamic TreeStamp creation).
+    int treeHeight = 0;
+    int canopyRadius = 0;
+
+    switch (biome)
+    {
+        case BiomeType::FOREST:
+        case BiomeType::PLAINS:
+            // Oak trees: 3-9 blocks tall, 1-5 radius canopy (EXPANDED RANGES)
+            treeHeight = 3 + (int)(heightNoise01 * 6.0f);      // 3-9
+            canopyRadius = 1 + (int)(radiusNoise01 * 4.0f);   // 1-5
+            break;
+
+        case BiomeType::TAIGA:
+        case BiomeType::SNOWY_TAIGA:
+        case BiomeType::SNOWY_PLAINS:
+            // Spruce trees: 5-13 blocks tall, 1-4 radius narrow canopy (EXPANDED RANGES)
+            treeHeight = 5 + (int)(heightNoise01 * 8.0f);      // 5-13
+            canopyRadius = 1 + (int)(radiusNoise01 * 3.0f);   // 1-4
+            break;
+
+        case BiomeType::JUNGLE:
+            // Jungle bushes: 2-7 blocks tall, 1-4 radius (EXPANDED RANGES)
+            treeHeight = 2 + (int)(heightNoise01 * 5.0f);      // 2-7
+            canopyRadius = 1 + (int)(radiusNoise01 * 3.0f);   // 1-4
+            break;
+
+        case BiomeType::DESERT:
+            // Cactus: 1-7 blocks tall, no canopy (EXPANDED RANGE)
+            treeHeight = 1 + (int)(heightNoise01 * 6.0f);      // 1-7
+            canopyRadius = 0;  // Cactus has no canopy
+            break;
+
+        case BiomeType::SAVANNA:
+            // Acacia trees: 4-11 blocks tall, 1-5 radius canopy (EXPANDED RANGES)
+            treeHeight = 4 + (int)(heightNoise01 * 7.0f);      // 4-11
+            canopyRadius = 1 + (int)(radiusNoise01 * 4.0f);   // 1-5
+            break;
+
+        default:
+            treeHeight = 5;
+            canopyRadius = 2;
+            break;
+    }
+
+    // Assignment 5 Phase 12: Use heightNoise01 to select tree variant (Small/Medium/Large)
+    // This provides visible tree size variation using existing TreeStamp variants
+    // Threshold: < 0.33 = Small, < 0.67 = Medium, >= 0.67 = Large
+    switch (biome)
+    {
+        case BiomeType::FOREST:
+        case BiomeType::PLAINS:
+            if (heightNoise01 < 0.33f)
+                treeStamp = &g_oakTreeSmall;
+            else if (heightNoise01 < 0.67f)
+                treeStamp = &g_oakTreeMedium;
+            else
+                treeStamp = &g_oakTreeLarge;
+            break;
+
+        case BiomeType::TAIGA:
+            if (heightNoise01 < 0.33f)
+                treeStamp = &g_spruceTreeSmall;
+            else if (heightNoise01 < 0.67f)
+                treeStamp = &g_spruceTreeMedium;
+            else
+                treeStamp = &g_spruceTreeLarge;
+            break;
+
+        case BiomeType::SNOWY_TAIGA:
+        case BiomeType::SNOWY_PLAINS:
+            // Snowy spruces only have one variant currently
+            treeStamp = &g_snowySpruceTree;
+            break;
+
+        case BiomeType::JUNGLE:
+            if (heightNoise01 < 0.33f)
+                treeStamp = &g_jungleTreeBush;
+            else if (heightNoise01 < 0.67f)
+                treeStamp = &g_jungleTreeMedium;
+            else
+                treeStamp = &g_jungleTreeLarge;
+            break;
+
+        case BiomeType::DESERT:
+            if (heightNoise01 < 0.33f)
+                treeStamp = &g_cactus;
+            else if (heightNoise01 < 0.67f)
+                treeStamp = &g_cactusMedium;
+            else
+                treeStamp = &g_cactusLarge;
+            break;
+
+        case BiomeType::SAVANNA:
+            if (heightNoise01 < 0.33f)
+                treeStamp = &g_acaciaTree;
+            else if (heightNoise01 < 0.67f)
+                treeStamp = &g_acaciaTreeMedium;
+            else
+                treeStamp = &g_acaciaTreeLarge;
+            break;
+
+        default:
+            // Keep the already-selected stamp (from initial selection)
+            break;
+    }
+
+    // Check if we should place a tree here
+    if (treeNoise01 < g_worldGenConfig->trees.treePlacementThreshold) return nullptr;
+
+    return treeStamp;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Farthest any stamp reaches from its trunk column, i.e. how far into a neighbor a tree can root
+//----------------------------------------------------------------------------------------------------
+static int GetMaxTreeStampReach()
+{
+    TreeStamp const* const stamps[] = { &g_oakTreeSmall, &g_oakTreeMedium, &g_oakTreeLarge,
+                                        &g_spruceTreeSmall, &g_spruceTreeMedium, &g_spruceTreeLarge,
+                                        &g_snowySpruceTree, &g_jungleTreeBush, &g_jungleTreeMedium, &g_jungleTreeLarge,
+                                        &g_acaciaTree, &g_acaciaTreeMedium, &g_acaciaTreeLarge,
+                                        &g_cactus, &g_cactusMedium, &g_cactusLarge };
+    int maxReach = 0;
+    for (TreeStamp const* stamp : stamps)
+    {
+        maxReach = (std::max)(maxReach, (std::max)(stamp->trunkOffsetX, stamp->sizeX - 1 - stamp->trunkOffsetX));
+        maxReach = (std::max)(maxReach, (std::max)(stamp->trunkOffsetY, stamp->sizeY - 1 - stamp->trunkOffsetY));
+    }
+    return maxReach;
+}
+
+//----------------------------------------------------------------------------------------------------
+// TREES stage - Every tree whose stamp overlaps this chunk, including trees rooted in neighbors
+//
+// Each chunk stamps its own part of every overlapping tree, so no chunk ever writes into another one.
+// Trees rooted in neighbors come from ProbeTreeFeatures() on a scratch chunk, which regenerates just
+// the neighbor's candidate root columns; the result is the same whether or not the neighbor is loaded.
+// Trees are stamped into air in global (y, x) root order, so overlapping trees resolve the same way
+// on both sides of a chunk edge.
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunTreeStage(ChunkGenerationSettings const& settings)
+{
     // --- Assignment 4: Tree Placement (Phase 3, Task 3B.2) ---
     //
     // After surface generation and subsurface layers, place trees based on:
@@ -2636,541 +3478,848 @@ void Chunk::GenerateTerrain()
     // - Sample tree noise at each surface location
     // - If noise exceeds threshold AND biome allows trees:
     //   - Select appropriate tree stamp for biome
-    //   - Check if tree extends beyond chunk bounds
-    //   - Store cross-chunk data if needed
+    //   - Collect the same records for neighbor columns whose trees reach into this chunk
     //   - Place tree portion that fits within current chunk
 
-    // Cross-Chunk Enhancement: Reduced edge safety margin from 4 to 1 block
-    // This allows trees much closer to chunk edges while preventing out-of-bounds access
-    int constexpr CROSS_CHUNK_SAFETY_MARGIN = 1;
+    // DEBUG: Count biomes in this chunk (focus on tree-bearing biomes only)
+    {
+        int desertCount = 0, snowyPlainsCount = 0, snowyTaigaCount = 0;
+        for (int i = 0; i < CHUNK_SIZE_X * CHUNK_SIZE_Y; i++)
+        {
+            BiomeType b = m_biomeData[i].biomeType;
+            if (b == BiomeType::DESERT) desertCount++;
+            else if (b == BiomeType::SNOWY_PLAINS) snowyPlainsCount++;
+            else if (b == BiomeType::SNOWY_TAIGA) snowyTaigaCount++;
+        }
+    }
+
+    std::vector<TreeFeature> features;
+    CollectTreeFeatures(0, 0, CHUNK_SIZE_X - 1, CHUNK_SIZE_Y - 1, features);
+    CollectNeighborTreeFeatures(settings, features);
+
+    std::sort(features.begin(), features.end(), [](TreeFeature const& a, TreeFeature const& b)
+    {
+        return (a.m_rootY != b.m_rootY) ? (a.m_rootY < b.m_rootY) : (a.m_rootX < b.m_rootX);
+    });
+
+    for (TreeFeature const& feature : features)
+    {
+        StampTreeFeature(feature);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// CollectTreeFeatures - Trees rooted in the given local column rectangle (inclusive) of this chunk
+// Needs biome data, surface heights and post-SURFACE block types for the columns that grow a tree
+//----------------------------------------------------------------------------------------------------
+void Chunk::CollectTreeFeatures(int const minX, int const minY, int const maxX, int const maxY,
+                                std::vector<TreeFeature>& outFeatures) const
+{
+    int const firstX = (std::max)(minX, TREE_ROOT_EDGE_MARGIN);
+    int const firstY = (std::max)(minY, TREE_ROOT_EDGE_MARGIN);
+    int const lastX  = (std::min)(maxX, CHUNK_SIZE_X - 1 - TREE_ROOT_EDGE_MARGIN);
+    int const lastY  = (std::min)(maxY, CHUNK_SIZE_Y - 1 - TREE_ROOT_EDGE_MARGIN);
+
+    for (int y = firstY; y <= lastY; y++)
+    {
+        for (int x = firstX; x <= lastX; x++)
+        {
+            int       columnIdx = x + y * CHUNK_SIZE_X;
+            BiomeType biome     = m_biomeData[columnIdx].biomeType;
+
+            TreeStamp const* treeStamp = SelectTreeStamp(biome, m_chunkCoords.x * CHUNK_SIZE_X + x, m_chunkCoords.y * CHUNK_SIZE_Y + y);
+            if (treeStamp == nullptr) continue;
+
+            int surfaceZ = m_surfaceHeight[columnIdx];
+
+            // Skip if no surface found in this column
+            if (surfaceZ < 0) continue;
+
+            // Don't place trees underwater (below sea level)
+            // This prevents trees from spawning on ocean floors or submerged beaches
+            // EXCEPTION: Allow desert cactus and snow trees even underwater for better visibility
+            if (surfaceZ < SEA_LEVEL_Z &&
+                biome != BiomeType::DESERT &&
+                biome != BiomeType::SNOWY_PLAINS &&
+                biome != BiomeType::SNOWY_TAIGA) continue;
+
+            // Check surface block type - only place trees on suitable blocks
+            int surfaceBlockIdx = x + y * CHUNK_SIZE_X + surfaceZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
+            uint8_t surfaceBlockType = m_blockTypeIndices[surfaceBlockIdx];
+
+
+            // Trees can only grow on grass, dirt, sand, or snow
+            bool isSuitableSurface = (
+                surfaceBlockType == BLOCK_GRASS ||
+                surfaceBlockType == BLOCK_GRASS_LIGHT ||
+                surfaceBlockType == BLOCK_GRASS_DARK ||
+                surfaceBlockType == BLOCK_GRASS_YELLOW ||
+                surfaceBlockType == BLOCK_DIRT ||
+                surfaceBlockType == BLOCK_SAND ||
+                surfaceBlockType == BLOCK_SNOW  // Allow trees on snow (for SNOWY_TAIGA)
+            );
+
+
+            if (!isSuitableSurface) continue;
+
+            TreeFeature feature;
+            feature.m_rootX = m_chunkCoords.x * CHUNK_SIZE_X + x;
+            feature.m_rootY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+            feature.m_baseZ = surfaceZ + 1;  // Place trunk 1 block above surface
+            feature.m_stamp = treeStamp;
+            outFeatures.push_back(feature);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// CollectNeighborTreeFeatures - Trees rooted in any of the 8 neighbors whose stamp can reach this chunk
+//----------------------------------------------------------------------------------------------------
+void Chunk::CollectNeighborTreeFeatures(ChunkGenerationSettings const& settings, std::vector<TreeFeature>& outFeatures) const
+{
+    int const reach = GetMaxTreeStampReach();
+
+    // Probes never keep snapshots; one scratch chunk serves every neighbor with candidate roots
+    ChunkGenerationSettings probeSettings = settings;
+    probeSettings.m_retainSurfaceSnapshot = false;
+    std::unique_ptr<Chunk> probeChunk;
+
+    for (int offsetY = -1; offsetY <= 1; ++offsetY)
+    {
+        for (int offsetX = -1; offsetX <= 1; ++offsetX)
+        {
+            if (offsetX == 0 && offsetY == 0) continue;
+
+            // This chunk's columns in neighbor-local coordinates, widened by the stamp reach
+            int const minX = -offsetX * CHUNK_SIZE_X - reach;
+            int const minY = -offsetY * CHUNK_SIZE_Y - reach;
+            int const maxX = -offsetX * CHUNK_SIZE_X + CHUNK_SIZE_X - 1 + reach;
+            int const maxY = -offsetY * CHUNK_SIZE_Y + CHUNK_SIZE_Y - 1 + reach;
+
+            IntVec2 const neighborCoords(m_chunkCoords.x + offsetX, m_chunkCoords.y + offsetY);
+            if (probeChunk == nullptr)
+            {
+                probeChunk = std::make_unique<Chunk>(neighborCoords);
+            }
+            probeChunk->m_chunkCoords = neighborCoords;
+            probeChunk->ProbeTreeFeatures(probeSettings, minX, minY, maxX, maxY, outFeatures);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// ProbeTreeFeatures - CollectTreeFeatures() for a chunk that has not been generated (scratch chunks only)
+//
+// Runs BIOME for the whole chunk, then DENSITY, TERRAIN and SURFACE for only the columns in the rectangle
+// that SelectTreeStamp() grows a tree on. Every stage is per column past the shared noise batches, so
+// those columns come out identical to a full generation of the chunk.
+//----------------------------------------------------------------------------------------------------
+void Chunk::ProbeTreeFeatures(ChunkGenerationSettings const& settings, int const minX, int const minY, int const maxX, int const maxY,
+                              std::vector<TreeFeature>& outFeatures)
+{
+    int const firstX = (std::max)(minX, TREE_ROOT_EDGE_MARGIN);
+    int const firstY = (std::max)(minY, TREE_ROOT_EDGE_MARGIN);
+    int const lastX  = (std::min)(maxX, CHUNK_SIZE_X - 1 - TREE_ROOT_EDGE_MARGIN);
+    int const lastY  = (std::min)(maxY, CHUNK_SIZE_Y - 1 - TREE_ROOT_EDGE_MARGIN);
+    if (firstX > lastX || firstY > lastY)
+    {
+        return;
+    }
+
+    std::unique_ptr<ChunkGenerationContext> context = std::make_unique<ChunkGenerationContext>();
+    context->m_settings       = settings;
+    context->m_isColumnMasked = true;
+    RunBiomeStage(*context);
+
+    int candidateCount = 0;
+    for (int y = firstY; y <= lastY; y++)
+    {
+        for (int x = firstX; x <= lastX; x++)
+        {
+            int const columnIdx = x + y * CHUNK_SIZE_X;
+            if (SelectTreeStamp(m_biomeData[columnIdx].biomeType, m_chunkCoords.x * CHUNK_SIZE_X + x, m_chunkCoords.y * CHUNK_SIZE_Y + y) != nullptr)
+            {
+                context->m_columnMask[columnIdx] = 1;
+                candidateCount++;
+            }
+        }
+    }
+    if (candidateCount == 0)
+    {
+        return;
+    }
+
+    RunDensityStage(*context);
+    RunTerrainStage(*context);
+    RunSurfaceStage(*context);
+    CollectTreeFeatures(firstX, firstY, lastX, lastY, outFeatures);
+}
+
+//----------------------------------------------------------------------------------------------------
+// StampTreeFeature - Write the part of a tree that lies inside this chunk (into air only)
+//----------------------------------------------------------------------------------------------------
+void Chunk::StampTreeFeature(TreeFeature const& feature)
+{
+    TreeStamp const& stamp = *feature.m_stamp;
+
+    // Place tree stamp at this location
+    // Tree origin is at trunk center-bottom, so offset by trunk offset values
+    int treeBaseX = feature.m_rootX - m_chunkCoords.x * CHUNK_SIZE_X - stamp.trunkOffsetX;
+    int treeBaseY = feature.m_rootY - m_chunkCoords.y * CHUNK_SIZE_Y - stamp.trunkOffsetY;
+    int treeBaseZ = feature.m_baseZ;
+
+    // Copy tree stamp blocks into chunk (only portions within current chunk)
+    for (int stampZ = 0; stampZ < stamp.sizeZ; stampZ++)
+    {
+        for (int stampY = 0; stampY < stamp.sizeY; stampY++)
+        {
+            for (int stampX = 0; stampX < stamp.sizeX; stampX++)
+            {
+                // Calculate world position for this stamp block
+                int worldX = treeBaseX + stampX;
+                int worldY = treeBaseY + stampY;
+                int worldZ = treeBaseZ + stampZ;
+
+                // Bounds check: only place blocks within current chunk
+                if (worldX < 0 || worldX >= CHUNK_SIZE_X) continue;
+                if (worldY < 0 || worldY >= CHUNK_SIZE_Y) continue;
+                if (worldZ < 0 || worldZ >= CHUNK_SIZE_Z) continue;
+
+                // Get block type from stamp
+                int stampIdx = stampX + stampY * stamp.sizeX + stampZ * stamp.sizeX * stamp.sizeY;
+                uint8_t stampBlockType = stamp.blocks[stampIdx];
+
+                // Skip air blocks (0 in stamp means don't place anything)
+                if (stampBlockType == BLOCK_AIR) continue;
+
+                // Calculate chunk block index
+                int chunkBlockIdx = worldX + worldY * CHUNK_SIZE_X + worldZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
+
+                // Only place tree blocks in air (don't overwrite existing solid blocks)
+                // BUGFIX: Direct array assignment instead of SetBlock() to avoid marking chunk as needing save
+                // Procedurally generated trees shouldn't trigger chunk saves
+                if (m_blockTypeIndices[chunkBlockIdx] == BLOCK_AIR)
+                {
+                    // BUG HUNT: Before placing tree block, log if it has unexpected lighting
+                    static int treeBlockLogCount = 0;
+                    uint8_t oldOutdoor = GetBlockAtIndex(chunkBlockIdx)->GetOutdoorLight();
+                    uint8_t oldIndoor = GetBlockAtIndex(chunkBlockIdx)->GetIndoorLight();
+
+                    if (treeBlockLogCount < 20 && (oldOutdoor > 0 || oldIndoor > 0))
+                    {
+                        DebuggerPrintf("[TREE PLACE] Chunk(%d,%d) replacing AIR at (%d,%d,%d) with tree block type=%d, AIR had outdoor=%d indoor=%d!\n",
+                                      m_chunkCoords.x, m_chunkCoords.y, worldX, worldY, worldZ,
+                                      stampBlockType, oldOutdoor, oldIndoor);
+                        treeBlockLogCount++;
+                    }
+
+                    m_blockTypeIndices[chunkBlockIdx] = stampBlockType;
+
+                    // BUG HUNT: After placing, verify lighting is still what we expect
+                    uint8_t newOutdoor = GetBlockAtIndex(chunkBlockIdx)->GetOutdoorLight();
+                    uint8_t newIndoor = GetBlockAtIndex(chunkBlockIdx)->GetIndoorLight();
+
+                    if (treeBlockLogCount < 20 && (newOutdoor != oldOutdoor || newIndoor != oldIndoor))
+                    {
+                        DebuggerPrintf("[TREE PLACE BUG] Lighting changed! outdoor %d->%d, indoor %d->%d\n",
+                                      oldOutdoor, newOutdoor, oldIndoor, newIndoor);
+                        treeBlockLogCount++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// LIGHTING stage - Section / column classification and initial lighting
+//----------------------------------------------------------------------------------------------------
+void Chunk::RunLightingStage()
+{
+    // Classify vertical sections once so lighting, meshing and saving can skip uniform ones, and
+    // build the opacity / solidity masks lighting, meshing and collision read instead of definitions
+    RecalculateSectionOccupancy();
+    RecalculateBlockMasks();
+    RecalculateColumnHeights();
+
+    // Assignment 5 Phase 3: Initialize lighting after terrain generation
+    InitializeLighting();
+
+    // NOTE: Do NOT mark mesh as dirty here!
+    // The mesh will be marked dirty AFTER lighting propagates via ProcessDirtyChunkMeshes()
+    // This ensures the mesh is built with correct lighting data, not stale outdoor=0 values
+    // m_isMeshDirty = true;  // DISABLED - mesh will be marked dirty by lighting system
+}
+
+//----------------------------------------------------------------------------------------------------
+void Chunk::RebuildMesh()
+{
+    // Clear existing mesh data
+    m_vertices.clear();
+    m_indices.clear();
+
+    EnsureBlocksUnpacked();
 
-    // DEBUG: Count biomes in this chunk (focus on tree-bearing biomes only)
+    // Visibility only depends on the block type, so resolve it once per type instead of once per block
+    uint32_t isVisibleByType[256];
+    for (int typeIndex = 0; typeIndex < 256; ++typeIndex)
     {
-        int desertCount = 0, snowyPlainsCount = 0, snowyTaigaCount = 0;
-        for (int i = 0; i < CHUNK_SIZE_X * CHUNK_SIZE_Y; i++)
-        {
-            BiomeType b = m_biomeData[i].biomeType;
-            if (b == BiomeType::DESERT) desertCount++;
-            else if (b == BiomeType::SNOWY_PLAINS) snowyPlainsCount++;
-            else if (b == BiomeType::SNOWY_TAIGA) snowyTaigaCount++;
-        }
+        sBlockDefinition const* def = sBlockDefinition::GetDefinitionByIndex((uint8_t)typeIndex);
+        isVisibleByType[typeIndex]  = (def != nullptr && def->IsVisible()) ? 1u : 0u;
     }
 
-    for (int y = CROSS_CHUNK_SAFETY_MARGIN; y < CHUNK_SIZE_Y - CROSS_CHUNK_SAFETY_MARGIN; y++)
+    // Row-at-a-time hidden surface removal (same rules as ChunkMeshJob): all-air sections are skipped, and
+    // a block is visited only if it is visible and has at least one non-opaque neighbor, which leaves just
+    // the shell of all-stone sections. This path has no World, so faces toward other chunks stay visible.
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        for (int x = CROSS_CHUNK_SAFETY_MARGIN; x < CHUNK_SIZE_X - CROSS_CHUNK_SAFETY_MARGIN; x++)
-        {
-            int columnIdx = x + y * CHUNK_SIZE_X;
-            int surfaceZ = m_surfaceHeight[columnIdx];
-
-            // Get biome type for this column
-            BiomeType biome = m_biomeData[columnIdx].biomeType;
-
-            // Skip if no surface found in this column
-            if (surfaceZ < 0) continue;
-
-            // Don't place trees underwater (below sea level)
-            // This prevents trees from spawning on ocean floors or submerged beaches
-            // EXCEPTION: Allow desert cactus and snow trees even underwater for better visibility
-            if (surfaceZ < SEA_LEVEL_Z &&
-                biome != BiomeType::DESERT &&
-                biome != BiomeType::SNOWY_PLAINS &&
-                biome != BiomeType::SNOWY_TAIGA) continue;
-
-            // Check if this biome should have trees
-            TreeStamp* treeStamp = nullptr;
+        ChunkSectionOccupancy const occupancy = GetSectionOccupancy(sectionIndex);
+        if (occupancy == ChunkSectionOccupancy::ALL_AIR) continue;
 
-            switch (biome)
+        int const firstRow = sectionIndex * CHUNK_ROWS_PER_SECTION;
+        for (int rowIndex = firstRow; rowIndex < firstRow + CHUNK_ROWS_PER_SECTION; ++rowIndex)
+        {
+            uint8_t const* rowTypes   = m_blockTypeIndices + (rowIndex << CHUNK_BITS_X);
+            uint32_t       visibleRow = 0;
+            for (int x = 0; x < CHUNK_SIZE_X; ++x)
             {
-                case BiomeType::PLAINS:
-                    treeStamp = &g_oakTreeSmall;  // Oak trees in plains
-                    break;
-
-                case BiomeType::FOREST:
-                    treeStamp = &g_oakTreeSmall;  // Oak trees in forests
-                    break;
+                visibleRow |= isVisibleByType[rowTypes[x]] << x;
+            }
+            if (visibleRow == 0) continue;
 
-                case BiomeType::TAIGA:
-                    treeStamp = &g_spruceTreeSmall;  // Regular spruce in taiga
-                    break;
+            uint32_t visibleFaces[BLOCK_FACE_COUNT];
+            GetRowFaceVisibility(rowIndex, nullptr, nullptr, nullptr, nullptr, false, visibleFaces);
 
-                case BiomeType::SNOWY_TAIGA:
-                    treeStamp = &g_snowySpruceTree;  // Snowy spruce in snowy taiga
-                    break;
+            uint32_t candidates = 0;
+            for (int faceIndex = 0; faceIndex < BLOCK_FACE_COUNT; ++faceIndex)
+            {
+                candidates |= visibleFaces[faceIndex];
+            }
+            candidates &= visibleRow;
 
-                case BiomeType::JUNGLE:
-                    treeStamp = &g_jungleTreeBush;  // Jungle bushes in jungle
-                    break;
+            while (candidates != 0)
+            {
+                int const x = std::countr_zero(candidates);
+                candidates &= candidates - 1;
 
-                case BiomeType::DESERT:
-                    treeStamp = &g_cactus;  // Cactus in desert
-                    break;
+                uint8_t visibleFaceBits = 0;
+                for (int faceIndex = 0; faceIndex < BLOCK_FACE_COUNT; ++faceIndex)
+                {
+                    visibleFaceBits |= (uint8_t)(((visibleFaces[faceIndex] >> x) & 1u) << faceIndex);
+                }
 
-                case BiomeType::SAVANNA:
-                    treeStamp = &g_acaciaTree;  // Acacia in savanna
-                    break;
+                int const         blockIndex = (rowIndex << CHUNK_BITS_X) | x;
+                sBlockDefinition* def        = sBlockDefinition::GetDefinitionByIndex(rowTypes[x]);
 
-                case BiomeType::SNOWY_PLAINS:
-                    treeStamp = &g_snowySpruceTree;  // Snowy spruce in snowy plains
-                    break;
+                // Create block iterator for efficient neighbor access
+                BlockIterator blockIter(this, blockIndex);
 
-                // Other biomes don't have trees
-                case BiomeType::OCEAN:
-                case BiomeType::DEEP_OCEAN:
-                case BiomeType::FROZEN_OCEAN:
-                case BiomeType::BEACH:
-                case BiomeType::SNOWY_BEACH:
-                case BiomeType::STONY_PEAKS:
-                case BiomeType::SNOWY_PEAKS:
-                default:
-                    continue;  // No trees in these biomes
+                // Emit only the faces the masks left visible
+                AddBlockFacesWithHiddenSurfaceRemoval(blockIter, def, visibleFaceBits);
             }
+        }
+    }
 
-            // Check if tree stamp is valid
-            if (treeStamp == nullptr) continue;
+    // Add debug wireframe for chunk bounds
+    AddVertsForWireframeAABB3D(m_debugVertices, m_worldBounds, 0.1f);
 
-            // Calculate global coordinates for tree noise sampling
-            int globalX = m_chunkCoords.x * CHUNK_SIZE_X + x;
-            int globalY = m_chunkCoords.y * CHUNK_SIZE_Y + y;
+    // Update GPU buffers from CPU arrays
+    UpdateVertexBuffer();
 
-            // DEBUG: Log ALL biome types to understand distribution
-            const char* biomeName = "UNKNOWN";
-            switch (biome) {
-                case BiomeType::OCEAN: biomeName = "OCEAN"; break;
-                case BiomeType::DEEP_OCEAN: biomeName = "DEEP_OCEAN"; break;
-                case BiomeType::FROZEN_OCEAN: biomeName = "FROZEN_OCEAN"; break;
-                case BiomeType::BEACH: biomeName = "BEACH"; break;
-                case BiomeType::SNOWY_BEACH: biomeName = "SNOWY_BEACH"; break;
-                case BiomeType::DESERT: biomeName = "DESERT"; break;
-                case BiomeType::SAVANNA: biomeName = "SAVANNA"; break;
-                case BiomeType::PLAINS: biomeName = "PLAINS"; break;
-                case BiomeType::SNOWY_PLAINS: biomeName = "SNOWY_PLAINS"; break;
-                case BiomeType::FOREST: biomeName = "FOREST"; break;
-                case BiomeType::JUNGLE: biomeName = "JUNGLE"; break;
-                case BiomeType::TAIGA: biomeName = "TAIGA"; break;
-                case BiomeType::SNOWY_TAIGA: biomeName = "SNOWY_TAIGA"; break;
-                case BiomeType::STONY_PEAKS: biomeName = "STONY_PEAKS"; break;
-                case BiomeType::SNOWY_PEAKS: biomeName = "SNOWY_PEAKS"; break;
-            }
+    // Mark mesh as no longer dirty
+    m_isMeshDirty = false;
+}
 
-            // Sample tree noise at this location
-            // Use deterministic seed based on GAME_SEED for consistent trees
-            unsigned int treeSeed = GAME_SEED + 12345;  // Different seed from terrain noise
-            float treeNoise = Compute2dPerlinNoise(
-                (float)globalX, (float)globalY,
-                g_worldGenConfig->trees.treeNoiseScale,
-                g_worldGenConfig->trees.treeNoiseOctaves,
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to -1..1
-                treeSeed
-            );
+//----------------------------------------------------------------------------------------------------
+BlockPtr Chunk::GetBlock(int const localBlockIndexX,
+                         int const localBlockIndexY,
+                         int const localBlockIndexZ)
+{
+    if (localBlockIndexX < 0 || localBlockIndexX > CHUNK_MAX_X ||
+        localBlockIndexY < 0 || localBlockIndexY > CHUNK_MAX_Y ||
+        localBlockIndexZ < 0 || localBlockIndexZ > CHUNK_MAX_Z)
+    {
+        return nullptr;
+    }
 
-            // Convert noise from [-1, 1] to [0, 1] for threshold comparison
-            float treeNoise01 = (treeNoise + 1.0f) * 0.5f;
-
-            // Assignment 5 Phase 12: Tree Height/Radius Variation using Perlin noise
-            // Generate height variation noise (scale 0.05, 3 octaves)
-            unsigned int heightNoiseSeed = GAME_SEED + 54321;
-            float heightNoise = Compute2dPerlinNoise(
-                (float)globalX * 0.05f, (float)globalY * 0.05f,
-                1.0f,  // scale
-                3,     // octaves
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to -1..1
-                heightNoiseSeed
-            );
-            // Normalize to [0, 1] for range mapping
-            float heightNoise01 = (heightNoise + 1.0f) * 0.5f;
-
-            // Generate radius variation noise (scale 0.07, different channel via offset)
-            unsigned int radiusNoiseSeed = GAME_SEED + 98765;
-            float radiusNoise = Compute2dPerlinNoise(
-                (float)globalX * 0.07f + 1000.0f, (float)globalY * 0.07f + 1000.0f,
-                1.0f,  // scale
-                3,     // octaves
-                DEFAULT_OCTAVE_PERSISTANCE,
-                DEFAULT_NOISE_OCTAVE_SCALE,
-                true,  // renormalize to -1..1
-                radiusNoiseSeed
-            );
-            // Normalize to [0, 1] for range mapping
-            float radiusNoise01 = (radiusNoise + 1.0f) * 0.5f;
-
-            // Calculate biome-specific height and radius ranges using noise
-            // These values represent what the tree WOULD be if procedurally generated
-            // Current TreeStamp system uses hardcoded sizes, but noise is calculated
-            // for future procedural tree generation implementation.
-            //
-            // Biome-specific tree variation ranges:
-            // - FOREST/PLAINS (Oak): height 4-7 blocks, radius 2-4 blocks
-            // - TAIGA/SNOWY_TAIGA (Spruce): height 6-10 blocks, radius 1-3 blocks
-            // - JUNGLE (Jungle Bush): height 3-5 blocks, radius 2-3 blocks
-            // - DESERT (Cactus): height 2-5 blocks, no canopy
-            // - SAVANNA (Acacia): height 5-8 blocks, radius 2-4 blocks
-            //
-            // NOTE: TreeStamp system currently uses fixed sizes.
-            // This noise-based variation is ready for integration when procedural
-            // tree generation is implemented (e.g., dynamic TreeStamp creation).
-            int treeHeight = 0;
-            int canopyRadius = 0;
+    int const index = LocalCoordsToIndex(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
 
-            switch (biome)
-            {
-                case BiomeType::FOREST:
-                case BiomeType::PLAINS:
-                    // Oak trees: 3-9 blocks tall, 1-5 radius canopy (EXPANDED RANGES)
-                    treeHeight = 3 + (int)(heightNoise01 * 6.0f);      // 3-9
-                    canopyRadius = 1 + (int)(radiusNoise01 * 4.0f);   // 1-5
-                    break;
+    EnsureBlocksUnpacked();
 
-                case BiomeType::TAIGA:
-                case BiomeType::SNOWY_TAIGA:
-                case BiomeType::SNOWY_PLAINS:
-                    // Spruce trees: 5-13 blocks tall, 1-4 radius narrow canopy (EXPANDED RANGES)
-                    treeHeight = 5 + (int)(heightNoise01 * 8.0f);      // 5-13
-                    canopyRadius = 1 + (int)(radiusNoise01 * 3.0f);   // 1-4
-                    break;
+    return GetBlockAtIndex(index);
+}
 
-                case BiomeType::JUNGLE:
-                    // Jungle bushes: 2-7 blocks tall, 1-4 radius (EXPANDED RANGES)
-                    treeHeight = 2 + (int)(heightNoise01 * 5.0f);      // 2-7
-                    canopyRadius = 1 + (int)(radiusNoise01 * 3.0f);   // 1-4
-                    break;
+//----------------------------------------------------------------------------------------------------
+void Chunk::SetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ, uint8_t blockTypeIndex, World* world)
+{
+    // SAFETY CHECK: Validate chunk is in a valid state before modification
+    // This prevents writing to chunks being deleted/deactivated during RegenerateAllChunks()
+    ChunkState currentState = m_state.load();
+    if (currentState != ChunkState::COMPLETE &&
+        currentState != ChunkState::TERRAIN_GENERATING)
+    {
+        // Chunk is being deleted or not fully initialized - do not modify
+        return;
+    }
 
-                case BiomeType::DESERT:
-                    // Cactus: 1-7 blocks tall, no canopy (EXPANDED RANGE)
-                    treeHeight = 1 + (int)(heightNoise01 * 6.0f);      // 1-7
-                    canopyRadius = 0;  // Cactus has no canopy
-                    break;
+    // Validate coordinates
+    if (localBlockIndexX < 0 || localBlockIndexX > CHUNK_MAX_X ||
+        localBlockIndexY < 0 || localBlockIndexY > CHUNK_MAX_Y ||
+        localBlockIndexZ < 0 || localBlockIndexZ > CHUNK_MAX_Z)
+    {
+        return; // Invalid coordinates
+    }
 
-                case BiomeType::SAVANNA:
-                    // Acacia trees: 4-11 blocks tall, 1-5 radius canopy (EXPANDED RANGES)
-                    treeHeight = 4 + (int)(heightNoise01 * 7.0f);      // 4-11
-                    canopyRadius = 1 + (int)(radiusNoise01 * 4.0f);   // 1-5
-                    break;
+    // Calculate block index
+    int index = LocalCoordsToIndex(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
 
-                default:
-                    treeHeight = 5;
-                    canopyRadius = 2;
-                    break;
-            }
+    EnsureBlocksUnpacked();
 
-            // Assignment 5 Phase 12: Use heightNoise01 to select tree variant (Small/Medium/Large)
-            // This provides visible tree size variation using existing TreeStamp variants
-            // Threshold: < 0.33 = Small, < 0.67 = Medium, >= 0.67 = Large
-            switch (biome)
-            {
-                case BiomeType::FOREST:
-                case BiomeType::PLAINS:
-                    if (heightNoise01 < 0.33f)
-                        treeStamp = &g_oakTreeSmall;
-                    else if (heightNoise01 < 0.67f)
-                        treeStamp = &g_oakTreeMedium;
-                    else
-                        treeStamp = &g_oakTreeLarge;
-                    break;
+    // Check if block type is actually changing
+    if (m_blockTypeIndices[index] != blockTypeIndex)
+    {
+        UpdateSectionOccupancy(index, m_blockTypeIndices[index], blockTypeIndex);
 
-                case BiomeType::TAIGA:
-                    if (heightNoise01 < 0.33f)
-                        treeStamp = &g_spruceTreeSmall;
-                    else if (heightNoise01 < 0.67f)
-                        treeStamp = &g_spruceTreeMedium;
-                    else
-                        treeStamp = &g_spruceTreeLarge;
-                    break;
+        // Set the new block type
+        m_blockTypeIndices[index] = blockTypeIndex;
+        UpdateBlockMasks(index, blockTypeIndex);
+        UpdateColumnHeights(index, blockTypeIndex);
 
-                case BiomeType::SNOWY_TAIGA:
-                case BiomeType::SNOWY_PLAINS:
-                    // Snowy spruces only have one variant currently
-                    treeStamp = &g_snowySpruceTree;
-                    break;
+        // Mark chunk as modified - needs saving and mesh regeneration
+        SetNeedsSaving(true);
+        SetIsMeshDirty(true);
 
-                case BiomeType::JUNGLE:
-                    if (heightNoise01 < 0.33f)
-                        treeStamp = &g_jungleTreeBush;
-                    else if (heightNoise01 < 0.67f)
-                        treeStamp = &g_jungleTreeMedium;
-                    else
-                        treeStamp = &g_jungleTreeLarge;
-                    break;
+        // Assignment 5 Phase 7 FIX: Recalculate lighting when block changes
+        // This fixes the oscillating lighting bug where placed blocks alternate between bright/dark
+        if (world)
+        {
+            // Create BlockIterator for this block
+            IntVec3 localCoords(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
+            BlockIterator blockIter(this, LocalCoordsToIndex(localCoords), world);
 
-                case BiomeType::DESERT:
-                    if (heightNoise01 < 0.33f)
-                        treeStamp = &g_cactus;
-                    else if (heightNoise01 < 0.67f)
-                        treeStamp = &g_cactusMedium;
-                    else
-                        treeStamp = &g_cactusLarge;
-                    break;
+            // Add this block to dirty light queue for recalculation
+            world->AddToDirtyLightQueue(blockIter);
 
-                case BiomeType::SAVANNA:
-                    if (heightNoise01 < 0.33f)
-                        treeStamp = &g_acaciaTree;
-                    else if (heightNoise01 < 0.67f)
-                        treeStamp = &g_acaciaTreeMedium;
-                    else
-                        treeStamp = &g_acaciaTreeLarge;
-                    break;
+            // Also add all 6 neighbors to propagate lighting changes
+            // This ensures smooth lighting transitions around the modified block
+            IntVec3 neighborOffsets[6] = {
+                IntVec3(1, 0, 0),   // East
+                IntVec3(-1, 0, 0),  // West
+                IntVec3(0, 1, 0),   // North
+                IntVec3(0, -1, 0),  // South
+                IntVec3(0, 0, 1),   // Up
+                IntVec3(0, 0, -1)   // Down
+            };
 
-                default:
-                    // Keep the already-selected stamp (from initial selection)
-                    break;
+            for (int i = 0; i < 6; i++)
+            {
+                BlockIterator neighborIter = blockIter.GetNeighbor(neighborOffsets[i]);
+                if (neighborIter.IsValid())
+                {
+                    world->AddToDirtyLightQueue(neighborIter);
+                }
             }
+        }
+    }
+}
 
-            // Check if we should place a tree here
-            if (treeNoise01 < g_worldGenConfig->trees.treePlacementThreshold) continue;
-
-            // Check surface block type - only place trees on suitable blocks
-            int surfaceBlockIdx = x + y * CHUNK_SIZE_X + surfaceZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
-            uint8_t surfaceBlockType = m_blocks[surfaceBlockIdx].m_typeIndex;
-
+//----------------------------------------------------------------------------------------------------
+// PackBlocks - Replace the flat block array with per-section palettes
+//
+// Called by World on the main thread for idle chunks only (COMPLETE, mesh clean, no lighting work
+// and no mesh job reading this chunk or its neighbors), so no worker holds a BlockPtr into the arrays.
+//----------------------------------------------------------------------------------------------------
+void Chunk::PackBlocks()
+{
+    std::lock_guard<std::mutex> lock(m_blockStorageMutex);
 
-            // Trees can only grow on grass, dirt, sand, or snow
-            bool isSuitableSurface = (
-                surfaceBlockType == BLOCK_GRASS ||
-                surfaceBlockType == BLOCK_GRASS_LIGHT ||
-                surfaceBlockType == BLOCK_GRASS_DARK ||
-                surfaceBlockType == BLOCK_GRASS_YELLOW ||
-                surfaceBlockType == BLOCK_DIRT ||
-                surfaceBlockType == BLOCK_SAND ||
-                surfaceBlockType == BLOCK_SNOW  // Allow trees on snow (for SNOWY_TAIGA)
-            );
+    if (m_isPacked.load(std::memory_order_acquire) || m_blockTypeIndices == nullptr)
+    {
+        return;
+    }
 
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+    {
+        int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+        m_packedSections[sectionIndex].Pack(m_blockTypeIndices + sectionBase,
+                                            m_blockLightingData + sectionBase,
+                                            m_blockBitFlags + sectionBase,
+                                            BLOCKS_PER_CHUNK_SECTION);
+    }
 
-            if (!isSuitableSurface) continue;
+    m_isPacked.store(true, std::memory_order_release);
 
+    FreeBlockStorage();
+}
 
+//----------------------------------------------------------------------------------------------------
+// UnpackBlocks - Re-expand palettes into a flat array (lazy, on first access after PackBlocks)
+//
+// May run on a worker thread (e.g. a neighbor's ChunkMeshJob stepping across the chunk border),
+// so the expansion is serialized and m_isPacked is only cleared after the arrays are fully written.
+//----------------------------------------------------------------------------------------------------
+void Chunk::UnpackBlocks()
+{
+    std::lock_guard<std::mutex> lock(m_blockStorageMutex);
 
-            // Place tree stamp at this location
-            // Tree origin is at trunk center-bottom, so offset by trunk offset values
-            int treeBaseX = x - treeStamp->trunkOffsetX;
-            int treeBaseY = y - treeStamp->trunkOffsetY;
-            int treeBaseZ = surfaceZ + 1;  // Place trunk 1 block above surface
+    if (!m_isPacked.load(std::memory_order_acquire))
+    {
+        return;     // Another thread finished unpacking while we waited
+    }
 
-            // Cross-Chunk Tree Detection: Check if tree extends beyond current chunk
-            bool extendsNorth = false;
-            bool extendsSouth = false;
-            bool extendsEast = false;
-            bool extendsWest = false;
+    AllocateBlockStorage();
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+    {
+        int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+        m_packedSections[sectionIndex].Unpack(m_blockTypeIndices + sectionBase,
+                                              m_blockLightingData + sectionBase,
+                                              m_blockBitFlags + sectionBase);
+        m_packedSections[sectionIndex].Clear();
+    }
 
-            int treeMinX = treeBaseX;
-            int treeMaxX = treeBaseX + treeStamp->sizeX - 1;
-            int treeMinY = treeBaseY;
-            int treeMaxY = treeBaseY + treeStamp->sizeY - 1;
+    m_isPacked.store(false, std::memory_order_release);
+}
 
-            if (treeMinX < 0) extendsWest = true;
-            if (treeMaxX >= CHUNK_SIZE_X) extendsEast = true;
-            if (treeMinY < 0) extendsSouth = true;
-            if (treeMaxY >= CHUNK_SIZE_Y) extendsNorth = true;
+//----------------------------------------------------------------------------------------------------
+size_t Chunk::GetResidentBlockBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_blockStorageMutex);
 
-            // Store cross-chunk tree data if this tree extends beyond chunk boundaries
-            if (extendsNorth || extendsSouth || extendsEast || extendsWest)
-            {
-                CrossChunkTreeData crossChunkTree;
-                crossChunkTree.localX = x;
-                crossChunkTree.localY = y;
-                crossChunkTree.localZ = treeBaseZ;
-                crossChunkTree.treeStamp = treeStamp;
-                crossChunkTree.extendsNorth = extendsNorth;
-                crossChunkTree.extendsSouth = extendsSouth;
-                crossChunkTree.extendsEast = extendsEast;
-                crossChunkTree.extendsWest = extendsWest;
-
-                m_crossChunkTrees.push_back(crossChunkTree);
-            }
+    if (!m_isPacked.load(std::memory_order_acquire))
+    {
+        return (size_t)BLOCKS_PER_CHUNK * sizeof(Block);
+    }
 
-            // Copy tree stamp blocks into chunk (only portions within current chunk)
-            for (int stampZ = 0; stampZ < treeStamp->sizeZ; stampZ++)
-            {
-                for (int stampY = 0; stampY < treeStamp->sizeY; stampY++)
-                {
-                    for (int stampX = 0; stampX < treeStamp->sizeX; stampX++)
-                    {
-                        // Calculate world position for this stamp block
-                        int worldX = treeBaseX + stampX;
-                        int worldY = treeBaseY + stampY;
-                        int worldZ = treeBaseZ + stampZ;
-
-                        // Bounds check: only place blocks within current chunk
-                        if (worldX < 0 || worldX >= CHUNK_SIZE_X) continue;
-                        if (worldY < 0 || worldY >= CHUNK_SIZE_Y) continue;
-                        if (worldZ < 0 || worldZ >= CHUNK_SIZE_Z) continue;
-
-                        // Get block type from stamp
-                        int stampIdx = stampX + stampY * treeStamp->sizeX + stampZ * treeStamp->sizeX * treeStamp->sizeY;
-                        uint8_t stampBlockType = treeStamp->blocks[stampIdx];
-
-                        // Skip air blocks (0 in stamp means don't place anything)
-                        if (stampBlockType == BLOCK_AIR) continue;
-
-                        // Calculate chunk block index
-                        int chunkBlockIdx = worldX + worldY * CHUNK_SIZE_X + worldZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
-
-                        // Only place tree blocks in air (don't overwrite existing solid blocks)
-                        // BUGFIX: Direct array assignment instead of SetBlock() to avoid marking chunk as needing save
-                        // Procedurally generated trees shouldn't trigger chunk saves
-                        if (m_blocks[chunkBlockIdx].m_typeIndex == BLOCK_AIR)
-                        {
-                            // BUG HUNT: Before placing tree block, log if it has unexpected lighting
-                            static int treeBlockLogCount = 0;
-                            uint8_t oldOutdoor = m_blocks[chunkBlockIdx].GetOutdoorLight();
-                            uint8_t oldIndoor = m_blocks[chunkBlockIdx].GetIndoorLight();
+    size_t totalBytes = 0;
+    for (PalettedBlockSection const& section : m_packedSections)
+    {
+        totalBytes += section.GetResidentBytes();
+    }
+    return totalBytes;
+}
 
-                            if (treeBlockLogCount < 20 && (oldOutdoor > 0 || oldIndoor > 0))
-                            {
-                                DebuggerPrintf("[TREE PLACE] Chunk(%d,%d) replacing AIR at (%d,%d,%d) with tree block type=%d, AIR had outdoor=%d indoor=%d!\n",
-                                              m_chunkCoords.x, m_chunkCoords.y, worldX, worldY, worldZ,
-                                              stampBlockType, oldOutdoor, oldIndoor);
-                                treeBlockLogCount++;
-                            }
+//----------------------------------------------------------------------------------------------------
+void Chunk::CopyBlocksTo(uint8_t* outTypeIndices, uint8_t* outLightingData, uint8_t* outBitFlags) const
+{
+    std::lock_guard<std::mutex> lock(m_blockStorageMutex);
 
-                            m_blocks[chunkBlockIdx].m_typeIndex = stampBlockType;
+    if (!m_isPacked.load(std::memory_order_acquire))
+    {
+        memcpy(outTypeIndices, m_blockTypeIndices, (size_t)BLOCKS_PER_CHUNK);
+        memcpy(outLightingData, m_blockLightingData, (size_t)BLOCKS_PER_CHUNK);
+        memcpy(outBitFlags, m_blockBitFlags, (size_t)BLOCKS_PER_CHUNK);
+        return;
+    }
 
-                            // BUG HUNT: After placing, verify lighting is still what we expect
-                            uint8_t newOutdoor = m_blocks[chunkBlockIdx].GetOutdoorLight();
-                            uint8_t newIndoor = m_blocks[chunkBlockIdx].GetIndoorLight();
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+    {
+        int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+        m_packedSections[sectionIndex].Unpack(outTypeIndices + sectionBase, outLightingData + sectionBase, outBitFlags + sectionBase);
+    }
+}
 
-                            if (treeBlockLogCount < 20 && (newOutdoor != oldOutdoor || newIndoor != oldIndoor))
-                            {
-                                DebuggerPrintf("[TREE PLACE BUG] Lighting changed! outdoor %d->%d, indoor %d->%d\n",
-                                              oldOutdoor, newOutdoor, oldIndoor, newIndoor);
-                                treeBlockLogCount++;
-                            }
-                        }
-                    }
-                }
+//----------------------------------------------------------------------------------------------------
+// CompressTo - Snapshot for ChunkCache (main thread, chunk is being deactivated)
+// Already-packed chunks hand over copies of their palettes instead of packing again
+//----------------------------------------------------------------------------------------------------
+void Chunk::CompressTo(CompressedChunkData& outData) const
+{
+    {
+        std::lock_guard<std::mutex> lock(m_blockStorageMutex);
+
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+        {
+            if (m_isPacked.load(std::memory_order_acquire))
+            {
+                outData.m_sections[sectionIndex] = m_packedSections[sectionIndex];
+                continue;
             }
+
+            int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+            outData.m_sections[sectionIndex].Pack(m_blockTypeIndices + sectionBase,
+                                                  m_blockLightingData + sectionBase,
+                                                  m_blockBitFlags + sectionBase,
+                                                  BLOCKS_PER_CHUNK_SECTION);
         }
     }
 
-    // Assignment 5 Phase 3: Initialize lighting after terrain generation
-    InitializeLighting();
-
-    // NOTE: Do NOT mark mesh as dirty here!
-    // The mesh will be marked dirty AFTER lighting propagates via ProcessDirtyChunkMeshes()
-    // This ensures the mesh is built with correct lighting data, not stale outdoor=0 values
-    // m_isMeshDirty = true;  // DISABLED - mesh will be marked dirty by lighting system
+    for (int columnIndex = 0; columnIndex < CHUNK_SIZE_X * CHUNK_SIZE_Y; ++columnIndex)
+    {
+        outData.m_surfaceHeight[columnIndex] = (int16_t)m_surfaceHeight[columnIndex];
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-void Chunk::RebuildMesh()
+// DecompressFrom - Restore a freshly acquired chunk from ChunkCache (replaces load + InitializeLighting)
+//----------------------------------------------------------------------------------------------------
+void Chunk::DecompressFrom(CompressedChunkData const& data)
 {
-    // Clear existing mesh data
-    m_vertices.clear();
-    m_indices.clear();
+    EnsureBlocksUnpacked();
 
-    // Cache-coherent iteration: iterate blocks in memory order for optimal cache performance
-    // Memory layout is: index = x + (y << CHUNK_BITS_X) + (z << (CHUNK_BITS_X + CHUNK_BITS_Y))
-    for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; blockIndex++)
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        Block&            block = m_blocks[blockIndex];
-        sBlockDefinition* def   = sBlockDefinition::GetDefinitionByIndex(block.m_typeIndex);
-
-        // Skip invisible blocks (air, transparent blocks)
-        if (!def || !def->IsVisible()) continue;
-
-        // Create block iterator for efficient neighbor access
-        BlockIterator blockIter(this, blockIndex);
+        int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+        data.m_sections[sectionIndex].Unpack(m_blockTypeIndices + sectionBase,
+                                             m_blockLightingData + sectionBase,
+                                             m_blockBitFlags + sectionBase);
+    }
 
-        // Use hidden surface removal for only visible faces
-        AddBlockFacesWithHiddenSurfaceRemoval(blockIter, def);
+    for (int columnIndex = 0; columnIndex < CHUNK_SIZE_X * CHUNK_SIZE_Y; ++columnIndex)
+    {
+        m_surfaceHeight[columnIndex] = (int)data.m_surfaceHeight[columnIndex];
     }
 
-    // Add debug wireframe for chunk bounds
-    AddVertsForWireframeAABB3D(m_debugVertices, m_worldBounds, 0.1f);
+    RecalculateSectionOccupancy();
+    RecalculateBlockMasks();
+    RecalculateColumnHeights();
+}
 
-    // Update GPU buffers from CPU arrays
-    UpdateVertexBuffer();
+//----------------------------------------------------------------------------------------------------
+// AllocateBlockStorage - One zeroed allocation split into the type / lighting / flag arrays
+//----------------------------------------------------------------------------------------------------
+void Chunk::AllocateBlockStorage()
+{
+    m_blockTypeIndices  = new uint8_t[(size_t)BLOCKS_PER_CHUNK * sizeof(Block)]();
+    m_blockLightingData = m_blockTypeIndices + BLOCKS_PER_CHUNK;
+    m_blockBitFlags     = m_blockLightingData + BLOCKS_PER_CHUNK;
+}
 
-    // Mark mesh as no longer dirty
-    m_isMeshDirty = false;
+//----------------------------------------------------------------------------------------------------
+void Chunk::FreeBlockStorage()
+{
+    delete[] m_blockTypeIndices;
+    m_blockTypeIndices  = nullptr;
+    m_blockLightingData = nullptr;
+    m_blockBitFlags     = nullptr;
 }
 
 //----------------------------------------------------------------------------------------------------
-Block* Chunk::GetBlock(int const localBlockIndexX,
-                       int const localBlockIndexY,
-                       int const localBlockIndexZ)
+ChunkSectionOccupancy Chunk::GetSectionOccupancy(int const sectionIndex) const
 {
-    if (localBlockIndexX < 0 || localBlockIndexX > CHUNK_MAX_X ||
-        localBlockIndexY < 0 || localBlockIndexY > CHUNK_MAX_Y ||
-        localBlockIndexZ < 0 || localBlockIndexZ > CHUNK_MAX_Z)
+    if (m_sectionAirCount[sectionIndex] == BLOCKS_PER_CHUNK_SECTION) return ChunkSectionOccupancy::ALL_AIR;
+    if (m_sectionStoneCount[sectionIndex] == BLOCKS_PER_CHUNK_SECTION) return ChunkSectionOccupancy::ALL_STONE;
+    return ChunkSectionOccupancy::MIXED;
+}
+
+//----------------------------------------------------------------------------------------------------
+// RecalculateSectionOccupancy - Full recount after bulk writes that bypass SetBlock (generation, disk load)
+//----------------------------------------------------------------------------------------------------
+void Chunk::RecalculateSectionOccupancy()
+{
+    EnsureBlocksUnpacked();
+
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        return nullptr;
+        uint8_t const* sectionTypes = m_blockTypeIndices + sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+        int            airCount     = 0;
+        int            stoneCount   = 0;
+
+        // Branch-free byte compares over a contiguous array, auto-vectorized in release builds
+        for (int i = 0; i < BLOCKS_PER_CHUNK_SECTION; ++i)
+        {
+            uint8_t const typeIndex = sectionTypes[i];
+            airCount   += (typeIndex == BLOCK_AIR) ? 1 : 0;
+            stoneCount += (typeIndex == BLOCK_STONE) ? 1 : 0;
+        }
+
+        m_sectionAirCount[sectionIndex]   = (uint16_t)airCount;
+        m_sectionStoneCount[sectionIndex] = (uint16_t)stoneCount;
     }
+}
 
-    int const index = LocalCoordsToIndex(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
+//----------------------------------------------------------------------------------------------------
+void Chunk::UpdateSectionOccupancy(int const blockIndex, uint8_t const oldTypeIndex, uint8_t const newTypeIndex)
+{
+    int const sectionIndex = blockIndex / BLOCKS_PER_CHUNK_SECTION;
 
-    return &m_blocks[index];
+    if (oldTypeIndex == BLOCK_AIR) --m_sectionAirCount[sectionIndex];
+    if (oldTypeIndex == BLOCK_STONE) --m_sectionStoneCount[sectionIndex];
+    if (newTypeIndex == BLOCK_AIR) ++m_sectionAirCount[sectionIndex];
+    if (newTypeIndex == BLOCK_STONE) ++m_sectionStoneCount[sectionIndex];
 }
 
 //----------------------------------------------------------------------------------------------------
-void Chunk::SetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ, uint8_t blockTypeIndex, World* world)
+// RecalculateBlockMasks - Full opacity / solidity mask rebuild after bulk writes that bypass SetBlock
+//
+// Definitions are looked up once per type into flag tables, then each row word is assembled from its
+// 32 contiguous type bytes. Uniform sections (see RecalculateSectionOccupancy) are filled without reading blocks.
+//----------------------------------------------------------------------------------------------------
+void Chunk::RecalculateBlockMasks()
 {
-    // SAFETY CHECK: Validate chunk is in a valid state before modification
-    // This prevents writing to chunks being deleted/deactivated during RegenerateAllChunks()
-    ChunkState currentState = m_state.load();
-    if (currentState != ChunkState::COMPLETE &&
-        currentState != ChunkState::TERRAIN_GENERATING)
+    EnsureBlocksUnpacked();
+
+    uint32_t isOpaqueByType[256];
+    uint32_t isSolidByType[256];
+    for (int typeIndex = 0; typeIndex < 256; ++typeIndex)
     {
-        // Chunk is being deleted or not fully initialized - do not modify
-        return;
+        sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex((uint8_t)typeIndex);
+        isOpaqueByType[typeIndex]        = (blockDef != nullptr && blockDef->IsOpaque()) ? 1u : 0u;
+        isSolidByType[typeIndex]         = (blockDef != nullptr && blockDef->IsSolid()) ? 1u : 0u;
     }
 
-    // Validate coordinates
-    if (localBlockIndexX < 0 || localBlockIndexX > CHUNK_MAX_X ||
-        localBlockIndexY < 0 || localBlockIndexY > CHUNK_MAX_Y ||
-        localBlockIndexZ < 0 || localBlockIndexZ > CHUNK_MAX_Z)
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        return; // Invalid coordinates
+        ChunkSectionOccupancy const occupancy = GetSectionOccupancy(sectionIndex);
+        int const                   firstRow  = sectionIndex * CHUNK_ROWS_PER_SECTION;
+
+        if (occupancy != ChunkSectionOccupancy::MIXED)
+        {
+            uint8_t const uniformType = (occupancy == ChunkSectionOccupancy::ALL_AIR) ? BLOCK_AIR : BLOCK_STONE;
+            std::fill_n(m_opaqueMask + firstRow, CHUNK_ROWS_PER_SECTION, isOpaqueByType[uniformType] ? ~0u : 0u);
+            std::fill_n(m_solidMask + firstRow, CHUNK_ROWS_PER_SECTION, isSolidByType[uniformType] ? ~0u : 0u);
+            continue;
+        }
+
+        for (int rowIndex = firstRow; rowIndex < firstRow + CHUNK_ROWS_PER_SECTION; ++rowIndex)
+        {
+            uint8_t const* rowTypes  = m_blockTypeIndices + (rowIndex << CHUNK_BITS_X);
+            uint32_t       opaqueRow = 0;
+            uint32_t       solidRow  = 0;
+            for (int x = 0; x < CHUNK_SIZE_X; ++x)
+            {
+                opaqueRow |= isOpaqueByType[rowTypes[x]] << x;
+                solidRow  |= isSolidByType[rowTypes[x]] << x;
+            }
+
+            m_opaqueMask[rowIndex] = opaqueRow;
+            m_solidMask[rowIndex]  = solidRow;
+        }
     }
+}
 
-    // Calculate block index
-    int index = LocalCoordsToIndex(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
+//----------------------------------------------------------------------------------------------------
+void Chunk::UpdateBlockMasks(int const blockIndex, uint8_t const newTypeIndex)
+{
+    sBlockDefinition const* newDef   = sBlockDefinition::GetDefinitionByIndex(newTypeIndex);
+    int const               rowIndex = blockIndex >> CHUNK_BITS_X;
+    uint32_t const          blockBit = 1u << (blockIndex & CHUNK_MASK_X);
 
-    // Check if block type is actually changing
-    if (m_blocks[index].m_typeIndex != blockTypeIndex)
-    {
+    m_opaqueMask[rowIndex] = (newDef != nullptr && newDef->IsOpaque()) ? (m_opaqueMask[rowIndex] | blockBit) : (m_opaqueMask[rowIndex] & ~blockBit);
+    m_solidMask[rowIndex]  = (newDef != nullptr && newDef->IsSolid()) ? (m_solidMask[rowIndex] | blockBit) : (m_solidMask[rowIndex] & ~blockBit);
+}
 
-        // Set the new block type
-        m_blocks[index].m_typeIndex = blockTypeIndex;
+//----------------------------------------------------------------------------------------------------
+// GetRowFaceVisibility - Hidden surface removal for 32 blocks at once
+//
+// Each face mask is the complement of the opacity row next to this one in that direction: the rows one
+// layer up / down, the rows at y +-1 (the neighbor chunk's far edge row at the chunk border), and this
+// row shifted by one block along X with the neighbor chunk's edge block shifted in.
+//----------------------------------------------------------------------------------------------------
+void Chunk::GetRowFaceVisibility(int const rowIndex, Chunk const* eastNeighbor, Chunk const* westNeighbor,
+                                 Chunk const* northNeighbor, Chunk const* southNeighbor, bool const isMissingNeighborOpaque,
+                                 uint32_t outVisibleFaces[BLOCK_FACE_COUNT]) const
+{
+    uint32_t const missingRow = isMissingNeighborOpaque ? ~0u : 0u;
+    uint32_t const opaqueRow  = m_opaqueMask[rowIndex];
+    int const      y          = rowIndex & CHUNK_MAX_Y;
+
+    uint32_t const aboveRow = (rowIndex + CHUNK_SIZE_Y < CHUNK_ROW_COUNT) ? m_opaqueMask[rowIndex + CHUNK_SIZE_Y] : 0u;
+    uint32_t const belowRow = (rowIndex >= CHUNK_SIZE_Y) ? m_opaqueMask[rowIndex - CHUNK_SIZE_Y] : 0u;
+
+    uint32_t const eastEdgeBit = (eastNeighbor != nullptr ? eastNeighbor->m_opaqueMask[rowIndex] : missingRow) & 1u;
+    uint32_t const westEdgeBit = (westNeighbor != nullptr ? westNeighbor->m_opaqueMask[rowIndex] : missingRow) >> CHUNK_MAX_X;
+    uint32_t const eastRow     = (opaqueRow >> 1) | (eastEdgeBit << CHUNK_MAX_X);
+    uint32_t const westRow     = (opaqueRow << 1) | westEdgeBit;
+
+    uint32_t const northRow = (y < CHUNK_MAX_Y) ? m_opaqueMask[rowIndex + 1]
+                                                : (northNeighbor != nullptr ? northNeighbor->m_opaqueMask[rowIndex - CHUNK_MAX_Y] : missingRow);
+    uint32_t const southRow = (y > 0) ? m_opaqueMask[rowIndex - 1]
+                                      : (southNeighbor != nullptr ? southNeighbor->m_opaqueMask[rowIndex + CHUNK_MAX_Y] : missingRow);
+
+    outVisibleFaces[(int)BlockFace::TOP]    = ~aboveRow;
+    outVisibleFaces[(int)BlockFace::BOTTOM] = ~belowRow;
+    outVisibleFaces[(int)BlockFace::EAST]   = ~eastRow;
+    outVisibleFaces[(int)BlockFace::WEST]   = ~westRow;
+    outVisibleFaces[(int)BlockFace::NORTH]  = ~northRow;
+    outVisibleFaces[(int)BlockFace::SOUTH]  = ~southRow;
+}
 
-        // Mark chunk as modified - needs saving and mesh regeneration
-        SetNeedsSaving(true);
-        SetIsMeshDirty(true);
+//----------------------------------------------------------------------------------------------------
+// RecalculateColumnHeights - Full heightmap rebuild after bulk writes that bypass SetBlock
+//
+// Each column is scanned top-down until its highest opaque block, skipping uniform air sections whole,
+// so the cost is proportional to the air above the terrain rather than the full 256-block column.
+// Opacity comes from the block masks, so RecalculateBlockMasks() must run first.
+//----------------------------------------------------------------------------------------------------
+void Chunk::RecalculateColumnHeights()
+{
+    EnsureBlocksUnpacked();
 
-        // Assignment 5 Phase 7 FIX: Recalculate lighting when block changes
-        // This fixes the oscillating lighting bug where placed blocks alternate between bright/dark
-        if (world)
+    for (int y = 0; y < CHUNK_SIZE_Y; ++y)
+    {
+        for (int x = 0; x < CHUNK_SIZE_X; ++x)
         {
-            // Create BlockIterator for this block
-            IntVec3 localCoords(localBlockIndexX, localBlockIndexY, localBlockIndexZ);
-            BlockIterator blockIter(this, LocalCoordsToIndex(localCoords), world);
+            int highestNonAirZ = -1;
+            int highestOpaqueZ = -1;
 
-            // Add this block to dirty light queue for recalculation
-            world->AddToDirtyLightQueue(blockIter);
+            for (int z = CHUNK_MAX_Z; z >= 0; --z)
+            {
+                if ((z & (CHUNK_SECTION_SIZE_Z - 1)) == CHUNK_SECTION_SIZE_Z - 1 &&
+                    GetSectionOccupancy(GetSectionIndex(z)) == ChunkSectionOccupancy::ALL_AIR)
+                {
+                    z -= CHUNK_SECTION_SIZE_Z - 1;
+                    continue;
+                }
 
-            // Also add all 6 neighbors to propagate lighting changes
-            // This ensures smooth lighting transitions around the modified block
-            IntVec3 neighborOffsets[6] = {
-                IntVec3(1, 0, 0),   // East
-                IntVec3(-1, 0, 0),  // West
-                IntVec3(0, 1, 0),   // North
-                IntVec3(0, -1, 0),  // South
-                IntVec3(0, 0, 1),   // Up
-                IntVec3(0, 0, -1)   // Down
-            };
+                int const blockIndex = LocalCoordsToIndex(x, y, z);
+                if (m_blockTypeIndices[blockIndex] == BLOCK_AIR) continue;
 
-            for (int i = 0; i < 6; i++)
-            {
-                BlockIterator neighborIter = blockIter.GetNeighbor(neighborOffsets[i]);
-                if (neighborIter.IsValid())
+                if (highestNonAirZ == -1) highestNonAirZ = z;
+
+                if (IsBlockOpaque(blockIndex))
                 {
-                    world->AddToDirtyLightQueue(neighborIter);
+                    highestOpaqueZ = z;
+                    break;
                 }
             }
+
+            m_highestNonAirZ[x + y * CHUNK_SIZE_X] = (int16_t)highestNonAirZ;
+            m_highestOpaqueZ[x + y * CHUNK_SIZE_X] = (int16_t)highestOpaqueZ;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// UpdateColumnHeights - Heightmap bookkeeping for a single block type change (call after the write
+// and after UpdateBlockMasks())
+//
+// Raising a column top is O(1). Removing the current top rescans downward from it, which only walks
+// the air/non-opaque blocks that were already under that top, so edits stay O(1) amortized.
+//----------------------------------------------------------------------------------------------------
+void Chunk::UpdateColumnHeights(int const blockIndex, uint8_t const newTypeIndex)
+{
+    int const columnIndex = blockIndex & (CHUNK_SIZE_X * CHUNK_SIZE_Y - 1);
+    int const z           = IndexToLocalZ(blockIndex);
+
+    bool const isNonAir = (newTypeIndex != BLOCK_AIR);
+    bool const isOpaque = IsBlockOpaque(blockIndex);
+
+    if (isNonAir && z > m_highestNonAirZ[columnIndex])
+    {
+        m_highestNonAirZ[columnIndex] = (int16_t)z;
+    }
+    else if (!isNonAir && z == m_highestNonAirZ[columnIndex])
+    {
+        int searchZ = z - 1;
+        while (searchZ >= 0 && m_blockTypeIndices[columnIndex + (searchZ << (CHUNK_BITS_X + CHUNK_BITS_Y))] == BLOCK_AIR)
+        {
+            --searchZ;
+        }
+        m_highestNonAirZ[columnIndex] = (int16_t)searchZ;
+    }
+
+    if (isOpaque && z > m_highestOpaqueZ[columnIndex])
+    {
+        m_highestOpaqueZ[columnIndex] = (int16_t)z;
+    }
+    else if (!isOpaque && z == m_highestOpaqueZ[columnIndex])
+    {
+        int searchZ = z - 1;
+        while (searchZ >= 0 && !IsBlockOpaque(columnIndex + (searchZ << (CHUNK_BITS_X + CHUNK_BITS_Y))))
+        {
+            --searchZ;
         }
+        m_highestOpaqueZ[columnIndex] = (int16_t)searchZ;
     }
 }
 
@@ -3451,7 +4600,8 @@ void Chunk::ClearNeighborPointers()
 
 //----------------------------------------------------------------------------------------------------
 void Chunk::AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter,
-                                                  sBlockDefinition*    def)
+                                                  sBlockDefinition*    def,
+                                                  uint8_t const        visibleFaceBits)
 {
     IntVec3 localCoords = blockIter.GetLocalCoords();
     Vec3    blockCenter = Vec3((float)localCoords.x + 0.5f, (float)localCoords.y + 0.5f, (float)localCoords.z + 0.5f) +
@@ -3488,10 +4638,10 @@ void Chunk::AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter
         0.8f     // South
     };
 
-    // For each face, check if it's visible before adding it
+    // For each face, check if it's visible before adding it (bit faceIndex of visibleFaceBits, see BlockFace)
     for (int faceIndex = 0; faceIndex < 6; faceIndex++)
     {
-        if (IsFaceVisible(blockIter, faceDirections[faceIndex]))
+        if ((visibleFaceBits & (1 << faceIndex)) != 0)
         {
             Vec2 uvs;
             if (faceIndex == 0) uvs = def->GetTopUVs();     // Top
@@ -3502,7 +4652,7 @@ void Chunk::AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter
             // This is the correct Minecraft behavior - each face uses the light from the neighbor
             // For example, the top face of grass uses the light from the air block above
             BlockIterator neighborIter = blockIter.GetNeighbor(faceDirections[faceIndex]);
-            Block* neighborBlock = neighborIter.IsValid() ? neighborIter.GetBlock() : nullptr;
+            BlockPtr neighborBlock = neighborIter.IsValid() ? neighborIter.GetBlock() : nullptr;
 
             // Assignment 5: Read lighting from neighbor block
             // FIX: If neighbor is unavailable (unloaded chunk), use default skylight value
@@ -3522,7 +4672,7 @@ void Chunk::AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter
             // BUG HUNT: Log if we're reading HIGH outdoor light from UNDERGROUND neighbors
             // Works in both Debug and Release builds
             static int logCount = 0;
-            Block* block = blockIter.GetBlock();
+            BlockPtr block = blockIter.GetBlock();
             IntVec3 blockCoords = blockIter.GetLocalCoords();
 
             // Log if UNDERGROUND block (z < 100) is reading outdoor > 5 from ANY neighbor
@@ -3578,59 +4728,6 @@ void Chunk::AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter
     }
 }
 
-//----------------------------------------------------------------------------------------------------
-bool Chunk::IsFaceVisible(BlockIterator const& blockIter, IntVec3 const& faceDirection) const
-{
-    // Get neighboring block in the face direction
-    BlockIterator neighborIter = blockIter.GetNeighbor(faceDirection);
-
-    // Assignment 5 Phase 0 FIX: Conservative hidden surface removal
-    // CRITICAL: If neighbor is invalid, assume it's OPAQUE (hidden face)
-    // This prevents rendering chunk boundary faces when neighbor chunks aren't fully loaded
-    // Only render faces at true world boundaries (z < 0 or z >= CHUNK_SIZE_Z)
-    if (!neighborIter.IsValid())
-    {
-        // Check if we're at vertical world boundaries (top/bottom of world)
-        IntVec3 currentCoords = blockIter.GetLocalCoords();
-        IntVec3 neighborCoords = currentCoords + faceDirection;
-
-        // Convert to world Z coordinate
-        int worldZ = neighborCoords.z;
-
-        // Only render face if at vertical world boundaries
-        if (worldZ < 0 || worldZ >= CHUNK_SIZE_Z)
-        {
-            return true;  // At vertical world boundaries, render face
-        }
-
-        // ✅ A7 FIX: Assume unloaded neighbor is AIR (transparent) - show face at chunk boundaries
-        // This prevents missing faces when neighboring chunks are unloaded
-        return true;
-    }
-
-    // Get the neighboring block
-    Block* neighborBlock = neighborIter.GetBlock();
-    if (!neighborBlock)
-    {
-        // No block data means assume opaque (safer for hidden surface removal)
-        return false;
-    }
-
-    // Get neighbor block definition
-    sBlockDefinition* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
-    if (!neighborDef)
-    {
-        // Invalid definition - assume opaque
-        return false;
-    }
-
-    // Assignment 5: Hidden Surface Removal Logic
-    // Face is VISIBLE if neighbor is NOT opaque (air, transparent, etc.)
-    // Face is HIDDEN if neighbor is opaque (solid block)
-    // Pattern matches reference: if (!neighborBlock->IsOpaque()) { AddQuadToMesh(); }
-    return !neighborDef->IsOpaque();
-}
-
 //----------------------------------------------------------------------------------------------------
 // Thread-safe chunk state management methods
 //----------------------------------------------------------------------------------------------------
@@ -3693,7 +4790,9 @@ bool Chunk::LoadFromDisk()
         return false; // Incompatible format
     }
 
-    // Decompress RLE data
+    // Decompress RLE data straight into the type array (lighting and flags are rebuilt by InitializeLighting)
+    EnsureBlocksUnpacked();
+
     size_t dataOffset = sizeof(ChunkFileHeader);
     int    blockIndex = 0;
 
@@ -3710,16 +4809,9 @@ bool Chunk::LoadFromDisk()
         dataOffset += sizeof(ChunkRLEEntry);
 
         // Apply run to blocks
-        for (int i = 0; i < entry.count && blockIndex < BLOCKS_PER_CHUNK; i++)
-        {
-            IntVec3 localCoords = IndexToLocalCoords(blockIndex);
-            Block*  block       = GetBlock(localCoords.x, localCoords.y, localCoords.z);
-            if (block != nullptr)
-            {
-                block->m_typeIndex = entry.value;
-            }
-            blockIndex++;
-        }
+        int const runLength = (entry.count < BLOCKS_PER_CHUNK - blockIndex) ? (int)entry.count : BLOCKS_PER_CHUNK - blockIndex;
+        memset(m_blockTypeIndices + blockIndex, entry.value, (size_t)runLength);
+        blockIndex += runLength;
     }
 
     // Verify we loaded exactly the right number of blocks
@@ -3728,6 +4820,10 @@ bool Chunk::LoadFromDisk()
         return false; // RLE data doesn't match expected block count
     }
 
+    RecalculateSectionOccupancy();
+    RecalculateBlockMasks();
+    RecalculateColumnHeights();
+
     return true;
 }
 
@@ -3742,17 +4838,36 @@ bool Chunk::SaveToDisk() const
 
     // Collect block data in order for RLE compression
     std::vector<uint8_t> blockData(BLOCKS_PER_CHUNK);
-    for (int i = 0; i < BLOCKS_PER_CHUNK; i++)
     {
-        IntVec3 localCoords = IndexToLocalCoords(i);
-        Block*  block       = const_cast<Chunk*>(this)->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-        if (block != nullptr)
+        // A lazy UnpackBlocks() (e.g. a neighbor's mesh or light job reading this chunk) swaps the storage
+        std::lock_guard<std::mutex> lock(m_blockStorageMutex);
+
+        if (IsBlockStoragePacked())
         {
-            blockData[i] = block->m_typeIndex;
+            // Palette-compressed chunks are read straight from their sections (no 786 KB re-expansion)
+            for (int i = 0; i < BLOCKS_PER_CHUNK; i++)
+            {
+                blockData[i] = m_packedSections[i / BLOCKS_PER_CHUNK_SECTION].GetBlockAt(i % BLOCKS_PER_CHUNK_SECTION).m_typeIndex;
+            }
         }
         else
         {
-            blockData[i] = 0; // Air block if invalid
+            for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+            {
+                int const                   sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+                ChunkSectionOccupancy const occupancy   = GetSectionOccupancy(sectionIndex);
+
+                // Uniform sections become one bulk run; the RLE pass below produces the same entries either way
+                if (occupancy != ChunkSectionOccupancy::MIXED)
+                {
+                    uint8_t const uniformType = (occupancy == ChunkSectionOccupancy::ALL_AIR) ? BLOCK_AIR : BLOCK_STONE;
+                    memset(blockData.data() + sectionBase, uniformType, BLOCKS_PER_CHUNK_SECTION);
+                    continue;
+                }
+
+                // Types are already contiguous in block index order
+                memcpy(blockData.data() + sectionBase, m_blockTypeIndices + sectionBase, BLOCKS_PER_CHUNK_SECTION);
+            }
         }
     }
 
@@ -3815,155 +4930,6 @@ bool Chunk::SaveToDisk() const
     return written == fileBuffer.size();
 }
 
-//----------------------------------------------------------------------------------------------------
-// Cross-Chunk Tree Placement (Option 1: Post-Processing Pass)
-//----------------------------------------------------------------------------------------------------
-void Chunk::PlaceCrossChunkTrees()
-{
-    // Only run on main thread when chunk is complete and neighbors are available
-    if (GetState() != ChunkState::COMPLETE) return;
-
-    // Process each tree that extends into neighboring chunks
-    for (CrossChunkTreeData const& treeData : m_crossChunkTrees)
-    {
-        TreeStamp* treeStamp = treeData.treeStamp;
-        if (!treeStamp) continue;
-
-        // Calculate tree base position
-        int treeBaseX = treeData.localX - treeStamp->trunkOffsetX;
-        int treeBaseY = treeData.localY - treeStamp->trunkOffsetY;
-        int treeBaseZ = treeData.localZ;
-
-        // Place tree portions that extend into each neighbor chunk
-        if (treeData.extendsNorth && m_northNeighbor && m_northNeighbor->IsComplete())
-        {
-            PlaceTreeInNeighborChunk(m_northNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, CHUNK_SIZE_Y, 0);
-        }
-
-        if (treeData.extendsSouth && m_southNeighbor && m_southNeighbor->IsComplete())
-        {
-            PlaceTreeInNeighborChunk(m_southNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, -CHUNK_SIZE_Y, 0);
-        }
-
-        if (treeData.extendsEast && m_eastNeighbor && m_eastNeighbor->IsComplete())
-        {
-            PlaceTreeInNeighborChunk(m_eastNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   CHUNK_SIZE_X, 0, 0);
-        }
-
-        if (treeData.extendsWest && m_westNeighbor && m_westNeighbor->IsComplete())
-        {
-            PlaceTreeInNeighborChunk(m_westNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   -CHUNK_SIZE_X, 0, 0);
-        }
-
-        // Handle corner cases (trees extending into diagonal neighbors)
-        // Note: Simplified diagonal neighbor access to avoid potential null pointer issues
-        if (treeData.extendsNorth && treeData.extendsEast && m_northNeighbor && m_eastNeighbor)
-        {
-            // The northeast diagonal chunk would be handled by both north and east chunks
-            // We'll place portions in both north and east chunks, avoiding direct diagonal access
-            PlaceTreeInNeighborChunk(m_northNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, CHUNK_SIZE_Y, 0);
-            PlaceTreeInNeighborChunk(m_eastNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   CHUNK_SIZE_X, 0, 0);
-        }
-
-        if (treeData.extendsNorth && treeData.extendsWest && m_northNeighbor && m_westNeighbor)
-        {
-            // The northwest diagonal chunk would be handled by both north and west chunks
-            PlaceTreeInNeighborChunk(m_northNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, CHUNK_SIZE_Y, 0);
-            PlaceTreeInNeighborChunk(m_westNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   -CHUNK_SIZE_X, 0, 0);
-        }
-
-        if (treeData.extendsSouth && treeData.extendsEast && m_southNeighbor && m_eastNeighbor)
-        {
-            // The southeast diagonal chunk would be handled by both south and east chunks
-            PlaceTreeInNeighborChunk(m_southNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, -CHUNK_SIZE_Y, 0);
-            PlaceTreeInNeighborChunk(m_eastNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   CHUNK_SIZE_X, 0, 0);
-        }
-
-        if (treeData.extendsSouth && treeData.extendsWest && m_southNeighbor && m_westNeighbor)
-        {
-            // The southwest diagonal chunk would be handled by both south and west chunks
-            PlaceTreeInNeighborChunk(m_southNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   0, -CHUNK_SIZE_Y, 0);
-            PlaceTreeInNeighborChunk(m_westNeighbor, treeStamp, treeBaseX, treeBaseY, treeBaseZ,
-                                   -CHUNK_SIZE_X, 0, 0);
-        }
-    }
-
-    // Clear cross-chunk tree data after processing
-    if (!m_crossChunkTrees.empty())
-    {
-        m_crossChunkTrees.clear();
-        // NOTE: Do NOT call SetIsMeshDirty(true) here!
-        // Tree blocks trigger lighting changes via RecalculateBlockLighting(),
-        // which adds chunk to m_chunksNeedingMeshRebuild automatically.
-        // ProcessDirtyChunkMeshes() will mark it dirty AFTER lighting stabilizes.
-    }
-}
-
-//----------------------------------------------------------------------------------------------------------------------
-void Chunk::PlaceTreeInNeighborChunk(Chunk* neighborChunk, TreeStamp* treeStamp,
-                                    int treeBaseX, int treeBaseY, int treeBaseZ,
-                                    int offsetX, int offsetY, int offsetZ)
-{
-    if (!neighborChunk || !treeStamp) return;
-
-    // Copy tree stamp blocks into neighbor chunk with coordinate transformation
-    for (int stampZ = 0; stampZ < treeStamp->sizeZ; stampZ++)
-    {
-        for (int stampY = 0; stampY < treeStamp->sizeY; stampY++)
-        {
-            for (int stampX = 0; stampX < treeStamp->sizeX; stampX++)
-            {
-                // Calculate world position relative to this chunk
-                int worldX = treeBaseX + stampX;
-                int worldY = treeBaseY + stampY;
-                int worldZ = treeBaseZ + stampZ;
-
-                // Transform to neighbor chunk coordinates
-                int neighborX = worldX + offsetX;
-                int neighborY = worldY + offsetY;
-                int neighborZ = worldZ + offsetZ;
-
-                // Check if block is within neighbor chunk bounds
-                if (neighborX < 0 || neighborX >= CHUNK_SIZE_X) continue;
-                if (neighborY < 0 || neighborY >= CHUNK_SIZE_Y) continue;
-                if (neighborZ < 0 || neighborZ >= CHUNK_SIZE_Z) continue;
-
-                // Get stamp block type
-                int stampIdx = stampX + stampY * treeStamp->sizeX + stampZ * treeStamp->sizeX * treeStamp->sizeY;
-                uint8_t stampBlockType = treeStamp->blocks[stampIdx];
-
-                if (stampBlockType == BLOCK_AIR) continue;
-
-                // Place block in neighbor chunk
-                int neighborBlockIdx = neighborX + neighborY * CHUNK_SIZE_X + neighborZ * CHUNK_SIZE_X * CHUNK_SIZE_Y;
-                if (neighborChunk->m_blocks[neighborBlockIdx].m_typeIndex == BLOCK_AIR)
-                {
-                    neighborChunk->m_blocks[neighborBlockIdx].m_typeIndex = stampBlockType;
-                }
-            }
-        }
-    }
-
-    // NOTE: Do NOT call SetIsMeshDirty(true) on neighbor chunk here!
-    // Tree blocks trigger lighting changes via RecalculateBlockLighting(),
-    // which adds neighbor chunk to m_chunksNeedingMeshRebuild automatically.
-    // ProcessDirtyChunkMeshes() will mark it dirty AFTER lighting stabilizes.
-    //
-    // NOTE: We also don't call SetNeedsSaving(true) because cross-chunk trees are
-    // procedurally generated and will be regenerated when the neighbor chunk loads.
-}
-
 //----------------------------------------------------------------------------------------------------
 // Assignment 5 Phase 3: Initialize lighting after terrain generation
 //----------------------------------------------------------------------------------------------------
@@ -3988,162 +4954,149 @@ void Chunk::InitializeLighting()
     // This ensures OnActivate() adds air ABOVE trees to dirty queue, not leaves inside canopy.
     bool needsSurfaceHeightInit = true;  // Always update to account for trees
 
-    // Scan each (x,y) column from top to bottom
-    for (int x = 0; x < CHUNK_SIZE_X; x++)
+    // Heightmap-driven: the surface search starts at each row's highest opaque block (m_highestOpaqueZ),
+    // and the sky flag / light bytes are written in memory order, 32 blocks per row from the opacity mask.
+    // Output is byte-identical to InitializeLightingLegacy(), the per-column scans this replaced.
+    EnsureBlocksUnpacked();
+
+    // Light byte of a block that does not see the sky, per type: outdoor=0, indoor=emission (emissive
+    // blocks, e.g. glowstone) or 0. Undefined types keep their light byte (0xFF in keepLightByType)
+    uint8_t unlitByType[256];
+    uint8_t keepLightByType[256];
+    for (int typeIndex = 0; typeIndex < 256; ++typeIndex)
+    {
+        sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex((uint8_t)typeIndex);
+        unlitByType[typeIndex]           = (blockDef != nullptr && blockDef->IsEmissive()) ? (uint8_t)(blockDef->GetEmissiveValue() & 0x0F) : (uint8_t)0x00;
+        keepLightByType[typeIndex]       = (blockDef != nullptr) ? (uint8_t)0x00 : (uint8_t)0xFF;
+    }
+
+    // Pass 1: Find the TRUE surface height (HIGHEST SOLID TERRAIN, not trees/leaves)
+    // The surface is the LAST transition from AIR → OPAQUE when descending from sky (caves, overhangs and
+    // tree canopies above it included), or the top block if the column is opaque to the top of the world.
+    // All 32 columns of an X row at once (bit x = column x), starting at the row's highest opaque block:
+    // everything above it is non-opaque, so no transition can be there
+    int columnSurfaceZ[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    std::fill_n(columnSurfaceZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, -1);   // -1 = all-air column
+
+    for (int y = 0; y < CHUNK_SIZE_Y; y++)
     {
-        for (int y = 0; y < CHUNK_SIZE_Y; y++)
+        int rowTopZ = -1;
+        for (int x = 0; x < CHUNK_SIZE_X; x++)
         {
-            int surfaceHeightForColumn = -1;  // Track surface height for m_surfaceHeight[] initialization (-1 = not found yet)
+            rowTopZ = (std::max)(rowTopZ, (int)m_highestOpaqueZ[x + y * CHUNK_SIZE_X]);
+        }
 
-            // CRITICAL FIX (2025-11-16): Two-pass approach to correctly identify sky-visible blocks
-            // Pass 1: Scan from top to bottom, mark blocks as sky-visible if no opaque block above
-            // Pass 2: Scan from top to bottom, set outdoor=15 ONLY for sky-visible blocks until first opaque
+        uint32_t nonOpaqueAbove = (rowTopZ == CHUNK_MAX_Z) ? 0u : ~0u;    // Columns whose block at z + 1 is non-opaque
+        uint32_t surfaceFound   = 0;                                      // Columns with a surface height so far
 
-            // Pass 1: Find the TRUE surface height (HIGHEST SOLID TERRAIN, not trees/leaves)
-            // CORRECT ALGORITHM: Find the LAST transition from AIR → OPAQUE when descending from sky
-            // This handles all cases: trees touching ground, trees with air gaps, no trees at all
-            int lastAirZ = -1;  // Track the last AIR block we saw
+        for (int z = rowTopZ; z >= 0; z--)
+        {
+            uint32_t const opaqueRow = m_opaqueMask[y + z * CHUNK_SIZE_Y];
+            uint32_t       newSurfaces = opaqueRow & (nonOpaqueAbove | ~surfaceFound);
+            surfaceFound              |= newSurfaces;
+            nonOpaqueAbove             = ~opaqueRow;
 
-            // First scan: Descend from sky and find the last AIR → OPAQUE transition
-            for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+            while (newSurfaces != 0)
             {
-                Block* block = GetBlock(x, y, z);
-                if (!block) continue;
-
-                sBlockDefinition* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
-                if (!blockDef) continue;
-
-                if (blockDef->IsOpaque())
-                {
-                    // Found an opaque block. If we just saw AIR above, this is a surface transition.
-                    if (lastAirZ != -1 && lastAirZ == z + 1)
-                    {
-                        // This is an AIR → OPAQUE transition, update surface height
-                        surfaceHeightForColumn = z;
-                        // Don't break! Keep searching for deeper transitions (caves, overhangs, etc.)
-                    }
-                    else if (surfaceHeightForColumn == -1)
-                    {
-                        // First opaque from top with no air above (e.g., bedrock column)
-                        surfaceHeightForColumn = z;
-                    }
-                }
-                else  // Non-opaque (AIR, WATER, etc.)
-                {
-                    lastAirZ = z;  // Remember this AIR block
-                }
+                int const x = std::countr_zero(newSurfaces);
+                newSurfaces &= newSurfaces - 1;
+                columnSurfaceZ[x + y * CHUNK_SIZE_X] = z;
             }
+        }
+    }
 
-            // If we never found any opaque blocks, surface is at -1 (all air column)
-            // This is handled by the sky-visible scan below
-
-            // Second scan: Mark sky-visible blocks (only blocks ABOVE surface get sky-visible=true)
-            for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
-            {
-                Block* block = GetBlock(x, y, z);
-                if (!block) continue;
+    // Layers above every surface are open sky, layers below every surface are fully dark
+    int minSurfaceZ = CHUNK_MAX_Z;
+    int maxSurfaceZ = -1;
+    for (int columnIndex = 0; columnIndex < CHUNK_SIZE_X * CHUNK_SIZE_Y; ++columnIndex)
+    {
+        minSurfaceZ = (std::min)(minSurfaceZ, columnSurfaceZ[columnIndex]);
+        maxSurfaceZ = (std::max)(maxSurfaceZ, columnSurfaceZ[columnIndex]);
+    }
 
-                sBlockDefinition* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
-                if (!blockDef) continue;
+    // Pass 2: Sky-visible flag and initial light, one rule for every block:
+    // - Sky-visible: ABOVE the column surface and non-opaque → outdoor=15 / indoor=0 (0xF0)
+    // - Everything else (opaque blocks, tree leaves/logs above the surface, all blocks below it) → unlit
+    for (int sectionIndex = CHUNK_SECTION_COUNT - 1; sectionIndex >= 0; --sectionIndex)
+    {
+        ChunkSectionOccupancy const occupancy      = GetSectionOccupancy(sectionIndex);
+        int const                   sectionBottomZ = sectionIndex * CHUNK_SECTION_SIZE_Z;
+        int const                   sectionTopZ    = sectionBottomZ + CHUNK_SECTION_SIZE_Z - 1;
+        int const                   sectionBase    = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+
+        // Uniform section whose sky visibility is the same for every block (stone never sees the sky; air
+        // does above every surface and never below every surface): one fill over the contiguous section
+        if (occupancy != ChunkSectionOccupancy::MIXED)
+        {
+            uint8_t const uniformType   = (occupancy == ChunkSectionOccupancy::ALL_AIR) ? BLOCK_AIR : BLOCK_STONE;
+            bool const    isOpaque      = (m_opaqueMask[sectionIndex * CHUNK_ROWS_PER_SECTION] != 0u);
+            bool const    isAboveAll    = (sectionBottomZ > maxSurfaceZ);
+            bool const    isBelowAll    = (sectionTopZ < minSurfaceZ);
 
-                // Blocks ABOVE the true surface (including tree leaves/logs and air) can see sky
-                if (z > surfaceHeightForColumn)
+            if (isOpaque || isAboveAll || isBelowAll)
+            {
+                bool const    seesTheSky = !isOpaque && isAboveAll;
+                uint8_t const skyFlag    = seesTheSky ? (uint8_t)0x01 : (uint8_t)0x00;
+                uint8_t*      bitFlags   = m_blockBitFlags + sectionBase;
+                for (int i = 0; i < BLOCKS_PER_CHUNK_SECTION; ++i)
                 {
-                    if (!blockDef->IsOpaque())  // Only non-opaque blocks get sky-visible flag
-                    {
-                        block->SetIsSkyVisible(true);
-                    }
-                    else
-                    {
-                        block->SetIsSkyVisible(false);  // Tree leaves/logs above surface don't see sky
-                    }
+                    bitFlags[i] = (uint8_t)((bitFlags[i] & ~0x01) | skyFlag);
                 }
-                else
+
+                if (keepLightByType[uniformType] == 0)
                 {
-                    // Blocks AT or BELOW surface cannot see sky
-                    block->SetIsSkyVisible(false);
+                    std::fill_n(m_blockLightingData + sectionBase, BLOCKS_PER_CHUNK_SECTION, seesTheSky ? (uint8_t)0xF0 : unlitByType[uniformType]);
+                    airBlocksSetToSky += seesTheSky ? BLOCKS_PER_CHUNK_SECTION : 0;
                 }
+                continue;
             }
+        }
 
-            // Pass 2: Set outdoor light based on sky visibility
-            // CRITICAL FIX: Don't break at FIRST opaque - break at SURFACE HEIGHT from Pass 1!
-            // This handles tree leaves above the terrain surface correctly.
-            for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+        for (int z = sectionTopZ; z >= sectionBottomZ; z--)
+        {
+            for (int y = 0; y < CHUNK_SIZE_Y; y++)
             {
-                Block* block = GetBlock(x, y, z);
-                if (!block)
-                    continue;
-
-                sBlockDefinition* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
-                if (!blockDef)
-                    continue;
+                int const rowIndex = y + z * CHUNK_SIZE_Y;
 
-                // Process blocks ABOVE and AT the surface
-                if (z >= surfaceHeightForColumn || surfaceHeightForColumn == -1)
+                // Columns whose surface is below this block; only the band between the lowest and highest
+                // surface needs the per-column compare
+                uint32_t aboveSurface = (z > maxSurfaceZ) ? ~0u : 0u;
+                if (z <= maxSurfaceZ && z >= minSurfaceZ)
                 {
-                    if (blockDef->IsOpaque())
-                    {
-                        // A5 SPEC COMPLIANT: ALL opaque blocks get outdoor=0 (NO EXCEPTIONS)
-                        // Per spec Task 3 (lines 154-155): "if (!foundSolid) outdoor=15 else outdoor=0"
-                        // Water/ice/leaves are marked isOpaque="true" for gameplay collision,
-                        // so InitializeLighting() treats them as opaque → outdoor=0
-                        // RecalculateBlockLighting() will handle light propagation THROUGH them
-                        block->SetOutdoorLight(0);
-
-                        // Check if emissive (glowstone, lava, etc.)
-                        if (blockDef->IsEmissive())
-                        {
-                            block->SetIndoorLight(blockDef->GetEmissiveValue());
-                        }
-                        else
-                        {
-                            block->SetIndoorLight(0);
-                        }
-                    }
-                    else  // Non-opaque block (AIR, WATER, etc.)
+                    for (int x = 0; x < CHUNK_SIZE_X; x++)
                     {
-                        // Only sky-visible blocks get outdoor=15
-                        if (block->IsSkyVisible())
-                        {
-                            block->SetOutdoorLight(15);
-                            block->SetIndoorLight(0);
-                            airBlocksSetToSky++;
-                        }
-                        else
-                        {
-                            // Non-sky-visible air (shouldn't happen above surface, but handle it)
-                            block->SetOutdoorLight(0);
-                            block->SetIndoorLight(0);
-                        }
+                        aboveSurface |= (uint32_t)(z > columnSurfaceZ[x + y * CHUNK_SIZE_X]) << x;
                     }
                 }
-                else
-                {
-                    // Blocks BELOW surface - set to darkness
-                    // A5 SPEC COMPLIANT: ALL blocks below surface get outdoor=0 (NO EXCEPTIONS)
-                    block->SetOutdoorLight(0);
 
-                    // Check if emissive (glowstone, lava, etc.)
-                    if (blockDef->IsEmissive())
-                    {
-                        block->SetIndoorLight(blockDef->GetEmissiveValue());
-                    }
-                    else
-                    {
-                        block->SetIndoorLight(0);
-                    }
-                }
-            }
+                uint32_t const skyRow   = aboveSurface & ~m_opaqueMask[rowIndex];
+                int const      rowBase  = rowIndex << CHUNK_BITS_X;
+                uint8_t const* rowTypes = m_blockTypeIndices + rowBase;
+                uint8_t*       rowLight = m_blockLightingData + rowBase;
+                uint8_t*       rowFlags = m_blockBitFlags + rowBase;
 
-            // CRITICAL FIX: Populate m_surfaceHeight[] for chunks loaded from disk
-            // This is essential for OnActivate() to add correct blocks to dirty light queue
-            if (needsSurfaceHeightInit)
-            {
-                m_surfaceHeight[x + y * CHUNK_SIZE_X] = surfaceHeightForColumn;
+                for (int x = 0; x < CHUNK_SIZE_X; x++)
+                {
+                    uint8_t const typeIndex = rowTypes[x];
+                    uint8_t const skyFlag   = (uint8_t)((skyRow >> x) & 1u);
+                    uint8_t const newLight  = skyFlag ? (uint8_t)0xF0 : unlitByType[typeIndex];
+                    uint8_t const keepMask  = keepLightByType[typeIndex];
+
+                    rowLight[x]        = (uint8_t)((rowLight[x] & keepMask) | (newLight & ~keepMask));
+                    rowFlags[x]        = (uint8_t)((rowFlags[x] & ~0x01) | skyFlag);
+                    airBlocksSetToSky += skyFlag & ~keepMask & 0x01;
+                }
             }
         }
     }
 
+    // CRITICAL FIX: Populate m_surfaceHeight[] for chunks loaded from disk
+    // This is essential for OnActivate() to add correct blocks to dirty light queue
+    if (needsSurfaceHeightInit)
+    {
+        std::copy_n(columnSurfaceZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, m_surfaceHeight);
+    }
+
     if (needsSurfaceHeightInit && callCount <= 3)
     {
         DebuggerPrintf("  [INIT LIGHTING] Populated m_surfaceHeight[] - sample: (0,0)=%d, (15,15)=%d\n",
@@ -4162,7 +5115,7 @@ void Chunk::InitializeLighting()
                 int surfaceZ = m_surfaceHeight[x + y * CHUNK_SIZE_X];
                 if (surfaceZ >= 0)
                 {
-                    Block* surfaceBlock = GetBlock(x, y, surfaceZ);
+                    BlockPtr surfaceBlock = GetBlock(x, y, surfaceZ);
                     if (surfaceBlock)
                     {
                         uint8_t outdoor = surfaceBlock->GetOutdoorLight();
@@ -4206,8 +5159,8 @@ void Chunk::InitializeLighting()
         int surfaceZ = m_surfaceHeight[sampleX + sampleY * CHUNK_SIZE_X];
         if (surfaceZ >= 0 && surfaceZ < CHUNK_SIZE_Z - 1)
         {
-            Block* surfaceBlock = GetBlock(sampleX, sampleY, surfaceZ);
-            Block* airAbove = GetBlock(sampleX, sampleY, surfaceZ + 1);
+            BlockPtr surfaceBlock = GetBlock(sampleX, sampleY, surfaceZ);
+            BlockPtr airAbove = GetBlock(sampleX, sampleY, surfaceZ + 1);
 
             if (surfaceBlock && airAbove)
             {
@@ -4230,7 +5183,7 @@ void Chunk::InitializeLighting()
             {
                 for (int x = 0; x < CHUNK_SIZE_X; x++)
                 {
-                    Block* block = GetBlock(x, y, z);
+                    BlockPtr block = GetBlock(x, y, z);
                     if (block)
                     {
                         uint8_t outdoor = block->GetOutdoorLight();
@@ -4269,7 +5222,7 @@ void Chunk::InitializeLighting()
                 int surfaceZ = m_surfaceHeight[x + y * CHUNK_SIZE_X];
                 if (surfaceZ >= 0 && surfaceZ < CHUNK_SIZE_Z - 1)
                 {
-                    Block* airAbove = GetBlock(x, y, surfaceZ + 1);
+                    BlockPtr airAbove = GetBlock(x, y, surfaceZ + 1);
                     if (airAbove && airAbove->GetOutdoorLight() == 0)
                     {
                         DebuggerPrintf("  [POST-INIT BUG] Column(%d,%d) surfaceZ=%d: AIR at z=%d has outdoor=%d! (Expected 15)\n",
@@ -4286,6 +5239,209 @@ void Chunk::InitializeLighting()
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// InitializeLightingLegacy - Per-column top-down scans that InitializeLighting() replaced
+//
+// Kept as the reference for World::RunSkylightInitBenchmark(): both must leave the same light bytes,
+// flag bytes and m_surfaceHeight[] on the same blocks. No debug logging.
+//----------------------------------------------------------------------------------------------------
+void Chunk::InitializeLightingLegacy()
+{
+    // Opacity comes from the block masks (see RecalculateBlockMasks), never from definition lookups.
+    // Section elision: uniform air/stone sections are written without per-block work in the sky/light
+    // passes. Results are identical to the per-block path, since air is always non-opaque and stone
+    // always opaque, and neither is emissive.
+    EnsureBlocksUnpacked();
+
+    ChunkSectionOccupancy sectionOccupancy[CHUNK_SECTION_COUNT];
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+    {
+        sectionOccupancy[sectionIndex] = GetSectionOccupancy(sectionIndex);
+    }
+
+    // CRITICAL FIX (2025-11-16): Two-pass approach to correctly identify sky-visible blocks
+    // Pass 1: Scan from top to bottom, mark blocks as sky-visible if no opaque block above
+    // Pass 2: Scan from top to bottom, set outdoor=15 ONLY for sky-visible blocks until first opaque
+
+    // Pass 1: Find the TRUE surface height (HIGHEST SOLID TERRAIN, not trees/leaves)
+    // CORRECT ALGORITHM: Find the LAST transition from AIR → OPAQUE when descending from sky
+    // This handles all cases: trees touching ground, trees with air gaps, no trees at all
+    // Runs on the opacity mask for all 32 columns of an X row at once (bit x = column x)
+    int columnSurfaceZ[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    std::fill_n(columnSurfaceZ, CHUNK_SIZE_X * CHUNK_SIZE_Y, -1);   // -1 = not found yet
+
+    for (int y = 0; y < CHUNK_SIZE_Y; y++)
+    {
+        uint32_t nonOpaqueAbove = 0;    // Columns whose block at z + 1 is AIR / non-opaque
+        uint32_t surfaceFound   = 0;    // Columns with a surface height so far
+
+        for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+        {
+            uint32_t const opaqueRow = m_opaqueMask[y + z * CHUNK_SIZE_Y];
+
+            // AIR → OPAQUE transitions replace the surface (keep searching deeper: caves, overhangs, etc.);
+            // the first opaque block of a column with no air above (e.g., bedrock column) sets it once
+            uint32_t newSurfaces = opaqueRow & (nonOpaqueAbove | ~surfaceFound);
+            surfaceFound        |= newSurfaces;
+            nonOpaqueAbove       = ~opaqueRow;
+
+            while (newSurfaces != 0)
+            {
+                int const x = std::countr_zero(newSurfaces);
+                newSurfaces &= newSurfaces - 1;
+                columnSurfaceZ[x + y * CHUNK_SIZE_X] = z;
+            }
+        }
+    }
+
+    // Scan each (x,y) column from top to bottom
+    for (int x = 0; x < CHUNK_SIZE_X; x++)
+    {
+        for (int y = 0; y < CHUNK_SIZE_Y; y++)
+        {
+            int const surfaceHeightForColumn = columnSurfaceZ[x + y * CHUNK_SIZE_X];
+
+            // If we never found any opaque blocks, surface is at -1 (all air column)
+            // This is handled by the sky-visible scan below
+
+            // Second scan: Mark sky-visible blocks (only blocks ABOVE surface get sky-visible=true)
+            for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+            {
+                if ((z & (CHUNK_SECTION_SIZE_Z - 1)) == CHUNK_SECTION_SIZE_Z - 1)
+                {
+                    ChunkSectionOccupancy const occupancy = sectionOccupancy[GetSectionIndex(z)];
+                    if (occupancy != ChunkSectionOccupancy::MIXED)
+                    {
+                        int const  sectionBottomZ = z - (CHUNK_SECTION_SIZE_Z - 1);
+                        bool const isAir          = (occupancy == ChunkSectionOccupancy::ALL_AIR);
+                        for (int sectionZ = z; sectionZ >= sectionBottomZ; sectionZ--)
+                        {
+                            uint8_t&   bitFlags   = m_blockBitFlags[LocalCoordsToIndex(x, y, sectionZ)];
+                            bool const seesTheSky = isAir && sectionZ > surfaceHeightForColumn;
+                            bitFlags              = seesTheSky ? (uint8_t)(bitFlags | 0x01) : (uint8_t)(bitFlags & ~0x01);
+                        }
+                        z = sectionBottomZ;
+                        continue;
+                    }
+                }
+
+                BlockPtr block = GetBlock(x, y, z);
+                if (!block) continue;
+
+                // Blocks ABOVE the true surface (including tree leaves/logs and air) can see sky
+                if (z > surfaceHeightForColumn)
+                {
+                    if (!IsBlockOpaque(LocalCoordsToIndex(x, y, z)))  // Only non-opaque blocks get sky-visible flag
+                    {
+                        block->SetIsSkyVisible(true);
+                    }
+                    else
+                    {
+                        block->SetIsSkyVisible(false);  // Tree leaves/logs above surface don't see sky
+                    }
+                }
+                else
+                {
+                    // Blocks AT or BELOW surface cannot see sky
+                    block->SetIsSkyVisible(false);
+                }
+            }
+
+            // Pass 2: Set outdoor light based on sky visibility
+            // CRITICAL FIX: Don't break at FIRST opaque - break at SURFACE HEIGHT from Pass 1!
+            // This handles tree leaves above the terrain surface correctly.
+            for (int z = CHUNK_SIZE_Z - 1; z >= 0; z--)
+            {
+                if ((z & (CHUNK_SECTION_SIZE_Z - 1)) == CHUNK_SECTION_SIZE_Z - 1)
+                {
+                    ChunkSectionOccupancy const occupancy = sectionOccupancy[GetSectionIndex(z)];
+                    if (occupancy != ChunkSectionOccupancy::MIXED)
+                    {
+                        // Stone: outdoor=0 / indoor=0. Air: outdoor=15 only where the sky pass marked it visible.
+                        // Written straight into the lighting array: 0xF0 is outdoor=15 / indoor=0
+                        int const sectionBottomZ = z - (CHUNK_SECTION_SIZE_Z - 1);
+                        for (int sectionZ = z; sectionZ >= sectionBottomZ; sectionZ--)
+                        {
+                            int const  blockIndex = LocalCoordsToIndex(x, y, sectionZ);
+                            bool const seesTheSky = (occupancy == ChunkSectionOccupancy::ALL_AIR) && (m_blockBitFlags[blockIndex] & 0x01) != 0;
+                            m_blockLightingData[blockIndex] = seesTheSky ? (uint8_t)0xF0 : (uint8_t)0x00;
+                        }
+                        z = sectionBottomZ;
+                        continue;
+                    }
+                }
+
+                BlockPtr block = GetBlock(x, y, z);
+                if (!block)
+                    continue;
+
+                sBlockDefinition* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
+                if (!blockDef)
+                    continue;
+
+                // Process blocks ABOVE and AT the surface
+                if (z >= surfaceHeightForColumn || surfaceHeightForColumn == -1)
+                {
+                    if (IsBlockOpaque(LocalCoordsToIndex(x, y, z)))
+                    {
+                        // A5 SPEC COMPLIANT: ALL opaque blocks get outdoor=0 (NO EXCEPTIONS)
+                        // Per spec Task 3 (lines 154-155): "if (!foundSolid) outdoor=15 else outdoor=0"
+                        // Water/ice/leaves are marked isOpaque="true" for gameplay collision,
+                        // so InitializeLighting() treats them as opaque → outdoor=0
+                        // RecalculateBlockLighting() will handle light propagation THROUGH them
+                        block->SetOutdoorLight(0);
+
+                        // Check if emissive (glowstone, lava, etc.)
+                        if (blockDef->IsEmissive())
+                        {
+                            block->SetIndoorLight(blockDef->GetEmissiveValue());
+                        }
+                        else
+                        {
+                            block->SetIndoorLight(0);
+                        }
+                    }
+                    else  // Non-opaque block (AIR, WATER, etc.)
+                    {
+                        // Only sky-visible blocks get outdoor=15
+                        if (block->IsSkyVisible())
+                        {
+                            block->SetOutdoorLight(15);
+                            block->SetIndoorLight(0);
+                        }
+                        else
+                        {
+                            // Non-sky-visible air (shouldn't happen above surface, but handle it)
+                            block->SetOutdoorLight(0);
+                            block->SetIndoorLight(0);
+                        }
+                    }
+                }
+                else
+                {
+                    // Blocks BELOW surface - set to darkness
+                    // A5 SPEC COMPLIANT: ALL blocks below surface get outdoor=0 (NO EXCEPTIONS)
+                    block->SetOutdoorLight(0);
+
+                    // Check if emissive (glowstone, lava, etc.)
+                    if (blockDef->IsEmissive())
+                    {
+                        block->SetIndoorLight(blockDef->GetEmissiveValue());
+                    }
+                    else
+                    {
+                        block->SetIndoorLight(0);
+                    }
+                }
+            }
+
+            // CRITICAL FIX: Populate m_surfaceHeight[] for chunks loaded from disk
+            // This is essential for OnActivate() to add correct blocks to dirty light queue
+            m_surfaceHeight[x + y * CHUNK_SIZE_X] = surfaceHeightForColumn;
+        }
+    }
+}
+
 
 //----------------------------------------------------------------------------------------------------
 // Assignment 5 Phase 6: Populate dirty light queue with edge blocks on chunk activation
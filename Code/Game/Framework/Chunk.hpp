@@ -6,6 +6,8 @@
 #pragma once
 #include <vector>
 #include <atomic>
+#include <memory>
+#include <mutex>
 
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Math/AABB3.hpp"
@@ -13,6 +15,7 @@
 #include "Engine/Math/IntVec3.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
 #include "Game/Framework/Block.hpp"
+#include "Game/Framework/BlockPalette.hpp"
 #include "Game/Framework/GameCommon.hpp"  // For BiomeType enum
 
 //-Forward-Declaration--------------------------------------------------------------------------------
@@ -24,6 +27,10 @@ class IndexBuffer;
 class VertexBuffer;
 class BlockIterator;
 class World;  // Assignment 5 Phase 6: For OnActivate() method
+struct CompressedChunkData;
+class BiomeRegionCache;
+struct ChunkGenerationContext;
+struct TreeFeature;
 
 //----------------------------------------------------------------------------------------------------
 // Phase 0, Task 0.5: Larger chunk sizes for Assignment 4 (World Generation)
@@ -46,6 +53,50 @@ int constexpr CHUNK_MASK_Y     = CHUNK_MAX_Y << CHUNK_BITS_X;
 int constexpr CHUNK_MASK_Z     = CHUNK_MAX_Z << (CHUNK_BITS_X + CHUNK_BITS_Y);      // Bit mask (0xFFC00) to extract Z bits from block index
 int constexpr BLOCKS_PER_CHUNK = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;        // Total blocks per chunk (32×32×256 = 262,144)
 
+//----------------------------------------------------------------------------------------------------
+// Vertical chunk sections: Z is the most significant part of the block index, so each 16-layer
+// section is one contiguous index range [section * BLOCKS_PER_CHUNK_SECTION, (section + 1) * BLOCKS_PER_CHUNK_SECTION)
+//----------------------------------------------------------------------------------------------------
+int constexpr CHUNK_SECTION_BITS_Z     = 4;                                                        // Section height needs 4 bits (16 layers)
+int constexpr CHUNK_SECTION_SIZE_Z     = 1 << CHUNK_SECTION_BITS_Z;                                // 16 blocks tall per section
+int constexpr CHUNK_SECTION_COUNT      = CHUNK_SIZE_Z / CHUNK_SECTION_SIZE_Z;                      // 16 sections per chunk column
+int constexpr BLOCKS_PER_CHUNK_SECTION = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SECTION_SIZE_Z;       // 32×32×16 = 16,384 blocks per section
+
+//----------------------------------------------------------------------------------------------------
+// ChunkSectionOccupancy - Whole-section classification so uniform sections are handled in one check
+// Most columns are air from z~120 up and solid stone below z~40, so these cover the majority of a chunk.
+//----------------------------------------------------------------------------------------------------
+enum class ChunkSectionOccupancy : uint8_t
+{
+    MIXED = 0,      // Needs per-block processing
+    ALL_AIR,        // Nothing to mesh; lighting depends only on the column surface height
+    ALL_STONE       // Opaque, unlit, never sky-visible; only the section shell can have visible faces
+};
+
+//----------------------------------------------------------------------------------------------------
+// Per-block bit masks: one uint32_t per (y,z) row of 32 blocks along X, bit x = block x
+// Row index = blockIndex >> CHUNK_BITS_X = y + z * CHUNK_SIZE_Y, so the X neighbors of a whole row are
+// one shift away and the Y / Z neighbors are the rows at +-1 / +-CHUNK_SIZE_Y
+//----------------------------------------------------------------------------------------------------
+static_assert(CHUNK_SIZE_X == 32, "Chunk block masks hold one X row per uint32_t");
+int constexpr CHUNK_ROW_COUNT        = CHUNK_SIZE_Y * CHUNK_SIZE_Z;               // 8,192 rows per chunk
+int constexpr CHUNK_ROWS_PER_SECTION = CHUNK_SIZE_Y * CHUNK_SECTION_SIZE_Z;       // 512 rows per vertical section
+
+//----------------------------------------------------------------------------------------------------
+// BlockFace - Face order of Chunk::GetRowFaceVisibility() and of both meshers' face loops
+//----------------------------------------------------------------------------------------------------
+enum class BlockFace : uint8_t
+{
+    TOP,        // +Z
+    BOTTOM,     // -Z
+    EAST,       // +X
+    WEST,       // -X
+    NORTH,      // +Y
+    SOUTH,      // -Y
+    COUNT
+};
+int constexpr BLOCK_FACE_COUNT = (int)BlockFace::COUNT;
+
 //----------------------------------------------------------------------------------------------------
 // ChunkState - Thread-safe chunk lifecycle management
 //
@@ -133,20 +184,53 @@ struct BiomeData
 };
 
 //----------------------------------------------------------------------------------------------------
-// Cross-Chunk Tree Placement Data (Option 1: Post-Processing Pass)
+// ChunkGenerationStage - Terrain generation pipeline stages, in run order
+//
+// A stage reads only what earlier stages left in the chunk or in its generation context, so a run can
+// stop after any stage and continue later on another worker (see Chunk::RunGenerationStages).
 //----------------------------------------------------------------------------------------------------
-// Stores trees that need to extend into neighboring chunks
-struct CrossChunkTreeData
+enum class ChunkGenerationStage : uint8_t
 {
-    int localX;           // X coordinate within this chunk (0-31)
-    int localY;           // Y coordinate within this chunk (0-31)
-    int localZ;           // Z coordinate within this chunk (0-255)
-    TreeStamp* treeStamp; // Pointer to tree stamp definition
-    // Direction indicates which neighbor chunks this tree extends into
-    bool extendsNorth;    // +Y direction
-    bool extendsSouth;    // -Y direction
-    bool extendsEast;     // +X direction
-    bool extendsWest;     // -X direction
+    BIOME = 0,      // Climate layers, biome selection and per-column temperature (Pass 1)
+    DENSITY,        // Density noise volume, column surface profile, ravine and river spans
+    TERRAIN,        // Density threshold, caves, carvers, ores, water and ice (Pass 2)
+    SURFACE,        // Surface heights and biome surface / subsurface layers
+    TREES,          // Tree stamps of every tree overlapping the chunk, including trees rooted in neighbors
+    LIGHTING,       // Section occupancy, column heights and InitializeLighting()
+    COUNT
+};
+
+int constexpr CHUNK_GENERATION_STAGE_COUNT = (int)ChunkGenerationStage::COUNT;
+
+char const* GetChunkGenerationStageName(ChunkGenerationStage stage);
+
+// Config dependencies: WORLDGEN_SECTION_* flags each stage reads, and the first stage reading any of them
+uint32_t             GetStageConfigSections(ChunkGenerationStage stage);
+ChunkGenerationStage GetFirstAffectedStage(uint32_t changedSections);     // COUNT if no stage reads them
+
+//----------------------------------------------------------------------------------------------------
+// ChunkGenerationSettings - Per-run options of the generation pipeline, fixed when BIOME starts
+//----------------------------------------------------------------------------------------------------
+struct ChunkGenerationSettings
+{
+    int               m_densityLatticeStepXY    = 1;          // Steps of 1 = exact density noise
+    int               m_densityLatticeStepZ     = 1;
+    bool              m_useColumnSurfaceProfile = true;       // false = legacy per-block surface search
+    BiomeRegionCache* m_biomeRegionCache        = nullptr;    // nullptr = exact climate per column
+    bool              m_retainSurfaceSnapshot   = false;      // Keep post-SURFACE block types for tree-only re-runs
+    bool              m_retainIntermediates     = false;      // Keep the generation context past LIGHTING for restages from DENSITY
+};
+
+//----------------------------------------------------------------------------------------------------
+// ChunkGenerationTimings - Wall time of each stage in the last generation run of a chunk
+//----------------------------------------------------------------------------------------------------
+struct ChunkGenerationTimings
+{
+    double m_stageSeconds[CHUNK_GENERATION_STAGE_COUNT] = {};     // 0 for stages that did not run
+
+    double GetStageSeconds(ChunkGenerationStage const stage) const { return m_stageSeconds[(int)stage]; }
+    double GetTerrainSeconds() const;                            // BIOME through TREES
+    double GetLightingSeconds() const { return GetStageSeconds(ChunkGenerationStage::LIGHTING); }
 };
 
 //----------------------------------------------------------------------------------------------------
@@ -156,6 +240,11 @@ public:
     explicit Chunk(IntVec2 const& chunkCoords);
     ~Chunk();
 
+    // Chunk pooling: return a recycled chunk to the freshly-constructed state at new coordinates
+    // Keeps the block allocation and CPU mesh vector capacity, releases GPU buffers
+    void ResetForReuse(IntVec2 const& chunkCoords);
+    void ReleaseRenderBuffers();
+
     void Update(float deltaSeconds);
     void Render();
 
@@ -167,8 +256,23 @@ public:
     int GetIndexCount() const { return (int)m_indices.size(); }
 
     // Core methods
-    void GenerateTerrain();
+    void GenerateTerrain();     // Density lattice steps and biome region cache from g_worldGenConfig
+    void GenerateTerrain(int densityLatticeStepXY, int densityLatticeStepZ, bool useColumnSurfaceProfile,
+                         BiomeRegionCache* biomeRegionCache);   // Steps of 1 = exact density noise; false = legacy per-block surface search; nullptr = exact climate per column
     void RebuildMesh();
+    ChunkGenerationTimings const& GetGenerationTimings() const { return m_generationTimings; }
+
+    // Staged terrain generation (GenerateTerrain() runs every stage in one call)
+    // BeginGeneration() starts a run at BIOME; RunGenerationStages() continues it at GetNextGenerationStage()
+    // PrepareRestage() rewinds a COMPLETE chunk to a stage CanRestageFrom() allows (main thread only)
+    static ChunkGenerationSettings GetDefaultGenerationSettings();
+    void                           BeginGeneration(ChunkGenerationSettings const& settings);
+    void                           RunGenerationStages(ChunkGenerationStage lastStage);
+    ChunkGenerationStage           GetNextGenerationStage() const { return m_nextGenerationStage; }
+    bool                           CanRestageFrom(ChunkGenerationStage stage) const;
+    void                           PrepareRestage(ChunkGenerationStage firstStage);
+    size_t                         GetSurfaceSnapshotBytes() const;
+    size_t                         GetRetainedIntermediateBytes() const;
 
     // Assignment 5 Phase 6: Chunk activation lighting
     void OnActivate(World* world);
@@ -183,8 +287,14 @@ public:
     // Make ChunkMeshJob a friend class so it can access private mesh generation methods
     friend class ChunkMeshJob;
 
-    Block* GetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ);
-    void   SetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ, uint8_t blockTypeIndex, World* world = nullptr);
+    BlockPtr GetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ);
+    void     SetBlock(int localBlockIndexX, int localBlockIndexY, int localBlockIndexZ, uint8_t blockTypeIndex, World* world = nullptr);
+
+    // Structure-of-arrays block storage: BLOCKS_PER_CHUNK bytes each, indexed by LocalCoordsToIndex()
+    // For hot loops that only need one attribute (mesher, lighting init, RLE writer); unpacks on demand
+    uint8_t* GetBlockTypeIndices() { EnsureBlocksUnpacked(); return m_blockTypeIndices; }
+    uint8_t* GetBlockLightingData() { EnsureBlocksUnpacked(); return m_blockLightingData; }
+    uint8_t* GetBlockBitFlags() { EnsureBlocksUnpacked(); return m_blockBitFlags; }
 
     // Static utility functions for chunk coordinate management
     static int     LocalCoordsToIndex(IntVec3 const& localCoords);
@@ -207,6 +317,8 @@ public:
     void SetNeedsSaving(bool const needsSaving) { m_needsSaving = needsSaving; }
     bool GetIsMeshDirty() const { return m_isMeshDirty; }
     void SetIsMeshDirty(bool const isDirty) { m_isMeshDirty = isDirty; }
+    int  GetLightQueueSlot() const { return m_lightQueueSlot; }
+    void SetLightQueueSlot(int const slot) { m_lightQueueSlot = slot; }
 
     // Debug rendering control
     bool GetDebugDraw() const { return m_drawDebug; }
@@ -230,19 +342,56 @@ public:
     bool IsComplete() const { return GetState() == ChunkState::COMPLETE; }
     bool CanBeModified() const { return GetState() == ChunkState::COMPLETE; }
 
-    // Cross-Chunk Tree Placement (Option 1: Post-Processing Pass)
-    void PlaceCrossChunkTrees();
-    void PlaceTreeInNeighborChunk(Chunk* neighborChunk, TreeStamp* treeStamp,
-                                int treeBaseX, int treeBaseY, int treeBaseZ,
-                                int offsetX, int offsetY, int offsetZ);
-
     // Disk I/O operations (thread-safe, called by I/O worker thread)
     bool LoadFromDisk();
     bool SaveToDisk() const;
 
     // Assignment 5 Phase 3: Initial lighting setup (called after terrain generation or disk load)
     // Made public so ChunkLoadJob can call it after loading from disk
+    // Needs current block masks and heightmap; InitializeLightingLegacy() is the per-column reference
     void InitializeLighting();
+    void InitializeLightingLegacy();
+    int  GetSurfaceHeight(int localBlockIndexX, int localBlockIndexY) const { return m_surfaceHeight[localBlockIndexX + localBlockIndexY * CHUNK_SIZE_X]; }
+
+    // Vertical section occupancy (kept current by SetBlock, recalculated after generation / disk load)
+    ChunkSectionOccupancy          GetSectionOccupancy(int sectionIndex) const;
+    void                           RecalculateSectionOccupancy();
+    static int                     GetSectionIndex(int localBlockIndexZ) { return localBlockIndexZ >> CHUNK_SECTION_BITS_Z; }
+
+    // Per-block opacity / solidity bit masks (kept current by SetBlock, recalculated after generation / disk load)
+    // Stay resident while the block arrays are packed, so these queries never unpack the chunk
+    bool     IsBlockOpaque(int blockIndex) const { return ((m_opaqueMask[blockIndex >> CHUNK_BITS_X] >> (blockIndex & CHUNK_MASK_X)) & 1u) != 0; }
+    bool     IsBlockSolid(int blockIndex) const { return ((m_solidMask[blockIndex >> CHUNK_BITS_X] >> (blockIndex & CHUNK_MASK_X)) & 1u) != 0; }
+    uint32_t GetOpaqueRow(int rowIndex) const { return m_opaqueMask[rowIndex]; }
+    uint32_t GetSolidRow(int rowIndex) const { return m_solidMask[rowIndex]; }
+    void     RecalculateBlockMasks();
+
+    // Bit x of outVisibleFaces[face] is set where block x of the row has a non-opaque neighbor across that face
+    // (see BlockFace). Neighbor chunks may be null: their border blocks then count as opaque or not per
+    // isMissingNeighborOpaque. Nothing hides faces at the top or bottom of the world.
+    void GetRowFaceVisibility(int rowIndex, Chunk const* eastNeighbor, Chunk const* westNeighbor,
+                              Chunk const* northNeighbor, Chunk const* southNeighbor, bool isMissingNeighborOpaque,
+                              uint32_t outVisibleFaces[BLOCK_FACE_COUNT]) const;
+
+    // Per-column heightmap (kept current by SetBlock, recalculated after generation / disk load)
+    // Local z of the highest non-air / opaque block in column (x,y), or -1 if the column has none
+    int  GetHighestNonAirZ(int localBlockIndexX, int localBlockIndexY) const { return m_highestNonAirZ[localBlockIndexX + localBlockIndexY * CHUNK_SIZE_X]; }
+    int  GetHighestOpaqueZ(int localBlockIndexX, int localBlockIndexY) const { return m_highestOpaqueZ[localBlockIndexX + localBlockIndexY * CHUNK_SIZE_X]; }
+    void RecalculateColumnHeights();
+
+    // Biome noise and type of column (x,y), written by GenerateTerrain() Pass 1
+    BiomeData const& GetBiomeData(int localBlockIndexX, int localBlockIndexY) const { return m_biomeData[localBlockIndexX + localBlockIndexY * CHUNK_SIZE_X]; }
+
+    // Palette-compressed block storage (main thread only, see World::PackIdleChunks)
+    // Packed chunks transparently re-expand on the next GetBlock/SetBlock/BlockIterator access
+    void   PackBlocks();
+    bool   IsBlockStoragePacked() const { return m_isPacked.load(std::memory_order_acquire); }
+    size_t GetResidentBlockBytes() const;
+    void   CopyBlocksTo(uint8_t* outTypeIndices, uint8_t* outLightingData, uint8_t* outBitFlags) const;   // Snapshot without unpacking
+
+    // In-memory chunk cache (see ChunkCache): blocks with light and flags plus surface heights
+    void CompressTo(CompressedChunkData& outData) const;
+    void DecompressFrom(CompressedChunkData const& data);
 
 private:
     /// @brief 6. Chunk coordinates: 2D, IntVec2 (int x,y), with x and y axes aligned with world axes (above).
@@ -251,7 +400,30 @@ private:
     IntVec2 m_chunkCoords = IntVec2::ZERO;
     /// @brief
     AABB3 m_worldBounds = AABB3::ZERO;
-    Block m_blocks[BLOCKS_PER_CHUNK]; // 1D array for cache efficiency
+
+    // Block storage as three 1D arrays (structure-of-arrays) carved from one BLOCKS_PER_CHUNK * 3 allocation
+    // Each attribute is contiguous, so a scan over types touches 256 KB instead of the full 768 KB
+    // All three are nullptr while packed
+    uint8_t* m_blockTypeIndices  = nullptr;    // Block::m_typeIndex
+    uint8_t* m_blockLightingData = nullptr;    // Block::m_lightingData (outdoor high nibble, indoor low nibble)
+    uint8_t* m_blockBitFlags     = nullptr;    // Block::m_bitFlags (bit 0: isSkyVisible)
+
+    // Palette-compressed copy of the block arrays, one entry per vertical section, only populated while m_isPacked
+    PalettedBlockSection m_packedSections[CHUNK_SECTION_COUNT];
+    std::atomic<bool>    m_isPacked{false};
+    mutable std::mutex   m_blockStorageMutex;   // Serializes lazy unpacking between main and worker threads
+
+    // Per-section block counts backing GetSectionOccupancy() (16,384 fits in uint16_t)
+    uint16_t m_sectionAirCount[CHUNK_SECTION_COUNT]   = {};
+    uint16_t m_sectionStoneCount[CHUNK_SECTION_COUNT] = {};
+
+    // Per-column heightmap backing GetHighestNonAirZ() / GetHighestOpaqueZ() (-1 = none, all-air on construction)
+    int16_t m_highestNonAirZ[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+    int16_t m_highestOpaqueZ[CHUNK_SIZE_X * CHUNK_SIZE_Y];
+
+    // Per-block masks backing IsBlockOpaque() / IsBlockSolid(), one word per row (32 KB each, all-air on construction)
+    uint32_t m_opaqueMask[CHUNK_ROW_COUNT] = {};
+    uint32_t m_solidMask[CHUNK_ROW_COUNT]  = {};
 
     // Assignment 4: Biome data per (x,y) column (Phase 1, Task 1.2)
     // Stores 6 noise parameters and biome type for each horizontal column
@@ -262,7 +434,14 @@ private:
     // Value of -1 indicates no solid blocks found in column (all air)
     int m_surfaceHeight[CHUNK_SIZE_X * CHUNK_SIZE_Y];
 
-    std::vector<CrossChunkTreeData> m_crossChunkTrees;
+    ChunkGenerationTimings m_generationTimings;     // Written by each stage on the generating thread
+
+    // Generation pipeline state: the context lives from BeginGeneration() to the end of LIGHTING, or to the
+    // next BIOME run when retained (see ChunkGenerationSettings::m_retainIntermediates)
+    std::unique_ptr<ChunkGenerationContext> m_generationContext;
+    ChunkGenerationStage                    m_nextGenerationStage = ChunkGenerationStage::BIOME;
+    std::vector<PalettedBlockSection>       m_surfaceSnapshot;            // Blocks after SURFACE, one per section; empty unless retained
+    std::vector<int>                        m_surfaceSnapshotHeights;     // m_surfaceHeight after SURFACE; empty unless retained
 
     // Rendering
     VertexList_PCU m_vertices;
@@ -276,8 +455,9 @@ private:
     bool           m_drawDebug         = false;
 
     // Chunk management flags for persistent world
-    bool m_needsSaving = false;        // true if chunk has been modified and needs to be saved to disk
-    bool m_isMeshDirty = true;         // true if mesh needs regeneration
+    bool m_needsSaving    = false;     // true if chunk has been modified and needs to be saved to disk
+    bool m_isMeshDirty    = true;      // true if mesh needs regeneration
+    int  m_lightQueueSlot = -1;        // World's DirtyLightQueue slot, -1 until a block of this chunk is queued
 
     // Thread-safe chunk state (atomic for multi-threaded access)
     mutable std::atomic<ChunkState> m_state{ChunkState::CONSTRUCTING};
@@ -288,14 +468,47 @@ private:
     Chunk* m_eastNeighbor  = nullptr;   // +X direction
     Chunk* m_westNeighbor  = nullptr;   // -X direction
 
+    // Section occupancy bookkeeping for a single block type change
+    void UpdateSectionOccupancy(int blockIndex, uint8_t oldTypeIndex, uint8_t newTypeIndex);
+
+    // Heightmap bookkeeping for a single block type change
+    void UpdateColumnHeights(int blockIndex, uint8_t newTypeIndex);
+
+    // Opacity / solidity mask bookkeeping for a single block type change
+    void UpdateBlockMasks(int blockIndex, uint8_t newTypeIndex);
+
+    // Block storage helpers
+    void     AllocateBlockStorage();
+    void     FreeBlockStorage();
+    BlockPtr GetBlockAtIndex(int blockIndex) { return BlockPtr(m_blockTypeIndices + blockIndex, m_blockLightingData + blockIndex, m_blockBitFlags + blockIndex); }
+
+    // Palette storage helpers
+    void UnpackBlocks();
+    void EnsureBlocksUnpacked() { if (m_isPacked.load(std::memory_order_acquire)) UnpackBlocks(); }
+
+    // Generation pipeline stages (see ChunkGenerationStage)
+    void RunBiomeStage(ChunkGenerationContext& context);
+    void RunDensityStage(ChunkGenerationContext& context);
+    void RunTerrainStage(ChunkGenerationContext& context);
+    void RunSurfaceStage(ChunkGenerationContext& context);
+    void RunTreeStage(ChunkGenerationSettings const& settings);
+    void RunLightingStage();
+    void GenerateDebugVisualizationTerrain(DebugVisualizationMode vizMode);
+
+    // Tree features (TREES stage): per-column tree records, so neighbors can stamp their part of a tree
+    void CollectTreeFeatures(int minX, int minY, int maxX, int maxY, std::vector<TreeFeature>& outFeatures) const;
+    void CollectNeighborTreeFeatures(ChunkGenerationSettings const& settings, std::vector<TreeFeature>& outFeatures) const;
+    void ProbeTreeFeatures(ChunkGenerationSettings const& settings, int minX, int minY, int maxX, int maxY,
+                           std::vector<TreeFeature>& outFeatures);
+    void StampTreeFeature(TreeFeature const& feature);
+
     // Helper methods
     void AddBlockFacesIfVisible(Vec3 const& blockCenter, sBlockDefinition* def, IntVec3 const& coords);
     void AddBlockFace(Vec3 const& blockCenter, Vec3 const& faceNormal, Vec2 const& uvs, Rgba8 const& tint);
 
 
     // Advanced mesh generation with hidden surface removal (accessible to ChunkMeshJob)
-    void AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter, sBlockDefinition* def);
-    bool IsFaceVisible(BlockIterator const& blockIter, IntVec3 const& faceDirection) const;
+    void AddBlockFacesWithHiddenSurfaceRemoval(BlockIterator const& blockIter, sBlockDefinition* def, uint8_t visibleFaceBits);
 
     // Make BlockIterator constructor accessible for ChunkMeshJob
     friend class BlockIterator;
@@ -0,0 +1,155 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkActivationFrontier.cpp - Incremental nearest-missing-chunk search around the camera
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ChunkActivationFrontier.hpp"
+
+#include <algorithm>
+#include <climits>
+
+#include "Game/Gameplay/World.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Offsets are bounded by the normal-mode activation range (DEBUG_FIXED_WORLD_GEN activates its own grid)
+int constexpr FRONTIER_RADIUS_CHUNKS = FULL_CHUNK_ACTIVATION_RANGE / CHUNK_SIZE_X + 1;
+int constexpr FRONTIER_BOX_SIZE      = 2 * FRONTIER_RADIUS_CHUNKS + 1;
+
+static_assert(FRONTIER_BOX_SIZE <= CHUNK_GRID_SIZE, "Activation frontier does not fit the toroidal slot window");
+
+//----------------------------------------------------------------------------------------------------
+ChunkActivationFrontier::ChunkActivationFrontier()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkActivationFrontier::SetCenter(IntVec2 const& centerChunkCoords)
+{
+    if (centerChunkCoords != m_center)
+    {
+        m_center = centerChunkCoords;
+        m_cursor = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 ChunkActivationFrontier::FindNextMissing()
+{
+    std::vector<IntVec2> const& offsets = GetSortedOffsets();
+
+    // Everything before the cursor is active or pending; stop (without advancing) at the first gap
+    while (m_cursor < (int)offsets.size())
+    {
+        IntVec2 const chunkCoords = m_center + offsets[m_cursor];
+        if (GetSlotState(chunkCoords) == ChunkSlotState::MISSING)
+        {
+            return chunkCoords;
+        }
+        ++m_cursor;
+    }
+
+    return IntVec2(INT_MAX, INT_MAX);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkActivationFrontier::SetSlotState(IntVec2 const& chunkCoords, ChunkSlotState const state)
+{
+    int const slotIndex = GetSlotIndex(chunkCoords);
+
+    if (state != ChunkSlotState::MISSING)
+    {
+        m_slotCoords[slotIndex] = chunkCoords;
+        m_slotStates[slotIndex] = state;
+        return;
+    }
+
+    if (m_slotCoords[slotIndex] != chunkCoords)
+    {
+        return;     // Slot already belongs to another chunk, so this one already reads as MISSING
+    }
+    m_slotStates[slotIndex] = ChunkSlotState::MISSING;
+
+    // A hole behind the cursor must be found again
+    int const offsetIndex = GetOffsetIndex(IntVec2(chunkCoords.x - m_center.x, chunkCoords.y - m_center.y));
+    if (offsetIndex >= 0 && offsetIndex < m_cursor)
+    {
+        m_cursor = offsetIndex;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkActivationFrontier::Clear()
+{
+    for (int slotIndex = 0; slotIndex < CHUNK_GRID_SIZE * CHUNK_GRID_SIZE; ++slotIndex)
+    {
+        m_slotCoords[slotIndex] = IntVec2(INT_MAX, INT_MAX);
+        m_slotStates[slotIndex] = ChunkSlotState::MISSING;
+    }
+    m_cursor = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+ChunkSlotState ChunkActivationFrontier::GetSlotState(IntVec2 const& chunkCoords) const
+{
+    int const slotIndex = GetSlotIndex(chunkCoords);
+    return (m_slotCoords[slotIndex] == chunkCoords) ? m_slotStates[slotIndex] : ChunkSlotState::MISSING;
+}
+
+//----------------------------------------------------------------------------------------------------
+// GetSortedOffsets - Chunk offsets whose center lies within activation range of the center chunk's center
+//
+// Sorted by squared distance, ties broken by (y, x) so the order is deterministic across platforms.
+//----------------------------------------------------------------------------------------------------
+std::vector<IntVec2> const& ChunkActivationFrontier::GetSortedOffsets()
+{
+    static std::vector<IntVec2> const s_offsets = []()
+    {
+        int constexpr        RANGE_SQUARED = FULL_CHUNK_ACTIVATION_RANGE * FULL_CHUNK_ACTIVATION_RANGE;
+        std::vector<IntVec2> offsets;
+
+        for (int dy = -FRONTIER_RADIUS_CHUNKS; dy <= FRONTIER_RADIUS_CHUNKS; ++dy)
+        {
+            for (int dx = -FRONTIER_RADIUS_CHUNKS; dx <= FRONTIER_RADIUS_CHUNKS; ++dx)
+            {
+                int const distanceX = dx * CHUNK_SIZE_X;
+                int const distanceY = dy * CHUNK_SIZE_Y;
+                if (distanceX * distanceX + distanceY * distanceY <= RANGE_SQUARED)
+                {
+                    offsets.emplace_back(dx, dy);
+                }
+            }
+        }
+
+        std::stable_sort(offsets.begin(), offsets.end(), [](IntVec2 const& a, IntVec2 const& b)
+        {
+            return (a.x * a.x + a.y * a.y) < (b.x * b.x + b.y * b.y);
+        });
+        return offsets;
+    }();
+
+    return s_offsets;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ChunkActivationFrontier::GetOffsetIndex(IntVec2 const& offset)
+{
+    static std::vector<int> const s_indexByOffset = []()
+    {
+        std::vector<int>            indexByOffset(FRONTIER_BOX_SIZE * FRONTIER_BOX_SIZE, -1);
+        std::vector<IntVec2> const& offsets = GetSortedOffsets();
+        for (int offsetIndex = 0; offsetIndex < (int)offsets.size(); ++offsetIndex)
+        {
+            IntVec2 const& sortedOffset = offsets[offsetIndex];
+            indexByOffset[(sortedOffset.x + FRONTIER_RADIUS_CHUNKS) + (sortedOffset.y + FRONTIER_RADIUS_CHUNKS) * FRONTIER_BOX_SIZE] = offsetIndex;
+        }
+        return indexByOffset;
+    }();
+
+    if (offset.x < -FRONTIER_RADIUS_CHUNKS || offset.x > FRONTIER_RADIUS_CHUNKS ||
+        offset.y < -FRONTIER_RADIUS_CHUNKS || offset.y > FRONTIER_RADIUS_CHUNKS)
+    {
+        return -1;
+    }
+    return s_indexByOffset[(offset.x + FRONTIER_RADIUS_CHUNKS) + (offset.y + FRONTIER_RADIUS_CHUNKS) * FRONTIER_BOX_SIZE];
+}
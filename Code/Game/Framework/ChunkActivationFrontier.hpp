@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkActivationFrontier.hpp - Incremental nearest-missing-chunk search around the camera
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/ChunkGrid.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class ChunkSlotState : uint8_t
+{
+    MISSING,    // Wanted (if in range) but neither active nor in flight
+    PENDING,    // Generation or disk load job submitted
+    ACTIVE      // In World::m_activeChunks
+};
+
+//----------------------------------------------------------------------------------------------------
+// ChunkActivationFrontier - Replaces the per-call ring walk over copied active/queued sets
+//
+// The wanted set is a precomputed table of chunk offsets within activation range, sorted nearest first.
+// A cursor marks how far into that table every chunk is already active or pending, so consecutive
+// FindNextMissing() calls resume where the last one stopped instead of rescanning from the center.
+// World reports every state change through SetSlotState(); a chunk going back to MISSING behind the
+// cursor rewinds it. Crossing a chunk boundary re-centers the table and restarts the cursor, which is
+// one pass of array reads over ~700 entries rather than thousands of hash inserts per frame.
+//
+// Slot states live in a toroidal CHUNK_GRID_SIZE^2 array (same indexing as ChunkGrid), tagged with
+// their coordinates so a stale chunk on the far side of the window reads as MISSING.
+//
+// Thread Safety:
+// - Main thread only (chunk activation and job completion both run there)
+//----------------------------------------------------------------------------------------------------
+class ChunkActivationFrontier
+{
+public:
+    ChunkActivationFrontier();
+
+    void    SetCenter(IntVec2 const& centerChunkCoords);
+    IntVec2 FindNextMissing();      // Nearest MISSING chunk in range, IntVec2(INT_MAX, INT_MAX) if none; O(1) amortized
+    void    SetSlotState(IntVec2 const& chunkCoords, ChunkSlotState state);
+    void    Clear();
+
+    ChunkSlotState GetSlotState(IntVec2 const& chunkCoords) const;
+    int            GetCursor() const { return m_cursor; }
+    static int     GetOffsetCount() { return (int)GetSortedOffsets().size(); }
+
+private:
+    static std::vector<IntVec2> const& GetSortedOffsets();
+    static int                         GetOffsetIndex(IntVec2 const& offset);     // -1 if not in the table
+    static int                         GetSlotIndex(IntVec2 const& chunkCoords) { return (chunkCoords.x & CHUNK_GRID_MASK) | ((chunkCoords.y & CHUNK_GRID_MASK) << CHUNK_GRID_BITS); }
+
+    IntVec2        m_center = IntVec2::ZERO;
+    int            m_cursor = 0;
+    IntVec2        m_slotCoords[CHUNK_GRID_SIZE * CHUNK_GRID_SIZE];
+    ChunkSlotState m_slotStates[CHUNK_GRID_SIZE * CHUNK_GRID_SIZE];
+};
@@ -0,0 +1,129 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkCache.cpp - Compressed in-memory LRU cache of recently deactivated chunks
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ChunkCache.hpp"
+
+//----------------------------------------------------------------------------------------------------
+size_t CompressedChunkData::GetResidentBytes() const
+{
+    size_t totalBytes = sizeof(CompressedChunkData);
+    for (PalettedBlockSection const& section : m_sections)
+    {
+        totalBytes += section.GetResidentBytes();
+    }
+    return totalBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+ChunkCache::ChunkCache(size_t const byteBudget)
+    : m_byteBudget(byteBudget)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkCache::Store(Chunk const& chunk)
+{
+    uint64_t const key = GetKey(chunk.GetChunkCoords());
+
+    auto found = m_entries.find(key);
+    if (found == m_entries.end())
+    {
+        found = m_entries.emplace(key, Entry()).first;
+    }
+    else
+    {
+        m_residentBytes -= found->second.m_residentBytes;
+        m_lruOrder.erase(found->second.m_lruPosition);
+    }
+
+    Entry& entry = found->second;
+    chunk.CompressTo(entry.m_data);
+    entry.m_residentBytes = entry.m_data.GetResidentBytes();
+    m_residentBytes      += entry.m_residentBytes;
+
+    m_lruOrder.push_front(key);
+    entry.m_lruPosition = m_lruOrder.begin();
+
+    EvictToBudget();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkCache::Restore(Chunk& chunk)
+{
+    auto const found = m_entries.find(GetKey(chunk.GetChunkCoords()));
+    if (found == m_entries.end())
+    {
+        ++m_missCount;
+        return false;
+    }
+
+    chunk.DecompressFrom(found->second.m_data);
+    ++m_hitCount;
+
+    m_residentBytes -= found->second.m_residentBytes;
+    m_lruOrder.erase(found->second.m_lruPosition);
+    m_entries.erase(found);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkCache::Contains(IntVec2 const& chunkCoords)
+{
+    if (m_entries.contains(GetKey(chunkCoords)))
+    {
+        return true;
+    }
+
+    ++m_missCount;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkCache::Erase(IntVec2 const& chunkCoords)
+{
+    auto const found = m_entries.find(GetKey(chunkCoords));
+    if (found == m_entries.end())
+    {
+        return;
+    }
+
+    m_residentBytes -= found->second.m_residentBytes;
+    m_lruOrder.erase(found->second.m_lruPosition);
+    m_entries.erase(found);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkCache::Clear()
+{
+    m_entries.clear();
+    m_lruOrder.clear();
+    m_residentBytes = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkCache::SetByteBudget(size_t const byteBudget)
+{
+    m_byteBudget = byteBudget;
+    EvictToBudget();
+}
+
+//----------------------------------------------------------------------------------------------------
+uint64_t ChunkCache::GetKey(IntVec2 const& chunkCoords)
+{
+    return ((uint64_t)(uint32_t)chunkCoords.x << 32) | (uint64_t)(uint32_t)chunkCoords.y;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkCache::EvictToBudget()
+{
+    while (m_residentBytes > m_byteBudget && !m_lruOrder.empty())
+    {
+        auto const found = m_entries.find(m_lruOrder.back());
+        m_residentBytes -= found->second.m_residentBytes;
+        m_entries.erase(found);
+        m_lruOrder.pop_back();
+        ++m_evictionCount;
+    }
+}
@@ -0,0 +1,78 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkCache.hpp - Compressed in-memory LRU cache of recently deactivated chunks
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/BlockPalette.hpp"
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// CompressedChunkData - Everything needed to bring a chunk back to COMPLETE without disk or lighting work
+//
+// Blocks are stored as one palette section per vertical section. Palette entries hold the full Block
+// (type, light nibbles and flags), so the settled light survives the round trip. Surface heights are
+// kept because OnActivate() seeds light propagation from them.
+//----------------------------------------------------------------------------------------------------
+struct CompressedChunkData
+{
+    PalettedBlockSection m_sections[CHUNK_SECTION_COUNT];
+    int16_t              m_surfaceHeight[CHUNK_SIZE_X * CHUNK_SIZE_Y] = {};   // -1..255, same as Chunk::m_surfaceHeight
+
+    size_t GetResidentBytes() const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// ChunkCache - Size-bounded LRU of CompressedChunkData keyed by chunk coordinates
+//
+// World stores every chunk it deactivates here and ActivateChunk() checks the cache before disk or
+// generation. A hit removes the entry (the chunk is live again and gets re-stored on its next
+// deactivation). When resident bytes exceed the budget, the least recently stored entries are dropped.
+// Dropping an entry loses nothing: modified chunks still go through ChunkSaveJob as before.
+//
+// Thread Safety:
+// - Main thread only (same as chunk activation/deactivation)
+//----------------------------------------------------------------------------------------------------
+class ChunkCache
+{
+public:
+    explicit ChunkCache(size_t byteBudget);
+
+    void Store(Chunk const& chunk);
+    bool Restore(Chunk& chunk);     // Looks up chunk's coordinates; on a hit fills the chunk and drops the entry
+    bool Contains(IntVec2 const& chunkCoords);     // Counts a miss when absent, so callers can skip allocating a Chunk to Restore() into
+    void Erase(IntVec2 const& chunkCoords);
+    void Clear();
+
+    void   SetByteBudget(size_t byteBudget);
+    size_t GetByteBudget() const { return m_byteBudget; }
+    size_t GetResidentBytes() const { return m_residentBytes; }
+    int    GetEntryCount() const { return (int)m_entries.size(); }
+    int    GetHitCount() const { return m_hitCount; }
+    int    GetMissCount() const { return m_missCount; }
+    int    GetEvictionCount() const { return m_evictionCount; }
+
+private:
+    struct Entry
+    {
+        CompressedChunkData           m_data;
+        size_t                        m_residentBytes = 0;
+        std::list<uint64_t>::iterator m_lruPosition;
+    };
+
+    static uint64_t GetKey(IntVec2 const& chunkCoords);
+    void            EvictToBudget();
+
+    std::unordered_map<uint64_t, Entry> m_entries;
+    std::list<uint64_t>                 m_lruOrder;           // Front = most recently stored
+    size_t                              m_byteBudget    = 0;
+    size_t                              m_residentBytes = 0;
+    int                                 m_hitCount      = 0;
+    int                                 m_missCount     = 0;
+    int                                 m_evictionCount = 0;
+};
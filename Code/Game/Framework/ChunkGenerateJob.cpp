@@ -8,10 +8,13 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 
 //----------------------------------------------------------------------------------------------------
-ChunkGenerateJob::ChunkGenerateJob(Chunk* chunk)
-    : m_chunk(chunk)
+ChunkGenerateJob::ChunkGenerateJob(Chunk* chunk, ChunkGenerationStage const lastStage)
+    : m_chunk(chunk),
+      m_lastStage(lastStage)
 {
     GUARANTEE_OR_DIE(m_chunk != nullptr, "ChunkGenerateJob created with null chunk pointer");
+    m_firstStage = m_chunk->GetNextGenerationStage();
+    GUARANTEE_OR_DIE(m_firstStage <= m_lastStage, "ChunkGenerateJob created with an empty stage range");
     
     // Verify chunk is in the correct state for terrain generation
     ChunkState currentState = m_chunk->GetState();
@@ -32,7 +35,13 @@ void ChunkGenerateJob::Execute()
         
         // Mark as successful
         m_wasSuccessful = true;
-        
+
+        // Intermediate stage jobs leave the chunk in TERRAIN_GENERATING for the next stage job
+        if (!IsFinalStage())
+        {
+            return;
+        }
+
         // Transition chunk to next state (lighting initialization)
         bool stateChanged = m_chunk->CompareAndSetState(ChunkState::TERRAIN_GENERATING, 
                                                        ChunkState::LIGHTING_INITIALIZING);
@@ -71,10 +80,14 @@ void ChunkGenerateJob::GenerateTerrainData()
         return;
     }
     
-    // Call the existing terrain generation method
-    // This method is thread-safe for chunks in TERRAIN_GENERATING state
+    // Run the stage range
+    // This is thread-safe for chunks in TERRAIN_GENERATING state
     // because only worker threads access block data during this phase
-    m_chunk->GenerateTerrain();
+    if (m_firstStage == ChunkGenerationStage::BIOME)
+    {
+        m_chunk->BeginGeneration(Chunk::GetDefaultGenerationSettings());
+    }
+    m_chunk->RunGenerationStages(m_lastStage);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -6,16 +6,15 @@
 #pragma once
 #include "Engine/Core/Job.hpp"
 #include "Engine/Math/IntVec2.hpp"
-
-//----------------------------------------------------------------------------------------------------
-class Chunk;
+#include "Game/Framework/Chunk.hpp"
 
 //----------------------------------------------------------------------------------------------------
 // ChunkGenerateJob - Asynchronous terrain generation for chunk data
 //
 // This job moves expensive chunk terrain generation off the main thread to eliminate frame drops.
-// The job operates on a chunk in TERRAIN_GENERATING state and transitions it to LIGHTING_INITIALIZING
-// when complete.
+// The job operates on a chunk in TERRAIN_GENERATING state and runs its generation stages from
+// Chunk::GetNextGenerationStage() through lastStage. Only a job that ends with the LIGHTING stage
+// transitions the chunk to LIGHTING_INITIALIZING; otherwise World submits a job for the next stage.
 //
 // Thread Safety:
 // - Execute() method runs on worker threads only
@@ -31,15 +30,15 @@ class Chunk;
 // Lifecycle:
 // 1. Main thread creates job with chunk pointer
 // 2. JobSystem queues job for worker thread
-// 3. Worker thread executes terrain generation
-// 4. Job transitions chunk state to LIGHTING_INITIALIZING
+// 3. Worker thread executes the generation stages
+// 4. Job transitions chunk state to LIGHTING_INITIALIZING (after the LIGHTING stage only)
 // 5. Main thread retrieves completed job and handles lighting
 //----------------------------------------------------------------------------------------------------
 class ChunkGenerateJob : public Job
 {
 public:
-    // Constructor: Takes chunk pointer that will be processed
-    explicit ChunkGenerateJob(Chunk* chunk);
+    // Constructor: Takes chunk pointer that will be processed and the last stage to run
+    explicit ChunkGenerateJob(Chunk* chunk, ChunkGenerationStage lastStage = ChunkGenerationStage::LIGHTING);
 
     // Destructor: Cleanup any resources
     ~ChunkGenerateJob() override = default;
@@ -58,10 +57,18 @@ public:
     IntVec2 GetChunkCoords() const;
     bool    WasSuccessful() const { return m_wasSuccessful; }
 
+    ChunkGenerationStage GetFirstStage() const { return m_firstStage; }
+    ChunkGenerationStage GetLastStage() const { return m_lastStage; }
+    bool                 IsFinalStage() const { return m_lastStage == ChunkGenerationStage::LIGHTING; }
+
 private:
     // Target chunk for terrain generation
     Chunk* m_chunk = nullptr;
 
+    // Stage range, fixed at construction (the chunk is not in flight yet)
+    ChunkGenerationStage m_firstStage = ChunkGenerationStage::BIOME;
+    ChunkGenerationStage m_lastStage  = ChunkGenerationStage::LIGHTING;
+
     // Success flag for error handling
     bool m_wasSuccessful = false;
 
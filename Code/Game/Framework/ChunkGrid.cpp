@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkGrid.cpp - Fixed-size toroidal grid of active chunk pointers for lock-free lookups
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ChunkGrid.hpp"
+
+#include <algorithm>
+
+//----------------------------------------------------------------------------------------------------
+// StoreSlot - Publish a slot's key and chunk as one unit (seqlock writer side, main thread only)
+//----------------------------------------------------------------------------------------------------
+void ChunkGrid::StoreSlot(ChunkGridSlot& slot, uint64_t const coordsKey, Chunk* chunk)
+{
+    uint32_t const sequence = slot.m_sequence.load(std::memory_order_relaxed);
+    slot.m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.m_coordsKey.store(coordsKey, std::memory_order_relaxed);
+    slot.m_chunk.store(chunk, std::memory_order_relaxed);
+    slot.m_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkGrid::Insert(IntVec2 const& chunkCoords, Chunk* chunk)
+{
+    ChunkGridSlot& slot      = m_slots[GetSlotIndex(chunkCoords)];
+    uint64_t const coordsKey = PackChunkCoords(chunkCoords);
+    Chunk* const   occupant  = slot.m_chunk.load(std::memory_order_relaxed);
+
+    // Slot held by a chunk from the other side of the window: keep this one in the map only
+    // (a chunk with the same coordinates is a replaced map entry, so the slot simply follows the map)
+    if (occupant != nullptr && occupant != chunk && slot.m_coordsKey.load(std::memory_order_relaxed) != coordsKey)
+    {
+        // A waiting chunk with the same coordinates is a replaced map entry as well
+        for (Chunk*& waitingChunk : m_overflowChunks)
+        {
+            if (waitingChunk == chunk || waitingChunk->GetChunkCoords() == chunkCoords)
+            {
+                waitingChunk = chunk;
+                return false;
+            }
+        }
+
+        m_overflowChunks.push_back(chunk);
+        m_overflowCount.fetch_add(1, std::memory_order_release);
+        return false;
+    }
+
+    StoreSlot(slot, coordsKey, chunk);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkGrid::Remove(IntVec2 const& chunkCoords, Chunk const* chunk)
+{
+    int const      slotIndex = GetSlotIndex(chunkCoords);
+    ChunkGridSlot& slot      = m_slots[slotIndex];
+
+    if (slot.m_chunk.load(std::memory_order_relaxed) != chunk)
+    {
+        // Chunk was never placed in the grid (see Insert)
+        auto const it = std::find(m_overflowChunks.begin(), m_overflowChunks.end(), chunk);
+        if (it != m_overflowChunks.end())
+        {
+            m_overflowChunks.erase(it);
+            m_overflowCount.fetch_sub(1, std::memory_order_release);
+        }
+        return;
+    }
+
+    // Hand the freed slot to a chunk waiting for it, if any
+    // (stored before the count drops, so a reader never sees neither the slot nor the overflow)
+    for (auto it = m_overflowChunks.begin(); it != m_overflowChunks.end(); ++it)
+    {
+        if (GetSlotIndex((*it)->GetChunkCoords()) == slotIndex)
+        {
+            StoreSlot(slot, PackChunkCoords((*it)->GetChunkCoords()), *it);
+            m_overflowChunks.erase(it);
+            m_overflowCount.fetch_sub(1, std::memory_order_release);
+            return;
+        }
+    }
+    StoreSlot(slot, slot.m_coordsKey.load(std::memory_order_relaxed), nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkGrid::Clear()
+{
+    for (ChunkGridSlot& slot : m_slots)
+    {
+        StoreSlot(slot, slot.m_coordsKey.load(std::memory_order_relaxed), nullptr);
+    }
+    m_overflowChunks.clear();
+    m_overflowCount.store(0, std::memory_order_release);
+}
@@ -0,0 +1,88 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkGrid.hpp - Fixed-size toroidal grid of active chunk pointers for lock-free lookups
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr CHUNK_GRID_BITS = 6;
+int constexpr CHUNK_GRID_SIZE = 1 << CHUNK_GRID_BITS;      // 64 x 64 slots, must exceed the active chunk diameter
+int constexpr CHUNK_GRID_MASK = CHUNK_GRID_SIZE - 1;
+
+//----------------------------------------------------------------------------------------------------
+// ChunkGrid - Slot (x & 63, y & 63) holds the active chunk with those coordinates
+//
+// Active chunks always lie within CHUNK_DEACTIVATION_RANGE of the player, so wrapping chunk coordinates
+// modulo the window keeps the grid implicitly centered on the player: the player moving one chunk simply
+// frees the slots behind them for the chunks ahead. No recentering pass is ever needed.
+//
+// A slot can briefly be wanted by two chunks (e.g. after a teleport, before the old chunks are
+// deactivated). The later chunk then stays out of the grid and is counted as overflow; while any
+// overflow exists, a grid miss is not authoritative and World falls back to its locked map.
+// Removing the slot's occupant moves a waiting overflow chunk into the slot, so the overflow drains as
+// the old chunks are deactivated (a teleport by a multiple of the grid size aliases every slot).
+//
+// Each slot carries the packed coordinates of its chunk next to the pointer, and Find() compares those
+// instead of Chunk::GetChunkCoords(): a chunk that has just been removed can be recycled through the
+// World's chunk pool, which rewrites its coordinates on the main thread while a reader may still hold
+// the stale pointer. Key and pointer are published together under a per-slot sequence counter.
+//
+// Thread Safety:
+// - Find() is lock-free and safe from any thread; it retries only while the main thread rewrites that slot
+// - Insert() / Remove() / Clear() are main thread only, called under World::m_activeChunksMutex
+//----------------------------------------------------------------------------------------------------
+class ChunkGrid
+{
+public:
+    ChunkGrid() = default;
+
+    Chunk* Find(IntVec2 const& chunkCoords) const
+    {
+        ChunkGridSlot const& slot      = m_slots[GetSlotIndex(chunkCoords)];
+        uint64_t const       coordsKey = PackChunkCoords(chunkCoords);
+        for (;;)
+        {
+            uint32_t const sequence = slot.m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1u) != 0) continue;     // Main thread mid-write
+
+            uint64_t const slotKey = slot.m_coordsKey.load(std::memory_order_relaxed);
+            Chunk* const   chunk   = slot.m_chunk.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.m_sequence.load(std::memory_order_relaxed) != sequence) continue;     // Torn read
+
+            return slotKey == coordsKey ? chunk : nullptr;
+        }
+    }
+
+    bool Insert(IntVec2 const& chunkCoords, Chunk* chunk);     // false if the slot is taken (chunk counted as overflow)
+    void Remove(IntVec2 const& chunkCoords, Chunk const* chunk);
+    void Clear();
+
+    bool HasOverflow() const { return m_overflowCount.load(std::memory_order_acquire) > 0; }
+    int  GetOverflowCount() const { return m_overflowCount.load(std::memory_order_acquire); }
+
+private:
+    // Odd m_sequence: the main thread is rewriting m_coordsKey / m_chunk. An empty slot has a null m_chunk,
+    // so whatever key it keeps, a match on it still finds nothing
+    struct ChunkGridSlot
+    {
+        std::atomic<uint32_t> m_sequence{0};
+        std::atomic<uint64_t> m_coordsKey{0};
+        std::atomic<Chunk*>   m_chunk{nullptr};
+    };
+
+    static int      GetSlotIndex(IntVec2 const& chunkCoords) { return (chunkCoords.x & CHUNK_GRID_MASK) | ((chunkCoords.y & CHUNK_GRID_MASK) << CHUNK_GRID_BITS); }
+    static uint64_t PackChunkCoords(IntVec2 const& chunkCoords) { return ((uint64_t)(uint32_t)chunkCoords.x << 32) | (uint64_t)(uint32_t)chunkCoords.y; }
+    static void     StoreSlot(ChunkGridSlot& slot, uint64_t coordsKey, Chunk* chunk);
+
+    ChunkGridSlot       m_slots[CHUNK_GRID_SIZE * CHUNK_GRID_SIZE];
+    std::atomic<int>    m_overflowCount{0};
+    std::vector<Chunk*> m_overflowChunks;       // Chunks kept out of a taken slot, m_overflowCount of them
+};
@@ -0,0 +1,151 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkJobScheduler.cpp - Priority queue of chunk jobs not yet handed to the JobSystem
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ChunkJobScheduler.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void ChunkJobScheduler::Enqueue(IntVec2 const& chunkCoords, ChunkJobKind const kind)
+{
+    ScheduledChunkJob job;
+    job.m_chunkCoords = chunkCoords;
+    job.m_kind        = kind;
+    job.m_priority    = ComputePriority(chunkCoords, m_viewpoint);
+    m_jobs.push_back(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkJobScheduler::Enqueue(Chunk* chunk, ChunkJobKind const kind)
+{
+    if (chunk == nullptr)
+    {
+        return;
+    }
+
+    ScheduledChunkJob job;
+    job.m_chunkCoords = chunk->GetChunkCoords();
+    job.m_chunk       = chunk;
+    job.m_kind        = kind;
+    job.m_priority    = ComputePriority(job.m_chunkCoords, m_viewpoint);
+    m_jobs.push_back(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkJobScheduler::Reprioritize(ChunkJobViewpoint const& viewpoint, float const cancelDistance, std::vector<ScheduledChunkJob>& outCancelledJobs)
+{
+    m_viewpoint = viewpoint;
+
+    float const cancelDistanceSquared = cancelDistance * cancelDistance;
+    int         keptCount             = 0;
+
+    for (ScheduledChunkJob& job : m_jobs)
+    {
+        IntVec2 const chunkCenter = Chunk::GetChunkCenter(job.m_chunkCoords);
+        float const   deltaX      = (float)chunkCenter.x - viewpoint.m_position.x;
+        float const   deltaY      = (float)chunkCenter.y - viewpoint.m_position.y;
+
+        // Left behind by the camera: never started, so nothing to undo
+        if (deltaX * deltaX + deltaY * deltaY > cancelDistanceSquared)
+        {
+            outCancelledJobs.push_back(job);
+            continue;
+        }
+
+        job.m_priority     = ComputePriority(job.m_chunkCoords, viewpoint);
+        m_jobs[keptCount++] = job;
+    }
+    m_jobs.resize(keptCount);
+
+    std::sort(m_jobs.begin(), m_jobs.end(), [](ScheduledChunkJob const& a, ScheduledChunkJob const& b)
+    {
+        return a.m_priority < b.m_priority;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+int ChunkJobScheduler::TakeNext(ChunkJobKind const kind, int const maxCount, std::vector<ScheduledChunkJob>& outJobs)
+{
+    int takenCount = 0;
+    int keptCount  = 0;
+
+    for (ScheduledChunkJob const& job : m_jobs)
+    {
+        if (job.m_kind == kind && takenCount < maxCount)
+        {
+            outJobs.push_back(job);
+            ++takenCount;
+            continue;
+        }
+        m_jobs[keptCount++] = job;
+    }
+    m_jobs.resize(keptCount);
+
+    return takenCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkJobScheduler::Clear(std::vector<ScheduledChunkJob>& outJobs)
+{
+    outJobs.insert(outJobs.end(), m_jobs.begin(), m_jobs.end());
+    m_jobs.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+int ChunkJobScheduler::GetQueuedCount(ChunkJobKind const kind) const
+{
+    int count = 0;
+    for (ScheduledChunkJob const& job : m_jobs)
+    {
+        if (job.m_kind == kind)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+// ComputePriority - XY distance to the chunk center, scaled down ahead of the camera and the movement
+//
+// Chunks within CHUNK_JOB_NEAR_DISTANCE keep their plain distance: the player stands on them whichever
+// way the camera faces. Beyond that the combined scale stays within [0.4, 1.6], so a chunk ahead can
+// overtake nearer chunks behind the camera but never one less than 0.4x its distance away.
+//----------------------------------------------------------------------------------------------------
+float ChunkJobScheduler::ComputePriority(IntVec2 const& chunkCoords, ChunkJobViewpoint const& viewpoint)
+{
+    IntVec2 const chunkCenter = Chunk::GetChunkCenter(chunkCoords);
+    float const   deltaX      = (float)chunkCenter.x - viewpoint.m_position.x;
+    float const   deltaY      = (float)chunkCenter.y - viewpoint.m_position.y;
+    float const   distance    = sqrtf(deltaX * deltaX + deltaY * deltaY);
+
+    if (distance <= CHUNK_JOB_NEAR_DISTANCE)
+    {
+        return distance;
+    }
+
+    float const directionX = deltaX / distance;
+    float const directionY = deltaY / distance;
+    float       scale      = 1.f;
+
+    float const forwardLength = sqrtf(viewpoint.m_forward.x * viewpoint.m_forward.x + viewpoint.m_forward.y * viewpoint.m_forward.y);
+    if (forwardLength > 0.001f)     // Zero when looking straight up or down: no preferred direction
+    {
+        float const facing = (viewpoint.m_forward.x * directionX + viewpoint.m_forward.y * directionY) / forwardLength;
+        scale -= CHUNK_JOB_VIEW_WEIGHT * facing;
+    }
+
+    float const speed = sqrtf(viewpoint.m_velocity.x * viewpoint.m_velocity.x + viewpoint.m_velocity.y * viewpoint.m_velocity.y);
+    if (speed > CHUNK_JOB_MIN_SPEED)
+    {
+        float const heading = (viewpoint.m_velocity.x * directionX + viewpoint.m_velocity.y * directionY) / speed;
+        scale -= CHUNK_JOB_VELOCITY_WEIGHT * heading;
+    }
+
+    return distance * scale;
+}
@@ -0,0 +1,77 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkJobScheduler.hpp - Priority queue of chunk jobs not yet handed to the JobSystem
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+class Chunk;
+
+//----------------------------------------------------------------------------------------------------
+float constexpr CHUNK_JOB_NEAR_DISTANCE   = 64.f;    // Chunks this close (XY, to chunk center) are ordered by distance only
+float constexpr CHUNK_JOB_VIEW_WEIGHT     = 0.35f;   // Effective distance scale: x0.65 straight ahead, x1.35 behind
+float constexpr CHUNK_JOB_VELOCITY_WEIGHT = 0.25f;   // Extra scale along (x0.75) or against (x1.25) the movement direction
+float constexpr CHUNK_JOB_MIN_SPEED       = 1.0f;    // Below this speed (m/s) velocity does not affect priority
+
+//----------------------------------------------------------------------------------------------------
+enum class ChunkJobKind : uint8_t
+{
+    GENERATE,   // Submitted through World::SubmitChunkForGeneration (generic workers)
+    LOAD        // Submitted through World::SubmitChunkForLoading (I/O worker)
+};
+
+//----------------------------------------------------------------------------------------------------
+struct ChunkJobViewpoint
+{
+    Vec3 m_position = Vec3::ZERO;
+    Vec3 m_forward  = Vec3::ZERO;   // Camera forward; only its XY direction is used
+    Vec3 m_velocity = Vec3::ZERO;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct ScheduledChunkJob
+{
+    IntVec2      m_chunkCoords = IntVec2::ZERO;
+    Chunk*       m_chunk       = nullptr;   // Null for a fresh activation: World allocates the chunk at submission
+    ChunkJobKind m_kind        = ChunkJobKind::GENERATE;
+    float        m_priority    = 0.f;       // Effective distance in blocks, lower runs first
+};
+
+//----------------------------------------------------------------------------------------------------
+// ChunkJobScheduler - Holds chunk jobs between ActivateChunk() and job submission
+//
+// Jobs handed to the JobSystem cannot be recalled, so World keeps only a small number in flight and
+// parks the rest here. A fresh activation is parked as bare coordinates: its Chunk (block storage,
+// masks, heightmaps) is only allocated once a worker slot is free for it, so hundreds of parked jobs
+// after a teleport cost a few bytes each. Chunks that already exist (restaged, between pipeline
+// stages, or a failed load) are parked with their pointer and stay ACTIVATING meanwhile. Every frame Reprioritize() re-scores each parked job from the current camera
+// position, view direction and velocity, and drops jobs for chunks that have fallen out of range;
+// TakeNext() then hands out the best jobs as worker slots free up. A turn or teleport therefore only
+// ever wastes the handful of jobs already in flight.
+//
+// Thread Safety:
+// - Main thread only
+//----------------------------------------------------------------------------------------------------
+class ChunkJobScheduler
+{
+public:
+    void Enqueue(IntVec2 const& chunkCoords, ChunkJobKind kind);     // Fresh activation, no Chunk yet
+    void Enqueue(Chunk* chunk, ChunkJobKind kind);                   // Existing ACTIVATING chunk
+    void Reprioritize(ChunkJobViewpoint const& viewpoint, float cancelDistance, std::vector<ScheduledChunkJob>& outCancelledJobs);
+    int  TakeNext(ChunkJobKind kind, int maxCount, std::vector<ScheduledChunkJob>& outJobs);   // Best first, removes them
+    void Clear(std::vector<ScheduledChunkJob>& outJobs);
+
+    int GetQueuedCount() const { return (int)m_jobs.size(); }
+    int GetQueuedCount(ChunkJobKind kind) const;
+
+    static float ComputePriority(IntVec2 const& chunkCoords, ChunkJobViewpoint const& viewpoint);
+
+private:
+    std::vector<ScheduledChunkJob> m_jobs;          // Sorted by m_priority after Reprioritize(), new jobs appended
+    ChunkJobViewpoint              m_viewpoint;     // Viewpoint of the last Reprioritize(), scores new jobs
+};
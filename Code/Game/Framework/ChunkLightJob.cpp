@@ -0,0 +1,455 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkLightJob.cpp - Chunk-local light flood fill on a worker thread
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ChunkLightJob.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Definition/BlockDefinition.hpp"
+
+//----------------------------------------------------------------------------------------------------
+uint8_t constexpr LIGHT_HALO_ABSENT_FLAG = 0x80;    // Snapshot-only m_bitFlags bit: no loaded chunk behind this halo block
+
+//----------------------------------------------------------------------------------------------------
+uint8_t GetLightSourceLevel(LightChannel const channel, sBlockDefinition const* blockDef, uint8_t const bitFlags)
+{
+    if (channel == LightChannel::OUTDOOR)
+    {
+        return (bitFlags & 0x01) != 0 ? MAX_LIGHT_LEVEL : 0;     // Block::IsSkyVisible()
+    }
+    return blockDef->IsEmissive() ? blockDef->GetEmissiveValue() : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool CanBlockReceiveLight(LightChannel const channel, sBlockDefinition const* blockDef, uint8_t const bitFlags)
+{
+    if (blockDef->IsOpaque()) return false;
+
+    return (channel == LightChannel::OUTDOOR) ? (bitFlags & 0x01) == 0 : !blockDef->IsEmissive();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool CanBlockProvideLight(LightChannel const channel, sBlockDefinition const* blockDef)
+{
+    return (channel == LightChannel::INDOOR) || !blockDef->IsOpaque() || blockDef->IsEmissive();
+}
+
+//----------------------------------------------------------------------------------------------------
+ChunkLightJob::ChunkLightJob(Chunk*                               chunk,
+                             std::vector<int> const&              seedIndices,
+                             std::vector<LightBorderDelta> const& incomingDeltas)
+    : m_chunk(chunk),
+      m_seedIndices(seedIndices),
+      m_incomingDeltas(incomingDeltas)
+{
+    GUARANTEE_OR_DIE(m_chunk != nullptr, "ChunkLightJob created with null chunk pointer");
+    GUARANTEE_OR_DIE(m_chunk->IsComplete(), "ChunkLightJob created for chunk not in COMPLETE state");
+
+    m_chunkCoords = m_chunk->GetChunkCoords();
+
+    m_typeIndices.assign(LIGHT_HALO_VOLUME, 0);
+    m_lightingData.assign(LIGHT_HALO_VOLUME, 0);
+    m_bitFlags.assign(LIGHT_HALO_VOLUME, LIGHT_HALO_ABSENT_FLAG);
+
+    // --- Interior: one 32-byte row per (y, z) from each array ---
+    uint8_t const* typeIndices  = m_chunk->GetBlockTypeIndices();
+    uint8_t const* lightingData = m_chunk->GetBlockLightingData();
+    uint8_t const* bitFlags     = m_chunk->GetBlockBitFlags();
+    for (int z = 0; z < CHUNK_SIZE_Z; ++z)
+    {
+        for (int y = 0; y < CHUNK_SIZE_Y; ++y)
+        {
+            int const blockIndex = Chunk::LocalCoordsToIndex(0, y, z);
+            int const cell       = GetHaloCell(0, y, z);
+            memcpy(&m_typeIndices[cell], typeIndices + blockIndex, CHUNK_SIZE_X);
+            memcpy(&m_lightingData[cell], lightingData + blockIndex, CHUNK_SIZE_X);
+            memcpy(&m_bitFlags[cell], bitFlags + blockIndex, CHUNK_SIZE_X);
+        }
+    }
+
+    // --- Halo: the facing border blocks of each COMPLETE neighbor ---
+    Chunk* const neighbors[CHUNK_BORDER_COUNT] = {
+        m_chunk->GetEastNeighbor(), m_chunk->GetWestNeighbor(), m_chunk->GetNorthNeighbor(), m_chunk->GetSouthNeighbor()
+    };
+    for (int borderIndex = 0; borderIndex < CHUNK_BORDER_COUNT; ++borderIndex)
+    {
+        Chunk* neighbor = neighbors[borderIndex];
+        if (neighbor == nullptr || !neighbor->IsComplete()) continue;
+
+        uint8_t const* neighborTypes    = neighbor->GetBlockTypeIndices();
+        uint8_t const* neighborLighting = neighbor->GetBlockLightingData();
+        uint8_t const* neighborFlags    = neighbor->GetBlockBitFlags();
+        for (int z = 0; z < CHUNK_SIZE_Z; ++z)
+        {
+            for (int edge = 0; edge < CHUNK_SIZE_X; ++edge)     // CHUNK_SIZE_X == CHUNK_SIZE_Y
+            {
+                int cell       = 0;
+                int blockIndex = 0;
+                switch ((ChunkBorder)borderIndex)
+                {
+                case ChunkBorder::EAST:  cell = GetHaloCell(CHUNK_SIZE_X, edge, z); blockIndex = Chunk::LocalCoordsToIndex(0, edge, z);           break;
+                case ChunkBorder::WEST:  cell = GetHaloCell(-1, edge, z);           blockIndex = Chunk::LocalCoordsToIndex(CHUNK_MAX_X, edge, z); break;
+                case ChunkBorder::NORTH: cell = GetHaloCell(edge, CHUNK_SIZE_Y, z); blockIndex = Chunk::LocalCoordsToIndex(edge, 0, z);           break;
+                default:                 cell = GetHaloCell(edge, -1, z);           blockIndex = Chunk::LocalCoordsToIndex(edge, CHUNK_MAX_Y, z); break;
+                }
+                m_typeIndices[cell]  = neighborTypes[blockIndex];
+                m_lightingData[cell] = neighborLighting[blockIndex];
+                m_bitFlags[cell]     = neighborFlags[blockIndex];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::Execute()
+{
+    auto const startTime = std::chrono::high_resolution_clock::now();
+
+    BuildChannelRules();
+
+    std::vector<uint8_t> const originalLighting = m_lightingData;
+
+    for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
+    {
+        RunChannel((LightChannel)channelIndex);
+    }
+    m_seedCount = (int64_t)m_seedIndices.size();
+
+    // Changed interior light bytes, in block index order
+    for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+    {
+        int const cell = GetHaloCell(blockIndex);
+        if (m_lightingData[cell] != originalLighting[cell])
+        {
+            m_lightChanges.push_back(ChunkLightChange{blockIndex, m_lightingData[cell]});
+        }
+    }
+
+    m_executeSeconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::ApplyLightToChunk() const
+{
+    if (m_isCancelled || m_lightChanges.empty()) return;
+
+    uint8_t* lightingData = m_chunk->GetBlockLightingData();
+    for (ChunkLightChange const& change : m_lightChanges)
+    {
+        lightingData[change.m_blockIndex] = change.m_lightingData;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// BuildChannelRules - Evaluate the shared channel rules once per (type, sky-visible) pair
+// The block definitions are read-only after startup, so this is safe on a worker thread
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::BuildChannelRules()
+{
+    for (int ruleIndex = 0; ruleIndex < 512; ++ruleIndex)
+    {
+        sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex((uint8_t)(ruleIndex & 0xFF));
+        uint8_t const           bitFlags = (uint8_t)(ruleIndex >> 8);
+
+        for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
+        {
+            LightChannel const channel = (LightChannel)channelIndex;
+            m_sourceLevels[channelIndex][ruleIndex] = blockDef ? GetLightSourceLevel(channel, blockDef, bitFlags) : 0;
+            m_receives[channelIndex][ruleIndex]     = blockDef ? CanBlockReceiveLight(channel, blockDef, bitFlags) : false;
+            m_provides[channelIndex][ruleIndex]     = blockDef ? CanBlockProvideLight(channel, blockDef) : false;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// RunChannel - Removal BFS, then addition BFS, over the snapshot (see World::ProcessDirtyLighting)
+//
+// 1. Removal seeds: incoming removal deltas and dirty blocks brighter than their neighborhood allows
+// 2. Removal BFS:   halo blocks it clears become removal deltas for the neighbor chunk
+// 3. Addition seeds: incoming addition deltas, plus the frontier the removal recorded
+// 4. Addition BFS:  halo blocks are raised but not expanded; their final level becomes an addition delta
+// Halo blocks only ever light interior blocks, the rest of the neighbor chunk is its own job's work.
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::RunChannel(LightChannel const channel)
+{
+    std::vector<RemovalNode> removalQueue;
+    std::vector<int>         additionQueue;
+    std::vector<int>         raisedHaloCells;
+    int                      neighborCells[6];
+
+    // --- 1. Removal seeds ---
+    for (LightBorderDelta const& delta : m_incomingDeltas)
+    {
+        if (delta.m_channel != channel || !delta.m_isRemoval) continue;
+
+        int const     cell  = GetHaloCell(delta.m_blockIndex);
+        uint8_t const light = GetLight(channel, cell);
+        if (light == 0) continue;
+
+        if (light < delta.m_light && CanReceive(channel, cell))
+        {
+            SetLight(channel, cell, 0);
+            removalQueue.push_back(RemovalNode{cell, light});
+        }
+        else
+        {
+            additionQueue.push_back(cell);
+        }
+    }
+
+    for (int const blockIndex : m_seedIndices)
+    {
+        int const     cell         = GetHaloCell(blockIndex);
+        uint8_t const currentLight = GetLight(channel, cell);
+        uint8_t const localLight   = ComputeLocalLight(channel, cell);
+
+        if (localLight < currentLight)
+        {
+            uint8_t const sourceLight = m_sourceLevels[(int)channel][GetRuleIndex(cell)];
+            SetLight(channel, cell, sourceLight);
+            removalQueue.push_back(RemovalNode{cell, currentLight});
+            if (sourceLight > 0)
+            {
+                additionQueue.push_back(cell);
+            }
+        }
+        else if (localLight > currentLight)
+        {
+            SetLight(channel, cell, localLight);
+            additionQueue.push_back(cell);
+        }
+        else if (currentLight > 1)
+        {
+            additionQueue.push_back(cell);
+        }
+    }
+
+    // --- 2. Removal BFS ---
+    for (size_t head = 0; head < removalQueue.size(); ++head)
+    {
+        RemovalNode const node = removalQueue[head];
+        ++m_removalVisitCount;
+
+        int const neighborCount = GetNeighborCells(node.m_cell, neighborCells);
+        for (int neighborIndex = 0; neighborIndex < neighborCount; ++neighborIndex)
+        {
+            int const     neighborCell  = neighborCells[neighborIndex];
+            uint8_t const neighborLight = GetLight(channel, neighborCell);
+            if (neighborLight == 0) continue;
+
+            if (neighborLight < node.m_oldLight && CanReceive(channel, neighborCell))
+            {
+                SetLight(channel, neighborCell, 0);
+                if (IsInteriorCell(neighborCell))
+                {
+                    removalQueue.push_back(RemovalNode{neighborCell, neighborLight});
+                }
+                else
+                {
+                    EmitBorderDelta(neighborCell, channel, node.m_oldLight, true);
+                }
+            }
+            else
+            {
+                additionQueue.push_back(neighborCell);
+            }
+        }
+    }
+
+    // --- 3. Addition seeds ---
+    for (LightBorderDelta const& delta : m_incomingDeltas)
+    {
+        if (delta.m_channel != channel || delta.m_isRemoval) continue;
+
+        int const cell = GetHaloCell(delta.m_blockIndex);
+        if (GetLight(channel, cell) < delta.m_light && CanReceive(channel, cell))
+        {
+            SetLight(channel, cell, delta.m_light);
+            additionQueue.push_back(cell);
+        }
+    }
+
+    // --- 4. Addition BFS ---
+    for (size_t head = 0; head < additionQueue.size(); ++head)
+    {
+        int const cell = additionQueue[head];
+        ++m_additionVisitCount;
+
+        uint8_t const light = GetLight(channel, cell);
+        if (light <= 1 || !CanProvide(channel, cell)) continue;
+
+        uint8_t const propagatedLight = light - 1;
+        int const     neighborCount   = GetNeighborCells(cell, neighborCells);
+        for (int neighborIndex = 0; neighborIndex < neighborCount; ++neighborIndex)
+        {
+            int const neighborCell = neighborCells[neighborIndex];
+            if (GetLight(channel, neighborCell) >= propagatedLight || !CanReceive(channel, neighborCell)) continue;
+
+            SetLight(channel, neighborCell, propagatedLight);
+            if (IsInteriorCell(neighborCell))
+            {
+                additionQueue.push_back(neighborCell);
+            }
+            else
+            {
+                raisedHaloCells.push_back(neighborCell);
+            }
+        }
+    }
+
+    // One addition delta per raised halo block, at its final level
+    std::sort(raisedHaloCells.begin(), raisedHaloCells.end());
+    raisedHaloCells.erase(std::unique(raisedHaloCells.begin(), raisedHaloCells.end()), raisedHaloCells.end());
+    for (int const cell : raisedHaloCells)
+    {
+        EmitBorderDelta(cell, channel, GetLight(channel, cell), false);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// EmitBorderDelta - Translate a halo cell into the neighbor chunk's block index and record the change
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::EmitBorderDelta(int const cell, LightChannel const channel, uint8_t const light, bool const isRemoval)
+{
+    int const z     = cell / LIGHT_HALO_LAYER_SIZE;
+    int const haloX = cell % LIGHT_HALO_SIZE_X;
+    int const haloY = (cell / LIGHT_HALO_SIZE_X) % LIGHT_HALO_SIZE_Y;
+
+    ChunkBorder border     = ChunkBorder::EAST;
+    int         blockIndex = 0;
+    if (haloX == LIGHT_HALO_SIZE_X - 1)
+    {
+        border     = ChunkBorder::EAST;
+        blockIndex = Chunk::LocalCoordsToIndex(0, haloY - 1, z);
+    }
+    else if (haloX == 0)
+    {
+        border     = ChunkBorder::WEST;
+        blockIndex = Chunk::LocalCoordsToIndex(CHUNK_MAX_X, haloY - 1, z);
+    }
+    else if (haloY == LIGHT_HALO_SIZE_Y - 1)
+    {
+        border     = ChunkBorder::NORTH;
+        blockIndex = Chunk::LocalCoordsToIndex(haloX - 1, 0, z);
+    }
+    else
+    {
+        border     = ChunkBorder::SOUTH;
+        blockIndex = Chunk::LocalCoordsToIndex(haloX - 1, CHUNK_MAX_Y, z);
+    }
+
+    m_outgoingDeltas[(int)border].push_back(LightBorderDelta{blockIndex, channel, light, isRemoval});
+}
+
+//----------------------------------------------------------------------------------------------------
+// ComputeLocalLight - Same as World::ComputeLocalLight, on the snapshot
+//----------------------------------------------------------------------------------------------------
+uint8_t ChunkLightJob::ComputeLocalLight(LightChannel const channel, int const cell) const
+{
+    if (!CanReceive(channel, cell))
+    {
+        return IsAbsent(cell) ? 0 : m_sourceLevels[(int)channel][GetRuleIndex(cell)];
+    }
+
+    int     neighborCells[6];
+    int     neighborCount = GetNeighborCells(cell, neighborCells);
+    uint8_t localLight    = 0;
+    for (int neighborIndex = 0; neighborIndex < neighborCount; ++neighborIndex)
+    {
+        int const     neighborCell  = neighborCells[neighborIndex];
+        uint8_t const neighborLight = GetLight(channel, neighborCell);
+        if (neighborLight > localLight + 1 && CanProvide(channel, neighborCell))
+        {
+            localLight = neighborLight - 1;
+        }
+    }
+    return localLight;
+}
+
+//----------------------------------------------------------------------------------------------------
+// GetNeighborCells - Face neighbors inside the snapshot; a halo cell only reaches interior cells
+//----------------------------------------------------------------------------------------------------
+int ChunkLightJob::GetNeighborCells(int const cell, int outNeighborCells[6]) const
+{
+    int const z     = cell / LIGHT_HALO_LAYER_SIZE;
+    int const haloX = cell % LIGHT_HALO_SIZE_X;
+    int const haloY = (cell / LIGHT_HALO_SIZE_X) % LIGHT_HALO_SIZE_Y;
+
+    bool const isInterior    = IsInteriorCell(cell);
+    int        neighborCount = 0;
+
+    auto const addNeighbor = [&](int const neighborCell)
+    {
+        if (isInterior || IsInteriorCell(neighborCell))
+        {
+            outNeighborCells[neighborCount++] = neighborCell;
+        }
+    };
+
+    if (haloX < LIGHT_HALO_SIZE_X - 1) addNeighbor(cell + 1);
+    if (haloX > 0)                     addNeighbor(cell - 1);
+    if (haloY < LIGHT_HALO_SIZE_Y - 1) addNeighbor(cell + LIGHT_HALO_SIZE_X);
+    if (haloY > 0)                     addNeighbor(cell - LIGHT_HALO_SIZE_X);
+    if (z < CHUNK_MAX_Z)               addNeighbor(cell + LIGHT_HALO_LAYER_SIZE);
+    if (z > 0)                         addNeighbor(cell - LIGHT_HALO_LAYER_SIZE);
+
+    return neighborCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint8_t ChunkLightJob::GetLight(LightChannel const channel, int const cell) const
+{
+    uint8_t const lightingData = m_lightingData[cell];
+    return (channel == LightChannel::OUTDOOR) ? (uint8_t)(lightingData >> 4) : (uint8_t)(lightingData & 0x0F);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ChunkLightJob::SetLight(LightChannel const channel, int const cell, uint8_t const light)
+{
+    uint8_t& lightingData = m_lightingData[cell];
+    if (channel == LightChannel::OUTDOOR)
+    {
+        lightingData = (uint8_t)((lightingData & 0x0F) | ((light & 0x0F) << 4));
+    }
+    else
+    {
+        lightingData = (uint8_t)((lightingData & 0xF0) | (light & 0x0F));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkLightJob::IsAbsent(int const cell) const
+{
+    return (m_bitFlags[cell] & LIGHT_HALO_ABSENT_FLAG) != 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkLightJob::CanReceive(LightChannel const channel, int const cell) const
+{
+    return !IsAbsent(cell) && m_receives[(int)channel][GetRuleIndex(cell)];
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkLightJob::CanProvide(LightChannel const channel, int const cell) const
+{
+    return !IsAbsent(cell) && m_provides[(int)channel][GetRuleIndex(cell)];
+}
+
+//----------------------------------------------------------------------------------------------------
+int ChunkLightJob::GetHaloCell(int const blockIndex)
+{
+    return GetHaloCell(Chunk::IndexToLocalX(blockIndex), Chunk::IndexToLocalY(blockIndex), Chunk::IndexToLocalZ(blockIndex));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ChunkLightJob::IsInteriorCell(int const cell)
+{
+    int const haloX = cell % LIGHT_HALO_SIZE_X;
+    int const haloY = (cell / LIGHT_HALO_SIZE_X) % LIGHT_HALO_SIZE_Y;
+    return haloX > 0 && haloX < LIGHT_HALO_SIZE_X - 1 && haloY > 0 && haloY < LIGHT_HALO_SIZE_Y - 1;
+}
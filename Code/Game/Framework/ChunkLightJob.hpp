@@ -0,0 +1,182 @@
+//----------------------------------------------------------------------------------------------------
+// ChunkLightJob.hpp - Chunk-local light flood fill on a worker thread
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Job.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sBlockDefinition;
+
+//----------------------------------------------------------------------------------------------------
+// Light channels: the two nibbles of Block::m_lightingData each run their own flood fill
+//----------------------------------------------------------------------------------------------------
+enum class LightChannel : uint8_t
+{
+    OUTDOOR,    // High nibble: skylight, sourced by sky-visible blocks
+    INDOOR,     // Low nibble: block light, sourced by emissive blocks
+    COUNT
+};
+int constexpr     LIGHT_CHANNEL_COUNT = (int)LightChannel::COUNT;
+uint8_t constexpr MAX_LIGHT_LEVEL     = 15;
+
+//----------------------------------------------------------------------------------------------------
+// Light channel rules, shared by World's main-thread flood fill and ChunkLightJob
+// (the same rules RecalculateBlockLighting() applies per block):
+// - Outdoor: sky-visible blocks are fixed at full skylight; other non-opaque blocks receive from
+//   neighbors that are non-opaque or emissive
+// - Indoor:  emissive blocks are fixed at their emission; other non-opaque blocks receive from any neighbor
+// - Opaque non-emissive blocks hold no light of their own (their faces are lit from their neighbors)
+// bitFlags is Block::m_bitFlags; blockDef must not be null
+//----------------------------------------------------------------------------------------------------
+uint8_t GetLightSourceLevel(LightChannel channel, sBlockDefinition const* blockDef, uint8_t bitFlags);
+bool    CanBlockReceiveLight(LightChannel channel, sBlockDefinition const* blockDef, uint8_t bitFlags);   // Else fixed at its source level
+bool    CanBlockProvideLight(LightChannel channel, sBlockDefinition const* blockDef);
+
+//----------------------------------------------------------------------------------------------------
+// Chunk borders crossed by light, in the order of ChunkLightJob's outgoing delta lists
+//----------------------------------------------------------------------------------------------------
+enum class ChunkBorder : uint8_t
+{
+    EAST,       // +X
+    WEST,       // -X
+    NORTH,      // +Y
+    SOUTH,      // -Y
+    COUNT
+};
+int constexpr CHUNK_BORDER_COUNT = (int)ChunkBorder::COUNT;
+
+//----------------------------------------------------------------------------------------------------
+// Halo-padded snapshot: the chunk plus a one-block ring of its four horizontal neighbors' border blocks
+//----------------------------------------------------------------------------------------------------
+int constexpr LIGHT_HALO_SIZE_X     = CHUNK_SIZE_X + 2;
+int constexpr LIGHT_HALO_SIZE_Y     = CHUNK_SIZE_Y + 2;
+int constexpr LIGHT_HALO_LAYER_SIZE = LIGHT_HALO_SIZE_X * LIGHT_HALO_SIZE_Y;
+int constexpr LIGHT_HALO_VOLUME     = LIGHT_HALO_LAYER_SIZE * CHUNK_SIZE_Z;
+
+//----------------------------------------------------------------------------------------------------
+// LightBorderDelta - Light change a job could not make itself because it lands in a neighbor chunk
+//----------------------------------------------------------------------------------------------------
+struct LightBorderDelta
+{
+    int          m_blockIndex = 0;                      // Chunk::LocalCoordsToIndex() in the receiving chunk
+    LightChannel m_channel    = LightChannel::OUTDOOR;
+    uint8_t      m_light      = 0;                      // Addition: level offered; removal: old light of the cleared block next to it
+    bool         m_isRemoval  = false;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct ChunkLightChange
+{
+    int     m_blockIndex   = 0;
+    uint8_t m_lightingData = 0;     // Both nibbles, as the job left them
+};
+
+//----------------------------------------------------------------------------------------------------
+// ChunkLightJob - Two-phase light flood fill for one chunk, run against a private halo-padded snapshot
+//
+// Runs the same removal / addition flood fill as World::ProcessDirtyLighting(), seeded by the chunk's
+// dirty blocks and by the border deltas its neighbors' jobs produced. Light that would spread into the
+// halo is not propagated further: it becomes a LightBorderDelta for the neighbor across that border,
+// which World feeds into that neighbor's next job. Rounds of jobs continue until no deltas remain.
+//
+// Thread Safety:
+// - The constructor copies the chunk and its neighbors' border blocks; main thread only
+// - Execute() runs on a worker thread and touches only the job's own snapshot, never a Chunk
+// - ApplyLightToChunk() writes the results; main thread only, and only if the job was not cancelled
+//
+// Lifecycle:
+// 1. Main thread creates the job with the chunk's seeds (snapshot taken here)
+// 2. Worker thread runs the flood fill and lists changed light bytes and outgoing deltas
+// 3. Main thread retrieves the job, commits the light and routes the deltas to the neighbor chunks
+//----------------------------------------------------------------------------------------------------
+class ChunkLightJob : public Job
+{
+public:
+    // Constructor: the chunk must be COMPLETE; neighbors that are not COMPLETE are treated as absent
+    ChunkLightJob(Chunk* chunk, std::vector<int> const& seedIndices, std::vector<LightBorderDelta> const& incomingDeltas);
+
+    // Destructor: Cleanup any resources
+    ~ChunkLightJob() override = default;
+
+    // Prevent copying and assignment
+    ChunkLightJob(ChunkLightJob const&)            = delete;
+    ChunkLightJob& operator=(ChunkLightJob const&) = delete;
+    ChunkLightJob(ChunkLightJob&&)                 = delete;
+    ChunkLightJob& operator=(ChunkLightJob&&)      = delete;
+
+    // Job interface implementation - called by worker thread
+    void Execute() override;
+
+    // Accessors for monitoring and debugging
+    Chunk*  GetChunk() const { return m_chunk; }
+    IntVec2 GetChunkCoords() const { return m_chunkCoords; }
+    bool    IsCancelled() const { return m_isCancelled; }
+    void    Cancel() { m_isCancelled = true; }     // Main thread: the chunk left the active set, drop the results
+
+    std::vector<ChunkLightChange> const& GetLightChanges() const { return m_lightChanges; }
+    std::vector<LightBorderDelta> const& GetOutgoingDeltas(ChunkBorder const border) const { return m_outgoingDeltas[(int)border]; }
+
+    int64_t GetSeedCount() const { return m_seedCount; }
+    int64_t GetRemovalVisitCount() const { return m_removalVisitCount; }
+    int64_t GetAdditionVisitCount() const { return m_additionVisitCount; }
+    double  GetExecuteSeconds() const { return m_executeSeconds; }
+
+    // Commit the changed light bytes to the chunk - called by main thread only
+    void ApplyLightToChunk() const;
+
+private:
+    struct RemovalNode
+    {
+        int     m_cell     = 0;
+        uint8_t m_oldLight = 0;
+    };
+
+    Chunk*  m_chunk       = nullptr;
+    IntVec2 m_chunkCoords = IntVec2::ZERO;
+    bool    m_isCancelled = false;      // Main thread only
+
+    // Inputs (copied on the main thread)
+    std::vector<int>              m_seedIndices;
+    std::vector<LightBorderDelta> m_incomingDeltas;
+    std::vector<uint8_t>          m_typeIndices;        // LIGHT_HALO_VOLUME each, see GetHaloCell()
+    std::vector<uint8_t>          m_lightingData;
+    std::vector<uint8_t>          m_bitFlags;           // LIGHT_HALO_ABSENT_FLAG where no neighbor chunk is loaded
+
+    // Channel rules per (type, sky-visible) pair, built by Execute() from the block definitions
+    uint8_t m_sourceLevels[LIGHT_CHANNEL_COUNT][512] = {};
+    bool    m_receives[LIGHT_CHANNEL_COUNT][512]     = {};
+    bool    m_provides[LIGHT_CHANNEL_COUNT][512]     = {};
+
+    // Outputs (read by the main thread after completion)
+    std::vector<ChunkLightChange> m_lightChanges;
+    std::vector<LightBorderDelta> m_outgoingDeltas[CHUNK_BORDER_COUNT];
+    int64_t                       m_seedCount          = 0;
+    int64_t                       m_removalVisitCount  = 0;
+    int64_t                       m_additionVisitCount = 0;
+    double                        m_executeSeconds     = 0.0;
+
+    // Flood fill over the snapshot (worker thread)
+    void    BuildChannelRules();
+    void    RunChannel(LightChannel channel);
+    void    EmitBorderDelta(int cell, LightChannel channel, uint8_t light, bool isRemoval);
+    uint8_t ComputeLocalLight(LightChannel channel, int cell) const;
+    int     GetNeighborCells(int cell, int outNeighborCells[6]) const;
+
+    uint8_t GetLight(LightChannel channel, int cell) const;
+    void    SetLight(LightChannel channel, int cell, uint8_t light);
+    int     GetRuleIndex(int cell) const { return m_typeIndices[cell] | ((m_bitFlags[cell] & 0x01) << 8); }
+    bool    IsAbsent(int cell) const;
+    bool    CanReceive(LightChannel channel, int cell) const;
+    bool    CanProvide(LightChannel channel, int cell) const;
+
+    static int  GetHaloCell(int x, int y, int z) { return (x + 1) + (y + 1) * LIGHT_HALO_SIZE_X + z * LIGHT_HALO_LAYER_SIZE; }
+    static int  GetHaloCell(int blockIndex);
+    static bool IsInteriorCell(int cell);
+};
@@ -15,6 +15,8 @@
 #include "Engine/Math/Vec3.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
 
+#include <bit>
+
 //----------------------------------------------------------------------------------------------------
 ChunkMeshJob::ChunkMeshJob(Chunk* chunk, World* world)
     : m_chunk(chunk), m_world(world)
@@ -89,110 +91,155 @@ void ChunkMeshJob::GenerateMeshData()
                          (float)(chunkCoords.y * CHUNK_SIZE_Y),
                          0.0f);
 
-    // Cache-coherent iteration: iterate blocks in memory order for optimal cache performance
-    // Memory layout is: index = x + (y << CHUNK_BITS_X) + (z << (CHUNK_BITS_X + CHUNK_BITS_Y))
-    for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; blockIndex++)
+    // Visibility only depends on the block type, so resolve it once per type instead of once per block
+    uint32_t isVisibleByType[256];
+    for (int typeIndex = 0; typeIndex < 256; ++typeIndex)
+    {
+        sBlockDefinition const* def = sBlockDefinition::GetDefinitionByIndex((uint8_t)typeIndex);
+        isVisibleByType[typeIndex]  = (def != nullptr && def->IsVisible()) ? 1u : 0u;
+    }
+
+    // Neighbor chunks for hidden surface removal across chunk borders
+    // CRITICAL: an unloaded neighbor counts as OPAQUE (hidden face), so chunk boundary faces are not
+    // rendered before the neighbor chunk is loaded; faces at the top/bottom of the world always render
+    Chunk const* eastNeighbor  = m_world->GetChunk(chunkCoords + IntVec2(1, 0));
+    Chunk const* westNeighbor  = m_world->GetChunk(chunkCoords + IntVec2(-1, 0));
+    Chunk const* northNeighbor = m_world->GetChunk(chunkCoords + IntVec2(0, 1));
+    Chunk const* southNeighbor = m_world->GetChunk(chunkCoords + IntVec2(0, -1));
+
+    // Row-at-a-time hidden surface removal: all-air sections have nothing to mesh, and the opacity masks
+    // give the visible faces of 32 blocks per row in a few word operations. A block is visited only if it
+    // is visible and has at least one visible face, which leaves just the shell of all-stone sections.
+    // (thread-safe since chunk is in COMPLETE state and worker threads only read block data during mesh generation)
+    uint8_t const* blockTypeIndices = m_chunk->GetBlockTypeIndices();
+
+    for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
     {
-        // Access block data via coordinate conversion (thread-safe since chunk is in COMPLETE state
-        // and worker threads only read block data during mesh generation)
-        IntVec3 localCoords = Chunk::IndexToLocalCoords(blockIndex);
-        Block*  block       = m_chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-        if (!block) continue;
-
-        sBlockDefinition* def = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
-
-        // Skip invisible blocks (air, transparent blocks)
-        if (!def || !def->IsVisible()) continue;
-
-        // Calculate block center in world coordinates
-        Vec3 blockCenter = Vec3((float)localCoords.x + 0.5f,
-                               (float)localCoords.y + 0.5f,
-                               (float)localCoords.z + 0.5f) + chunkWorldOffset;
-
-        // Assignment 5 Phase 0 FIX: Create block iterator with World pointer for cross-chunk navigation
-        // This enables GetNeighbor() to access blocks in adjacent chunks for proper hidden surface removal
-        BlockIterator blockIter(m_chunk, blockIndex, m_world);
-
-        // Check each face direction and only add visible faces
-        // Face directions as offset vectors
-        IntVec3 faceDirections[6] = {
-            IntVec3(0, 0, 1),   // Top face (+Z)
-            IntVec3(0, 0, -1),  // Bottom face (-Z)
-            IntVec3(1, 0, 0),   // East face (+X)
-            IntVec3(-1, 0, 0),  // West face (-X)
-            IntVec3(0, 1, 0),   // North face (+Y)
-            IntVec3(0, -1, 0)   // South face (-Y)
-        };
-
-        Vec3 faceNormals[6] = {
-            Vec3::Z_BASIS,      // Top
-            -Vec3::Z_BASIS,     // Bottom
-            Vec3::X_BASIS,      // East
-            -Vec3::X_BASIS,     // West
-            Vec3::Y_BASIS,      // North
-            -Vec3::Y_BASIS      // South
-        };
-
-        // Assignment 5 Phase 7: Directional shading values for b channel
-        // Top = 1.0 (255), Sides = 0.8 (204), Bottom = 0.6 (153)
-        float directionalShading[6] = {
-            1.0f,    // Top
-            0.6f,    // Bottom
-            0.8f,    // East
-            0.8f,    // West
-            0.8f,    // North
-            0.8f     // South
-        };
-
-        // Check each of the 6 faces
-        for (int faceIndex = 0; faceIndex < 6; ++faceIndex)
+        ChunkSectionOccupancy const occupancy = m_chunk->GetSectionOccupancy(sectionIndex);
+        if (occupancy == ChunkSectionOccupancy::ALL_AIR) continue;
+
+        int const firstRow = sectionIndex * CHUNK_ROWS_PER_SECTION;
+        for (int rowIndex = firstRow; rowIndex < firstRow + CHUNK_ROWS_PER_SECTION; ++rowIndex)
         {
-            // Check if face is visible (not hidden by adjacent opaque block)
-            if (!IsFaceVisibleForJob(blockIter, faceDirections[faceIndex]))
+            uint8_t const* rowTypes   = blockTypeIndices + (rowIndex << CHUNK_BITS_X);
+            uint32_t       visibleRow = 0;
+            for (int x = 0; x < CHUNK_SIZE_X; ++x)
             {
-                continue; // Skip hidden face
+                visibleRow |= isVisibleByType[rowTypes[x]] << x;
             }
+            if (visibleRow == 0) continue;
+
+            uint32_t visibleFaces[BLOCK_FACE_COUNT];
+            m_chunk->GetRowFaceVisibility(rowIndex, eastNeighbor, westNeighbor, northNeighbor, southNeighbor, true, visibleFaces);
 
-            // Get UV coordinates based on which face this is
-            Vec2 uvs;
-            if (faceIndex == 0)      uvs = def->GetTopUVs();    // Top
-            else if (faceIndex == 1) uvs = def->GetBottomUVs(); // Bottom
-            else                     uvs = def->GetSideUVs();    // Sides (East, West, North, South)
-
-            // Assignment 5 Phase 7 FIX: Get lighting from NEIGHBOR block in face direction
-            // This matches Chunk.cpp behavior - each face uses the light from the neighbor
-            // For example, the top face of grass uses the light from the air block above
-            BlockIterator neighborIter = blockIter.GetNeighbor(faceDirections[faceIndex]);
-            Block* neighborBlock = neighborIter.IsValid() ? neighborIter.GetBlock() : nullptr;
-
-            // Assignment 5: Read lighting from neighbor block
-            // FIX: If neighbor is unavailable (unloaded chunk), use default skylight value
-            // This prevents completely black faces on chunk edges where neighbors aren't loaded yet
-            uint8_t outdoorLight = neighborBlock ? neighborBlock->GetOutdoorLight() : 15;  // Default to full skylight
-            uint8_t indoorLight = neighborBlock ? neighborBlock->GetIndoorLight() : 0;
-
-            // FIX: Apply minimum ambient light as INDOOR light (not outdoor) to prevent black faces
-            // Indoor light is NOT modulated by day/night cycle, providing constant ambient illumination
-            // This matches Minecraft's behavior where shadowed areas remain visible even at night
-            constexpr uint8_t MIN_AMBIENT_LIGHT = 4;  // Minimum light level (4/15 = ~27% brightness)
-            if (outdoorLight < MIN_AMBIENT_LIGHT && indoorLight == 0)
+            uint32_t candidates = 0;
+            for (int faceIndex = 0; faceIndex < BLOCK_FACE_COUNT; ++faceIndex)
             {
-                indoorLight = MIN_AMBIENT_LIGHT;  // Use indoor channel to avoid day/night modulation
+                candidates |= visibleFaces[faceIndex];
             }
+            candidates &= visibleRow;
 
-            // Normalize lighting to 0.0-1.0 range
-            float outdoorNormalized = (float)outdoorLight / 15.0f;
-            float indoorNormalized = (float)indoorLight / 15.0f;
-
-            // Assignment 5 Phase 7: Encode lighting in vertex colors
-            // r = outdoor light (0-255), g = indoor light (0-255), b = directional shading (0-255)
-            uint8_t r = (uint8_t)(outdoorNormalized * 255.0f);
-            uint8_t g = (uint8_t)(indoorNormalized * 255.0f);
-            uint8_t b = (uint8_t)(directionalShading[faceIndex] * 255.0f);
-            Rgba8 vertexColor = Rgba8(r, g, b, 255);
-
-            // Add the visible face to our local vertex/index buffers with lighting
-            AddBlockFaceToJob(blockCenter, faceNormals[faceIndex], uvs, vertexColor);
+            while (candidates != 0)
+            {
+                int const x = std::countr_zero(candidates);
+                candidates &= candidates - 1;
+
+                int const         blockIndex = (rowIndex << CHUNK_BITS_X) | x;
+                sBlockDefinition* def        = sBlockDefinition::GetDefinitionByIndex(rowTypes[x]);
+
+                IntVec3 localCoords = Chunk::IndexToLocalCoords(blockIndex);
+
+                // Calculate block center in world coordinates
+                Vec3 blockCenter = Vec3((float)localCoords.x + 0.5f,
+                                       (float)localCoords.y + 0.5f,
+                                       (float)localCoords.z + 0.5f) + chunkWorldOffset;
+
+                // Assignment 5 Phase 0 FIX: Create block iterator with World pointer for cross-chunk navigation
+                // This enables GetNeighbor() to access blocks in adjacent chunks for proper hidden surface removal
+                BlockIterator blockIter(m_chunk, blockIndex, m_world);
+
+                // Check each face direction and only add visible faces
+                // Face directions as offset vectors
+                IntVec3 faceDirections[6] = {
+                    IntVec3(0, 0, 1),   // Top face (+Z)
+                    IntVec3(0, 0, -1),  // Bottom face (-Z)
+                    IntVec3(1, 0, 0),   // East face (+X)
+                    IntVec3(-1, 0, 0),  // West face (-X)
+                    IntVec3(0, 1, 0),   // North face (+Y)
+                    IntVec3(0, -1, 0)   // South face (-Y)
+                };
+
+                Vec3 faceNormals[6] = {
+                    Vec3::Z_BASIS,      // Top
+                    -Vec3::Z_BASIS,     // Bottom
+                    Vec3::X_BASIS,      // East
+                    -Vec3::X_BASIS,     // West
+                    Vec3::Y_BASIS,      // North
+                    -Vec3::Y_BASIS      // South
+                };
+
+                // Assignment 5 Phase 7: Directional shading values for b channel
+                // Top = 1.0 (255), Sides = 0.8 (204), Bottom = 0.6 (153)
+                float directionalShading[6] = {
+                    1.0f,    // Top
+                    0.6f,    // Bottom
+                    0.8f,    // East
+                    0.8f,    // West
+                    0.8f,    // North
+                    0.8f     // South
+                };
+
+                // Check each of the 6 faces
+                for (int faceIndex = 0; faceIndex < 6; ++faceIndex)
+                {
+                    // Check if face is visible (not hidden by adjacent opaque block)
+                    if (((visibleFaces[faceIndex] >> x) & 1u) == 0)
+                    {
+                        continue; // Skip hidden face
+                    }
+
+                    // Get UV coordinates based on which face this is
+                    Vec2 uvs;
+                    if (faceIndex == 0)      uvs = def->GetTopUVs();    // Top
+                    else if (faceIndex == 1) uvs = def->GetBottomUVs(); // Bottom
+                    else                     uvs = def->GetSideUVs();    // Sides (East, West, North, South)
+
+                    // Assignment 5 Phase 7 FIX: Get lighting from NEIGHBOR block in face direction
+                    // This matches Chunk.cpp behavior - each face uses the light from the neighbor
+                    // For example, the top face of grass uses the light from the air block above
+                    BlockIterator neighborIter = blockIter.GetNeighbor(faceDirections[faceIndex]);
+                    BlockPtr neighborBlock = neighborIter.IsValid() ? neighborIter.GetBlock() : nullptr;
+
+                    // Assignment 5: Read lighting from neighbor block
+                    // FIX: If neighbor is unavailable (unloaded chunk), use default skylight value
+                    // This prevents completely black faces on chunk edges where neighbors aren't loaded yet
+                    uint8_t outdoorLight = neighborBlock ? neighborBlock->GetOutdoorLight() : 15;  // Default to full skylight
+                    uint8_t indoorLight = neighborBlock ? neighborBlock->GetIndoorLight() : 0;
+
+                    // FIX: Apply minimum ambient light as INDOOR light (not outdoor) to prevent black faces
+                    // Indoor light is NOT modulated by day/night cycle, providing constant ambient illumination
+                    // This matches Minecraft's behavior where shadowed areas remain visible even at night
+                    constexpr uint8_t MIN_AMBIENT_LIGHT = 4;  // Minimum light level (4/15 = ~27% brightness)
+                    if (outdoorLight < MIN_AMBIENT_LIGHT && indoorLight == 0)
+                    {
+                        indoorLight = MIN_AMBIENT_LIGHT;  // Use indoor channel to avoid day/night modulation
+                    }
+
+                    // Normalize lighting to 0.0-1.0 range
+                    float outdoorNormalized = (float)outdoorLight / 15.0f;
+                    float indoorNormalized = (float)indoorLight / 15.0f;
+
+                    // Assignment 5 Phase 7: Encode lighting in vertex colors
+                    // r = outdoor light (0-255), g = indoor light (0-255), b = directional shading (0-255)
+                    uint8_t r = (uint8_t)(outdoorNormalized * 255.0f);
+                    uint8_t g = (uint8_t)(indoorNormalized * 255.0f);
+                    uint8_t b = (uint8_t)(directionalShading[faceIndex] * 255.0f);
+                    Rgba8 vertexColor = Rgba8(r, g, b, 255);
+
+                    // Add the visible face to our local vertex/index buffers with lighting
+                    AddBlockFaceToJob(blockCenter, faceNormals[faceIndex], uvs, vertexColor);
+                }
+            }
         }
     }
 
@@ -239,57 +286,6 @@ void ChunkMeshJob::ApplyMeshDataToChunk()
     // which must be called on the main thread
 }
 
-//----------------------------------------------------------------------------------------------------
-bool ChunkMeshJob::IsFaceVisibleForJob(BlockIterator const& blockIter, IntVec3 const& faceDirection) const
-{
-    // Assignment 5 Phase 0 FIX: Use GetNeighbor() instead of Move methods for cross-chunk support
-    // MoveEast()/MoveWest()/etc. only work within the same chunk and return false at chunk boundaries
-    // GetNeighbor() properly navigates across chunk boundaries via World pointer
-    BlockIterator neighborIter = blockIter.GetNeighbor(faceDirection);
-
-    // CRITICAL: If neighbor is invalid, assume it's OPAQUE (hidden face)
-    // This prevents rendering chunk boundary faces when neighbor chunks aren't fully loaded
-    // Only render faces at true world boundaries (z < 0 or z >= CHUNK_SIZE_Z)
-    if (!neighborIter.IsValid())
-    {
-        // Check if we're at vertical world boundaries (top/bottom of world)
-        IntVec3 currentCoords = blockIter.GetLocalCoords();
-        IntVec3 neighborCoords = currentCoords + faceDirection;
-
-        // Convert to world Z coordinate
-        int worldZ = neighborCoords.z;
-
-        // Only render face if at vertical world boundaries
-        if (worldZ < 0 || worldZ >= CHUNK_SIZE_Z)
-        {
-            return true;  // At vertical world boundaries, render face
-        }
-
-        // Horizontal chunk boundary with unloaded neighbor - assume opaque (hide face)
-        return false;
-    }
-
-    // Get the neighbor block
-    Block* neighborBlock = neighborIter.GetBlock();
-    if (!neighborBlock)
-    {
-        // No block data means assume opaque (safer for hidden surface removal)
-        return false;
-    }
-
-    // Get neighbor block definition
-    sBlockDefinition* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
-    if (!neighborDef)
-    {
-        // Invalid definition - assume opaque
-        return false;
-    }
-
-    // Face is VISIBLE if neighbor is NOT opaque
-    // Face is HIDDEN if neighbor is opaque
-    return !neighborDef->IsOpaque();
-}
-
 //----------------------------------------------------------------------------------------------------
 void ChunkMeshJob::AddBlockFaceToJob(Vec3 const& blockCenter, Vec3 const& faceNormal, Vec2 const& uvs, Rgba8 const& tint)
 {
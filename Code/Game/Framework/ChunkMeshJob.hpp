@@ -89,6 +89,5 @@ private:
     void ValidateChunkState();
 
     // Thread-safe mesh building helpers (write to job's local vectors)
-    bool IsFaceVisibleForJob(BlockIterator const& blockIter, IntVec3 const& faceDirection) const;
     void AddBlockFaceToJob(Vec3 const& blockCenter, Vec3 const& faceNormal, Vec2 const& uvs, Rgba8 const& tint);
 };
\ No newline at end of file
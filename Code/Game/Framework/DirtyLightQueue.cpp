@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------------------------------
+// DirtyLightQueue.cpp - FIFO of blocks waiting for light recalculation, deduplicated by an in-block bit
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DirtyLightQueue.hpp"
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool DirtyLightQueue::Push(Chunk* chunk, int const blockIndex)
+{
+    uint8_t& bitFlags = chunk->GetBlockBitFlags()[blockIndex];
+    if ((bitFlags & BLOCK_FLAG_LIGHT_QUEUED) != 0)
+    {
+        return false;   // Already queued
+    }
+
+    int chunkSlot = chunk->GetLightQueueSlot();
+    if (chunkSlot < 0)
+    {
+        chunkSlot = AcquireChunkSlot(chunk);
+    }
+    bitFlags = (uint8_t)(bitFlags | BLOCK_FLAG_LIGHT_QUEUED);
+    ++m_slotQueuedCounts[chunkSlot];
+
+    // Tail page full: move on to the next page of the ring, splicing in a new one if the head still holds it
+    if (m_pages.empty())
+    {
+        m_pages.push_back(std::make_unique<uint32_t[]>(DIRTY_LIGHT_PAGE_SIZE));
+    }
+    else if (m_tailOffset == DIRTY_LIGHT_PAGE_SIZE)
+    {
+        int nextPage = (m_tailPage + 1) % (int)m_pages.size();
+        if (nextPage == m_headPage)
+        {
+            nextPage = m_tailPage + 1;
+            m_pages.insert(m_pages.begin() + nextPage, std::make_unique<uint32_t[]>(DIRTY_LIGHT_PAGE_SIZE));
+            if (m_headPage >= nextPage)
+            {
+                ++m_headPage;
+            }
+        }
+        m_tailPage   = nextPage;
+        m_tailOffset = 0;
+    }
+
+    m_pages[m_tailPage][m_tailOffset++] = ((uint32_t)chunkSlot << DIRTY_LIGHT_BLOCK_INDEX_BITS) | (uint32_t)blockIndex;
+    ++m_entryCount;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool DirtyLightQueue::Pop(Chunk*& outChunk, int& outBlockIndex)
+{
+    while (m_entryCount > 0)
+    {
+        uint32_t const entry = m_pages[m_headPage][m_headOffset++];
+        --m_entryCount;
+
+        if (m_entryCount == 0)
+        {
+            // Drained: restart at the top of the tail page so the next burst stays on as few pages as possible
+            m_headPage   = m_tailPage;
+            m_headOffset = 0;
+            m_tailOffset = 0;
+        }
+        else if (m_headOffset == DIRTY_LIGHT_PAGE_SIZE)
+        {
+            m_headPage   = (m_headPage + 1) % (int)m_pages.size();
+            m_headOffset = 0;
+        }
+
+        int const    chunkSlot  = (int)(entry >> DIRTY_LIGHT_BLOCK_INDEX_BITS);
+        int const    blockIndex = (int)(entry & (uint32_t)(BLOCKS_PER_CHUNK - 1));
+        Chunk* const chunk      = m_slotChunks[chunkSlot];
+        if (chunk == nullptr) continue;     // Chunk released since
+
+        uint8_t& bitFlags = chunk->GetBlockBitFlags()[blockIndex];
+        if ((bitFlags & BLOCK_FLAG_LIGHT_QUEUED) == 0) continue;     // Slot reused by another chunk, block not queued there
+
+        bitFlags = (uint8_t)(bitFlags & ~BLOCK_FLAG_LIGHT_QUEUED);
+        --m_slotQueuedCounts[chunkSlot];
+
+        outChunk      = chunk;
+        outBlockIndex = blockIndex;
+        return true;
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// ReleaseChunk - Forget a chunk that leaves the world (pooled, cached or deleted next)
+//
+// The queued bits must not survive: a chunk restored from ChunkCache, or this Chunk object recycled,
+// would otherwise refuse Push() for blocks no entry refers to anymore.
+//----------------------------------------------------------------------------------------------------
+void DirtyLightQueue::ReleaseChunk(Chunk* chunk)
+{
+    int const chunkSlot = chunk->GetLightQueueSlot();
+    if (chunkSlot < 0) return;
+
+    if (m_slotQueuedCounts[chunkSlot] > 0)
+    {
+        uint8_t* bitFlags = chunk->GetBlockBitFlags();
+        for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+        {
+            bitFlags[blockIndex] = (uint8_t)(bitFlags[blockIndex] & ~BLOCK_FLAG_LIGHT_QUEUED);
+        }
+    }
+
+    m_slotChunks[chunkSlot]       = nullptr;
+    m_slotQueuedCounts[chunkSlot] = 0;
+    m_freeSlots.push_back(chunkSlot);
+    chunk->SetLightQueueSlot(-1);
+}
+
+//----------------------------------------------------------------------------------------------------
+int DirtyLightQueue::AcquireChunkSlot(Chunk* chunk)
+{
+    int chunkSlot = 0;
+    if (!m_freeSlots.empty())
+    {
+        chunkSlot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+        m_slotChunks[chunkSlot] = chunk;
+    }
+    else
+    {
+        GUARANTEE_OR_DIE((int)m_slotChunks.size() < DIRTY_LIGHT_MAX_CHUNK_SLOTS, "DirtyLightQueue: out of chunk slots");
+        chunkSlot = (int)m_slotChunks.size();
+        m_slotChunks.push_back(chunk);
+        m_slotQueuedCounts.push_back(0);
+    }
+
+    chunk->SetLightQueueSlot(chunkSlot);
+    return chunkSlot;
+}
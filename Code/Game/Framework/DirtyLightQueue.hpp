@@ -0,0 +1,72 @@
+//----------------------------------------------------------------------------------------------------
+// DirtyLightQueue.hpp - FIFO of blocks waiting for light recalculation, deduplicated by an in-block bit
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+int constexpr DIRTY_LIGHT_PAGE_SIZE        = 4096;     // Entries per ring page (16 KB)
+int constexpr DIRTY_LIGHT_BLOCK_INDEX_BITS = 18;       // Chunk::LocalCoordsToIndex() range
+int constexpr DIRTY_LIGHT_MAX_CHUNK_SLOTS  = 1 << (32 - DIRTY_LIGHT_BLOCK_INDEX_BITS);
+
+static_assert(BLOCKS_PER_CHUNK == (1 << DIRTY_LIGHT_BLOCK_INDEX_BITS), "DirtyLightQueue entries pack the block index into 18 bits");
+
+//----------------------------------------------------------------------------------------------------
+// DirtyLightQueue - Chunked ring buffer of (chunk slot, block index) entries packed into 32 bits
+//
+// Deduplication lives in the blocks themselves: Push() sets BLOCK_FLAG_LIGHT_QUEUED in the block's
+// m_bitFlags and refuses blocks that already carry it, Pop() clears it. No hash set has to be kept in
+// step with the queue, and an entry costs 4 bytes instead of a BlockIterator.
+//
+// Entries live in fixed-size pages arranged as a ring. The tail moves into the next page when its own
+// fills up; only when that page is still held by the head is a new page spliced into the ring, so pages
+// are reused frame after frame and a drained queue keeps its capacity.
+//
+// A chunk gets a slot on its first Push() and keeps it until ReleaseChunk(), which clears the chunk's
+// queued bits and frees the slot. Entries left behind are resolved lazily: Pop() skips an entry whose
+// slot is empty, or whose block no longer carries the bit. A freed slot can be handed to another chunk
+// while old entries still name it; such an entry either finds the bit clear and is skipped, or finds a
+// block genuinely queued under the same slot and index and simply takes that block's turn early.
+//
+// Thread Safety:
+// - Main thread only: Push() / Pop() read and write the chunks' bit flags
+//----------------------------------------------------------------------------------------------------
+class DirtyLightQueue
+{
+public:
+    DirtyLightQueue() = default;
+
+    // Prevent copying (pages and slots refer to this queue only)
+    DirtyLightQueue(DirtyLightQueue const&)            = delete;
+    DirtyLightQueue& operator=(DirtyLightQueue const&) = delete;
+
+    bool Push(Chunk* chunk, int blockIndex);                // false if the block is already queued
+    bool Pop(Chunk*& outChunk, int& outBlockIndex);         // false once no live entry is left
+    void ReleaseChunk(Chunk* chunk);                        // Chunk leaves the world: clear its queued bits, free its slot
+
+    bool    IsEmpty() const { return m_entryCount == 0; }   // Counts stale entries too, see Pop()
+    int64_t GetEntryCount() const { return m_entryCount; }
+    int     GetPageCount() const { return (int)m_pages.size(); }
+
+private:
+    int AcquireChunkSlot(Chunk* chunk);
+
+    // Ring of pages: entries run from (m_headPage, m_headOffset) to (m_tailPage, m_tailOffset)
+    std::vector<std::unique_ptr<uint32_t[]>> m_pages;
+    int                                      m_headPage   = 0;
+    int                                      m_headOffset = 0;
+    int                                      m_tailPage   = 0;
+    int                                      m_tailOffset = 0;
+    int64_t                                  m_entryCount = 0;
+
+    // Chunk slots: entry slot -> chunk, and the number of that chunk's blocks carrying the queued bit
+    std::vector<Chunk*> m_slotChunks;
+    std::vector<int>    m_slotQueuedCounts;
+    std::vector<int>    m_freeSlots;
+};
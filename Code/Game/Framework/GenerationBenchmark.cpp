@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------------------------------
+// GenerationBenchmark.cpp - Renderer-free world generation throughput and determinism benchmark
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GenerationBenchmark.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Game/Framework/BiomeRegionCache.hpp"
+#include "Game/Framework/Chunk.hpp"
+#include "Game/Framework/WorldGenConfig.hpp"
+
+//----------------------------------------------------------------------------------------------------
+uint64_t constexpr FNV_OFFSET_BASIS = 14695981039346656037ull;
+uint64_t constexpr FNV_PRIME        = 1099511628211ull;
+
+//----------------------------------------------------------------------------------------------------
+static uint64_t HashBytes(uint64_t hash, uint8_t const* bytes, int const byteCount)
+{
+    for (int byteIndex = 0; byteIndex < byteCount; ++byteIndex)
+    {
+        hash = (hash ^ bytes[byteIndex]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+GenerationBenchmarkResult RunGenerationBenchmark(GenerationBenchmarkSettings const& settings)
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    int const chunkRadius = (std::max)(settings.m_chunkRadius, 0);
+    int const sideCount   = 2 * chunkRadius + 1;
+
+    GenerationBenchmarkResult result;
+    result.m_chunkCount  = sideCount * sideCount;
+    result.m_workerCount = (std::max)(settings.m_workerCount, 1);
+
+    // Row-major square: chunk (x, y) of the square is chunks[y * sideCount + x]
+    std::vector<Chunk*> chunks;
+    chunks.reserve(result.m_chunkCount);
+    for (int offsetY = -chunkRadius; offsetY <= chunkRadius; ++offsetY)
+    {
+        for (int offsetX = -chunkRadius; offsetX <= chunkRadius; ++offsetX)
+        {
+            chunks.push_back(new Chunk(IntVec2(settings.m_centerChunkCoords.x + offsetX, settings.m_centerChunkCoords.y + offsetY)));
+        }
+    }
+
+    BiomeRegionCache  biomeRegionCache(DEFAULT_BIOME_REGION_CAPACITY);
+    BiomeRegionCache* biomeRegionCachePtr = g_worldGenConfig->biomeNoise.useRegionCache ? &biomeRegionCache : nullptr;
+    int const         latticeStepXY       = g_worldGenConfig->density.densityLatticeStepXY;
+    int const         latticeStepZ        = g_worldGenConfig->density.densityLatticeStepZ;
+
+    BenchmarkClock::time_point const start = BenchmarkClock::now();
+
+    // --- Generation: workers pull chunk indices until the square is done ---
+    std::atomic<int>         nextChunkIndex{0};
+    std::vector<std::thread> workers;
+    workers.reserve(result.m_workerCount);
+    for (int workerIndex = 0; workerIndex < result.m_workerCount; ++workerIndex)
+    {
+        workers.emplace_back([&chunks, &nextChunkIndex, biomeRegionCachePtr, latticeStepXY, latticeStepZ]()
+        {
+            for (int chunkIndex = nextChunkIndex.fetch_add(1); chunkIndex < (int)chunks.size(); chunkIndex = nextChunkIndex.fetch_add(1))
+            {
+                chunks[chunkIndex]->SetState(ChunkState::TERRAIN_GENERATING);
+                chunks[chunkIndex]->GenerateTerrain(latticeStepXY, latticeStepZ, true, biomeRegionCachePtr);
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    BenchmarkClock::time_point const end = BenchmarkClock::now();
+
+    result.m_wallSeconds     = std::chrono::duration<double>(end - start).count();
+    result.m_chunksPerSecond = result.m_wallSeconds > 0.0 ? (double)result.m_chunkCount / result.m_wallSeconds : 0.0;
+
+    // --- Stage totals and checksum, in row order so neither depends on which worker ran what ---
+    std::vector<uint8_t> typeIndices(BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> lightingData(BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> bitFlags(BLOCKS_PER_CHUNK);
+    double               stageSeconds[CHUNK_GENERATION_STAGE_COUNT] = {};
+    uint64_t             checksum                                   = FNV_OFFSET_BASIS;
+
+    for (Chunk* chunk : chunks)
+    {
+        for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+        {
+            stageSeconds[stageIndex] += chunk->GetGenerationTimings().m_stageSeconds[stageIndex];
+        }
+
+        chunk->CopyBlocksTo(typeIndices.data(), lightingData.data(), bitFlags.data());
+        checksum = HashBytes(checksum, typeIndices.data(), BLOCKS_PER_CHUNK);
+        checksum = HashBytes(checksum, lightingData.data(), BLOCKS_PER_CHUNK);
+        checksum = HashBytes(checksum, bitFlags.data(), BLOCKS_PER_CHUNK);
+    }
+
+    for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+    {
+        result.m_stageMsPerChunk[stageIndex] = stageSeconds[stageIndex] * 1000.0 / (double)result.m_chunkCount;
+        if (stageIndex == (int)ChunkGenerationStage::LIGHTING)
+        {
+            result.m_lightingMsPerChunk += result.m_stageMsPerChunk[stageIndex];
+        }
+        else
+        {
+            result.m_terrainMsPerChunk += result.m_stageMsPerChunk[stageIndex];
+        }
+    }
+    result.m_checksum = checksum;
+
+    for (Chunk* chunk : chunks)
+    {
+        delete chunk;
+    }
+
+    DebuggerPrintf("[GENERATION BENCHMARK] %d chunks on %d workers: %.3f s, %.1f chunks/s\n",
+                   result.m_chunkCount, result.m_workerCount, result.m_wallSeconds, result.m_chunksPerSecond);
+    DebuggerPrintf("[GENERATION BENCHMARK] Per chunk: terrain %.2f ms, lighting %.2f ms, checksum %016llx\n",
+                   result.m_terrainMsPerChunk, result.m_lightingMsPerChunk, (unsigned long long)result.m_checksum);
+    for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+    {
+        DebuggerPrintf("[GENERATION BENCHMARK]   %-8s %.2f ms\n",
+                       GetChunkGenerationStageName((ChunkGenerationStage)stageIndex), result.m_stageMsPerChunk[stageIndex]);
+    }
+
+    return result;
+}
@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------
+// GenerationBenchmark.hpp - Renderer-free world generation throughput and determinism benchmark
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Game/Framework/Chunk.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct GenerationBenchmarkSettings
+{
+    IntVec2 m_centerChunkCoords = IntVec2::ZERO;
+    int     m_chunkRadius       = 4;        // (2 * radius + 1)^2 chunks
+    int     m_workerCount       = 4;        // Generation threads (at least 1)
+};
+
+//----------------------------------------------------------------------------------------------------
+struct GenerationBenchmarkResult
+{
+    int      m_chunkCount         = 0;
+    int      m_workerCount        = 0;
+    double   m_wallSeconds        = 0.0;    // Generation of the whole square, as seen by the caller
+    double   m_chunksPerSecond    = 0.0;
+    double   m_terrainMsPerChunk  = 0.0;    // Per-chunk stage times, summed over workers and averaged
+    double   m_lightingMsPerChunk = 0.0;
+    double   m_stageMsPerChunk[CHUNK_GENERATION_STAGE_COUNT] = {};     // Terrain split by pipeline stage
+    uint64_t m_checksum           = 0;      // FNV-1a over type, light and flag bytes of every chunk in row order
+};
+
+//----------------------------------------------------------------------------------------------------
+// RunGenerationBenchmark - Generate a square of chunks on worker threads and checksum the result
+//
+// Runs GenerateTerrain() (including InitializeLighting()) for each chunk on settings.m_workerCount plain
+// std::threads. Each chunk stamps the trees reaching in from its neighbors itself, so the square needs no
+// post-pass. The chunks never enter a World: no renderer, JobSystem, saving or light propagation is involved.
+//
+// The checksum depends only on g_worldGenConfig and the chunk square, not on the worker count or the
+// finishing order, so a generation change can be checked for bit-exactness by comparing checksums.
+// The biome region cache, when enabled in the config, is a private one that starts empty.
+//
+// Runs in-game from the "benchgen" command and the debug panel, or headless from the GenerationBenchmark
+// console project (Code/GenerationBenchmark), which creates no window or renderer.
+//
+// Thread Safety:
+// - Blocking; call from the main thread. Game jobs keep running alongside and skew the timings (not the checksum)
+//----------------------------------------------------------------------------------------------------
+GenerationBenchmarkResult RunGenerationBenchmark(GenerationBenchmarkSettings const& settings);
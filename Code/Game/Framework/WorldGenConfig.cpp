@@ -45,6 +45,18 @@ void WorldGenConfig::InitializeDefaultCurves()
     continentalnessCurve = CreateDefaultContinentalnessCurve();
     erosionCurve         = CreateDefaultErosionCurve();
     peaksValleysCurve    = CreateDefaultPeaksValleysCurve();
+
+    BakeCurves();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Bake Curves - Refresh the lookup tables of curves edited since their last bake
+//----------------------------------------------------------------------------------------------------
+void WorldGenConfig::BakeCurves()
+{
+    continentalnessTable.BakeIfChanged(continentalnessCurve, -1.2f, 1.0f);
+    erosionTable.BakeIfChanged(erosionCurve, -1.0f, 1.0f);
+    peaksValleysTable.BakeIfChanged(peaksValleysCurve, -1.0f, 1.0f);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -56,6 +68,51 @@ void WorldGenConfig::ResetToDefaults()
     *this = WorldGenConfig();
 }
 
+//----------------------------------------------------------------------------------------------------
+// Changed Sections - Which parameter groups differ from a baseline copy
+// World keeps the config its chunks were generated with and restages only what reads a changed group
+//----------------------------------------------------------------------------------------------------
+uint32_t WorldGenConfig::GetChangedSections(WorldGenConfig const& baseline) const
+{
+    uint32_t changedSections = 0;
+
+    if (!(biomeNoise == baseline.biomeNoise)) changedSections |= WORLDGEN_SECTION_BIOME_NOISE;
+    if (!(density == baseline.density))       changedSections |= WORLDGEN_SECTION_DENSITY;
+    if (!(caves == baseline.caves))           changedSections |= WORLDGEN_SECTION_CAVES;
+    if (!(trees == baseline.trees))           changedSections |= WORLDGEN_SECTION_TREES;
+    if (!(carvers == baseline.carvers))       changedSections |= WORLDGEN_SECTION_CARVERS;
+
+    if (!(curves == baseline.curves) ||
+        !AreCurvesEqual(continentalnessCurve, baseline.continentalnessCurve) ||
+        !AreCurvesEqual(erosionCurve, baseline.erosionCurve) ||
+        !AreCurvesEqual(peaksValleysCurve, baseline.peaksValleysCurve))
+    {
+        changedSections |= WORLDGEN_SECTION_CURVES;
+    }
+
+    return changedSections;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WorldGenConfig::AreCurvesEqual(PiecewiseCurve1D const& curveA, PiecewiseCurve1D const& curveB)
+{
+    if (curveA.GetNumPoints() != curveB.GetNumPoints())
+    {
+        return false;
+    }
+
+    for (int i = 0; i < curveA.GetNumPoints(); ++i)
+    {
+        PiecewiseCurve1D::ControlPoint const pointA = curveA.GetPoint(i);
+        PiecewiseCurve1D::ControlPoint const pointB = curveB.GetPoint(i);
+        if (pointA.t != pointB.t || pointA.value != pointB.value)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------------------------------
 // XML Serialization - Save
 //----------------------------------------------------------------------------------------------------
@@ -97,6 +154,10 @@ void WorldGenConfig::SaveToXML(std::string const& filepath) const
         biomeNoiseElement->SetAttribute("weirdnessScale", biomeNoise.weirdnessScale);
         biomeNoiseElement->SetAttribute("weirdnessOctaves", biomeNoise.weirdnessOctaves);
         biomeNoiseElement->SetAttribute("weirdnessPersistence", biomeNoise.weirdnessPersistence);
+
+        // Region cache
+        biomeNoiseElement->SetAttribute("useRegionCache", biomeNoise.useRegionCache);
+        biomeNoiseElement->SetAttribute("regionSampleStep", biomeNoise.regionSampleStep);
     }
 
     // Density Parameters
@@ -107,6 +168,8 @@ void WorldGenConfig::SaveToXML(std::string const& filepath) const
         densityElement->SetAttribute("densityNoiseScale", density.densityNoiseScale);
         densityElement->SetAttribute("densityNoiseOctaves", density.densityNoiseOctaves);
         densityElement->SetAttribute("densityBiasPerBlock", density.densityBiasPerBlock);
+        densityElement->SetAttribute("densityLatticeStepXY", density.densityLatticeStepXY);
+        densityElement->SetAttribute("densityLatticeStepZ", density.densityLatticeStepZ);
 
         // Slides
         densityElement->SetAttribute("topSlideStart", density.topSlideStart);
@@ -207,6 +270,16 @@ void WorldGenConfig::SaveToXML(std::string const& filepath) const
         carversElement->SetAttribute("riverEdgeFalloff", carvers.riverEdgeFalloff);
     }
 
+    // Pipeline Parameters
+    {
+        XmlElement* pipelineElement = doc.NewElement("Pipeline");
+        root->InsertEndChild(pipelineElement);
+
+        pipelineElement->SetAttribute("splitStageJobs", pipeline.splitStageJobs);
+        pipelineElement->SetAttribute("retainSurfaceSnapshots", pipeline.retainSurfaceSnapshots);
+        pipelineElement->SetAttribute("retainStageIntermediates", pipeline.retainStageIntermediates);
+    }
+
     // Save to file
     doc.SaveFile(filepath.c_str());
 }
@@ -253,6 +326,9 @@ void WorldGenConfig::LoadFromXML(std::string const& filepath)
         biomeNoise.weirdnessScale = ParseXmlAttribute(*biomeNoiseElement, "weirdnessScale", biomeNoise.weirdnessScale);
         biomeNoise.weirdnessOctaves = ParseXmlAttribute(*biomeNoiseElement, "weirdnessOctaves", biomeNoise.weirdnessOctaves);
         biomeNoise.weirdnessPersistence = ParseXmlAttribute(*biomeNoiseElement, "weirdnessPersistence", biomeNoise.weirdnessPersistence);
+
+        biomeNoise.useRegionCache = ParseXmlAttribute(*biomeNoiseElement, "useRegionCache", biomeNoise.useRegionCache);
+        biomeNoise.regionSampleStep = ParseXmlAttribute(*biomeNoiseElement, "regionSampleStep", biomeNoise.regionSampleStep);
     }
 
     // Load Density Parameters
@@ -261,6 +337,8 @@ void WorldGenConfig::LoadFromXML(std::string const& filepath)
         density.densityNoiseScale = ParseXmlAttribute(*densityElement, "densityNoiseScale", density.densityNoiseScale);
         density.densityNoiseOctaves = ParseXmlAttribute(*densityElement, "densityNoiseOctaves", density.densityNoiseOctaves);
         density.densityBiasPerBlock = ParseXmlAttribute(*densityElement, "densityBiasPerBlock", density.densityBiasPerBlock);
+        density.densityLatticeStepXY = ParseXmlAttribute(*densityElement, "densityLatticeStepXY", density.densityLatticeStepXY);
+        density.densityLatticeStepZ = ParseXmlAttribute(*densityElement, "densityLatticeStepZ", density.densityLatticeStepZ);
 
         density.topSlideStart = ParseXmlAttribute(*densityElement, "topSlideStart", density.topSlideStart);
         density.topSlideEnd = ParseXmlAttribute(*densityElement, "topSlideEnd", density.topSlideEnd);
@@ -297,6 +375,7 @@ void WorldGenConfig::LoadFromXML(std::string const& filepath)
     {
         peaksValleysCurve = LoadCurveFromXML(*peaksValleysCurveElement);
     }
+    BakeCurves();
 
     // Load Cave Parameters
     if (XmlElement* cavesElement = root->FirstChildElement("Caves"))
@@ -351,6 +430,14 @@ void WorldGenConfig::LoadFromXML(std::string const& filepath)
         carvers.riverDepthMax = ParseXmlAttribute(*carversElement, "riverDepthMax", carvers.riverDepthMax);
         carvers.riverEdgeFalloff = ParseXmlAttribute(*carversElement, "riverEdgeFalloff", carvers.riverEdgeFalloff);
     }
+
+    // Load Pipeline Parameters
+    if (XmlElement* pipelineElement = root->FirstChildElement("Pipeline"))
+    {
+        pipeline.splitStageJobs = ParseXmlAttribute(*pipelineElement, "splitStageJobs", pipeline.splitStageJobs);
+        pipeline.retainSurfaceSnapshots = ParseXmlAttribute(*pipelineElement, "retainSurfaceSnapshots", pipeline.retainSurfaceSnapshots);
+        pipeline.retainStageIntermediates = ParseXmlAttribute(*pipelineElement, "retainStageIntermediates", pipeline.retainStageIntermediates);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -8,6 +8,8 @@
 #pragma once
 //----------------------------------------------------------------------------------------------------
 #include "Engine/Math/Curve1D.hpp"
+#include "Game/Framework/BakedCurve1D.hpp"
+#include <cstdint>
 #include <string>
 
 //----------------------------------------------------------------------------------------------------
@@ -19,6 +21,16 @@ namespace tinyxml2
 	class XMLElement;
 }
 
+//----------------------------------------------------------------------------------------------------
+// Parameter groups of WorldGenConfig, as bit flags (see WorldGenConfig::GetChangedSections)
+//----------------------------------------------------------------------------------------------------
+uint32_t constexpr WORLDGEN_SECTION_BIOME_NOISE = 1u << 0;
+uint32_t constexpr WORLDGEN_SECTION_DENSITY     = 1u << 1;
+uint32_t constexpr WORLDGEN_SECTION_CURVES      = 1u << 2;     // CurveParams and the three shaping curves
+uint32_t constexpr WORLDGEN_SECTION_CAVES       = 1u << 3;
+uint32_t constexpr WORLDGEN_SECTION_TREES       = 1u << 4;
+uint32_t constexpr WORLDGEN_SECTION_CARVERS     = 1u << 5;
+
 //----------------------------------------------------------------------------------------------------
 // WorldGenConfig - Tunable world generation parameters
 // Replaces hardcoded constexpr values in GameCommon.hpp with runtime-editable settings
@@ -55,6 +67,13 @@ struct WorldGenConfig
 		float weirdnessScale = 350.f;
 		int weirdnessOctaves = 3;
 		float weirdnessPersistence = 0.5f;
+
+		// Region cache: T/H/C/E/W sampled every regionSampleStep blocks over 8x8 chunk regions, shared by
+		// all chunks in the region and bilinearly upsampled (1 = exact per column). Power of two, at most 32
+		bool useRegionCache = true;
+		int regionSampleStep = 4;
+
+		bool operator==(BiomeNoiseParams const&) const = default;
 	} biomeNoise;
 
 	//----------------------------------------------------------------------------------------------------
@@ -66,6 +85,11 @@ struct WorldGenConfig
 		int densityNoiseOctaves = 3;
 		float densityBiasPerBlock = 0.10f;
 
+		// Density noise lattice: sample every step blocks and trilinearly interpolate (1 = exact per block)
+		// Rounded down to a power of two dividing the chunk size
+		int densityLatticeStepXY = 4;
+		int densityLatticeStepZ = 8;
+
 		// Slides
 		int topSlideStart = 100;
 		int topSlideEnd = 120;
@@ -75,6 +99,8 @@ struct WorldGenConfig
 		// Default terrain height (sea level)
 		float defaultTerrainHeight = 80.f;
 		float seaLevel = 80.f;
+
+		bool operator==(DensityParams const&) const = default;
 	} density;
 
 	//----------------------------------------------------------------------------------------------------
@@ -93,6 +119,8 @@ struct WorldGenConfig
 		// Peaks & Valleys curve: Additional height variation
 		float pvHeightMin = -15.0f;
 		float pvHeightMax = 25.0f;
+
+		bool operator==(CurveParams const&) const = default;
 	} curves;
 
 	//----------------------------------------------------------------------------------------------------
@@ -115,6 +143,8 @@ struct WorldGenConfig
 		// Safety parameters
 		int minCaveDepthFromSurface = 5;
 		int minCaveHeightAboveLava = 3;
+
+		bool operator==(CaveParams const&) const = default;
 	} caves;
 
 	//----------------------------------------------------------------------------------------------------
@@ -126,6 +156,8 @@ struct WorldGenConfig
 		int treeNoiseOctaves = 2;
 		float treePlacementThreshold = 0.45f;  // Lowered from 0.8 to 0.45 for visibility
 		int minTreeSpacing = 3;
+
+		bool operator==(TreeParams const&) const = default;
 	} trees;
 
 	//----------------------------------------------------------------------------------------------------
@@ -158,8 +190,28 @@ struct WorldGenConfig
 		int riverDepthMin = 3;
 		int riverDepthMax = 8;
 		float riverEdgeFalloff = 0.4f;
+
+		bool operator==(CarverParams const&) const = default;
 	} carvers;
 
+	//----------------------------------------------------------------------------------------------------
+	// Generation Pipeline Parameters (see ChunkGenerationStage)
+	//----------------------------------------------------------------------------------------------------
+	struct PipelineParams
+	{
+		// One ChunkGenerateJob per stage instead of one per chunk: stages of a chunk may run on different
+		// workers, at the cost of one frame of latency per stage
+		bool splitStageJobs = false;
+
+		// Keep each chunk's block types after the SURFACE stage (palette-compressed) so tree changes
+		// re-run only the TREES and LIGHTING stages
+		bool retainSurfaceSnapshots = true;
+
+		// Keep each chunk's climate columns, density noise lattice and carver spans after generation so
+		// density, curve, cave and carver changes restart at the DENSITY stage and reuse what still matches
+		bool retainStageIntermediates = true;
+	} pipeline;
+
 	//----------------------------------------------------------------------------------------------------
 	// Curve Objects (for terrain shaping)
 	//----------------------------------------------------------------------------------------------------
@@ -167,6 +219,12 @@ struct WorldGenConfig
 	PiecewiseCurve1D erosionCurve;          // Maps erosion to scale multiplier
 	PiecewiseCurve1D peaksValleysCurve;     // Maps PV to height modifier
 
+	// Lookup tables of the three curves over their noise input ranges, read by generation instead of the
+	// curves themselves. BakeCurves() refreshes them; the config does so on construction and load
+	BakedCurve1D continentalnessTable;      // Input: C noise [-1.2, 1.0]
+	BakedCurve1D erosionTable;              // Input: E noise [-1, 1]
+	BakedCurve1D peaksValleysTable;         // Input: PV [-1, 1]
+
 	//----------------------------------------------------------------------------------------------------
 	// Methods
 	//----------------------------------------------------------------------------------------------------
@@ -188,6 +246,13 @@ struct WorldGenConfig
 	// Reset to default values
 	void ResetToDefaults();
 
+	// Re-bake the curve tables whose curve changed since the last bake (curve editor calls this every frame)
+	void BakeCurves();
+
+	// WORLDGEN_SECTION_* flags of the parameter groups that differ from baseline (pipeline options excluded)
+	uint32_t GetChangedSections(WorldGenConfig const& baseline) const;
+	static bool AreCurvesEqual(PiecewiseCurve1D const& curveA, PiecewiseCurve1D const& curveB);
+
 	// SimpleMiner-specific terrain shaping curve presets
 	// Moved from Engine to maintain architectural purity (Engine should be game-agnostic)
 	static PiecewiseCurve1D CreateDefaultContinentalnessCurve();
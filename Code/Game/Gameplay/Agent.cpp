@@ -17,6 +17,8 @@
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/DebugRenderSystem.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+
+#include <algorithm>
 //----------------------------------------------------------------------------------------------------
 
 //----------------------------------------------------------------------------------------------------
@@ -282,7 +284,12 @@ std::vector<Agent::BlockInfo> Agent::GetNearbyBlocks(float radius) const
 	{
 		for (int dy = -radiusBlocks; dy <= radiusBlocks; ++dy)
 		{
-			for (int dz = -radiusBlocks; dz <= radiusBlocks; ++dz)
+			// Everything above the column top is air, so stop the vertical sweep there
+			int const columnTopZ = world->GetHighestNonAirZ(static_cast<int>(m_position.x) + dx,
+			                                                static_cast<int>(m_position.y) + dy);
+			int const maxDz      = (std::min)(radiusBlocks, columnTopZ - static_cast<int>(m_position.z));
+
+			for (int dz = -radiusBlocks; dz <= maxDz; ++dz)
 			{
 				// Calculate global block coordinates
 				IntVec3 blockCoords = IntVec3(
@@ -504,6 +504,30 @@ void Game::UpdateFromKeyBoard()
                                            m_world->GetPendingGenerateJobCount(),
                                            m_world->GetPendingLoadJobCount(),
                                            m_world->GetPendingSaveJobCount()), Vec2(0.f, 240.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+                DebugAddScreenText(Stringf("Scheduled Jobs - Generate: %d Load: %d Cancelled: %d Teleport->Visible: %.0f ms",
+                                           m_world->GetScheduledChunkJobCount(ChunkJobKind::GENERATE),
+                                           m_world->GetScheduledChunkJobCount(ChunkJobKind::LOAD),
+                                           m_world->GetCancelledChunkJobCount(),
+                                           m_world->GetLastTeleportFirstVisibleMs()), Vec2(0.f, 320.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+                DebugAddScreenText(Stringf("Completed Jobs - Last Frame: %d Cost: %.3f ms Peak: %.3f ms",
+                                           m_world->GetCompletedJobDispatchStats().m_lastFrameJobCount,
+                                           m_world->GetCompletedJobDispatchStats().m_lastFrameMs,
+                                           m_world->GetCompletedJobDispatchStats().m_peakFrameMs), Vec2(0.f, 340.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+                // Palette block storage: how many chunks are compressed and what the block data costs
+                DebugAddScreenText(Stringf("Block Storage - Packed: %d/%d Resident: %.1f MB",
+                                           m_world->GetPackedChunkCount(),
+                                           m_world->GetActiveChunkCount(),
+                                           (double)m_world->GetTotalResidentBlockBytes() / (1024.0 * 1024.0)), Vec2(0.f, 260.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+                DebugAddScreenText(Stringf("Chunk Pool - Pooled: %d Hits: %d Misses: %d",
+                                           m_world->GetPooledChunkCount(),
+                                           m_world->GetChunkPoolHitCount(),
+                                           m_world->GetChunkPoolMissCount()), Vec2(0.f, 280.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+                DebugAddScreenText(Stringf("Chunk Cache - Entries: %d Hits: %d Misses: %d Resident: %.1f MB",
+                                           m_world->GetChunkCache().GetEntryCount(),
+                                           m_world->GetChunkCache().GetHitCount(),
+                                           m_world->GetChunkCache().GetMissCount(),
+                                           (double)m_world->GetChunkCache().GetResidentBytes() / (1024.0 * 1024.0)), Vec2(0.f, 300.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
             }
         }
 #endif
@@ -650,6 +674,17 @@ Vec3 Game::GetPlayerVelocity() const
     return Vec3::ZERO;
 }
 
+//----------------------------------------------------------------------------------------------------
+Vec3 Game::GetPlayerCameraForward() const
+{
+    if (m_player && m_player->GetCamera())
+    {
+        return m_player->GetCamera()->GetOrientation().GetAsMatrix_IFwd_JLeft_KUp().GetIBasis3D();
+    }
+
+    return Vec3::ZERO;
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::ShowTerrainDebugWindow()
 {
@@ -696,6 +731,16 @@ void Game::ShowTerrainDebugWindow()
                 }
             }
 
+            if (ImGui::MenuItem("Apply Config Changes", nullptr, false, !m_autoApplyConfigChanges))
+            {
+                // Re-run only the generation stages that read a changed parameter group
+                if (m_world != nullptr)
+                {
+                    m_world->RegenerateChangedStages();
+                }
+            }
+            ImGui::MenuItem("Auto Apply Config Changes", nullptr, &m_autoApplyConfigChanges);
+
             ImGui::Separator();
 
             // Phase 0, Task 0.4: Debug Visualization Mode Selection
@@ -801,6 +846,13 @@ void Game::ShowTerrainDebugWindow()
             ImGui::EndTabItem();
         }
 
+        // Tab 7: Performance (storage / streaming benchmarks)
+        if (ImGui::BeginTabItem("Performance"))
+        {
+            ShowPerformanceTab();
+            ImGui::EndTabItem();
+        }
+
         // Tab 5: Visualization
         if (ImGui::BeginTabItem("Visualization"))
         {
@@ -867,6 +919,12 @@ void Game::ShowTerrainDebugWindow()
         ImGui::EndTabBar();
     }
 
+    // Apply edits once the widget is released: only the stages reading the changed sections re-run
+    if (m_autoApplyConfigChanges && m_world != nullptr && !ImGui::IsAnyItemActive() && !ImGui::IsMouseDown(0))
+    {
+        m_world->RegenerateChangedStages();
+    }
+
     ImGui::End();
 }
 
@@ -1200,6 +1258,7 @@ void Game::ShowCurvesTab()
         ShowCurveEditor("Continentalness", g_worldGenConfig->continentalnessCurve,
                         g_worldGenConfig->curves.continentalnessHeightMin,
                         g_worldGenConfig->curves.continentalnessHeightMax);
+        ImGui::Text("Lookup table error: <= %.2e", g_worldGenConfig->continentalnessTable.GetMaxError());
 
         ImGui::DragFloat("Height Min", &g_worldGenConfig->curves.continentalnessHeightMin, 1.0f, -50.0f, 0.0f);
         ImGui::DragFloat("Height Max", &g_worldGenConfig->curves.continentalnessHeightMax, 1.0f, 0.0f, 100.0f);
@@ -1219,6 +1278,7 @@ void Game::ShowCurvesTab()
         ShowCurveEditor("Erosion", g_worldGenConfig->erosionCurve,
                         g_worldGenConfig->curves.erosionScaleMin,
                         g_worldGenConfig->curves.erosionScaleMax);
+        ImGui::Text("Lookup table error: <= %.2e", g_worldGenConfig->erosionTable.GetMaxError());
 
         ImGui::DragFloat("Scale Min", &g_worldGenConfig->curves.erosionScaleMin, 0.1f, 0.0f, 1.0f);
         ImGui::DragFloat("Scale Max", &g_worldGenConfig->curves.erosionScaleMax, 0.1f, 1.0f, 5.0f);
@@ -1238,12 +1298,16 @@ void Game::ShowCurvesTab()
         ShowCurveEditor("Peaks & Valleys", g_worldGenConfig->peaksValleysCurve,
                         g_worldGenConfig->curves.pvHeightMin,
                         g_worldGenConfig->curves.pvHeightMax);
+        ImGui::Text("Lookup table error: <= %.2e", g_worldGenConfig->peaksValleysTable.GetMaxError());
 
         ImGui::DragFloat("PV Height Min", &g_worldGenConfig->curves.pvHeightMin, 1.0f, -30.0f, 0.0f);
         ImGui::DragFloat("PV Height Max", &g_worldGenConfig->curves.pvHeightMax, 1.0f, 0.0f, 50.0f);
 
         ImGui::PopID();
     }
+
+    // Generation reads the baked tables: refresh any the editors above changed this frame
+    g_worldGenConfig->BakeCurves();
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1295,6 +1359,47 @@ void Game::ShowBiomeNoiseTab()
         ImGui::DragFloat("W Persistence", &g_worldGenConfig->biomeNoise.weirdnessPersistence, 0.01f, 0.1f, 1.0f);
         ImGui::Text("Note: PV = 1 - |(3 * |W|) - 2| (calculated from Weirdness)");
     }
+
+    // Region cache of the five layers above, shared by all chunks of an 8x8 chunk region
+    if (ImGui::CollapsingHeader("Region Cache"))
+    {
+        ImGui::Checkbox("Use Region Cache", &g_worldGenConfig->biomeNoise.useRegionCache);
+        ImGui::DragInt("Region Sample Step", &g_worldGenConfig->biomeNoise.regionSampleStep, 0.1f, 1, BIOME_REGION_MAX_SAMPLE_STEP);
+        ImGui::Text("Bilinear between samples, 1 = exact per column (takes effect on Regenerate Chunks)");
+
+        if (m_world != nullptr)
+        {
+            BiomeRegionCacheStats const stats       = m_world->GetBiomeRegionCache().GetStats();
+            int const                   lookupCount = stats.m_hitCount + stats.m_missCount;
+
+            ImGui::Text("Regions: %d / %d  Resident: %.2f MB", stats.m_regionCount, m_world->GetBiomeRegionCache().GetCapacity(),
+                        (double)stats.m_residentBytes / (1024.0 * 1024.0));
+            ImGui::Text("Hits: %d Misses: %d (%.1f%% hit rate)  Evictions: %d", stats.m_hitCount, stats.m_missCount,
+                        lookupCount > 0 ? 100.f * (float)stats.m_hitCount / (float)lookupCount : 0.f, stats.m_evictionCount);
+
+            if (ImGui::Button("Run Biome Region Comparison"))
+            {
+                m_world->RunBiomeRegionComparison();
+            }
+
+            BiomeRegionComparisonResult const& comparison = m_world->GetBiomeRegionComparisonResult();
+            if (comparison.m_sampledChunkCount > 0)
+            {
+                int const columnCount = comparison.m_sampledChunkCount * CHUNK_SIZE_X * CHUNK_SIZE_Y;
+
+                ImGui::Text("Step %d over %d chunks", comparison.m_sampleStep, comparison.m_sampledChunkCount);
+                ImGui::Text("Exact: %.2f ms/chunk  Cached: %.2f ms/chunk  (%.1fx)", comparison.m_exactMsPerChunk,
+                            comparison.m_cachedMsPerChunk,
+                            comparison.m_cachedMsPerChunk > 0.0 ? comparison.m_exactMsPerChunk / comparison.m_cachedMsPerChunk : 0.0);
+                ImGui::Text("Max climate error: %.5f", comparison.m_maxClimateError);
+                ImGui::Text("Biome changed: %d / %d columns (%.3f%%)", comparison.m_changedBiomeCount, columnCount,
+                            100.0 * (double)comparison.m_changedBiomeCount / (double)columnCount);
+                ImGui::Text("Solidity changed: %d / %d blocks (%.4f%%)", comparison.m_changedSolidityCount, comparison.m_totalBlockCount,
+                            100.0 * (double)comparison.m_changedSolidityCount / (double)comparison.m_totalBlockCount);
+                ImGui::Text("Block type changed: %d", comparison.m_changedTypeCount);
+            }
+        }
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1313,6 +1418,33 @@ void Game::ShowDensityTab()
         ImGui::DragInt("Density Octaves", &g_worldGenConfig->density.densityNoiseOctaves, 0.1f, 1, 5);
         ImGui::DragFloat("Bias Per Block", &g_worldGenConfig->density.densityBiasPerBlock, 0.001f, 0.0f, 0.5f);
         ImGui::Text("Formula: D(x,y,z) = N3D(x,y,z,scale) + bias * (DEFAULT_HEIGHT - z)");
+
+        ImGui::Separator();
+
+        ImGui::Text("N3D lattice (trilinear between samples, 1 = exact per block)");
+        ImGui::DragInt("Lattice Step XY", &g_worldGenConfig->density.densityLatticeStepXY, 0.1f, 1, 32);
+        ImGui::DragInt("Lattice Step Z", &g_worldGenConfig->density.densityLatticeStepZ, 0.1f, 1, 256);
+
+        if (m_world != nullptr && ImGui::Button("Run Density Lattice Comparison"))
+        {
+            m_world->RunDensityLatticeComparison();
+        }
+
+        if (m_world != nullptr)
+        {
+            DensityLatticeComparisonResult const& comparison = m_world->GetDensityLatticeComparisonResult();
+            if (comparison.m_sampledChunkCount > 0)
+            {
+                ImGui::Text("Lattice %dx%dx%d over %d chunks", comparison.m_latticeStepXY, comparison.m_latticeStepXY,
+                            comparison.m_latticeStepZ, comparison.m_sampledChunkCount);
+                ImGui::Text("Exact: %.2f ms/chunk  Lattice: %.2f ms/chunk  (%.1fx)", comparison.m_exactMsPerChunk,
+                            comparison.m_latticeMsPerChunk,
+                            comparison.m_latticeMsPerChunk > 0.0 ? comparison.m_exactMsPerChunk / comparison.m_latticeMsPerChunk : 0.0);
+                ImGui::Text("Solidity changed: %d / %d blocks (%.4f%%)", comparison.m_changedSolidityCount, comparison.m_totalBlockCount,
+                            100.0 * (double)comparison.m_changedSolidityCount / (double)comparison.m_totalBlockCount);
+                ImGui::Text("Block type changed: %d", comparison.m_changedTypeCount);
+            }
+        }
     }
 
     // Slides
@@ -1374,6 +1506,29 @@ void Game::ShowCavesTab()
         ImGui::DragInt("Min Cave Height Above Lava", &g_worldGenConfig->caves.minCaveHeightAboveLava, 1, 0, 10);
         ImGui::Text("Prevents caves from breaking through surface or affecting lava layer");
     }
+
+    // Surface search benchmark
+    if (ImGui::CollapsingHeader("Cave Surface Benchmark"))
+    {
+        ImGui::Text("Per-block upward surface search vs per-column surface profile (3x3 chunks, exact density)");
+
+        if (m_world != nullptr && ImGui::Button("Run Cave Surface Benchmark"))
+        {
+            m_world->RunCaveSurfaceBenchmark();
+        }
+
+        if (m_world != nullptr)
+        {
+            CaveSurfaceBenchmarkResult const& benchmark = m_world->GetCaveSurfaceBenchmarkResult();
+            if (benchmark.m_sampledChunkCount > 0)
+            {
+                ImGui::Text("Search: %.2f ms/chunk  Profile: %.2f ms/chunk  (%.1fx)", benchmark.m_legacyMsPerChunk,
+                            benchmark.m_profileMsPerChunk,
+                            benchmark.m_profileMsPerChunk > 0.0 ? benchmark.m_legacyMsPerChunk / benchmark.m_profileMsPerChunk : 0.0);
+                ImGui::Text("Blocks differing: %d (over %d chunks)", benchmark.m_changedBlockCount, benchmark.m_sampledChunkCount);
+            }
+        }
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1394,6 +1549,16 @@ void Game::ShowTreesTab()
         ImGui::Text("Higher threshold = fewer trees");
         ImGui::Text("Note: Trees are placed based on biome type (see Phase 3B implementation)");
     }
+
+    // Tree parameters only feed the TREES stage: re-run it (and LIGHTING) on the retained post-surface blocks
+    if (m_world != nullptr && !m_autoApplyConfigChanges && ImGui::Button("Apply Tree Changes (Trees + Lighting stages)"))
+    {
+        m_world->RegenerateChangedStages();
+    }
+    if (!g_worldGenConfig->pipeline.retainSurfaceSnapshots)
+    {
+        ImGui::Text("Surface snapshots are off: chunks re-run every stage");
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1456,6 +1621,334 @@ void Game::ShowCarversTab()
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+// ShowPerformanceTab - ImGui tab for runtime storage statistics and benchmarks
+//----------------------------------------------------------------------------------------------------
+void Game::ShowPerformanceTab()
+{
+    if (m_world == nullptr)
+    {
+        ImGui::Text("No world loaded");
+        return;
+    }
+
+    // Palette-compressed block storage
+    if (ImGui::CollapsingHeader("Block Storage", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        int const    activeChunkCount = m_world->GetActiveChunkCount();
+        size_t const residentBytes    = m_world->GetTotalResidentBlockBytes();
+        size_t const flatBytes        = (size_t)activeChunkCount * BLOCKS_PER_CHUNK * sizeof(Block);
+
+        ImGui::Text("Packed Chunks: %d / %d", m_world->GetPackedChunkCount(), activeChunkCount);
+        ImGui::Text("Resident Block Data: %.1f MB (flat would be %.1f MB)",
+                    (double)residentBytes / (1024.0 * 1024.0),
+                    (double)flatBytes / (1024.0 * 1024.0));
+
+        if (ImGui::Button("Run Block Storage Benchmark"))
+        {
+            m_world->RunBlockStorageBenchmark();
+        }
+
+        BlockStorageBenchmarkResult const& result = m_world->GetBlockStorageBenchmarkResult();
+        if (result.m_sampledChunkCount > 0)
+        {
+            double const chunkCount = (double)result.m_sampledChunkCount;
+            ImGui::Text("Sampled Chunks: %d", result.m_sampledChunkCount);
+            ImGui::Text("Memory/Chunk: flat %.1f KB, palette %.1f KB",
+                        (double)result.m_flatBytes / chunkCount / 1024.0,
+                        (double)result.m_paletteBytes / chunkCount / 1024.0);
+            ImGui::Text("Sequential Read: flat SoA %.2f ns, interleaved %.2f ns, palette %.2f ns",
+                        result.m_flatSequentialNsPerRead, result.m_interleavedSeqNsPerRead, result.m_paletteSequentialNsPerRead);
+            ImGui::Text("Random Read: flat %.2f ns, palette %.2f ns", result.m_flatRandomNsPerRead, result.m_paletteRandomNsPerRead);
+            ImGui::Text("Pack: %.3f ms/chunk, Unpack: %.3f ms/chunk", result.m_packMsPerChunk, result.m_unpackMsPerChunk);
+        }
+    }
+
+    // Chunk object pool (recycled instead of new/delete on activation/deactivation)
+    if (ImGui::CollapsingHeader("Chunk Pool", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        int const hitCount     = m_world->GetChunkPoolHitCount();
+        int const missCount    = m_world->GetChunkPoolMissCount();
+        int const acquireCount = hitCount + missCount;
+
+        ImGui::Text("Pooled Chunks: %d / %d", m_world->GetPooledChunkCount(), MAX_POOLED_CHUNKS);
+        ImGui::Text("Hits: %d Misses: %d (%.1f%% hit rate)", hitCount, missCount,
+                    acquireCount > 0 ? 100.f * (float)hitCount / (float)acquireCount : 0.f);
+    }
+
+    // Compressed cache of recently deactivated chunks (checked by ActivateChunk before disk / generation)
+    if (ImGui::CollapsingHeader("Chunk Cache", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ChunkCache const& chunkCache  = m_world->GetChunkCache();
+        int const         lookupCount = chunkCache.GetHitCount() + chunkCache.GetMissCount();
+
+        ImGui::Text("Entries: %d", chunkCache.GetEntryCount());
+        ImGui::Text("Resident: %.1f MB / %.1f MB",
+                    (double)chunkCache.GetResidentBytes() / (1024.0 * 1024.0),
+                    (double)chunkCache.GetByteBudget() / (1024.0 * 1024.0));
+        ImGui::Text("Hits: %d Misses: %d (%.1f%% hit rate)", chunkCache.GetHitCount(), chunkCache.GetMissCount(),
+                    lookupCount > 0 ? 100.f * (float)chunkCache.GetHitCount() / (float)lookupCount : 0.f);
+        ImGui::Text("Evictions: %d", chunkCache.GetEvictionCount());
+
+        int budgetMB = (int)(chunkCache.GetByteBudget() / (1024 * 1024));
+        if (ImGui::SliderInt("Budget (MB)", &budgetMB, 0, 512))
+        {
+            m_world->SetChunkCacheByteBudget((size_t)budgetMB * 1024 * 1024);
+        }
+    }
+
+    // Active chunk lookup (GetChunk reads a lock-free toroidal grid; overflow falls back to the locked map)
+    if (ImGui::CollapsingHeader("Chunk Lookup", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Text("Grid: %d x %d slots, Overflow: %d", CHUNK_GRID_SIZE, CHUNK_GRID_SIZE, m_world->GetChunkGridOverflowCount());
+        ImGui::Text("Activation Frontier: %d / %d offsets resolved",
+                    m_world->GetActivationFrontier().GetCursor(), ChunkActivationFrontier::GetOffsetCount());
+
+        if (ImGui::Button("Run Chunk Lookup Benchmark"))
+        {
+            m_world->RunChunkLookupBenchmark();
+        }
+
+        ChunkLookupBenchmarkResult const& result = m_world->GetChunkLookupBenchmarkResult();
+        if (result.m_lookupCount > 0)
+        {
+            ImGui::Text("Lookups: %d (%d hits)", result.m_lookupCount, result.m_hitCount);
+            ImGui::Text("GetChunk: locked map %.2f ns, grid %.2f ns (%.1fx)",
+                        result.m_mapNsPerLookup, result.m_gridNsPerLookup,
+                        result.m_gridNsPerLookup > 0.0 ? result.m_mapNsPerLookup / result.m_gridNsPerLookup : 0.0);
+        }
+    }
+
+    // Chunk job scheduling (parked jobs are re-scored every frame and cancelled once out of range)
+    if (ImGui::CollapsingHeader("Chunk Job Scheduler", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ImGui::Text("In Flight - Generate: %d / %d Load: %d / %d",
+                    m_world->GetPendingGenerateJobCount(), MAX_PENDING_GENERATE_JOBS,
+                    m_world->GetPendingLoadJobCount(), MAX_PENDING_LOAD_JOBS);
+        ImGui::Text("Scheduled - Generate: %d Load: %d",
+                    m_world->GetScheduledChunkJobCount(ChunkJobKind::GENERATE),
+                    m_world->GetScheduledChunkJobCount(ChunkJobKind::LOAD));
+        ImGui::Text("Cancelled: %d", m_world->GetCancelledChunkJobCount());
+
+        if (m_world->IsTimingTeleport())
+        {
+            ImGui::Text("Teleport -> first visible chunk: waiting...");
+        }
+        else if (m_world->GetLastTeleportFirstVisibleMs() >= 0.f)
+        {
+            ImGui::Text("Teleport -> first visible chunk: %.1f ms", m_world->GetLastTeleportFirstVisibleMs());
+        }
+
+        // Jump far beyond the deactivation range so every chunk around the landing point is missing
+        if (ImGui::Button("Teleport Player +4096 X") && m_player != nullptr)
+        {
+            m_player->m_position.x += 4096.f;
+            m_player->m_velocity   = Vec3::ZERO;
+        }
+    }
+
+    // Completed job dispatch (each job goes straight to its type's handler, no tracking-list scans)
+    if (ImGui::CollapsingHeader("Completed Job Dispatch", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        CompletedJobDispatchStats const& stats = m_world->GetCompletedJobDispatchStats();
+        ImGui::Text("Last Frame: %d jobs, %.3f ms", stats.m_lastFrameJobCount, stats.m_lastFrameMs);
+        ImGui::Text("Peak: %.3f ms", stats.m_peakFrameMs);
+        ImGui::SameLine();
+        if (ImGui::Button("Reset Peak"))
+        {
+            m_world->ResetCompletedJobDispatchPeak();
+        }
+
+        ImGui::SliderInt("Jobs In Flight (per type)", &m_jobDispatchBenchmarkInFlightCount, 16, 1024);
+        if (ImGui::Button("Run Job Dispatch Benchmark"))
+        {
+            m_world->RunJobDispatchBenchmark(m_jobDispatchBenchmarkInFlightCount);
+        }
+
+        JobDispatchBenchmarkResult const& result = m_world->GetJobDispatchBenchmarkResult();
+        if (result.m_inFlightCount > 0)
+        {
+            ImGui::Text("%d per type: linear scan %.1f ns/job, hashed %.1f ns/job (%.1fx)",
+                        result.m_inFlightCount, result.m_linearNsPerJob, result.m_hashedNsPerJob,
+                        result.m_hashedNsPerJob > 0.0 ? result.m_linearNsPerJob / result.m_hashedNsPerJob : 0.0);
+        }
+    }
+
+    // Grid-at-a-time Perlin noise used by terrain generation
+    if (ImGui::CollapsingHeader("Batch Noise", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        BatchNoiseValidation const& validation = GetBatchNoiseValidation();
+        ImGui::Text("Path: %s", validation.m_isSimdEnabled ? "SSE2" : (validation.m_isSimdAvailable ? "Scalar (SSE2 out of tolerance)" : "Scalar"));
+        ImGui::Text("Validation: %d / %d samples bit-identical", validation.m_exactSampleCount, validation.m_sampleCount);
+        ImGui::Text("Max error: 2D %g  3D %g  (tolerance %g)", (double)validation.m_maxError2d, (double)validation.m_maxError3d,
+                    (double)BATCH_NOISE_TOLERANCE);
+
+        if (ImGui::Button("Run Batch Noise Benchmark"))
+        {
+            m_batchNoiseBenchmarkResult    = RunBatchNoiseBenchmark();
+            m_hasBatchNoiseBenchmarkResult = true;
+        }
+
+        if (m_hasBatchNoiseBenchmarkResult)
+        {
+            BatchNoiseBenchmarkResult const& result = m_batchNoiseBenchmarkResult;
+            ImGui::Text("2D: scalar %.1f ns  batch %.1f ns per sample (%.1fx)", result.m_scalarNsPerSample2d, result.m_batchNsPerSample2d,
+                        result.m_batchNsPerSample2d > 0.0 ? result.m_scalarNsPerSample2d / result.m_batchNsPerSample2d : 0.0);
+            ImGui::Text("3D: scalar %.1f ns  batch %.1f ns per sample (%.1fx)", result.m_scalarNsPerSample3d, result.m_batchNsPerSample3d,
+                        result.m_batchNsPerSample3d > 0.0 ? result.m_scalarNsPerSample3d / result.m_batchNsPerSample3d : 0.0);
+        }
+    }
+
+    // Worker time per generation pipeline stage over the generate jobs completed in this world
+    if (ImGui::CollapsingHeader("Generation Stages", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        ChunkGenerationStageStats const& stats = m_world->GetGenerationStageStats();
+        ImGui::Text("%d generate jobs completed", stats.m_jobCount);
+        for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+        {
+            int const runCount = stats.m_runCount[stageIndex];
+            ImGui::Text("%-8s %7.3f ms avg  (%d runs)", GetChunkGenerationStageName((ChunkGenerationStage)stageIndex),
+                        runCount > 0 ? stats.m_totalSeconds[stageIndex] * 1000.0 / (double)runCount : 0.0, runCount);
+        }
+        if (ImGui::Button("Reset Stage Timings"))
+        {
+            m_world->ResetGenerationStageStats();
+        }
+
+        ImGui::Checkbox("One Job Per Stage", &g_worldGenConfig->pipeline.splitStageJobs);
+        ImGui::Checkbox("Retain Surface Snapshots", &g_worldGenConfig->pipeline.retainSurfaceSnapshots);
+        ImGui::Text("Surface snapshots: %.2f MB", (double)m_world->GetTotalSurfaceSnapshotBytes() / (1024.0 * 1024.0));
+        ImGui::Checkbox("Retain Stage Intermediates", &g_worldGenConfig->pipeline.retainStageIntermediates);
+        ImGui::Text("Stage intermediates: %.2f MB", (double)m_world->GetTotalRetainedIntermediateBytes() / (1024.0 * 1024.0));
+    }
+
+    // Scratch-chunk generation throughput and block data checksum (see GenerationBenchmark.hpp)
+    if (ImGui::CollapsingHeader("Generation Benchmark"))
+    {
+        GenerationBenchmarkSettings& settings = m_generationBenchmarkSettings;
+        ImGui::DragInt2("Center Chunk", &settings.m_centerChunkCoords.x, 0.5f);
+        ImGui::SliderInt("Chunk Radius", &settings.m_chunkRadius, 0, 8);
+        ImGui::SliderInt("Workers", &settings.m_workerCount, 1, 32);
+
+        if (ImGui::Button("Run Generation Benchmark"))
+        {
+            m_generationBenchmarkResult    = RunGenerationBenchmark(settings);
+            m_hasGenerationBenchmarkResult = true;
+        }
+
+        if (m_hasGenerationBenchmarkResult)
+        {
+            GenerationBenchmarkResult const& result = m_generationBenchmarkResult;
+            ImGui::Text("%d chunks on %d workers: %.3f s (%.1f chunks/s)", result.m_chunkCount, result.m_workerCount,
+                        result.m_wallSeconds, result.m_chunksPerSecond);
+            ImGui::Text("Per chunk: terrain %.2f ms  lighting %.2f ms  trees %.2f ms", result.m_terrainMsPerChunk,
+                        result.m_lightingMsPerChunk, result.m_stageMsPerChunk[(int)ChunkGenerationStage::TREES]);
+            for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+            {
+                ImGui::SameLine();
+                ImGui::Text("%s %.2f", GetChunkGenerationStageName((ChunkGenerationStage)stageIndex), result.m_stageMsPerChunk[stageIndex]);
+            }
+            ImGui::Text("Checksum: %016llx", (unsigned long long)result.m_checksum);
+        }
+    }
+
+    // Vertical section occupancy (uniform sections are skipped by meshing, lighting and saving)
+    if (ImGui::CollapsingHeader("Chunk Sections", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        int allAirCount   = 0;
+        int allStoneCount = 0;
+        int mixedCount    = 0;
+        m_world->GetSectionOccupancyCounts(allAirCount, allStoneCount, mixedCount);
+
+        int const   totalCount = allAirCount + allStoneCount + mixedCount;
+        float const toPercent  = (totalCount > 0) ? 100.f / (float)totalCount : 0.f;
+        ImGui::Text("All Air: %d (%.1f%%)", allAirCount, (float)allAirCount * toPercent);
+        ImGui::Text("All Stone: %d (%.1f%%)", allStoneCount, (float)allStoneCount * toPercent);
+        ImGui::Text("Mixed: %d (%.1f%%)", mixedCount, (float)mixedCount * toPercent);
+    }
+
+    // Light propagation engine and a place / remove light source benchmark at the camera
+    if (ImGui::CollapsingHeader("Lighting", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        bool useFloodFill = m_world->IsFloodFillLightingEnabled();
+        if (ImGui::Checkbox("Flood Fill Light Engine", &useFloodFill))
+        {
+            m_world->SetFloodFillLightingEnabled(useFloodFill);
+        }
+        ImGui::SameLine();
+        bool useParallel = m_world->IsParallelLightingEnabled();
+        if (ImGui::Checkbox("Parallel Light Jobs", &useParallel))
+        {
+            m_world->SetParallelLightingEnabled(useParallel);
+        }
+
+        LightPropagationStats const& stats = m_world->GetLightPropagationStats();
+        ImGui::Text("Blocks touched: %lld (dirty %lld, removal %lld, addition %lld, influence map %lld)",
+                    (long long)stats.GetTouchedBlockCount(), (long long)stats.m_seedCount, (long long)stats.m_removalVisitCount,
+                    (long long)stats.m_additionVisitCount, (long long)stats.m_legacyVisitCount);
+        ImGui::Text("Light changes: %lld%s", (long long)stats.m_changedLightCount, m_world->HasPendingLightWork() ? " (propagating)" : "");
+        ImGui::Text("Dirty light queue: %d entries", m_world->GetDirtyLightQueueEntryCount());
+        ImGui::Text("Light jobs: %lld (%.1f ms worker time), border deltas %lld, in flight %d, chunks waiting %d",
+                    (long long)stats.m_lightJobCount, stats.m_lightJobSeconds * 1000.0, (long long)stats.m_borderDeltaCount,
+                    m_world->GetPendingLightJobCount(), m_world->GetPendingLightChunkCount());
+        if (ImGui::Button("Reset Light Stats"))
+        {
+            m_world->ResetLightPropagationStats();
+        }
+
+        if (ImGui::Button("Run Lighting Benchmark"))
+        {
+            m_world->RunLightingBenchmark();
+        }
+
+        LightingBenchmarkResult const& result = m_world->GetLightingBenchmarkResult();
+        if (result.m_cycleCount > 0)
+        {
+            ImGui::Text("Place:  influence map %lld blocks %.3f ms, flood fill %lld blocks %.3f ms",
+                        (long long)result.m_legacyPlaceTouched, result.m_legacyPlaceMs,
+                        (long long)result.m_floodFillPlaceTouched, result.m_floodFillPlaceMs);
+            ImGui::Text("Remove: influence map %lld blocks %.3f ms, flood fill %lld blocks %.3f ms",
+                        (long long)result.m_legacyRemoveTouched, result.m_legacyRemoveMs,
+                        (long long)result.m_floodFillRemoveTouched, result.m_floodFillRemoveMs);
+            ImGui::Text("Engine mismatches: %d after place, %d after remove", result.m_placeMismatchCount, result.m_removeMismatchCount);
+            ImGui::Text("Light jobs: place %lld blocks %.3f ms, remove %lld blocks %.3f ms, %d mismatches vs flood fill",
+                        (long long)result.m_parallelPlaceTouched, result.m_parallelPlaceMs,
+                        (long long)result.m_parallelRemoveTouched, result.m_parallelRemoveMs, result.m_parallelMismatchCount);
+            ImGui::Text("Relight %d chunks: flood fill %lld blocks %.1f ms, light jobs %lld blocks %.1f ms (%lld jobs), %d mismatches",
+                        result.m_relightChunkCount, (long long)result.m_relightSerialTouched, result.m_relightSerialMs,
+                        (long long)result.m_relightParallelTouched, result.m_relightParallelMs, (long long)result.m_relightJobCount,
+                        result.m_relightMismatchCount);
+        }
+
+        if (ImGui::Button("Run Skylight Init Benchmark"))
+        {
+            m_world->RunSkylightInitBenchmark();
+        }
+
+        SkylightInitBenchmarkResult const& skylightResult = m_world->GetSkylightInitBenchmarkResult();
+        if (skylightResult.m_sampledChunkCount > 0)
+        {
+            ImGui::Text("Skylight init %d chunks x %d: legacy %.3f ms/chunk, heightmap %.3f ms/chunk, %d mismatches",
+                        skylightResult.m_sampledChunkCount, skylightResult.m_repeatCount, skylightResult.m_legacyMsPerChunk,
+                        skylightResult.m_heightmapMsPerChunk, skylightResult.m_mismatchCount);
+        }
+
+        if (ImGui::Button("Run Dirty Light Queue Benchmark"))
+        {
+            m_world->RunDirtyLightQueueBenchmark();
+        }
+
+        DirtyLightQueueBenchmarkResult const& queueResult = m_world->GetDirtyLightQueueBenchmarkResult();
+        if (queueResult.m_queuedBlockCount > 0)
+        {
+            ImGui::Text("Light queue %d chunks x %d: %lld pushes -> %lld blocks, set %.1f M blocks/s, ring %.1f M blocks/s, %d mismatches",
+                        queueResult.m_chunkCount, queueResult.m_repeatCount, (long long)queueResult.m_offeredBlockCount,
+                        (long long)queueResult.m_queuedBlockCount, queueResult.m_setBlocksPerSecond / 1.0e6,
+                        queueResult.m_ringBlocksPerSecond / 1.0e6, queueResult.m_mismatchCount);
+        }
+    }
+}
+
 #ifdef ENGINE_SCRIPTING_ENABLED
 //----------------------------------------------------------------------------------------------------
 // Assignment 7-AI: Initialize KADI WebSocket subsystem with runtime key generation
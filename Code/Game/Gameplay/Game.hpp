@@ -5,6 +5,8 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 //----------------------------------------------------------------------------------------------------
+#include "Game/Framework/BatchNoise.hpp"
+#include "Game/Framework/GenerationBenchmark.hpp"
 #include "Game/Gameplay/World.hpp"
 #include <unordered_map>
 #include <string>
@@ -50,6 +52,7 @@ public:
     bool IsInventoryOpen() const;  // Assignment 7-UI: Check if inventory screen is visible
     Vec3 GetPlayerCameraPosition() const;
     Vec3 GetPlayerVelocity() const;  // For directional chunk preloading (Task 0.7)
+    Vec3 GetPlayerCameraForward() const;  // For view-direction chunk job priority
     void ShowTerrainDebugWindow();
 
     // Accessors for debug visualization (Phase 0, Task 0.4)
@@ -80,6 +83,7 @@ private:
     void ShowCavesTab();
     void ShowTreesTab();
     void ShowCarversTab();
+    void ShowPerformanceTab();
     void ShowCurveEditor(char const* label, class PiecewiseCurve1D& curve, float minValue, float maxValue);
 
     // Interactive curve editor helpers
@@ -131,4 +135,19 @@ private:
 
     // Assignment 5 Phase 10: Raycast visual feedback
     RaycastResult m_lastRaycastHit;  // Last raycast result for debug visualization
+
+    // Terrain debug window: restage the changed generation stages whenever an edit is released
+    bool m_autoApplyConfigChanges = true;
+
+    // ImGui Performance tab: simulated jobs per type for the job dispatch benchmark
+    int m_jobDispatchBenchmarkInFlightCount = 128;
+
+    // ImGui Performance tab: last batch noise benchmark
+    BatchNoiseBenchmarkResult m_batchNoiseBenchmarkResult;
+    bool                      m_hasBatchNoiseBenchmarkResult = false;
+
+    // ImGui Performance tab: generation benchmark square and its last result
+    GenerationBenchmarkSettings m_generationBenchmarkSettings;
+    GenerationBenchmarkResult   m_generationBenchmarkResult;
+    bool                        m_hasGenerationBenchmarkResult = false;
 };
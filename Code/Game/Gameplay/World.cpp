@@ -6,6 +6,7 @@
 #include "Game/Gameplay/World.hpp"
 
 #include <algorithm>
+#include <bit>         // For std::popcount over chunk solidity masks
 #include <chrono>      // For std::chrono::milliseconds
 #include <cmath>       // For cosf, fmod in day/night cycle (Assignment 5 Phase 9)
 #include <filesystem>
@@ -31,10 +32,12 @@
 #include "Game/Framework/Chunk.hpp"
 #include "Game/Definition/BlockDefinition.hpp"  // Assignment 5 Phase 5: For IsOpaque(), IsEmissive()
 #include "Game/Framework/ChunkGenerateJob.hpp"
+#include "Game/Framework/ChunkLightJob.hpp"
 #include "Game/Framework/ChunkLoadJob.hpp"
 #include "Game/Framework/ChunkMeshJob.hpp"
 #include "Game/Framework/ChunkSaveJob.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/WorldGenConfig.hpp"
 #include "Game/Gameplay/Entity.hpp"  // Assignment 6: For GetWorldAABB() in IsEntityOnGround()
 #include "Game/Gameplay/Game.hpp"
 #include "Game/Gameplay/ItemEntity.hpp"  // Assignment 7: For SpawnItemEntity()
@@ -74,6 +77,11 @@ World::World()
     // Assignment 5 Phase 8: Load World shader and create constant buffer
     m_worldShader = g_renderer->CreateOrGetShaderFromFile("Data/Shaders/World");
     m_worldConstantBuffer = g_renderer->CreateConstantBuffer(sizeof(WorldConstants));
+
+    if (g_worldGenConfig != nullptr)
+    {
+        m_generatedConfig = *g_worldGenConfig;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -190,7 +198,10 @@ World::~World()
         m_chunkGenerationJobs.clear();
         m_chunkLoadJobs.clear();
         m_chunkSaveJobs.clear();
+        m_chunkLightJobs.clear();
     }
+    m_lightJobByChunk.clear();
+    m_pendingChunkLight.clear();
 
     // Delete all completed jobs
     for (Job* job : completedJobs)
@@ -217,6 +228,16 @@ World::~World()
         m_nonActiveChunks.clear();
     }
 
+    // Chunks still parked in the job scheduler were never submitted, so no worker references them
+    {
+        std::vector<ScheduledChunkJob> scheduledJobs;
+        m_chunkJobScheduler.Clear(scheduledJobs);
+        for (ScheduledChunkJob const& job : scheduledJobs)
+        {
+            delete job.m_chunk;     // Null for a fresh activation
+        }
+    }
+
     // Clear mesh rebuild tracking set
     {
         std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
@@ -261,6 +282,13 @@ World::~World()
     DeactivateAllChunks(true);
     // DebuggerPrintf("[WORLD DESTRUCTOR] Deactivation complete\n");
 
+    // Free recycled chunks held by the chunk pool
+    for (Chunk* pooledChunk : m_chunkPool)
+    {
+        delete pooledChunk;
+    }
+    m_chunkPool.clear();
+
     // Print buffer leak reports
     DebuggerPrintf("\n");
     VertexBuffer::PrintLeakReport();
@@ -450,7 +478,7 @@ void World::Update(float const deltaSeconds)
         }
 
         // 2. Only rebuild meshes after initial world gen is complete AND light queue is empty
-        if (m_initialWorldGenComplete && m_dirtyLightQueue.empty())
+        if (m_initialWorldGenComplete && !HasPendingLightWork())
         {
             // Assignment 5 Phase 10 FIX: Mark chunks with changed lighting as mesh-dirty FIRST
             {
@@ -473,6 +501,7 @@ void World::Update(float const deltaSeconds)
             {
                 nearestDirtyChunk->RebuildMesh();
                 nearestDirtyChunk->SetIsMeshDirty(false);
+                OnChunkMeshUploaded(nearestDirtyChunk);
             }
         }
 
@@ -494,6 +523,11 @@ void World::Update(float const deltaSeconds)
                         exists = (m_activeChunks.find(chunkCoords) != m_activeChunks.end());
                     }
                     if (!exists)
+                    {
+                        // Parked in the job scheduler (not yet in m_nonActiveChunks)
+                        exists = (m_activationFrontier.GetSlotState(chunkCoords) == ChunkSlotState::PENDING);
+                    }
+                    if (!exists)
                     {
                         std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
                         for (Chunk* chunk : m_nonActiveChunks)
@@ -515,6 +549,7 @@ void World::Update(float const deltaSeconds)
             }
             if (!foundChunk) break; // All 256 chunks generated
         }
+        DispatchScheduledChunkJobs(cameraPos);
 
         // 3. NEVER deactivate chunks in debug mode (keep all 256 active)
         return; // Skip normal chunk management
@@ -548,7 +583,7 @@ void World::Update(float const deltaSeconds)
 
     // 1. Check for dirty chunks and regenerate the single nearest dirty chunk
     // CRITICAL FIX: Only rebuild if light queue is empty to prevent progressive brightening
-    if (m_dirtyLightQueue.empty())
+    if (!HasPendingLightWork())
     {
         // Assignment 5 Phase 10 FIX: Mark chunks with changed lighting as mesh-dirty FIRST
         {
@@ -572,6 +607,7 @@ void World::Update(float const deltaSeconds)
         {
             nearestDirtyChunk->RebuildMesh();
             nearestDirtyChunk->SetIsMeshDirty(false);
+            OnChunkMeshUploaded(nearestDirtyChunk);
         }
     }
 
@@ -590,6 +626,9 @@ void World::Update(float const deltaSeconds)
         }
     }
 
+    // Submit the best-placed parked jobs (including the ones just activated) into free worker slots
+    DispatchScheduledChunkJobs(cameraPos);
+
     // 3. Deactivate the farthest active chunk if outside deactivation range
     IntVec2 const farthestChunk = FindFarthestActiveChunkOutsideDeactivationRange(cameraPos);
 
@@ -598,6 +637,9 @@ void World::Update(float const deltaSeconds)
         DeactivateChunk(farthestChunk);
     }
 
+    // 4. Palette-compress idle chunks outside the interaction radius to bound resident memory
+    PackIdleChunks(cameraPos);
+
     // Assignment 7-AI: Update all agents
     UpdateAgents(deltaSeconds);
 }
@@ -688,6 +730,7 @@ void World::ActivateChunk(IntVec2 const& chunkCoords)
         std::lock_guard lock(m_activeChunksMutex);
         if (m_activeChunks.contains(chunkCoords))
         {
+            m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::ACTIVE);
             return; // Already active
         }
     }
@@ -697,27 +740,43 @@ void World::ActivateChunk(IntVec2 const& chunkCoords)
         std::lock_guard lock(m_queuedChunksMutex);
         if (m_queuedGenerateChunks.find(chunkCoords) != m_queuedGenerateChunks.end())
         {
+            m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::PENDING);
             return; // Already queued for generation
         }
     }
 
-    // Create new chunk
-    Chunk* newChunk = new Chunk(chunkCoords);
-
-    // Set initial state
-    newChunk->SetState(ChunkState::ACTIVATING);
-
-    // Try to load from disk first using asynchronous I/O job
-    if (ChunkExistsOnDisk(chunkCoords))
+    // Waiting in the job scheduler or loading from disk
+    if (m_activationFrontier.GetSlotState(chunkCoords) == ChunkSlotState::PENDING)
     {
-        // Submit LoadChunkJob to I/O worker thread
-        SubmitChunkForLoading(newChunk);
+        return;
     }
-    else
+
+    // Recently deactivated chunks come back from the in-memory cache with blocks and light intact,
+    // skipping the file read, generation and InitializeLighting (same completion steps as a disk load)
+    if (m_chunkCache.Contains(chunkCoords))
     {
-        // No save file exists, submit for asynchronous generation
-        SubmitChunkForGeneration(newChunk);
+        Chunk* newChunk = AcquireChunk(chunkCoords);    // Recycled from the chunk pool when possible
+        m_chunkCache.Restore(*newChunk);
+        newChunk->SetState(ChunkState::COMPLETE);
+        newChunk->SetDebugDraw(m_globalChunkDebugDraw);
+
+        {
+            std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+            m_activeChunks[chunkCoords] = newChunk;
+            m_chunkGrid.Insert(chunkCoords, newChunk);
+        }
+        m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::ACTIVE);
+
+        UpdateNeighborPointers(chunkCoords);
+        newChunk->OnActivate(this);
+        return;
     }
+
+    // Load from disk if a save file exists, otherwise generate; DispatchScheduledChunkJobs() allocates
+    // the chunk and submits the job once it is among the best-placed for a free worker slot
+    ChunkJobKind const jobKind = ChunkExistsOnDisk(chunkCoords) ? ChunkJobKind::LOAD : ChunkJobKind::GENERATE;
+    m_chunkJobScheduler.Enqueue(chunkCoords, jobKind);
+    m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::PENDING);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -749,9 +808,11 @@ void World::DeactivateChunk(IntVec2 const& chunkCoords, bool forceSynchronousSav
             return;
         }
 
-        // Remove from active chunks map
+        // Remove from active chunks map (and the lookup grid, before the chunk can be recycled)
         m_activeChunks.erase(it);
+        m_chunkGrid.Remove(localChunkCoords, chunk);
     }
+    m_activationFrontier.SetSlotState(localChunkCoords, ChunkSlotState::MISSING);
 
     // DebuggerPrintf("[DEACTIVATE] Chunk(%d,%d) found, processing deactivation...\n",
     //               localChunkCoords.x, localChunkCoords.y);
@@ -765,9 +826,18 @@ void World::DeactivateChunk(IntVec2 const& chunkCoords, bool forceSynchronousSav
         m_chunksNeedingMeshRebuild.erase(chunk);
     }
 
+    // Queued light work dies with the activation: the chunk may be recycled before its light job completes
+    DropChunkLightWork(chunk);
+
     // Update neighbors to remove references to this chunk
     ClearNeighborReferences(localChunkCoords);
 
+    // Keep a compressed copy for fast reactivation (synchronous deactivation is shutdown / regeneration only)
+    if (!forceSynchronousSave && chunk->GetState() == ChunkState::COMPLETE)
+    {
+        m_chunkCache.Store(*chunk);
+    }
+
     // Save to disk if needed
     if (chunk->GetNeedsSaving())
     {
@@ -778,7 +848,7 @@ void World::DeactivateChunk(IntVec2 const& chunkCoords, bool forceSynchronousSav
             chunk->SaveToDisk();
             // DebuggerPrintf("[DEACTIVATE] Chunk(%d,%d) saved, deleting...\n",
             //               localChunkCoords.x, localChunkCoords.y);
-            delete chunk;
+            ReleaseChunk(chunk);
         }
         else
         {
@@ -789,8 +859,51 @@ void World::DeactivateChunk(IntVec2 const& chunkCoords, bool forceSynchronousSav
     {
         // DebuggerPrintf("[DEACTIVATE] Chunk(%d,%d) doesn't need saving, deleting...\n",
         //               localChunkCoords.x, localChunkCoords.y);
+        ReleaseChunk(chunk);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// AcquireChunk - Reuse a pooled Chunk (reset in place) or allocate a new one
+//----------------------------------------------------------------------------------------------------
+Chunk* World::AcquireChunk(IntVec2 const& chunkCoords)
+{
+    if (!m_chunkPool.empty())
+    {
+        Chunk* chunk = m_chunkPool.back();
+        m_chunkPool.pop_back();
+        chunk->ResetForReuse(chunkCoords);
+        ++m_chunkPoolHitCount;
+        return chunk;
+    }
+
+    ++m_chunkPoolMissCount;
+    return new Chunk(chunkCoords);
+}
+
+//----------------------------------------------------------------------------------------------------
+// ReleaseChunk - Return a chunk that no container or job references anymore
+// GPU buffers are released right away; the rest is reset lazily by AcquireChunk
+//----------------------------------------------------------------------------------------------------
+void World::ReleaseChunk(Chunk* chunk)
+{
+    if (chunk == nullptr)
+    {
+        return;
+    }
+
+    // No-op after DeactivateChunk() / RestageActiveChunks(); covers any chunk that queued light otherwise
+    m_dirtyLightQueue.ReleaseChunk(chunk);
+
+    if ((int)m_chunkPool.size() >= MAX_POOLED_CHUNKS)
+    {
         delete chunk;
+        return;
     }
+
+    chunk->ReleaseRenderBuffers();
+    chunk->SetState(ChunkState::DECONSTRUCTING);
+    m_chunkPool.push_back(chunk);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -858,31 +971,26 @@ void World::RegenerateAllChunks()
         // Remove completed mesh jobs from tracking list
         for (Job* completedJob : completedJobs)
         {
-            // Try to find and remove from mesh jobs list
-            auto meshIt = std::find(m_chunkMeshJobs.begin(), m_chunkMeshJobs.end(),
-                                   static_cast<ChunkMeshJob*>(completedJob));
-            if (meshIt != m_chunkMeshJobs.end())
+            // Try to remove from mesh jobs set
+            if (m_chunkMeshJobs.erase(static_cast<ChunkMeshJob*>(completedJob)) > 0)
             {
-                m_chunkMeshJobs.erase(meshIt);
-                continue;  // Found in mesh jobs, skip other lists
+                continue;  // Found in mesh jobs, skip other sets
             }
 
-            // Try to find and remove from generation jobs list
-            auto genIt = std::find(m_chunkGenerationJobs.begin(), m_chunkGenerationJobs.end(),
-                                  static_cast<ChunkGenerateJob*>(completedJob));
-            if (genIt != m_chunkGenerationJobs.end())
+            // Try to remove from generation jobs set
+            if (m_chunkGenerationJobs.erase(static_cast<ChunkGenerateJob*>(completedJob)) > 0)
             {
-                m_chunkGenerationJobs.erase(genIt);
-                continue;  // Found in generation jobs, skip other lists
+                continue;  // Found in generation jobs, skip other sets
             }
 
-            // Try to find and remove from load jobs list
-            auto loadIt = std::find(m_chunkLoadJobs.begin(), m_chunkLoadJobs.end(),
-                                   static_cast<ChunkLoadJob*>(completedJob));
-            if (loadIt != m_chunkLoadJobs.end())
+            // Try to remove from light jobs set
+            if (m_chunkLightJobs.erase(static_cast<ChunkLightJob*>(completedJob)) > 0)
             {
-                m_chunkLoadJobs.erase(loadIt);
+                continue;  // Found in light jobs, skip other sets
             }
+
+            // Try to remove from load jobs set
+            m_chunkLoadJobs.erase(static_cast<ChunkLoadJob*>(completedJob));
         }
 
         // NOW delete all remaining tracked jobs (not yet completed)
@@ -912,7 +1020,17 @@ void World::RegenerateAllChunks()
             }
         }
         m_chunkLoadJobs.clear();
+
+        for (ChunkLightJob* lightJob : m_chunkLightJobs)
+        {
+            if (lightJob != nullptr)
+            {
+                delete lightJob;
+            }
+        }
+        m_chunkLightJobs.clear();
     }
+    m_lightJobByChunk.clear();
 
     // Finally, delete all completed jobs (removed from tracking lists above)
     for (Job* job : completedJobs)
@@ -928,12 +1046,22 @@ void World::RegenerateAllChunks()
         {
             if (chunk != nullptr)
             {
-                delete chunk;  // Safe now - releases DirectX resources in ~Chunk() destructor
+                ReleaseChunk(chunk);  // Safe now - releases DirectX resources and recycles the chunk
             }
         }
         m_nonActiveChunks.clear();
     }
 
+    // Parked jobs would otherwise submit chunks that were queued against the old terrain
+    {
+        std::vector<ScheduledChunkJob> scheduledJobs;
+        m_chunkJobScheduler.Clear(scheduledJobs);
+        for (ScheduledChunkJob const& job : scheduledJobs)
+        {
+            ReleaseChunk(job.m_chunk);  // Null for a fresh activation
+        }
+    }
+
     // Mark all chunks as not needing save
     // CRITICAL: This prevents RegenerateAllChunks() from writing old terrain to disk
     {
@@ -950,40 +1078,154 @@ void World::RegenerateAllChunks()
     // CRITICAL FIX: Delete ALL saved chunk files to force fresh terrain generation
     // This ensures chunks regenerate with NEW terrain instead of loading old saves
     // Bug: Without this, ActivateChunk() finds saved files and loads old terrain!
-    try
+    DeleteAllChunkFiles();
+
+    // Deactivate all chunks (they won't be saved due to SetNeedsSaving(false))
+    DeactivateAllChunks();
+
+    // Cached copies hold the old terrain as well, and cached regions the old biome noise parameters
+    m_chunkCache.Clear();
+    m_biomeRegionCache.Clear();
+    m_activationFrontier.Clear();
+    m_generatedConfig = *g_worldGenConfig;
+
+    // Note: Chunks will automatically reactivate and regenerate during the next Update()
+    // when the activation system detects missing chunks around the player
+}
+
+//----------------------------------------------------------------------------------------------------
+// RestageActiveChunks - Re-run the generation pipeline from firstStage on every active chunk
+//
+// Unlike RegenerateAllChunks(), the chunks are not released: each one is taken out of the active set,
+// rewound with Chunk::PrepareRestage() and handed back to the job scheduler, so the nearest chunks are
+// regenerated first and the stages before firstStage are skipped where the chunk retained their output.
+// Each chunk restarts at the latest stage at or before firstStage it can (TREES needs a surface snapshot,
+// TERRAIN falls back to DENSITY, which needs retained intermediates; BIOME always works). Player edits are
+// discarded, and saved chunk files are deleted for the same reason as in RegenerateAllChunks().
+//
+// In-flight generate and load jobs are drained first: chunks mid-pipeline would otherwise finish with the
+// old config (or a mix of old and new stages) and never be restaged. They land as active chunks and are
+// restaged with the rest. Chunks parked in the job scheduler are rewound the same way.
+//----------------------------------------------------------------------------------------------------
+int World::RestageActiveChunks(ChunkGenerationStage const firstStage)
+{
+    if (g_jobSystem == nullptr) return 0;
+
+    // Mesh jobs read the blocks of active chunks; generate and load jobs would complete against the old
+    // config or files, and save jobs would write files after they are deleted. Let all of them land first
+    // (a landing split-pipeline stage submits the chunk's next stage, so this runs until the chunk is active)
+    while (true)
     {
-        std::string saveDir = "Saves/";
-        if (std::filesystem::exists(saveDir))
         {
-            // Iterate through all .chunk files in Saves/ directory
-            for (auto const& entry : std::filesystem::directory_iterator(saveDir))
+            std::lock_guard<std::mutex> lock(m_jobListsMutex);
+            if (m_chunkMeshJobs.empty() && m_chunkGenerationJobs.empty() && m_chunkLoadJobs.empty() && m_chunkSaveJobs.empty())
             {
-                if (entry.is_regular_file() && entry.path().extension() == ".chunk")
-                {
-                    try
-                    {
-                        std::filesystem::remove(entry.path());
-                        DebuggerPrintf("Deleted chunk file: %s\n", entry.path().string().c_str());
-                    }
-                    catch (std::filesystem::filesystem_error const& e)
-                    {
-                        DebuggerPrintf("Failed to delete chunk file %s: %s\n",
-                                       entry.path().string().c_str(), e.what());
-                    }
-                }
+                break;
             }
         }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        ProcessCompletedJobs();
     }
-    catch (std::filesystem::filesystem_error const& e)
+
+    DeleteAllChunkFiles();
+    m_chunkCache.Clear();
+    if (firstStage == ChunkGenerationStage::BIOME)
     {
-        DebuggerPrintf("Failed to iterate Saves/ directory: %s\n", e.what());
+        m_biomeRegionCache.Clear();
     }
 
-    // Deactivate all chunks (they won't be saved due to SetNeedsSaving(false))
-    DeactivateAllChunks();
+    std::vector<Chunk*> restagedChunks;
+    {
+        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+        restagedChunks.reserve(m_activeChunks.size());
+        for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
+        {
+            if (chunkPair.second != nullptr)
+            {
+                m_chunkGrid.Remove(chunkPair.first, chunkPair.second);
+                restagedChunks.push_back(chunkPair.second);
+            }
+        }
+        m_activeChunks.clear();
+    }
 
-    // Note: Chunks will automatically reactivate and regenerate during the next Update()
-    // when the activation system detects missing chunks around the player
+    for (Chunk* chunk : restagedChunks)
+    {
+        IntVec2 const chunkCoords = chunk->GetChunkCoords();
+
+        // Every active chunk leaves at once, so clearing each chunk's own pointers unlinks them all
+        chunk->ClearNeighborPointers();
+        {
+            std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
+            m_chunksNeedingMeshRebuild.erase(chunk);
+        }
+
+        // Light computed for the old blocks must not land on the regenerated ones (same chunk, same coordinates)
+        DropChunkLightWork(chunk);
+
+        chunk->SetNeedsSaving(false);
+        ChunkGenerationStage restageStage = firstStage;
+        while (!chunk->CanRestageFrom(restageStage))
+        {
+            restageStage = (ChunkGenerationStage)((int)restageStage - 1);
+        }
+        chunk->PrepareRestage(restageStage);
+        chunk->SetState(ChunkState::ACTIVATING);
+        m_chunkJobScheduler.Enqueue(chunk, ChunkJobKind::GENERATE);
+        m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::PENDING);
+    }
+
+    // Parked chunks that would resume past firstStage are rewound too; with the files gone, loads become generation
+    std::vector<ScheduledChunkJob> scheduledJobs;
+    m_chunkJobScheduler.Clear(scheduledJobs);
+    for (ScheduledChunkJob const& job : scheduledJobs)
+    {
+        if (job.m_chunk == nullptr)
+        {
+            m_chunkJobScheduler.Enqueue(job.m_chunkCoords, ChunkJobKind::GENERATE);
+            continue;
+        }
+
+        if (job.m_chunk->GetNextGenerationStage() > firstStage)
+        {
+            ChunkGenerationStage restageStage = firstStage;
+            while (!job.m_chunk->CanRestageFrom(restageStage))
+            {
+                restageStage = (ChunkGenerationStage)((int)restageStage - 1);
+            }
+            job.m_chunk->PrepareRestage(restageStage);
+        }
+        m_chunkJobScheduler.Enqueue(job.m_chunk, ChunkJobKind::GENERATE);
+    }
+
+    DebuggerPrintf("[RESTAGE] %d chunks re-run from the %s stage\n", (int)restagedChunks.size(), GetChunkGenerationStageName(firstStage));
+    return (int)restagedChunks.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+// RegenerateChangedStages - Apply WorldGenConfig edits by re-running only the stages that read them
+//
+// Diffs g_worldGenConfig against the config the chunks were generated with. A cave or curve change
+// restarts at DENSITY on chunks with retained intermediates, where the lattice and carver spans are reused,
+// so only the density expansion and the stages after it run; a tree change re-runs TREES and LIGHTING.
+// Returns the number of restaged chunks (0 when nothing a stage reads has changed).
+//----------------------------------------------------------------------------------------------------
+int World::RegenerateChangedStages()
+{
+    uint32_t const changedSections = g_worldGenConfig->GetChangedSections(m_generatedConfig);
+    if (changedSections == 0)
+    {
+        return 0;
+    }
+
+    m_generatedConfig = *g_worldGenConfig;
+
+    ChunkGenerationStage const firstStage = GetFirstAffectedStage(changedSections);
+    if (firstStage == ChunkGenerationStage::COUNT)
+    {
+        return 0;
+    }
+    return RestageActiveChunks(firstStage);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1106,7 +1348,7 @@ uint8_t World::GetBlockTypeAtGlobalCoords(IntVec3 const& globalCoords) const
     }
 
     // Get the block using the chunk's GetBlock method
-    Block* block = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
+    BlockPtr block = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
 
     if (block == nullptr)
     {
@@ -1117,32 +1359,55 @@ uint8_t World::GetBlockTypeAtGlobalCoords(IntVec3 const& globalCoords) const
 }
 
 //----------------------------------------------------------------------------------------------------
-// Assignment 6: Check if block at global coordinates is solid (opaque) for collision detection
-// Returns false for air (type 0) and transparent blocks like glass/water
-// Returns true for opaque blocks that should block player movement
+// GetHighestNonAirZ - Top non-air block of a global column, read from the owning chunk's heightmap
 //----------------------------------------------------------------------------------------------------
-bool World::IsBlockSolid(IntVec3 const& globalCoords) const
+int World::GetHighestNonAirZ(int const globalX, int const globalY) const
 {
-    // Get block type at this position
-    uint8_t blockType = GetBlockTypeAtGlobalCoords(globalCoords);
+    IntVec3 const globalCoords(globalX, globalY, 0);
+    Chunk const*  chunk = GetChunk(Chunk::GetChunkCoords(globalCoords));
 
-    // Air (type 0) is never solid
-    if (blockType == 0)
+    if (chunk == nullptr)
     {
-        return false;
+        return -1;
     }
 
-    // Get the block definition to check opacity
-    sBlockDefinition* blockDef = sBlockDefinition::GetDefinitionByIndex(blockType);
+    IntVec3 const localCoords = Chunk::GlobalCoordsToLocalCoords(globalCoords);
+    return chunk->GetHighestNonAirZ(localCoords.x, localCoords.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+// GetHighestOpaqueZ - Top opaque block of a global column, read from the owning chunk's heightmap
+//----------------------------------------------------------------------------------------------------
+int World::GetHighestOpaqueZ(int const globalX, int const globalY) const
+{
+    IntVec3 const globalCoords(globalX, globalY, 0);
+    Chunk const*  chunk = GetChunk(Chunk::GetChunkCoords(globalCoords));
 
-    // If no definition, treat as non-solid (safe default)
-    if (blockDef == nullptr)
+    if (chunk == nullptr)
     {
-        return false;
+        return -1;
     }
 
-    // Opaque blocks are solid for collision purposes
-    return blockDef->IsOpaque();
+    IntVec3 const localCoords = Chunk::GlobalCoordsToLocalCoords(globalCoords);
+    return chunk->GetHighestOpaqueZ(localCoords.x, localCoords.y);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Assignment 6: Check if block at global coordinates is solid (opaque) for collision detection
+// Returns false for air (type 0) and transparent blocks like glass/water
+// Returns true for opaque blocks that should block player movement
+//----------------------------------------------------------------------------------------------------
+bool World::IsBlockSolid(IntVec3 const& globalCoords) const
+{
+    Chunk const* chunk = GetChunk(Chunk::GetChunkCoords(globalCoords));
+    if (chunk == nullptr || globalCoords.z < 0 || globalCoords.z > CHUNK_MAX_Z)
+    {
+        return false;   // Unloaded or outside the world: treat as air
+    }
+
+    // Opaque blocks are solid for collision purposes (air and undefined types are not); read from the
+    // chunk's opacity mask, which stays resident while the chunk's block storage is packed
+    return chunk->IsBlockOpaque(Chunk::GlobalCoordsToIndex(globalCoords));
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -1466,6 +1731,19 @@ void World::RenderAgents() const
 
 //----------------------------------------------------------------------------------------------------
 Chunk* World::GetChunk(IntVec2 const& chunkCoords) const
+{
+    // Lock-free path: a grid hit is always correct, and a miss is authoritative unless some active
+    // chunk could not be placed in the grid (slot collision while old chunks are still deactivating)
+    Chunk* const chunk = m_chunkGrid.Find(chunkCoords);
+    if (chunk != nullptr || !m_chunkGrid.HasOverflow())
+    {
+        return chunk;
+    }
+    return GetChunkFromMap(chunkCoords);
+}
+
+//----------------------------------------------------------------------------------------------------
+Chunk* World::GetChunkFromMap(IntVec2 const& chunkCoords) const
 {
     std::lock_guard lock(m_activeChunksMutex);
     auto const      it = m_activeChunks.find(chunkCoords);
@@ -1536,1305 +1814,2611 @@ int World::GetPendingSaveJobCount() const
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec3 World::GetCameraPosition() const
+int World::GetPackedChunkCount() const
 {
-    if (g_game != nullptr)
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+
+    int packedCount = 0;
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
     {
-        return g_game->GetPlayerCameraPosition();
+        if (chunkPair.second != nullptr && chunkPair.second->IsBlockStoragePacked())
+        {
+            ++packedCount;
+        }
     }
-    return Vec3::ZERO; // Fallback if no game instance
+    return packedCount;
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec3 World::GetPlayerVelocity() const
+size_t World::GetTotalResidentBlockBytes() const
 {
-    if (g_game != nullptr)
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+
+    size_t totalBytes = 0;
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
     {
-        return g_game->GetPlayerVelocity();
+        if (chunkPair.second != nullptr)
+        {
+            totalBytes += chunkPair.second->GetResidentBlockBytes();
+        }
     }
-    return Vec3::ZERO; // Fallback if no game instance
+    return totalBytes;
 }
 
 //----------------------------------------------------------------------------------------------------
-float World::GetDistanceToChunkCenter(IntVec2 const& chunkCoords, Vec3 const& cameraPos) const
+size_t World::GetTotalSurfaceSnapshotBytes() const
 {
-    IntVec2 chunkCenter   = Chunk::GetChunkCenter(chunkCoords);
-    Vec3    chunkCenter3D = Vec3(static_cast<float>(chunkCenter.x), static_cast<float>(chunkCenter.y), cameraPos.z);
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
 
-    // Only consider XY distance as specified
-    float deltaX = chunkCenter3D.x - cameraPos.x;
-    float deltaY = chunkCenter3D.y - cameraPos.y;
-    return sqrtf(deltaX * deltaX + deltaY * deltaY);
+    size_t totalBytes = 0;
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
+    {
+        if (chunkPair.second != nullptr)
+        {
+            totalBytes += chunkPair.second->GetSurfaceSnapshotBytes();
+        }
+    }
+    return totalBytes;
 }
 
 //----------------------------------------------------------------------------------------------------
-IntVec2 World::FindNearestMissingChunkInRange(Vec3 const& cameraPos) const
+size_t World::GetTotalRetainedIntermediateBytes() const
 {
-    IntVec2 cameraChunkCoords = Chunk::GetChunkCoords(IntVec3(static_cast<int>(cameraPos.x), static_cast<int>(cameraPos.y), static_cast<int>(cameraPos.z)));
-
-    int maxRadius = (CHUNK_ACTIVATION_RANGE / 16) + 2; // CHUNK_SIZE_X is 16
-
-    // Phase 0, Task 0.7: Get player velocity for directional preloading
-    Vec3  playerVelocity        = GetPlayerVelocity();
-    float velocityMagnitude     = playerVelocity.GetLength();
-    bool  useDirectionalPreload = velocityMagnitude > PRELOAD_VELOCITY_THRESHOLD;
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
 
-    // Calculate movement direction (normalized)
-    Vec3 movementDirection = Vec3::ZERO;
-    if (useDirectionalPreload)
+    size_t totalBytes = 0;
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
     {
-        movementDirection = playerVelocity.GetNormalized();
+        if (chunkPair.second != nullptr)
+        {
+            totalBytes += chunkPair.second->GetRetainedIntermediateBytes();
+        }
     }
+    return totalBytes;
+}
 
-    // OPTIMIZATION: Build lookup sets ONCE with single mutex lock per set
-    // This reduces mutex locks from ~1,936 per call to just 2 total
-    std::unordered_set<IntVec2> activeSet;
-    std::unordered_set<IntVec2> queuedSet;
+//----------------------------------------------------------------------------------------------------
+void World::GetSectionOccupancyCounts(int& outAllAir, int& outAllStone, int& outMixed) const
+{
+    outAllAir   = 0;
+    outAllStone = 0;
+    outMixed    = 0;
 
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
     {
-        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
-        for (auto const& pair : m_activeChunks)
+        if (chunkPair.second == nullptr) continue;
+
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
         {
-            activeSet.insert(pair.first);
+            switch (chunkPair.second->GetSectionOccupancy(sectionIndex))
+            {
+                case ChunkSectionOccupancy::ALL_AIR:   ++outAllAir;   break;
+                case ChunkSectionOccupancy::ALL_STONE: ++outAllStone; break;
+                default:                               ++outMixed;    break;
+            }
         }
     }
+}
 
+//----------------------------------------------------------------------------------------------------
+// PackIdleChunks - Palette-compress chunks that nothing is going to read for a while
+//
+// A chunk is idle when it is COMPLETE, its mesh is clean, no lighting work is pending, all four
+// neighbors are COMPLETE (so no future neighbor mesh job will step into it soon) and no mesh job in
+// flight reads it or one of its neighbors. Anything that touches a packed chunk afterwards simply
+// re-expands it through Chunk::GetBlock, so this is purely a memory optimization.
+//----------------------------------------------------------------------------------------------------
+void World::PackIdleChunks(Vec3 const& cameraPos)
+{
+    // Lighting propagation walks across chunks through raw Block pointers, never pack during it
+    if (HasPendingLightWork())
     {
-        std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
-        queuedSet = m_queuedGenerateChunks; // Copy the set
+        return;
     }
 
-    // Phase 0, Task 0.7: Smart directional preloading
-    // If player is moving, prioritize chunks ahead of movement direction
-    if (useDirectionalPreload)
+    // Chunks currently being read by mesh jobs (the job's own chunk plus its 4 neighbors)
+    std::vector<Chunk*> chunksInUseByMeshJobs;
     {
-        // Calculate lookahead position (3 chunks ahead in movement direction)
-        float   lookaheadDistance = PRELOAD_LOOKAHEAD_CHUNKS * CHUNK_SIZE_X;
-        Vec3    lookaheadPos      = cameraPos + (movementDirection * lookaheadDistance);
-        IntVec2 lookaheadChunk    = Chunk::GetChunkCoords(IntVec3(static_cast<int>(lookaheadPos.x), static_cast<int>(lookaheadPos.y), 0));
-
-        // Search in expanding rings around lookahead position
-        for (int radius = 0; radius <= 2; radius++) // Only check nearby chunks around lookahead
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        for (ChunkMeshJob const* meshJob : m_chunkMeshJobs)
         {
-            for (int dx = -radius; dx <= radius; dx++)
+            if (meshJob != nullptr)
             {
-                for (int dy = -radius; dy <= radius; dy++)
-                {
-                    // Only check perimeter of current ring
-                    if (abs(dx) != radius && abs(dy) != radius)
-                    {
-                        continue;
-                    }
-
-                    IntVec2 testChunk(lookaheadChunk.x + dx, lookaheadChunk.y + dy);
-
-                    // Phase 0, Task 0.6: Fixed world bounds DISABLED for infinite world generation
-                    // Previously limited to 16x16 chunks (256 total) for testing
-                    // Now supports infinite terrain generation
-                    /*
-                    if (testChunk.x < WORLD_MIN_CHUNK_X || testChunk.x > WORLD_MAX_CHUNK_X ||
-                        testChunk.y < WORLD_MIN_CHUNK_Y || testChunk.y > WORLD_MAX_CHUNK_Y)
-                    {
-                        continue;
-                    }
-                    */
-
-                    // Fast O(1) lookups without mutex locks
-                    if (activeSet.find(testChunk) != activeSet.end())
-                    {
-                        continue;
-                    }
-                    if (queuedSet.find(testChunk) != queuedSet.end())
-                    {
-                        continue;
-                    }
-
-                    // Check if within activation range
-                    float distance = GetDistanceToChunkCenter(testChunk, cameraPos);
-                    if (distance <= CHUNK_ACTIVATION_RANGE)
-                    {
-                        return testChunk; // Found chunk in movement direction! Prioritize this
-                    }
-                }
+                chunksInUseByMeshJobs.push_back(meshJob->GetChunk());
             }
         }
     }
 
-    // Standard spiral search from camera position (fallback or when not moving)
-    // OPTIMIZATION: Spiral search outward from camera (nearest-first)
-    // Returns immediately when first valid chunk found, avoiding distance sorting
-    for (int radius = 0; radius <= maxRadius; radius++)
+    std::vector<Chunk*> chunksAwaitingRemesh;
     {
-        // Check ring at 'radius' distance from camera
-        for (int dx = -radius; dx <= radius; dx++)
+        std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
+        chunksAwaitingRemesh.assign(m_chunksNeedingMeshRebuild.begin(), m_chunksNeedingMeshRebuild.end());
+    }
+
+    auto const isReadByMeshJob = [&chunksInUseByMeshJobs](Chunk const* chunk)
+    {
+        for (Chunk const* meshChunk : chunksInUseByMeshJobs)
         {
-            for (int dy = -radius; dy <= radius; dy++)
+            if (meshChunk == chunk ||
+                meshChunk->GetNorthNeighbor() == chunk || meshChunk->GetSouthNeighbor() == chunk ||
+                meshChunk->GetEastNeighbor() == chunk || meshChunk->GetWestNeighbor() == chunk)
             {
-                // Only check perimeter of current ring (not interior)
-                if (abs(dx) != radius && abs(dy) != radius)
-                {
-                    continue;
-                }
-
-                IntVec2 testChunk(cameraChunkCoords.x + dx, cameraChunkCoords.y + dy);
+                return true;
+            }
+        }
+        return false;
+    };
 
-                // Phase 0, Task 0.6: Fixed world bounds DISABLED for infinite world generation
-                // Previously limited to 16x16 chunks (256 total) for testing
-                // Now supports infinite terrain generation
-                /*
-                if (testChunk.x < WORLD_MIN_CHUNK_X || testChunk.x > WORLD_MAX_CHUNK_X ||
-                    testChunk.y < WORLD_MIN_CHUNK_Y || testChunk.y > WORLD_MAX_CHUNK_Y)
-                {
-                    continue;
-                }
-                */
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
 
-                // Fast O(1) lookups without mutex locks
-                if (activeSet.find(testChunk) != activeSet.end())
-                {
-                    continue;
-                }
-                if (queuedSet.find(testChunk) != queuedSet.end())
-                {
-                    continue;
-                }
+    int packedThisFrame = 0;
+    for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
+    {
+        Chunk* chunk = chunkPair.second;
+        if (chunk == nullptr || chunk->IsBlockStoragePacked()) continue;
+        if (!chunk->IsComplete() || chunk->GetIsMeshDirty()) continue;
+        if (GetDistanceToChunkCenter(chunkPair.first, cameraPos) < CHUNK_PACK_MIN_DISTANCE) continue;
 
-                // Check if within activation range
-                float distance = GetDistanceToChunkCenter(testChunk, cameraPos);
-                if (distance <= CHUNK_ACTIVATION_RANGE)
-                {
-                    return testChunk; // Found nearest! Return immediately
-                }
+        Chunk const* neighbors[4] = { chunk->GetNorthNeighbor(), chunk->GetSouthNeighbor(), chunk->GetEastNeighbor(), chunk->GetWestNeighbor() };
+        bool allNeighborsComplete = true;
+        for (Chunk const* neighbor : neighbors)
+        {
+            if (neighbor == nullptr || !neighbor->IsComplete())
+            {
+                allNeighborsComplete = false;
+                break;
             }
         }
-    }
-
-    return IntVec2(INT_MAX, INT_MAX); // No valid chunk found in range
-}
+        if (!allNeighborsComplete) continue;
 
-//----------------------------------------------------------------------------------------------------
-IntVec2 World::FindFarthestActiveChunkOutsideDeactivationRange(Vec3 const& cameraPos) const
-{
-    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
-    float                       farthestDistance = 0.0f;
-    IntVec2                     farthestChunk    = IntVec2(INT_MAX, INT_MAX);
+        if (std::find(chunksAwaitingRemesh.begin(), chunksAwaitingRemesh.end(), chunk) != chunksAwaitingRemesh.end()) continue;
+        if (isReadByMeshJob(chunk)) continue;
 
-    for (auto const& chunkPair : m_activeChunks)
-    {
-        float distance = GetDistanceToChunkCenter(chunkPair.first, cameraPos);
+        chunk->PackBlocks();
 
-        // Only consider chunks outside deactivation range
-        if (distance > CHUNK_DEACTIVATION_RANGE && distance > farthestDistance)
+        if (++packedThisFrame >= MAX_CHUNKS_PACKED_PER_FRAME)
         {
-            farthestDistance = distance;
-            farthestChunk    = chunkPair.first;
+            break;
         }
     }
-
-    return farthestChunk;
 }
 
 //----------------------------------------------------------------------------------------------------
-Chunk* World::FindNearestDirtyChunk(Vec3 const& cameraPos) const
+// RunBlockStorageBenchmark - Compare flat structure-of-arrays storage against palette sections on live chunks
+//
+// Works on snapshots (Chunk::CopyBlocksTo), so live chunk storage is left untouched.
+// The sequential scan is also run over an interleaved Block[] copy to measure the SoA layout itself.
+// Results are printed to the debugger output and kept for the ImGui Performance tab.
+//----------------------------------------------------------------------------------------------------
+void World::RunBlockStorageBenchmark()
 {
-    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
-    float                       nearestDistance   = FLT_MAX;
-    Chunk*                      nearestDirtyChunk = nullptr;
+    using BenchmarkClock = std::chrono::high_resolution_clock;
 
-    for (const auto& chunkPair : m_activeChunks)
+    int constexpr MAX_SAMPLED_CHUNKS = 32;
+    int constexpr RANDOM_READ_COUNT  = 1 << 20;
+
+    std::vector<Chunk*> sampledChunks;
     {
-        Chunk* chunk = chunkPair.second;
-        if (chunk != nullptr && chunk->GetIsMeshDirty())
+        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+        for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
         {
-            float distance = GetDistanceToChunkCenter(chunkPair.first, cameraPos);
-            if (distance < nearestDistance)
+            if (chunkPair.second != nullptr && chunkPair.second->IsComplete())
             {
-                nearestDistance   = distance;
-                nearestDirtyChunk = chunk;
+                sampledChunks.push_back(chunkPair.second);
+                if ((int)sampledChunks.size() >= MAX_SAMPLED_CHUNKS) break;
             }
         }
     }
 
-    return nearestDirtyChunk;
-}
+    BlockStorageBenchmarkResult result;
+    if (sampledChunks.empty())
+    {
+        m_blockStorageBenchmarkResult = result;
+        DebuggerPrintf("[BLOCK STORAGE BENCHMARK] No complete chunks to sample\n");
+        return;
+    }
 
-//----------------------------------------------------------------------------------------------------
-bool World::ChunkExistsOnDisk(IntVec2 const& chunkCoords) const
-{
-    std::string filename = StringFormat("Saves/Chunk({0},{1}).chunk", chunkCoords.x, chunkCoords.y);
-    return std::filesystem::exists(filename);
+    std::vector<uint8_t> flatTypes((size_t)BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> flatLighting((size_t)BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> flatFlags((size_t)BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> unpackedTypes((size_t)BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> unpackedLighting((size_t)BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> unpackedFlags((size_t)BLOCKS_PER_CHUNK);
+    std::vector<Block>   interleavedBlocks((size_t)BLOCKS_PER_CHUNK);
+    PalettedBlockSection sections[CHUNK_SECTION_COUNT];
+
+    double   packSeconds              = 0.0;
+    double   unpackSeconds            = 0.0;
+    double   flatSequentialSeconds    = 0.0;
+    double   interleavedSeqSeconds    = 0.0;
+    double   paletteSequentialSeconds = 0.0;
+    double   flatRandomSeconds        = 0.0;
+    double   paletteRandomSeconds     = 0.0;
+    uint64_t checksum                 = 0;    // Keeps the read loops from being optimized away
+
+    for (Chunk const* chunk : sampledChunks)
+    {
+        chunk->CopyBlocksTo(flatTypes.data(), flatLighting.data(), flatFlags.data());
+        for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+        {
+            interleavedBlocks[blockIndex].m_typeIndex    = flatTypes[blockIndex];
+            interleavedBlocks[blockIndex].m_lightingData = flatLighting[blockIndex];
+            interleavedBlocks[blockIndex].m_bitFlags     = flatFlags[blockIndex];
+        }
+
+        // Pack cost
+        BenchmarkClock::time_point start = BenchmarkClock::now();
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+        {
+            int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+            sections[sectionIndex].Pack(flatTypes.data() + sectionBase, flatLighting.data() + sectionBase, flatFlags.data() + sectionBase, BLOCKS_PER_CHUNK_SECTION);
+        }
+        packSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        // Unpack cost
+        start = BenchmarkClock::now();
+        for (int sectionIndex = 0; sectionIndex < CHUNK_SECTION_COUNT; ++sectionIndex)
+        {
+            int const sectionBase = sectionIndex * BLOCKS_PER_CHUNK_SECTION;
+            sections[sectionIndex].Unpack(unpackedTypes.data() + sectionBase, unpackedLighting.data() + sectionBase, unpackedFlags.data() + sectionBase);
+        }
+        unpackSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        // Resident memory
+        result.m_flatBytes += (size_t)BLOCKS_PER_CHUNK * sizeof(Block);
+        for (PalettedBlockSection const& section : sections)
+        {
+            result.m_paletteBytes += section.GetResidentBytes();
+        }
+
+        // Sequential scan (mesher / lighting / RLE writer access pattern)
+        start = BenchmarkClock::now();
+        for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+        {
+            checksum += flatTypes[blockIndex];
+        }
+        flatSequentialSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        start = BenchmarkClock::now();
+        for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+        {
+            checksum += interleavedBlocks[blockIndex].m_typeIndex;
+        }
+        interleavedSeqSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        start = BenchmarkClock::now();
+        for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+        {
+            checksum += sections[blockIndex / BLOCKS_PER_CHUNK_SECTION].GetBlockAt(blockIndex % BLOCKS_PER_CHUNK_SECTION).m_typeIndex;
+        }
+        paletteSequentialSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        // Random reads (collision / raycast / agent access pattern), same LCG sequence for both
+        uint32_t randomState = 12345u;
+        start = BenchmarkClock::now();
+        for (int readIndex = 0; readIndex < RANDOM_READ_COUNT; ++readIndex)
+        {
+            randomState = randomState * 1664525u + 1013904223u;
+            checksum += flatTypes[(randomState >> 8) & (BLOCKS_PER_CHUNK - 1)];
+        }
+        flatRandomSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        randomState = 12345u;
+        start       = BenchmarkClock::now();
+        for (int readIndex = 0; readIndex < RANDOM_READ_COUNT; ++readIndex)
+        {
+            randomState = randomState * 1664525u + 1013904223u;
+            int const blockIndex = (int)((randomState >> 8) & (BLOCKS_PER_CHUNK - 1));
+            checksum += sections[blockIndex / BLOCKS_PER_CHUNK_SECTION].GetBlockAt(blockIndex % BLOCKS_PER_CHUNK_SECTION).m_typeIndex;
+        }
+        paletteRandomSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+    }
+
+    double const chunkCount      = (double)sampledChunks.size();
+    double const sequentialReads = chunkCount * (double)BLOCKS_PER_CHUNK;
+    double const randomReads     = chunkCount * (double)RANDOM_READ_COUNT;
+
+    result.m_sampledChunkCount          = (int)sampledChunks.size();
+    result.m_flatSequentialNsPerRead    = flatSequentialSeconds * 1e9 / sequentialReads;
+    result.m_interleavedSeqNsPerRead    = interleavedSeqSeconds * 1e9 / sequentialReads;
+    result.m_paletteSequentialNsPerRead = paletteSequentialSeconds * 1e9 / sequentialReads;
+    result.m_flatRandomNsPerRead        = flatRandomSeconds * 1e9 / randomReads;
+    result.m_paletteRandomNsPerRead     = paletteRandomSeconds * 1e9 / randomReads;
+    result.m_packMsPerChunk             = packSeconds * 1e3 / chunkCount;
+    result.m_unpackMsPerChunk           = unpackSeconds * 1e3 / chunkCount;
+    m_blockStorageBenchmarkResult       = result;
+
+    DebuggerPrintf("[BLOCK STORAGE BENCHMARK] %d chunks: flat %.1f KB/chunk, palette %.1f KB/chunk (%.1fx smaller)\n",
+                   result.m_sampledChunkCount,
+                   (double)result.m_flatBytes / chunkCount / 1024.0,
+                   (double)result.m_paletteBytes / chunkCount / 1024.0,
+                   result.m_paletteBytes > 0 ? (double)result.m_flatBytes / (double)result.m_paletteBytes : 0.0);
+    DebuggerPrintf("[BLOCK STORAGE BENCHMARK] Sequential read: flat SoA %.2f ns, interleaved %.2f ns, palette %.2f ns | Random read: flat %.2f ns, palette %.2f ns\n",
+                   result.m_flatSequentialNsPerRead, result.m_interleavedSeqNsPerRead, result.m_paletteSequentialNsPerRead,
+                   result.m_flatRandomNsPerRead, result.m_paletteRandomNsPerRead);
+    DebuggerPrintf("[BLOCK STORAGE BENCHMARK] Pack %.3f ms/chunk, Unpack %.3f ms/chunk (checksum %llu)\n",
+                   result.m_packMsPerChunk, result.m_unpackMsPerChunk, (unsigned long long)checksum);
 }
 
 //----------------------------------------------------------------------------------------------------
-bool World::LoadChunkFromDisk(Chunk* chunk) const
+// RunChunkLookupBenchmark - GetChunk throughput through the toroidal grid vs the locked hash map
+//
+// Probes pseudo-random coordinates in the bounding box of the active chunks (plus a one-chunk border),
+// so the mix of hits and misses matches collision, raycast and BlockIterator edge lookups.
+// Both paths see the same probe sequence. Results go to the debugger output and the ImGui Performance tab.
+//----------------------------------------------------------------------------------------------------
+void World::RunChunkLookupBenchmark()
 {
-    if (chunk == nullptr) return false;
+    using BenchmarkClock = std::chrono::high_resolution_clock;
 
-    IntVec2     chunkCoords = chunk->GetChunkCoords();
-    std::string filename    = StringFormat("Saves/Chunk({0},{1}).chunk", chunkCoords.x, chunkCoords.y);
+    int constexpr LOOKUP_COUNT = 1 << 22;
+    int constexpr PROBE_COUNT  = 1 << 12;
 
-    std::vector<uint8_t> buffer;
-    if (!FileReadToBuffer(buffer, filename))
+    IntVec2 minCoords(INT_MAX, INT_MAX);
+    IntVec2 maxCoords(INT_MIN, INT_MIN);
     {
-        return false;
+        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+        for (std::pair<IntVec2 const, Chunk*> const& chunkPair : m_activeChunks)
+        {
+            minCoords.x = (std::min)(minCoords.x, chunkPair.first.x);
+            minCoords.y = (std::min)(minCoords.y, chunkPair.first.y);
+            maxCoords.x = (std::max)(maxCoords.x, chunkPair.first.x);
+            maxCoords.y = (std::max)(maxCoords.y, chunkPair.first.y);
+        }
     }
 
-    // Verify minimum file size (header + at least one RLE entry)
-    if (buffer.size() < sizeof(ChunkFileHeader) + sizeof(ChunkRLEEntry))
+    ChunkLookupBenchmarkResult result;
+    if (minCoords.x > maxCoords.x)
     {
-        return false; // File too small
+        m_chunkLookupBenchmarkResult = result;
+        DebuggerPrintf("[CHUNK LOOKUP BENCHMARK] No active chunks to probe\n");
+        return;
     }
 
-    // Read and validate header
-    ChunkFileHeader header;
-    memcpy(&header, buffer.data(), sizeof(ChunkFileHeader));
-
-    // Validate header
-    if (header.fourCC[0] != 'G' || header.fourCC[1] != 'C' ||
-        header.fourCC[2] != 'H' || header.fourCC[3] != 'K')
+    // Precomputed probe coordinates keep coordinate generation out of the timed loops
+    int const            spanX       = maxCoords.x - minCoords.x + 3;
+    int const            spanY       = maxCoords.y - minCoords.y + 3;
+    uint32_t             randomState = 12345u;
+    std::vector<IntVec2> probes;
+    probes.reserve(PROBE_COUNT);
+    for (int probeIndex = 0; probeIndex < PROBE_COUNT; ++probeIndex)
     {
-        return false; // Invalid 4CC
+        randomState = randomState * 1664525u + 1013904223u;
+        int const probeX = minCoords.x - 1 + (int)((randomState >> 8) % (uint32_t)spanX);
+        randomState = randomState * 1664525u + 1013904223u;
+        int const probeY = minCoords.y - 1 + (int)((randomState >> 8) % (uint32_t)spanY);
+        probes.emplace_back(probeX, probeY);
     }
 
-    if (header.version != 1 || header.chunkBitsX != CHUNK_BITS_X ||
-        header.chunkBitsY != CHUNK_BITS_Y || header.chunkBitsZ != CHUNK_BITS_Z)
+    uintptr_t mapChecksum  = 0;
+    uintptr_t gridChecksum = 0;
+
+    BenchmarkClock::time_point start = BenchmarkClock::now();
+    for (int lookupIndex = 0; lookupIndex < LOOKUP_COUNT; ++lookupIndex)
     {
-        return false; // Incompatible format
+        mapChecksum += (uintptr_t)GetChunkFromMap(probes[lookupIndex & (PROBE_COUNT - 1)]);
     }
+    double const mapSeconds = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
 
-    // Decompress RLE data
-    size_t dataOffset = sizeof(ChunkFileHeader);
-    int    blockIndex = 0;
-
-    while (dataOffset < buffer.size() && blockIndex < BLOCKS_PER_CHUNK)
+    start = BenchmarkClock::now();
+    for (int lookupIndex = 0; lookupIndex < LOOKUP_COUNT; ++lookupIndex)
     {
-        // Read RLE entry
-        if (dataOffset + sizeof(ChunkRLEEntry) > buffer.size())
-        {
-            return false; // Incomplete RLE entry
-        }
-
-        ChunkRLEEntry entry;
-        memcpy(&entry, buffer.data() + dataOffset, sizeof(ChunkRLEEntry));
-        dataOffset += sizeof(ChunkRLEEntry);
-
-        // Apply run to blocks
-        for (int i = 0; i < entry.count && blockIndex < BLOCKS_PER_CHUNK; i++)
-        {
-            IntVec3 localCoords = Chunk::IndexToLocalCoords(blockIndex);
-            Block*  block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-            if (block != nullptr)
-            {
-                block->m_typeIndex = entry.value;
-            }
-            blockIndex++;
-        }
+        gridChecksum += (uintptr_t)GetChunk(probes[lookupIndex & (PROBE_COUNT - 1)]);
     }
+    double const gridSeconds = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
 
-    // Verify we loaded exactly the right number of blocks
-    if (blockIndex != BLOCKS_PER_CHUNK)
+    for (IntVec2 const& probe : probes)
     {
-        return false; // RLE data doesn't match expected block count
+        result.m_hitCount += (GetChunkFromMap(probe) != nullptr) ? 1 : 0;
     }
+    result.m_hitCount            = (int)((int64_t)result.m_hitCount * (LOOKUP_COUNT / PROBE_COUNT));
+    result.m_lookupCount         = LOOKUP_COUNT;
+    result.m_mapNsPerLookup      = mapSeconds * 1e9 / (double)LOOKUP_COUNT;
+    result.m_gridNsPerLookup     = gridSeconds * 1e9 / (double)LOOKUP_COUNT;
+    m_chunkLookupBenchmarkResult = result;
 
-    return true;
+    DebuggerPrintf("[CHUNK LOOKUP BENCHMARK] %d lookups (%d hits): map %.2f ns, grid %.2f ns (%.1fx), results %s\n",
+                   result.m_lookupCount, result.m_hitCount, result.m_mapNsPerLookup, result.m_gridNsPerLookup,
+                   result.m_gridNsPerLookup > 0.0 ? result.m_mapNsPerLookup / result.m_gridNsPerLookup : 0.0,
+                   (mapChecksum == gridChecksum) ? "match" : "DIFFER");
 }
 
 //----------------------------------------------------------------------------------------------------
-bool World::SaveChunkToDisk(Chunk* chunk) const
+// RunJobDispatchBenchmark - Cost of matching one completed job to its tracking container
+//
+// Simulates inFlightCount jobs of each of the four chunk job types. Every completion is looked up the
+// way the previous ProcessCompletedJobs did it (scan the generate, load, mesh and save vectors in turn,
+// then erase by index) and the way it does now (hash erase from the set named by the job's type), and
+// is immediately replaced by a new submission so the in-flight count stays constant.
+//----------------------------------------------------------------------------------------------------
+void World::RunJobDispatchBenchmark(int const inFlightCount)
 {
-    if (chunk == nullptr) return false;
+    using BenchmarkClock = std::chrono::high_resolution_clock;
 
-    IntVec2 chunkCoords = chunk->GetChunkCoords();
-
-    // Debug output to help diagnose save issues
-    DebuggerPrintf("Saving chunk (%d,%d) to disk...\n", chunkCoords.x, chunkCoords.y);
+    int constexpr JOB_TYPE_COUNT    = 4;
+    int constexpr COMPLETION_COUNT  = 1 << 18;
+    int constexpr COMPLETION_ORDERS = 1 << 12;
 
-    // Ensure save directory exists (relative to executable in Run/ directory)
-    std::string saveDir = "Saves/";
-    std::filesystem::create_directories(saveDir);
+    JobDispatchBenchmarkResult result;
+    result.m_inFlightCount = (std::max)(inFlightCount, 1);
+    int const jobCount     = result.m_inFlightCount * JOB_TYPE_COUNT;
 
-    std::string filename = StringFormat("{0}Chunk({1},{2}).chunk", saveDir, chunkCoords.x, chunkCoords.y);
+    // Stand-in job addresses; job i has type i % JOB_TYPE_COUNT
+    std::vector<uint64_t>     jobStorage(jobCount);
+    std::vector<void*>        linearLists[JOB_TYPE_COUNT];
+    std::unordered_set<void*> hashedSets[JOB_TYPE_COUNT];
+    for (int jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+    {
+        linearLists[jobIndex % JOB_TYPE_COUNT].push_back(&jobStorage[jobIndex]);
+        hashedSets[jobIndex % JOB_TYPE_COUNT].insert(&jobStorage[jobIndex]);
+    }
 
-    // Collect block data in order for RLE compression
-    std::vector<uint8_t> blockData(BLOCKS_PER_CHUNK);
-    for (int i = 0; i < BLOCKS_PER_CHUNK; i++)
+    uint32_t         randomState = 12345u;
+    std::vector<int> completionOrder(COMPLETION_ORDERS);
+    for (int& jobIndex : completionOrder)
     {
-        IntVec3 localCoords = Chunk::IndexToLocalCoords(i);
-        Block*  block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-        if (block != nullptr)
-        {
-            blockData[i] = block->m_typeIndex;
-        }
-        else
-        {
-            blockData[i] = 0; // Air block if invalid
-        }
+        randomState = randomState * 1664525u + 1013904223u;
+        jobIndex    = (int)((randomState >> 8) % (uint32_t)jobCount);
     }
 
-    // Compress using RLE
-    std::vector<ChunkRLEEntry> rleEntries;
-    uint8_t                    currentType = blockData[0];
-    uint8_t                    runLength   = 1;
+    std::mutex benchmarkMutex;
+    int64_t    linearChecksum = 0;
+    int64_t    hashedChecksum = 0;
 
-    for (int i = 1; i < BLOCKS_PER_CHUNK; i++)
+    BenchmarkClock::time_point start = BenchmarkClock::now();
+    for (int completionIndex = 0; completionIndex < COMPLETION_COUNT; ++completionIndex)
     {
-        if (blockData[i] == currentType && runLength < 255)
-        {
-            runLength++;
-        }
-        else
+        void* const completedJob = &jobStorage[completionOrder[completionIndex & (COMPLETION_ORDERS - 1)]];
+
+        std::lock_guard<std::mutex> lock(benchmarkMutex);
+        bool                        found = false;
+        for (int jobType = 0; jobType < JOB_TYPE_COUNT && !found; ++jobType)
         {
-            // End current run
-            rleEntries.push_back({currentType, runLength});
-            currentType = blockData[i];
-            runLength   = 1;
+            std::vector<void*>& trackedJobs = linearLists[jobType];
+            for (int i = 0; i < (int)trackedJobs.size(); ++i)
+            {
+                if (trackedJobs[i] == completedJob)
+                {
+                    trackedJobs.erase(trackedJobs.begin() + i);
+                    trackedJobs.push_back(completedJob);
+                    linearChecksum += jobType;
+                    found = true;
+                    break;
+                }
+            }
         }
     }
-    // Don't forget the last run
-    rleEntries.push_back({currentType, runLength});
-
-    // Create file header
-    ChunkFileHeader header;
-    header.fourCC[0]  = 'G';
-    header.fourCC[1]  = 'C';
-    header.fourCC[2]  = 'H';
-    header.fourCC[3]  = 'K';
-    header.version    = 1;
-    header.chunkBitsX = CHUNK_BITS_X;
-    header.chunkBitsY = CHUNK_BITS_Y;
-    header.chunkBitsZ = CHUNK_BITS_Z;
-
-    // Calculate total file size
-    size_t               fileSize = sizeof(ChunkFileHeader) + rleEntries.size() * sizeof(ChunkRLEEntry);
-    std::vector<uint8_t> fileBuffer(fileSize);
-
-    // Write header
-    memcpy(fileBuffer.data(), &header, sizeof(ChunkFileHeader));
+    double const linearSeconds = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
 
-    // Write RLE entries
-    size_t offset = sizeof(ChunkFileHeader);
-    for (const ChunkRLEEntry& entry : rleEntries)
+    start = BenchmarkClock::now();
+    for (int completionIndex = 0; completionIndex < COMPLETION_COUNT; ++completionIndex)
     {
-        memcpy(fileBuffer.data() + offset, &entry, sizeof(ChunkRLEEntry));
-        offset += sizeof(ChunkRLEEntry);
-    }
+        int const   jobIndex     = completionOrder[completionIndex & (COMPLETION_ORDERS - 1)];
+        void* const completedJob = &jobStorage[jobIndex];
+        int const   jobType      = jobIndex % JOB_TYPE_COUNT;     // Known from the job's dynamic type
 
-    // Write to file using safe fopen_s
-    FILE*   file = nullptr;
-    errno_t err  = fopen_s(&file, filename.c_str(), "wb");
-    if (err != 0 || file == nullptr) return false;
+        std::lock_guard<std::mutex> lock(benchmarkMutex);
+        if (hashedSets[jobType].erase(completedJob) > 0)
+        {
+            hashedSets[jobType].insert(completedJob);
+            hashedChecksum += jobType;
+        }
+    }
+    double const hashedSeconds = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
 
-    size_t written = fwrite(fileBuffer.data(), 1, fileBuffer.size(), file);
-    fclose(file);
+    result.m_linearNsPerJob      = linearSeconds * 1e9 / (double)COMPLETION_COUNT;
+    result.m_hashedNsPerJob      = hashedSeconds * 1e9 / (double)COMPLETION_COUNT;
+    m_jobDispatchBenchmarkResult = result;
 
-    return written == fileBuffer.size();
+    DebuggerPrintf("[JOB DISPATCH BENCHMARK] %d jobs in flight per type: linear scan %.1f ns/job, hashed %.1f ns/job (%.1fx), results %s\n",
+                   result.m_inFlightCount, result.m_linearNsPerJob, result.m_hashedNsPerJob,
+                   result.m_hashedNsPerJob > 0.0 ? result.m_linearNsPerJob / result.m_hashedNsPerJob : 0.0,
+                   (linearChecksum == hashedChecksum) ? "match" : "DIFFER");
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::UpdateNeighborPointers(IntVec2 const& chunkCoords)
+// Scratch terrain comparison shared by the generation benchmarks below
+//----------------------------------------------------------------------------------------------------
+struct TerrainGenerationVariant
 {
-    Chunk* centerChunk = GetChunk(chunkCoords);
-    if (centerChunk == nullptr) return;
+    int               m_latticeStepXY           = 1;
+    int               m_latticeStepZ            = 1;
+    bool              m_useColumnSurfaceProfile = true;
+    BiomeRegionCache* m_biomeRegionCache        = nullptr;     // nullptr = exact climate noise per column
+};
 
-    // Get neighbor coordinates
-    IntVec2 northCoords = chunkCoords + IntVec2(0, 1);
-    IntVec2 southCoords = chunkCoords + IntVec2(0, -1);
-    IntVec2 eastCoords  = chunkCoords + IntVec2(1, 0);
-    IntVec2 westCoords  = chunkCoords + IntVec2(-1, 0);
+struct TerrainGenerationComparison
+{
+    int    m_sampledChunkCount    = 0;
+    double m_baselineSeconds      = 0.0;
+    double m_variantSeconds       = 0.0;
+    int    m_changedSolidityCount = 0;
+    int    m_changedTypeCount     = 0;
+    int    m_totalBlockCount      = 0;
+    int    m_changedBiomeCount    = 0;
+};
 
-    // Get neighbor chunks (if they exist)
-    Chunk* northChunk = GetChunk(northCoords);
-    Chunk* southChunk = GetChunk(southCoords);
-    Chunk* eastChunk  = GetChunk(eastCoords);
-    Chunk* westChunk  = GetChunk(westCoords);
+//----------------------------------------------------------------------------------------------------
+// CompareTerrainGeneration - Generate the chunks around centerCoords with both variants and diff them
+//
+// Uses two scratch chunks outside the world (no activation, neighbors or saving), so the live terrain
+// is untouched. Blocks are compared after the whole GenerateTerrain (caves, carvers, surface layers
+// included), since a generation change only matters where it flips a block.
+//----------------------------------------------------------------------------------------------------
+static TerrainGenerationComparison CompareTerrainGeneration(IntVec2 const&                  centerCoords,
+                                                            int const                       sampleRadius,
+                                                            TerrainGenerationVariant const& baseline,
+                                                            TerrainGenerationVariant const& variant)
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
 
-    // Set neighbor pointers on center chunk
-    centerChunk->SetNeighborChunks(northChunk, southChunk, eastChunk, westChunk);
+    TerrainGenerationComparison comparison;
+    Chunk                       baselineChunk(centerCoords);
+    Chunk                       variantChunk(centerCoords);
 
-    // Update neighbor chunks to point back to center chunk
-    if (northChunk != nullptr) northChunk->SetNeighborChunks(northChunk->GetNorthNeighbor(), centerChunk, northChunk->GetEastNeighbor(), northChunk->GetWestNeighbor());
-    if (southChunk != nullptr) southChunk->SetNeighborChunks(centerChunk, southChunk->GetSouthNeighbor(), southChunk->GetEastNeighbor(), southChunk->GetWestNeighbor());
-    if (eastChunk != nullptr) eastChunk->SetNeighborChunks(eastChunk->GetNorthNeighbor(), eastChunk->GetSouthNeighbor(), eastChunk->GetEastNeighbor(), centerChunk);
-    if (westChunk != nullptr) westChunk->SetNeighborChunks(westChunk->GetNorthNeighbor(), westChunk->GetSouthNeighbor(), centerChunk, westChunk->GetWestNeighbor());
+    for (int offsetY = -sampleRadius; offsetY <= sampleRadius; ++offsetY)
+    {
+        for (int offsetX = -sampleRadius; offsetX <= sampleRadius; ++offsetX)
+        {
+            IntVec2 const chunkCoords(centerCoords.x + offsetX, centerCoords.y + offsetY);
+            baselineChunk.ResetForReuse(chunkCoords);
+            variantChunk.ResetForReuse(chunkCoords);
+
+            BenchmarkClock::time_point start = BenchmarkClock::now();
+            baselineChunk.GenerateTerrain(baseline.m_latticeStepXY, baseline.m_latticeStepZ, baseline.m_useColumnSurfaceProfile, baseline.m_biomeRegionCache);
+            comparison.m_baselineSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+            start = BenchmarkClock::now();
+            variantChunk.GenerateTerrain(variant.m_latticeStepXY, variant.m_latticeStepZ, variant.m_useColumnSurfaceProfile, variant.m_biomeRegionCache);
+            comparison.m_variantSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+            uint8_t const* baselineTypes = baselineChunk.GetBlockTypeIndices();
+            uint8_t const* variantTypes  = variantChunk.GetBlockTypeIndices();
+            for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+            {
+                comparison.m_changedTypeCount += (baselineTypes[blockIndex] != variantTypes[blockIndex]) ? 1 : 0;
+            }
+
+            // Solidity flips straight from the chunks' solidity masks, 32 blocks per word
+            for (int rowIndex = 0; rowIndex < CHUNK_ROW_COUNT; ++rowIndex)
+            {
+                comparison.m_changedSolidityCount += std::popcount(baselineChunk.GetSolidRow(rowIndex) ^ variantChunk.GetSolidRow(rowIndex));
+            }
+
+            for (int localY = 0; localY < CHUNK_SIZE_Y; ++localY)
+            {
+                for (int localX = 0; localX < CHUNK_SIZE_X; ++localX)
+                {
+                    bool const isSameBiome         = baselineChunk.GetBiomeData(localX, localY).biomeType == variantChunk.GetBiomeData(localX, localY).biomeType;
+                    comparison.m_changedBiomeCount += isSameBiome ? 0 : 1;
+                }
+            }
+
+            ++comparison.m_sampledChunkCount;
+            comparison.m_totalBlockCount += BLOCKS_PER_CHUNK;
+        }
+    }
+
+    return comparison;
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::ClearNeighborReferences(IntVec2 const& chunkCoords)
+// RunDensityLatticeComparison - Generate the 3x3 chunks around the camera with the configured density
+// lattice and with exact per-block noise, and diff them
+//----------------------------------------------------------------------------------------------------
+void World::RunDensityLatticeComparison()
 {
-    // Clear references to this chunk from its neighbors
-    IntVec2 northCoords = chunkCoords + IntVec2(0, 1);
-    IntVec2 southCoords = chunkCoords + IntVec2(0, -1);
-    IntVec2 eastCoords  = chunkCoords + IntVec2(1, 0);
-    IntVec2 westCoords  = chunkCoords + IntVec2(-1, 0);
+    int constexpr SAMPLE_RADIUS = 1;
 
-    Chunk* northChunk = GetChunk(northCoords);
-    Chunk* southChunk = GetChunk(southCoords);
-    Chunk* eastChunk  = GetChunk(eastCoords);
-    Chunk* westChunk  = GetChunk(westCoords);
+    DensityLatticeComparisonResult result;
+    int const requestedStepXY = g_worldGenConfig->density.densityLatticeStepXY;
+    int const requestedStepZ  = g_worldGenConfig->density.densityLatticeStepZ;
 
-    if (northChunk != nullptr) northChunk->SetNeighborChunks(northChunk->GetNorthNeighbor(), nullptr, northChunk->GetEastNeighbor(), northChunk->GetWestNeighbor());
-    if (southChunk != nullptr) southChunk->SetNeighborChunks(nullptr, southChunk->GetSouthNeighbor(), southChunk->GetEastNeighbor(), southChunk->GetWestNeighbor());
-    if (eastChunk != nullptr) eastChunk->SetNeighborChunks(eastChunk->GetNorthNeighbor(), eastChunk->GetSouthNeighbor(), eastChunk->GetEastNeighbor(), nullptr);
-    if (westChunk != nullptr) westChunk->SetNeighborChunks(westChunk->GetNorthNeighbor(), westChunk->GetSouthNeighbor(), nullptr, westChunk->GetWestNeighbor());
+    // Effective steps, using the same rounding as Chunk::GenerateTerrain
+    while (result.m_latticeStepXY * 2 <= requestedStepXY && CHUNK_SIZE_X % (result.m_latticeStepXY * 2) == 0)
+    {
+        result.m_latticeStepXY *= 2;
+    }
+    while (result.m_latticeStepZ * 2 <= requestedStepZ && CHUNK_SIZE_Z % (result.m_latticeStepZ * 2) == 0)
+    {
+        result.m_latticeStepZ *= 2;
+    }
+
+    TerrainGenerationVariant exact;
+    TerrainGenerationVariant lattice;
+    lattice.m_latticeStepXY = result.m_latticeStepXY;
+    lattice.m_latticeStepZ  = result.m_latticeStepZ;
+
+    Vec3 const                        cameraPos    = GetCameraPosition();
+    IntVec2 const                     centerCoords = Chunk::GetChunkCoords(IntVec3((int)floorf(cameraPos.x), (int)floorf(cameraPos.y), 0));
+    TerrainGenerationComparison const comparison   = CompareTerrainGeneration(centerCoords, SAMPLE_RADIUS, exact, lattice);
+
+    result.m_sampledChunkCount       = comparison.m_sampledChunkCount;
+    result.m_exactMsPerChunk         = comparison.m_baselineSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_latticeMsPerChunk       = comparison.m_variantSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_changedSolidityCount    = comparison.m_changedSolidityCount;
+    result.m_changedTypeCount        = comparison.m_changedTypeCount;
+    result.m_totalBlockCount         = comparison.m_totalBlockCount;
+    m_densityLatticeComparisonResult = result;
+
+    DebuggerPrintf("[DENSITY LATTICE] %d chunks, lattice %dx%dx%d: exact %.2f ms/chunk, lattice %.2f ms/chunk (%.1fx)\n",
+                   result.m_sampledChunkCount, result.m_latticeStepXY, result.m_latticeStepXY, result.m_latticeStepZ,
+                   result.m_exactMsPerChunk, result.m_latticeMsPerChunk,
+                   result.m_latticeMsPerChunk > 0.0 ? result.m_exactMsPerChunk / result.m_latticeMsPerChunk : 0.0);
+    DebuggerPrintf("[DENSITY LATTICE] Solidity changed: %d of %d blocks (%.4f%%), type changed: %d\n",
+                   result.m_changedSolidityCount, result.m_totalBlockCount,
+                   100.0 * (double)result.m_changedSolidityCount / (double)result.m_totalBlockCount,
+                   result.m_changedTypeCount);
 }
 
 //----------------------------------------------------------------------------------------------------
-// Digging and Placing System
+// RunCaveSurfaceBenchmark - Legacy per-block upward surface search vs the per-column surface profile
+//
+// Both runs use exact density noise (lattice steps of 1), where the profile must reproduce the search
+// exactly, so any changed block is a bug. The world seed is fixed; raise cave density (Caves tab
+// thresholds) before running to benchmark cave-heavy terrain.
 //----------------------------------------------------------------------------------------------------
+void World::RunCaveSurfaceBenchmark()
+{
+    int constexpr SAMPLE_RADIUS = 1;
+
+    TerrainGenerationVariant legacySearch;
+    TerrainGenerationVariant columnProfile;
+    legacySearch.m_useColumnSurfaceProfile  = false;
+    columnProfile.m_useColumnSurfaceProfile = true;
+
+    Vec3 const                        cameraPos    = GetCameraPosition();
+    IntVec2 const                     centerCoords = Chunk::GetChunkCoords(IntVec3((int)floorf(cameraPos.x), (int)floorf(cameraPos.y), 0));
+    TerrainGenerationComparison const comparison   = CompareTerrainGeneration(centerCoords, SAMPLE_RADIUS, legacySearch, columnProfile);
+
+    CaveSurfaceBenchmarkResult result;
+    result.m_sampledChunkCount   = comparison.m_sampledChunkCount;
+    result.m_legacyMsPerChunk    = comparison.m_baselineSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_profileMsPerChunk   = comparison.m_variantSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_changedBlockCount   = comparison.m_changedTypeCount;
+    m_caveSurfaceBenchmarkResult = result;
+
+    DebuggerPrintf("[CAVE SURFACE BENCHMARK] %d chunks: per-block search %.2f ms/chunk, column profile %.2f ms/chunk (%.1fx), %d blocks differ\n",
+                   result.m_sampledChunkCount, result.m_legacyMsPerChunk, result.m_profileMsPerChunk,
+                   result.m_profileMsPerChunk > 0.0 ? result.m_legacyMsPerChunk / result.m_profileMsPerChunk : 0.0,
+                   result.m_changedBlockCount);
+}
 
 //----------------------------------------------------------------------------------------------------
-IntVec3 World::FindHighestNonAirBlockAtOrBelow(Vec3 const& position) const
+// RunBiomeRegionComparison - Generate the 5x5 chunks around the camera with climate noise upsampled from
+// region samples and with exact per-column climate noise, and diff them
+//
+// The cached run uses its own empty cache at the configured sample step, so the region builds are paid
+// inside the measurement (5x5 chunks touch one to four regions) and the live cache is left alone.
+//----------------------------------------------------------------------------------------------------
+void World::RunBiomeRegionComparison()
 {
-    // Start from camera position and search downward
-    IntVec3 searchPos = IntVec3(static_cast<int>(floorf(position.x)),
-                                static_cast<int>(floorf(position.y)),
-                                static_cast<int>(floorf(position.z)));
+    int constexpr SAMPLE_RADIUS = 2;
 
-    // Search downward from camera Z position to find highest non-air block
-    for (int z = searchPos.z; z >= 0; z--)
+    BiomeRegionComparisonResult result;
+    result.m_sampleStep = BiomeRegionCache::GetEffectiveSampleStep(g_worldGenConfig->biomeNoise.regionSampleStep);
+
+    Vec3 const    cameraPos    = GetCameraPosition();
+    IntVec2 const centerCoords = Chunk::GetChunkCoords(IntVec3((int)floorf(cameraPos.x), (int)floorf(cameraPos.y), 0));
+
+    // Climate error against the exact layers, measured on a second cold cache
     {
-        IntVec3 testPos(searchPos.x, searchPos.y, z);
-        uint8_t blockType = GetBlockTypeAtGlobalCoords(testPos);
+        BiomeRegionCache    errorCache(DEFAULT_BIOME_REGION_CAPACITY);
+        BiomeClimateColumns exactColumns;
+        BiomeClimateColumns cachedColumns;
 
-        // If we found a non-air block, this is our target
-        if (blockType != 0) // 0 = BLOCK_AIR
+        for (int offsetY = -SAMPLE_RADIUS; offsetY <= SAMPLE_RADIUS; ++offsetY)
         {
-            return testPos;
+            for (int offsetX = -SAMPLE_RADIUS; offsetX <= SAMPLE_RADIUS; ++offsetX)
+            {
+                IntVec2 const chunkCoords(centerCoords.x + offsetX, centerCoords.y + offsetY);
+                ComputeBiomeClimateColumns(chunkCoords, exactColumns);
+                errorCache.SampleChunk(chunkCoords, result.m_sampleStep, cachedColumns);
+
+                for (int columnIndex = 0; columnIndex < CHUNK_SIZE_X * CHUNK_SIZE_Y; ++columnIndex)
+                {
+                    result.m_maxClimateError = (std::max)(result.m_maxClimateError, fabsf(cachedColumns.m_humidityNoise[columnIndex] - exactColumns.m_humidityNoise[columnIndex]));
+                    result.m_maxClimateError = (std::max)(result.m_maxClimateError, fabsf(cachedColumns.m_temperatureNoise[columnIndex] - exactColumns.m_temperatureNoise[columnIndex]));
+                    result.m_maxClimateError = (std::max)(result.m_maxClimateError, fabsf(cachedColumns.m_continentalness[columnIndex] - exactColumns.m_continentalness[columnIndex]));
+                    result.m_maxClimateError = (std::max)(result.m_maxClimateError, fabsf(cachedColumns.m_erosion[columnIndex] - exactColumns.m_erosion[columnIndex]));
+                    result.m_maxClimateError = (std::max)(result.m_maxClimateError, fabsf(cachedColumns.m_weirdness[columnIndex] - exactColumns.m_weirdness[columnIndex]));
+                }
+            }
         }
     }
 
-    // No non-air block found (all air down to bedrock)
-    return IntVec3(INT_MAX, INT_MAX, INT_MAX); // Invalid position
+    BiomeRegionCache         comparisonCache(DEFAULT_BIOME_REGION_CAPACITY);
+    TerrainGenerationVariant exact;
+    TerrainGenerationVariant cached;
+    cached.m_biomeRegionCache = &comparisonCache;
+
+    // Same density lattice in both runs, so only the climate source differs
+    exact.m_latticeStepXY  = g_worldGenConfig->density.densityLatticeStepXY;
+    exact.m_latticeStepZ   = g_worldGenConfig->density.densityLatticeStepZ;
+    cached.m_latticeStepXY = exact.m_latticeStepXY;
+    cached.m_latticeStepZ  = exact.m_latticeStepZ;
+
+    TerrainGenerationComparison const comparison = CompareTerrainGeneration(centerCoords, SAMPLE_RADIUS, exact, cached);
+
+    result.m_sampledChunkCount    = comparison.m_sampledChunkCount;
+    result.m_exactMsPerChunk      = comparison.m_baselineSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_cachedMsPerChunk     = comparison.m_variantSeconds * 1000.0 / (double)comparison.m_sampledChunkCount;
+    result.m_changedBiomeCount    = comparison.m_changedBiomeCount;
+    result.m_changedSolidityCount = comparison.m_changedSolidityCount;
+    result.m_changedTypeCount     = comparison.m_changedTypeCount;
+    result.m_totalBlockCount      = comparison.m_totalBlockCount;
+    m_biomeRegionComparisonResult = result;
+
+    DebuggerPrintf("[BIOME REGION CACHE] %d chunks, sample step %d: exact %.2f ms/chunk, cached %.2f ms/chunk (%.1fx), max climate error %.5f\n",
+                   result.m_sampledChunkCount, result.m_sampleStep, result.m_exactMsPerChunk, result.m_cachedMsPerChunk,
+                   result.m_cachedMsPerChunk > 0.0 ? result.m_exactMsPerChunk / result.m_cachedMsPerChunk : 0.0,
+                   result.m_maxClimateError);
+    DebuggerPrintf("[BIOME REGION CACHE] Biome changed: %d of %d columns, solidity changed: %d of %d blocks, type changed: %d\n",
+                   result.m_changedBiomeCount, result.m_sampledChunkCount * CHUNK_SIZE_X * CHUNK_SIZE_Y,
+                   result.m_changedSolidityCount, result.m_totalBlockCount, result.m_changedTypeCount);
 }
 
 //----------------------------------------------------------------------------------------------------
-// Assignment 5 Phase 10: Fast Voxel Raycast using Amanatides & Woo algorithm
-//----------------------------------------------------------------------------------------------------
-RaycastResult World::RaycastVoxel(Vec3 const& start, Vec3 const& direction, float maxDistance) const
+Vec3 World::GetCameraPosition() const
 {
-    // Validate input: direction must be normalized
-    Vec3 normalizedDir = direction.GetNormalized();
-
-    // Convert world position to global block coordinates
-    IntVec3 currentBlock = IntVec3(static_cast<int>(floorf(start.x)),
-                                   static_cast<int>(floorf(start.y)),
-                                   static_cast<int>(floorf(start.z)));
-
-    // Get chunk and check if starting position is valid
-    IntVec2 chunkCoords = Chunk::GetChunkCoords(IntVec3(currentBlock.x, currentBlock.y, currentBlock.z));
-    Chunk*  chunk       = GetChunk(chunkCoords);
+    if (g_game != nullptr)
+    {
+        return g_game->GetPlayerCameraPosition();
+    }
+    return Vec3::ZERO; // Fallback if no game instance
+}
 
-    // If starting position is outside loaded chunks, return no hit
-    if (chunk == nullptr)
+//----------------------------------------------------------------------------------------------------
+Vec3 World::GetPlayerVelocity() const
+{
+    if (g_game != nullptr)
     {
-        return RaycastResult(false);
+        return g_game->GetPlayerVelocity();
     }
+    return Vec3::ZERO; // Fallback if no game instance
+}
 
-    // Check if we're starting inside a solid block (shouldn't happen in gameplay, but handle it)
-    IntVec3 localCoords = Chunk::GlobalCoordsToLocalCoords(currentBlock);
-    Block*  block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-    sBlockDefinition* def = (block != nullptr) ? sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex) : nullptr;
-    if (def != nullptr && def->IsOpaque())
+//----------------------------------------------------------------------------------------------------
+Vec3 World::GetCameraForward() const
+{
+    if (g_game != nullptr)
     {
-        // Starting inside solid block - return immediate hit
-        RaycastResult result(true, currentBlock, 0.0f);
-        result.m_impactPosition = start;
-        result.m_impactNormal   = -normalizedDir;
-        return result;
+        return g_game->GetPlayerCameraForward();
     }
+    return Vec3::ZERO; // No preferred direction without a game instance
+}
 
-    // ================================================================================
-    // Amanatides & Woo Algorithm - Fast Voxel Traversal
-    // ================================================================================
+//----------------------------------------------------------------------------------------------------
+float World::GetDistanceToChunkCenter(IntVec2 const& chunkCoords, Vec3 const& cameraPos) const
+{
+    IntVec2 chunkCenter   = Chunk::GetChunkCenter(chunkCoords);
+    Vec3    chunkCenter3D = Vec3(static_cast<float>(chunkCenter.x), static_cast<float>(chunkCenter.y), cameraPos.z);
 
-    // Calculate step direction for each axis (-1, 0, or +1)
-    int stepX = (normalizedDir.x < 0.0f) ? -1 : (normalizedDir.x > 0.0f) ? 1 : 0;
-    int stepY = (normalizedDir.y < 0.0f) ? -1 : (normalizedDir.y > 0.0f) ? 1 : 0;
-    int stepZ = (normalizedDir.z < 0.0f) ? -1 : (normalizedDir.z > 0.0f) ? 1 : 0;
+    // Only consider XY distance as specified
+    float deltaX = chunkCenter3D.x - cameraPos.x;
+    float deltaY = chunkCenter3D.y - cameraPos.y;
+    return sqrtf(deltaX * deltaX + deltaY * deltaY);
+}
 
-    // Calculate tDelta: distance along ray to cross 1 voxel in each axis
-    // Avoid division by zero for rays parallel to axis
-    float tDeltaX = (stepX != 0) ? (1.0f / fabsf(normalizedDir.x)) : FLT_MAX;
-    float tDeltaY = (stepY != 0) ? (1.0f / fabsf(normalizedDir.y)) : FLT_MAX;
-    float tDeltaZ = (stepZ != 0) ? (1.0f / fabsf(normalizedDir.z)) : FLT_MAX;
+//----------------------------------------------------------------------------------------------------
+// FindNearestMissingChunkInRange - Next chunk to activate: ahead of the player first, then nearest-first
+//
+// Both searches read ChunkActivationFrontier slot states (plain array reads, no locks or set copies).
+// The nearest-first search resumes from the frontier cursor, so repeated calls within a frame are O(1) each.
+//----------------------------------------------------------------------------------------------------
+IntVec2 World::FindNearestMissingChunkInRange(Vec3 const& cameraPos)
+{
+    IntVec2 cameraChunkCoords = Chunk::GetChunkCoords(IntVec3(static_cast<int>(cameraPos.x), static_cast<int>(cameraPos.y), static_cast<int>(cameraPos.z)));
 
-    // Calculate tMax: distance along ray to next voxel boundary in each axis
-    // This is the distance from start to the first grid boundary crossed
-    float tMaxX, tMaxY, tMaxZ;
+    // Crossing a chunk boundary re-centers the precomputed offset table
+    m_activationFrontier.SetCenter(cameraChunkCoords);
 
-    // X axis
-    if (stepX > 0)
-        tMaxX = ((currentBlock.x + 1.0f) - start.x) / normalizedDir.x;
-    else if (stepX < 0)
-        tMaxX = (currentBlock.x - start.x) / normalizedDir.x;
-    else
-        tMaxX = FLT_MAX;
+    // Phase 0, Task 0.7: Get player velocity for directional preloading
+    Vec3  playerVelocity        = GetPlayerVelocity();
+    float velocityMagnitude     = playerVelocity.GetLength();
+    bool  useDirectionalPreload = velocityMagnitude > PRELOAD_VELOCITY_THRESHOLD;
 
-    // Y axis
-    if (stepY > 0)
-        tMaxY = ((currentBlock.y + 1.0f) - start.y) / normalizedDir.y;
-    else if (stepY < 0)
-        tMaxY = (currentBlock.y - start.y) / normalizedDir.y;
-    else
-        tMaxY = FLT_MAX;
+    // Phase 0, Task 0.7: Smart directional preloading
+    // If player is moving, prioritize chunks ahead of movement direction
+    if (useDirectionalPreload)
+    {
+        // Calculate lookahead position (3 chunks ahead in movement direction)
+        Vec3    movementDirection = playerVelocity.GetNormalized();
+        float   lookaheadDistance = PRELOAD_LOOKAHEAD_CHUNKS * CHUNK_SIZE_X;
+        Vec3    lookaheadPos      = cameraPos + (movementDirection * lookaheadDistance);
+        IntVec2 lookaheadChunk    = Chunk::GetChunkCoords(IntVec3(static_cast<int>(lookaheadPos.x), static_cast<int>(lookaheadPos.y), 0));
 
-    // Z axis
-    if (stepZ > 0)
-        tMaxZ = ((currentBlock.z + 1.0f) - start.z) / normalizedDir.z;
-    else if (stepZ < 0)
-        tMaxZ = (currentBlock.z - start.z) / normalizedDir.z;
-    else
-        tMaxZ = FLT_MAX;
+        // Search in expanding rings around lookahead position
+        for (int radius = 0; radius <= 2; radius++) // Only check nearby chunks around lookahead
+        {
+            for (int dx = -radius; dx <= radius; dx++)
+            {
+                for (int dy = -radius; dy <= radius; dy++)
+                {
+                    // Only check perimeter of current ring
+                    if (abs(dx) != radius && abs(dy) != radius)
+                    {
+                        continue;
+                    }
 
-    // ================================================================================
-    // Main Traversal Loop
-    // ================================================================================
+                    IntVec2 testChunk(lookaheadChunk.x + dx, lookaheadChunk.y + dy);
 
-    float distanceTraveled = 0.0f;
-    Vec3  impactNormal     = Vec3(0.0f, 0.0f, 0.0f);
+                    if (m_activationFrontier.GetSlotState(testChunk) != ChunkSlotState::MISSING)
+                    {
+                        continue;
+                    }
+
+                    // Check if within activation range
+                    float distance = GetDistanceToChunkCenter(testChunk, cameraPos);
+                    if (distance <= CHUNK_ACTIVATION_RANGE)
+                    {
+                        return testChunk; // Found chunk in movement direction! Prioritize this
+                    }
+                }
+            }
+        }
+    }
+
+    // Nearest-first from the camera chunk (fallback or when not moving)
+    return m_activationFrontier.FindNextMissing();
+}
+
+//----------------------------------------------------------------------------------------------------
+IntVec2 World::FindFarthestActiveChunkOutsideDeactivationRange(Vec3 const& cameraPos) const
+{
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+    float                       farthestDistance = 0.0f;
+    IntVec2                     farthestChunk    = IntVec2(INT_MAX, INT_MAX);
+
+    for (auto const& chunkPair : m_activeChunks)
+    {
+        float distance = GetDistanceToChunkCenter(chunkPair.first, cameraPos);
+
+        // Only consider chunks outside deactivation range
+        if (distance > CHUNK_DEACTIVATION_RANGE && distance > farthestDistance)
+        {
+            farthestDistance = distance;
+            farthestChunk    = chunkPair.first;
+        }
+    }
+
+    return farthestChunk;
+}
+
+//----------------------------------------------------------------------------------------------------
+Chunk* World::FindNearestDirtyChunk(Vec3 const& cameraPos) const
+{
+    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+    float                       nearestDistance   = FLT_MAX;
+    Chunk*                      nearestDirtyChunk = nullptr;
+
+    for (const auto& chunkPair : m_activeChunks)
+    {
+        Chunk* chunk = chunkPair.second;
+        if (chunk != nullptr && chunk->GetIsMeshDirty())
+        {
+            float distance = GetDistanceToChunkCenter(chunkPair.first, cameraPos);
+            if (distance < nearestDistance)
+            {
+                nearestDistance   = distance;
+                nearestDirtyChunk = chunk;
+            }
+        }
+    }
+
+    return nearestDirtyChunk;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::ChunkExistsOnDisk(IntVec2 const& chunkCoords) const
+{
+    std::string filename = StringFormat("Saves/Chunk({0},{1}).chunk", chunkCoords.x, chunkCoords.y);
+    return std::filesystem::exists(filename);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::LoadChunkFromDisk(Chunk* chunk) const
+{
+    if (chunk == nullptr) return false;
+
+    IntVec2     chunkCoords = chunk->GetChunkCoords();
+    std::string filename    = StringFormat("Saves/Chunk({0},{1}).chunk", chunkCoords.x, chunkCoords.y);
+
+    std::vector<uint8_t> buffer;
+    if (!FileReadToBuffer(buffer, filename))
+    {
+        return false;
+    }
+
+    // Verify minimum file size (header + at least one RLE entry)
+    if (buffer.size() < sizeof(ChunkFileHeader) + sizeof(ChunkRLEEntry))
+    {
+        return false; // File too small
+    }
+
+    // Read and validate header
+    ChunkFileHeader header;
+    memcpy(&header, buffer.data(), sizeof(ChunkFileHeader));
+
+    // Validate header
+    if (header.fourCC[0] != 'G' || header.fourCC[1] != 'C' ||
+        header.fourCC[2] != 'H' || header.fourCC[3] != 'K')
+    {
+        return false; // Invalid 4CC
+    }
+
+    if (header.version != 1 || header.chunkBitsX != CHUNK_BITS_X ||
+        header.chunkBitsY != CHUNK_BITS_Y || header.chunkBitsZ != CHUNK_BITS_Z)
+    {
+        return false; // Incompatible format
+    }
+
+    // Decompress RLE data
+    size_t dataOffset = sizeof(ChunkFileHeader);
+    int    blockIndex = 0;
+
+    while (dataOffset < buffer.size() && blockIndex < BLOCKS_PER_CHUNK)
+    {
+        // Read RLE entry
+        if (dataOffset + sizeof(ChunkRLEEntry) > buffer.size())
+        {
+            return false; // Incomplete RLE entry
+        }
+
+        ChunkRLEEntry entry;
+        memcpy(&entry, buffer.data() + dataOffset, sizeof(ChunkRLEEntry));
+        dataOffset += sizeof(ChunkRLEEntry);
+
+        // Apply run to blocks
+        for (int i = 0; i < entry.count && blockIndex < BLOCKS_PER_CHUNK; i++)
+        {
+            IntVec3  localCoords = Chunk::IndexToLocalCoords(blockIndex);
+            BlockPtr block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
+            if (block != nullptr)
+            {
+                block->m_typeIndex = entry.value;
+            }
+            blockIndex++;
+        }
+    }
+
+    // Verify we loaded exactly the right number of blocks
+    if (blockIndex != BLOCKS_PER_CHUNK)
+    {
+        return false; // RLE data doesn't match expected block count
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::SaveChunkToDisk(Chunk* chunk) const
+{
+    if (chunk == nullptr) return false;
+
+    IntVec2 chunkCoords = chunk->GetChunkCoords();
+
+    // Debug output to help diagnose save issues
+    DebuggerPrintf("Saving chunk (%d,%d) to disk...\n", chunkCoords.x, chunkCoords.y);
+
+    // Ensure save directory exists (relative to executable in Run/ directory)
+    std::string saveDir = "Saves/";
+    std::filesystem::create_directories(saveDir);
+
+    std::string filename = StringFormat("{0}Chunk({1},{2}).chunk", saveDir, chunkCoords.x, chunkCoords.y);
+
+    // Collect block data in order for RLE compression
+    std::vector<uint8_t> blockData(BLOCKS_PER_CHUNK);
+    for (int i = 0; i < BLOCKS_PER_CHUNK; i++)
+    {
+        IntVec3  localCoords = Chunk::IndexToLocalCoords(i);
+        BlockPtr block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
+        if (block != nullptr)
+        {
+            blockData[i] = block->m_typeIndex;
+        }
+        else
+        {
+            blockData[i] = 0; // Air block if invalid
+        }
+    }
+
+    // Compress using RLE
+    std::vector<ChunkRLEEntry> rleEntries;
+    uint8_t                    currentType = blockData[0];
+    uint8_t                    runLength   = 1;
+
+    for (int i = 1; i < BLOCKS_PER_CHUNK; i++)
+    {
+        if (blockData[i] == currentType && runLength < 255)
+        {
+            runLength++;
+        }
+        else
+        {
+            // End current run
+            rleEntries.push_back({currentType, runLength});
+            currentType = blockData[i];
+            runLength   = 1;
+        }
+    }
+    // Don't forget the last run
+    rleEntries.push_back({currentType, runLength});
+
+    // Create file header
+    ChunkFileHeader header;
+    header.fourCC[0]  = 'G';
+    header.fourCC[1]  = 'C';
+    header.fourCC[2]  = 'H';
+    header.fourCC[3]  = 'K';
+    header.version    = 1;
+    header.chunkBitsX = CHUNK_BITS_X;
+    header.chunkBitsY = CHUNK_BITS_Y;
+    header.chunkBitsZ = CHUNK_BITS_Z;
+
+    // Calculate total file size
+    size_t               fileSize = sizeof(ChunkFileHeader) + rleEntries.size() * sizeof(ChunkRLEEntry);
+    std::vector<uint8_t> fileBuffer(fileSize);
+
+    // Write header
+    memcpy(fileBuffer.data(), &header, sizeof(ChunkFileHeader));
+
+    // Write RLE entries
+    size_t offset = sizeof(ChunkFileHeader);
+    for (const ChunkRLEEntry& entry : rleEntries)
+    {
+        memcpy(fileBuffer.data() + offset, &entry, sizeof(ChunkRLEEntry));
+        offset += sizeof(ChunkRLEEntry);
+    }
+
+    // Write to file using safe fopen_s
+    FILE*   file = nullptr;
+    errno_t err  = fopen_s(&file, filename.c_str(), "wb");
+    if (err != 0 || file == nullptr) return false;
+
+    size_t written = fwrite(fileBuffer.data(), 1, fileBuffer.size(), file);
+    fclose(file);
+
+    return written == fileBuffer.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::DeleteAllChunkFiles() const
+{
+    try
+    {
+        std::string saveDir = "Saves/";
+        if (std::filesystem::exists(saveDir))
+        {
+            // Iterate through all .chunk files in Saves/ directory
+            for (auto const& entry : std::filesystem::directory_iterator(saveDir))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".chunk")
+                {
+                    try
+                    {
+                        std::filesystem::remove(entry.path());
+                        DebuggerPrintf("Deleted chunk file: %s\n", entry.path().string().c_str());
+                    }
+                    catch (std::filesystem::filesystem_error const& e)
+                    {
+                        DebuggerPrintf("Failed to delete chunk file %s: %s\n",
+                                       entry.path().string().c_str(), e.what());
+                    }
+                }
+            }
+        }
+    }
+    catch (std::filesystem::filesystem_error const& e)
+    {
+        DebuggerPrintf("Failed to iterate Saves/ directory: %s\n", e.what());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::UpdateNeighborPointers(IntVec2 const& chunkCoords)
+{
+    Chunk* centerChunk = GetChunk(chunkCoords);
+    if (centerChunk == nullptr) return;
+
+    // Get neighbor coordinates
+    IntVec2 northCoords = chunkCoords + IntVec2(0, 1);
+    IntVec2 southCoords = chunkCoords + IntVec2(0, -1);
+    IntVec2 eastCoords  = chunkCoords + IntVec2(1, 0);
+    IntVec2 westCoords  = chunkCoords + IntVec2(-1, 0);
+
+    // Get neighbor chunks (if they exist)
+    Chunk* northChunk = GetChunk(northCoords);
+    Chunk* southChunk = GetChunk(southCoords);
+    Chunk* eastChunk  = GetChunk(eastCoords);
+    Chunk* westChunk  = GetChunk(westCoords);
+
+    // Set neighbor pointers on center chunk
+    centerChunk->SetNeighborChunks(northChunk, southChunk, eastChunk, westChunk);
+
+    // Update neighbor chunks to point back to center chunk
+    if (northChunk != nullptr) northChunk->SetNeighborChunks(northChunk->GetNorthNeighbor(), centerChunk, northChunk->GetEastNeighbor(), northChunk->GetWestNeighbor());
+    if (southChunk != nullptr) southChunk->SetNeighborChunks(centerChunk, southChunk->GetSouthNeighbor(), southChunk->GetEastNeighbor(), southChunk->GetWestNeighbor());
+    if (eastChunk != nullptr) eastChunk->SetNeighborChunks(eastChunk->GetNorthNeighbor(), eastChunk->GetSouthNeighbor(), eastChunk->GetEastNeighbor(), centerChunk);
+    if (westChunk != nullptr) westChunk->SetNeighborChunks(westChunk->GetNorthNeighbor(), westChunk->GetSouthNeighbor(), centerChunk, westChunk->GetWestNeighbor());
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::ClearNeighborReferences(IntVec2 const& chunkCoords)
+{
+    // Clear references to this chunk from its neighbors
+    IntVec2 northCoords = chunkCoords + IntVec2(0, 1);
+    IntVec2 southCoords = chunkCoords + IntVec2(0, -1);
+    IntVec2 eastCoords  = chunkCoords + IntVec2(1, 0);
+    IntVec2 westCoords  = chunkCoords + IntVec2(-1, 0);
+
+    Chunk* northChunk = GetChunk(northCoords);
+    Chunk* southChunk = GetChunk(southCoords);
+    Chunk* eastChunk  = GetChunk(eastCoords);
+    Chunk* westChunk  = GetChunk(westCoords);
+
+    if (northChunk != nullptr) northChunk->SetNeighborChunks(northChunk->GetNorthNeighbor(), nullptr, northChunk->GetEastNeighbor(), northChunk->GetWestNeighbor());
+    if (southChunk != nullptr) southChunk->SetNeighborChunks(nullptr, southChunk->GetSouthNeighbor(), southChunk->GetEastNeighbor(), southChunk->GetWestNeighbor());
+    if (eastChunk != nullptr) eastChunk->SetNeighborChunks(eastChunk->GetNorthNeighbor(), eastChunk->GetSouthNeighbor(), eastChunk->GetEastNeighbor(), nullptr);
+    if (westChunk != nullptr) westChunk->SetNeighborChunks(westChunk->GetNorthNeighbor(), westChunk->GetSouthNeighbor(), nullptr, westChunk->GetWestNeighbor());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Digging and Placing System
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+IntVec3 World::FindHighestNonAirBlockAtOrBelow(Vec3 const& position) const
+{
+    // Start from camera position and search downward
+    IntVec3 searchPos = IntVec3(static_cast<int>(floorf(position.x)),
+                                static_cast<int>(floorf(position.y)),
+                                static_cast<int>(floorf(position.z)));
+
+    // Camera at or above the column top (the common case): the heightmap answers directly
+    int const columnTopZ = GetHighestNonAirZ(searchPos.x, searchPos.y);
+    if (columnTopZ < 0)
+    {
+        return IntVec3(INT_MAX, INT_MAX, INT_MAX); // All air (or chunk not loaded)
+    }
+    if (columnTopZ <= searchPos.z)
+    {
+        return IntVec3(searchPos.x, searchPos.y, columnTopZ);
+    }
+
+    // Camera below the column top (caves, overhangs): search downward from camera Z position
+    for (int z = searchPos.z; z >= 0; z--)
+    {
+        IntVec3 testPos(searchPos.x, searchPos.y, z);
+        uint8_t blockType = GetBlockTypeAtGlobalCoords(testPos);
+
+        // If we found a non-air block, this is our target
+        if (blockType != 0) // 0 = BLOCK_AIR
+        {
+            return testPos;
+        }
+    }
+
+    // No non-air block found (all air down to bedrock)
+    return IntVec3(INT_MAX, INT_MAX, INT_MAX); // Invalid position
+}
+
+//----------------------------------------------------------------------------------------------------
+// Assignment 5 Phase 10: Fast Voxel Raycast using Amanatides & Woo algorithm
+//----------------------------------------------------------------------------------------------------
+RaycastResult World::RaycastVoxel(Vec3 const& start, Vec3 const& direction, float maxDistance) const
+{
+    // Validate input: direction must be normalized
+    Vec3 normalizedDir = direction.GetNormalized();
+
+    // Convert world position to global block coordinates
+    IntVec3 currentBlock = IntVec3(static_cast<int>(floorf(start.x)),
+                                   static_cast<int>(floorf(start.y)),
+                                   static_cast<int>(floorf(start.z)));
+
+    // Get chunk and check if starting position is valid
+    IntVec2 chunkCoords = Chunk::GetChunkCoords(IntVec3(currentBlock.x, currentBlock.y, currentBlock.z));
+    Chunk*  chunk       = GetChunk(chunkCoords);
+
+    // If starting position is outside loaded chunks, return no hit
+    if (chunk == nullptr)
+    {
+        return RaycastResult(false);
+    }
+
+    // Check if we're starting inside a solid block (shouldn't happen in gameplay, but handle it)
+    // Opacity comes from the chunk's opacity mask; rows outside the world's vertical range are never solid
+    IntVec3 localCoords = Chunk::GlobalCoordsToLocalCoords(currentBlock);
+    bool    isOpaque    = localCoords.z >= 0 && localCoords.z <= CHUNK_MAX_Z && chunk->IsBlockOpaque(Chunk::LocalCoordsToIndex(localCoords));
+    if (isOpaque)
+    {
+        // Starting inside solid block - return immediate hit
+        RaycastResult result(true, currentBlock, 0.0f);
+        result.m_impactPosition = start;
+        result.m_impactNormal   = -normalizedDir;
+        return result;
+    }
+
+    // ================================================================================
+    // Amanatides & Woo Algorithm - Fast Voxel Traversal
+    // ================================================================================
+
+    // Calculate step direction for each axis (-1, 0, or +1)
+    int stepX = (normalizedDir.x < 0.0f) ? -1 : (normalizedDir.x > 0.0f) ? 1 : 0;
+    int stepY = (normalizedDir.y < 0.0f) ? -1 : (normalizedDir.y > 0.0f) ? 1 : 0;
+    int stepZ = (normalizedDir.z < 0.0f) ? -1 : (normalizedDir.z > 0.0f) ? 1 : 0;
+
+    // Calculate tDelta: distance along ray to cross 1 voxel in each axis
+    // Avoid division by zero for rays parallel to axis
+    float tDeltaX = (stepX != 0) ? (1.0f / fabsf(normalizedDir.x)) : FLT_MAX;
+    float tDeltaY = (stepY != 0) ? (1.0f / fabsf(normalizedDir.y)) : FLT_MAX;
+    float tDeltaZ = (stepZ != 0) ? (1.0f / fabsf(normalizedDir.z)) : FLT_MAX;
+
+    // Calculate tMax: distance along ray to next voxel boundary in each axis
+    // This is the distance from start to the first grid boundary crossed
+    float tMaxX, tMaxY, tMaxZ;
+
+    // X axis
+    if (stepX > 0)
+        tMaxX = ((currentBlock.x + 1.0f) - start.x) / normalizedDir.x;
+    else if (stepX < 0)
+        tMaxX = (currentBlock.x - start.x) / normalizedDir.x;
+    else
+        tMaxX = FLT_MAX;
+
+    // Y axis
+    if (stepY > 0)
+        tMaxY = ((currentBlock.y + 1.0f) - start.y) / normalizedDir.y;
+    else if (stepY < 0)
+        tMaxY = (currentBlock.y - start.y) / normalizedDir.y;
+    else
+        tMaxY = FLT_MAX;
+
+    // Z axis
+    if (stepZ > 0)
+        tMaxZ = ((currentBlock.z + 1.0f) - start.z) / normalizedDir.z;
+    else if (stepZ < 0)
+        tMaxZ = (currentBlock.z - start.z) / normalizedDir.z;
+    else
+        tMaxZ = FLT_MAX;
+
+    // ================================================================================
+    // Main Traversal Loop
+    // ================================================================================
+
+    float distanceTraveled = 0.0f;
+    Vec3  impactNormal     = Vec3(0.0f, 0.0f, 0.0f);
+
+    while (distanceTraveled < maxDistance)
+    {
+        // Determine which axis boundary we cross first
+        if (tMaxX < tMaxY && tMaxX < tMaxZ)
+        {
+            // Cross X boundary first
+            if (tMaxX > maxDistance)
+                break; // Exceeded max distance
+
+            // Step to next voxel in X direction
+            currentBlock.x += stepX;
+            distanceTraveled = tMaxX;
+            tMaxX += tDeltaX;
+            impactNormal = Vec3(static_cast<float>(-stepX), 0.0f, 0.0f);
+        }
+        else if (tMaxY < tMaxZ)
+        {
+            // Cross Y boundary first
+            if (tMaxY > maxDistance)
+                break; // Exceeded max distance
+
+            // Step to next voxel in Y direction
+            currentBlock.y += stepY;
+            distanceTraveled = tMaxY;
+            tMaxY += tDeltaY;
+            impactNormal = Vec3(0.0f, static_cast<float>(-stepY), 0.0f);
+        }
+        else
+        {
+            // Cross Z boundary first
+            if (tMaxZ > maxDistance)
+                break; // Exceeded max distance
+
+            // Step to next voxel in Z direction
+            currentBlock.z += stepZ;
+            distanceTraveled = tMaxZ;
+            tMaxZ += tDeltaZ;
+            impactNormal = Vec3(0.0f, 0.0f, static_cast<float>(-stepZ));
+        }
+
+        // Check if we stepped outside world bounds
+        if (currentBlock.z < 0 || currentBlock.z >= CHUNK_SIZE_Z)
+        {
+            return RaycastResult(false); // Hit world boundary
+        }
+
+        // Get the chunk containing the new block
+        chunkCoords = Chunk::GetChunkCoords(IntVec3(currentBlock.x, currentBlock.y, currentBlock.z));
+        chunk       = GetChunk(chunkCoords);
+
+        // If chunk not loaded, treat as no hit
+        if (chunk == nullptr)
+        {
+            return RaycastResult(false);
+        }
+
+        // Check if current block is solid
+        localCoords = Chunk::GlobalCoordsToLocalCoords(currentBlock);
+        isOpaque    = localCoords.z >= 0 && localCoords.z <= CHUNK_MAX_Z && chunk->IsBlockOpaque(Chunk::LocalCoordsToIndex(localCoords));
+
+        if (isOpaque)
+        {
+            // Hit a solid block!
+            RaycastResult result(true, currentBlock, distanceTraveled);
+            result.m_impactPosition = start + (normalizedDir * distanceTraveled);
+            result.m_impactNormal   = impactNormal;
+            return result;
+        }
+    }
+
+    // No hit within max distance
+    return RaycastResult(false);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::DigBlockAtCameraPosition(Vec3 const& cameraPos)
+{
+    // Find highest non-air block at or below camera position
+    IntVec3 targetBlock = FindHighestNonAirBlockAtOrBelow(cameraPos);
+
+    // Check if we found a valid block to dig
+    if (targetBlock.x == INT_MAX || targetBlock.y == INT_MAX || targetBlock.z == INT_MAX)
+    {
+        return false; // No block to dig
+    }
+
+    // Convert the block to air (dig it)
+    bool success = SetBlockAtGlobalCoords(targetBlock, 0); // 0 = BLOCK_AIR
+
+    if (success)
+    {
+        DebuggerPrintf("Dug block at (%d,%d,%d)\n", targetBlock.x, targetBlock.y, targetBlock.z);
+    }
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::PlaceBlockAtCameraPosition(Vec3 const&   cameraPos,
+                                       uint8_t const blockType)
+{
+    // Find highest non-air block at or below camera position
+    IntVec3 highestBlock = FindHighestNonAirBlockAtOrBelow(cameraPos);
+
+    // Check if we found a valid foundation block
+    if (highestBlock.x == INT_MAX || highestBlock.y == INT_MAX || highestBlock.z == INT_MAX)
+    {
+        return false; // No foundation block found
+    }
+
+    // Place block directly above the highest non-air block
+    IntVec3 placePos = IntVec3(highestBlock.x, highestBlock.y, highestBlock.z + 1);
+
+    // Check if the target position is valid (within world bounds)
+    if (placePos.z >= CHUNK_SIZE_Z)
+    {
+        return false; // Would place block above world height limit
+    }
+
+    // Check if target position is already occupied by a non-air block
+    uint8_t existingBlock = GetBlockTypeAtGlobalCoords(placePos);
+    if (existingBlock != 0) // 0 = BLOCK_AIR
+    {
+        return false; // Position already occupied
+    }
+
+    // Place the new block
+    bool success = SetBlockAtGlobalCoords(placePos, blockType);
+
+    if (success)
+    {
+        DebuggerPrintf("Placed block type %d at (%d,%d,%d)\n", blockType, placePos.x, placePos.y, placePos.z);
+    }
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Asynchronous job processing methods
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+// ProcessCompletedJobs - Route each finished job to its type's completion handler
+//
+// The job's dynamic type identifies its tracking set, so dispatch is one cast plus one hash erase per
+// job instead of a walk over every in-flight list. m_jobListsMutex is held only for that erase; the
+// handlers (which take other World locks and may touch the chunk maps) run without it.
+//----------------------------------------------------------------------------------------------------
+void World::ProcessCompletedJobs()
+{
+    if (g_jobSystem == nullptr) return;
+
+    auto const dispatchStartTime = std::chrono::high_resolution_clock::now();
+
+    // Retrieve all completed jobs from JobSystem ONCE
+    std::vector<Job*> completedJobs = g_jobSystem->RetrieveAllCompletedJobs();
+
+    // Process each completed job
+    for (Job* completedJob : completedJobs)
+    {
+        if (ChunkGenerateJob* generateJob = dynamic_cast<ChunkGenerateJob*>(completedJob))
+        {
+            if (UntrackJob(m_chunkGenerationJobs, generateJob))
+            {
+                HandleCompletedGenerateJob(generateJob);
+            }
+        }
+        else if (ChunkLoadJob* loadJob = dynamic_cast<ChunkLoadJob*>(completedJob))
+        {
+            if (UntrackJob(m_chunkLoadJobs, loadJob))
+            {
+                HandleCompletedLoadJob(loadJob);
+            }
+        }
+        else if (ChunkMeshJob* meshJob = dynamic_cast<ChunkMeshJob*>(completedJob))
+        {
+            if (UntrackJob(m_chunkMeshJobs, meshJob))
+            {
+                HandleCompletedMeshJob(meshJob);
+            }
+        }
+        else if (ChunkSaveJob* saveJob = dynamic_cast<ChunkSaveJob*>(completedJob))
+        {
+            if (UntrackJob(m_chunkSaveJobs, saveJob))
+            {
+                HandleCompletedSaveJob(saveJob);
+            }
+        }
+        else if (ChunkLightJob* lightJob = dynamic_cast<ChunkLightJob*>(completedJob))
+        {
+            if (UntrackJob(m_chunkLightJobs, lightJob))
+            {
+                HandleCompletedLightJob(lightJob);
+            }
+        }
+        // Anything else is not one of our job types
+    }
+
+    auto const dispatchEndTime = std::chrono::high_resolution_clock::now();
+    m_completedJobDispatchStats.m_lastFrameJobCount = (int)completedJobs.size();
+    m_completedJobDispatchStats.m_lastFrameMs       = std::chrono::duration<double, std::milli>(dispatchEndTime - dispatchStartTime).count();
+    m_completedJobDispatchStats.m_peakFrameMs       = (std::max)(m_completedJobDispatchStats.m_peakFrameMs, m_completedJobDispatchStats.m_lastFrameMs);
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::HandleCompletedGenerateJob(ChunkGenerateJob* job)
+{
+    Chunk* chunk = job->GetChunk();
+    if (!chunk)
+    {
+        // Clean up invalid job
+        delete job;
+        return;
+    }
+
+    IntVec2 chunkCoords = chunk->GetChunkCoords();
+
+    if (job->WasSuccessful())
+    {
+        ChunkGenerationTimings const& timings = chunk->GetGenerationTimings();
+        for (int stageIndex = (int)job->GetFirstStage(); stageIndex <= (int)job->GetLastStage(); ++stageIndex)
+        {
+            m_generationStageStats.m_totalSeconds[stageIndex] += timings.m_stageSeconds[stageIndex];
+            m_generationStageStats.m_runCount[stageIndex]++;
+        }
+        m_generationStageStats.m_jobCount++;
+
+        // Split pipeline: the chunk stays TERRAIN_GENERATING (and queued) until its LIGHTING stage job lands.
+        // Follow-up stages bypass MAX_PENDING_GENERATE_JOBS so a started chunk is never parked half-done.
+        if (!job->IsFinalStage() && chunk->GetState() == ChunkState::TERRAIN_GENERATING)
+        {
+            SubmitGenerateJob(chunk);
+            delete job;
+            return;
+        }
+    }
+
+    // Verify the chunk is in the expected state
+    if (chunk->GetState() == ChunkState::LIGHTING_INITIALIZING)
+    {
+        // Job completed successfully - handle lighting initialization on main thread
+        // For now, just transition to COMPLETE state
+        chunk->SetState(ChunkState::COMPLETE);
+        chunk->SetDebugDraw(m_globalChunkDebugDraw); // Inherit global debug state
+
+        // Remove from non-active chunks, add to active chunks
+        {
+            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
+            m_nonActiveChunks.erase(chunk);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+            if (m_activeChunks.find(chunkCoords) == m_activeChunks.end())
+            {
+                m_activeChunks[chunkCoords] = chunk;
+                m_chunkGrid.Insert(chunkCoords, chunk);
+            }
+        }
+        m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::ACTIVE);
+
+        // Update neighbor pointers (needs active chunks mutex, but UpdateNeighborPointers handles it)
+        UpdateNeighborPointers(chunkCoords);
+
+        // Remove from queued chunks
+        {
+            std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
+            m_queuedGenerateChunks.erase(chunkCoords);
+        }
+
+        // Assignment 5 Phase 6: Trigger cross-chunk lighting propagation FIRST
+        // This queues edge blocks for lighting propagation
+        chunk->OnActivate(this);
+
+        // NOTE: Do NOT call SetIsMeshDirty(true) here!
+        // The deferred mesh rebuild system will mark this chunk dirty
+        // AFTER lighting stabilizes via ProcessDirtyChunkMeshes()
+    }
+    else
+    {
+        // Job completed but chunk is in unexpected state - handle error
+        // This could happen if the job failed or chunk was modified externally
+        // For now, we'll clean up and let the chunk be retried later
+
+        // Remove from non-active chunks
+        {
+            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
+            m_nonActiveChunks.erase(chunk);
+        }
+
+        // Remove from queued chunks
+        {
+            std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
+            m_queuedGenerateChunks.erase(chunkCoords);
+        }
+
+        // Reset chunk to ACTIVATING state so it can be retried (from the first stage)
+        chunk->PrepareRestage(ChunkGenerationStage::BIOME);
+        chunk->SetState(ChunkState::ACTIVATING);
+        m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::MISSING);
+    }
+
+    // Clean up the job
+    delete job;
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::HandleCompletedLoadJob(ChunkLoadJob* job)
+{
+    Chunk* chunk = job->GetChunk();
+
+    if (chunk)
+    {
+        IntVec2 chunkCoords = chunk->GetChunkCoords();
+
+        if (job->WasSuccessful() && chunk->GetState() == ChunkState::LOAD_COMPLETE)
+        {
+            chunk->SetState(ChunkState::COMPLETE);
+            chunk->SetDebugDraw(m_globalChunkDebugDraw); // Inherit global debug state
+
+            {
+                std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
+                m_nonActiveChunks.erase(chunk);
+            }
+
+            {
+                std::lock_guard<std::mutex> activeLock(m_activeChunksMutex);
+                m_activeChunks[chunkCoords] = chunk;
+                m_chunkGrid.Insert(chunkCoords, chunk);
+            }
+            m_activationFrontier.SetSlotState(chunkCoords, ChunkSlotState::ACTIVE);
+
+            UpdateNeighborPointers(chunkCoords);
+
+            // Assignment 5 Phase 6: Trigger cross-chunk lighting propagation
+            chunk->OnActivate(this);  // CRITICAL: Re-enabled for loaded chunks
+
+            // NOTE: Do NOT call SetIsMeshDirty(true) here!
+            // The deferred mesh rebuild system will mark this chunk dirty
+            // AFTER lighting stabilizes via ProcessDirtyChunkMeshes()
+        }
+        else
+        {
+            {
+                std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
+                m_nonActiveChunks.erase(chunk);
+            }
+
+            // Failed load falls back to generation through the scheduler (chunk stays PENDING in the frontier)
+            chunk->SetState(ChunkState::ACTIVATING);
+            m_chunkJobScheduler.Enqueue(chunk, ChunkJobKind::GENERATE);
+        }
+    }
+
+    delete job;
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::HandleCompletedMeshJob(ChunkMeshJob* job)
+{
+    Chunk* chunk = job->GetChunk();
+
+    if (job->WasSuccessful())
+    {
+        // Apply mesh data on main thread (CPU data only)
+        job->ApplyMeshDataToChunk();
+
+        // Now perform DirectX operations on main thread
+        chunk->UpdateVertexBuffer();
+        chunk->SetMeshClean();
+        OnChunkMeshUploaded(chunk);
+    }
+
+    delete job;
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::HandleCompletedSaveJob(ChunkSaveJob* job)
+{
+    Chunk* chunk = job->GetChunk();
+
+    if (chunk)
+    {
+        {
+            std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
+            m_nonActiveChunks.erase(chunk);
+        }
+
+        ReleaseChunk(chunk);
+    }
+
+    delete job;
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::ProcessDirtyChunkMeshes()
+{
+    // CRITICAL FIX: Don't rebuild meshes while light propagation is in progress
+    // This prevents "progressive brightening" bug where chunks appear dark and gradually brighten
+    // as light propagates from neighboring chunks
+    if (HasPendingLightWork())
+    {
+        return;  // Don't rebuild any meshes until light queue is empty
+    }
+
+    // Assignment 5 Phase 10 FIX: Lighting queue is now empty (lighting has stabilized)
+    // Mark all chunks with changed lighting as mesh-dirty so they rebuild with correct lighting
+    // This fixes the "inconsistent nighttime lighting" bug where some chunks stay bright
+    {
+        std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
+        if (!m_chunksNeedingMeshRebuild.empty())
+        {
+            for (Chunk* chunk : m_chunksNeedingMeshRebuild)
+            {
+                if (chunk)
+                {
+                    chunk->SetIsMeshDirty(true);
+                }
+            }
+            m_chunksNeedingMeshRebuild.clear();
+        }
+    }
+
+    ChunkJobViewpoint viewpoint;
+    viewpoint.m_position = GetCameraPosition();
+    viewpoint.m_forward  = GetCameraForward();
+    viewpoint.m_velocity = GetPlayerVelocity();
+
+    // Find up to 2 dirty chunks with the best job priority (distance weighted by view and movement direction)
+    std::vector<std::pair<float, Chunk*>> dirtyChunksWithDistance;
+
+    {
+        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+        for (auto const& chunkPair : m_activeChunks)
+        {
+            Chunk* chunk = chunkPair.second;
+            if (chunk && chunk->GetIsMeshDirty() && chunk->GetState() == ChunkState::COMPLETE)
+            {
+                float priority = ChunkJobScheduler::ComputePriority(chunk->GetChunkCoords(), viewpoint);
+                dirtyChunksWithDistance.emplace_back(priority, chunk);
+            }
+        }
+    }
+
+    // Sort by priority (best first)
+    std::sort(dirtyChunksWithDistance.begin(), dirtyChunksWithDistance.end());
+
+    // Rebuild mesh for up to 2 closest dirty chunks
+    int meshesRebuilt = 0;
+    for (auto const& pair : dirtyChunksWithDistance)
+    {
+        if (meshesRebuilt >= 2)
+        {
+            break;
+        }
+
+        Chunk* chunk = pair.second;
+
+        // Assignment 5 Phase 0 (Hidden Surface Removal): Only construct meshes for chunks with all 4 neighbors active
+        // This prevents rendering incomplete chunk edges (blackness underwater/underground)
+        // Reference: A5 specification line 97: "Only construct meshes for chunks with all 4 neighbors active"
+        IntVec2 chunkCoords = chunk->GetChunkCoords();
+        bool allNeighborsActive = true;
+        {
+            std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+
+            // Check all 4 horizontal neighbors (East, West, North, South)
+            IntVec2 neighborOffsets[4] = {
+                IntVec2(1, 0),   // East
+                IntVec2(-1, 0),  // West
+                IntVec2(0, 1),   // North
+                IntVec2(0, -1)   // South
+            };
+
+            for (int i = 0; i < 4; ++i)
+            {
+                IntVec2 neighborCoords = chunkCoords + neighborOffsets[i];
+                auto iter = m_activeChunks.find(neighborCoords);
+                if (iter == m_activeChunks.end() || iter->second == nullptr ||
+                    iter->second->GetState() != ChunkState::COMPLETE)
+                {
+                    allNeighborsActive = false;
+                    break;
+                }
+            }
+        }
+
+        // Only submit chunk for mesh generation if all 4 neighbors are active
+        if (allNeighborsActive)
+        {
+            // Submit mesh generation job instead of rebuilding on main thread
+            SubmitChunkForMeshGeneration(chunk);
+            ++meshesRebuilt;
+        }
+        // If neighbors not ready, leave chunk marked as dirty - it will be retried next frame
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::SubmitChunkForGeneration(Chunk* chunk)
+{
+    if (!chunk)
+    {
+        return;
+    }
+
+    if (g_jobSystem == nullptr) return;
+
+    IntVec2 chunkCoords = chunk->GetChunkCoords();
+
+    // Check if we've reached the maximum number of pending generation jobs
+    {
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        if ((int)m_chunkGenerationJobs.size() >= MAX_PENDING_GENERATE_JOBS)
+        {
+            return; // Too many jobs in flight, try again next frame
+        }
+    }
+
+    // Check if chunk is already queued for generation (with mutex protection)
+    {
+        std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
+        if (m_queuedGenerateChunks.find(chunkCoords) != m_queuedGenerateChunks.end())
+        {
+            return; // Already queued
+        }
+    }
 
-    while (distanceTraveled < maxDistance)
+    // Set chunk state and submit job
+    if (chunk->CompareAndSetState(ChunkState::ACTIVATING, ChunkState::TERRAIN_GENERATING))
     {
-        // Determine which axis boundary we cross first
-        if (tMaxX < tMaxY && tMaxX < tMaxZ)
+        // Add chunk to non-active chunks (being processed by worker thread)
         {
-            // Cross X boundary first
-            if (tMaxX > maxDistance)
-                break; // Exceeded max distance
-
-            // Step to next voxel in X direction
-            currentBlock.x += stepX;
-            distanceTraveled = tMaxX;
-            tMaxX += tDeltaX;
-            impactNormal = Vec3(static_cast<float>(-stepX), 0.0f, 0.0f);
+            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
+            m_nonActiveChunks.insert(chunk);
         }
-        else if (tMaxY < tMaxZ)
-        {
-            // Cross Y boundary first
-            if (tMaxY > maxDistance)
-                break; // Exceeded max distance
 
-            // Step to next voxel in Y direction
-            currentBlock.y += stepY;
-            distanceTraveled = tMaxY;
-            tMaxY += tDeltaY;
-            impactNormal = Vec3(0.0f, static_cast<float>(-stepY), 0.0f);
-        }
-        else
+        // Mark as queued
         {
-            // Cross Z boundary first
-            if (tMaxZ > maxDistance)
-                break; // Exceeded max distance
-
-            // Step to next voxel in Z direction
-            currentBlock.z += stepZ;
-            distanceTraveled = tMaxZ;
-            tMaxZ += tDeltaZ;
-            impactNormal = Vec3(0.0f, 0.0f, static_cast<float>(-stepZ));
+            std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
+            m_queuedGenerateChunks.insert(chunkCoords);
         }
 
-        // Check if we stepped outside world bounds
-        if (currentBlock.z < 0 || currentBlock.z >= CHUNK_SIZE_Z)
+        SubmitGenerateJob(chunk);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// SubmitGenerateJob - One job for the chunk's next stage (split pipeline) or for all remaining stages
+//----------------------------------------------------------------------------------------------------
+void World::SubmitGenerateJob(Chunk* chunk)
+{
+    ChunkGenerationStage const lastStage = g_worldGenConfig->pipeline.splitStageJobs ? chunk->GetNextGenerationStage()
+                                                                                      : ChunkGenerationStage::LIGHTING;
+    ChunkGenerateJob* job = new ChunkGenerateJob(chunk, lastStage);
+
+    // Add job to tracking lists
+    {
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        m_chunkGenerationJobs.insert(job);
+    }
+
+    g_jobSystem->SubmitJob(job);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool World::SubmitChunkForLoading(Chunk* chunk)
+{
+    if (!chunk)
+    {
+        return false;
+    }
+
+    if (g_jobSystem == nullptr) return false;
+
+    // Check if we've reached the maximum number of pending load jobs
+    {
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        if ((int)m_chunkLoadJobs.size() >= MAX_PENDING_LOAD_JOBS)
         {
-            return RaycastResult(false); // Hit world boundary
+            return false; // Too many load jobs in flight, try again next frame
         }
+    }
 
-        // Get the chunk containing the new block
-        chunkCoords = Chunk::GetChunkCoords(IntVec3(currentBlock.x, currentBlock.y, currentBlock.z));
-        chunk       = GetChunk(chunkCoords);
+    // Set chunk state and submit I/O job
+    if (chunk->CompareAndSetState(ChunkState::ACTIVATING, ChunkState::LOADING))
+    {
+        ChunkLoadJob* job = new ChunkLoadJob(chunk);
 
-        // If chunk not loaded, treat as no hit
-        if (chunk == nullptr)
+        // Add chunk to non-active chunks (being processed by I/O worker thread)
         {
-            return RaycastResult(false);
+            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
+            m_nonActiveChunks.insert(chunk);
         }
 
-        // Check if current block is solid
-        localCoords = Chunk::GlobalCoordsToLocalCoords(currentBlock);
-        block       = chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z);
-        def         = (block != nullptr) ? sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex) : nullptr;
-
-        if (def != nullptr && def->IsOpaque())
+        // Add job to tracking lists
         {
-            // Hit a solid block!
-            RaycastResult result(true, currentBlock, distanceTraveled);
-            result.m_impactPosition = start + (normalizedDir * distanceTraveled);
-            result.m_impactNormal   = impactNormal;
-            return result;
+            std::lock_guard<std::mutex> lock(m_jobListsMutex);
+            m_chunkLoadJobs.insert(job);
         }
-    }
 
-    // No hit within max distance
-    return RaycastResult(false);
+        g_jobSystem->SubmitJob(job);
+        return true;
+    }
+    return false;
 }
 
 //----------------------------------------------------------------------------------------------------
-bool World::DigBlockAtCameraPosition(Vec3 const& cameraPos)
+void World::SubmitChunkForSaving(Chunk* chunk)
 {
-    // Find highest non-air block at or below camera position
-    IntVec3 targetBlock = FindHighestNonAirBlockAtOrBelow(cameraPos);
-
-    // Check if we found a valid block to dig
-    if (targetBlock.x == INT_MAX || targetBlock.y == INT_MAX || targetBlock.z == INT_MAX)
+    if (!chunk)
     {
-        return false; // No block to dig
+        return;
     }
 
-    // Convert the block to air (dig it)
-    bool success = SetBlockAtGlobalCoords(targetBlock, 0); // 0 = BLOCK_AIR
+    if (g_jobSystem == nullptr)
+    {
+        // Can't save asynchronously, delete chunk
+        ReleaseChunk(chunk);
+        return;
+    }
 
-    if (success)
+    // Check if we've reached the maximum number of pending save jobs
     {
-        DebuggerPrintf("Dug block at (%d,%d,%d)\n", targetBlock.x, targetBlock.y, targetBlock.z);
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        if ((int)m_chunkSaveJobs.size() >= MAX_PENDING_SAVE_JOBS)
+        {
+            // Too many save jobs in flight, save synchronously (fallback)
+            chunk->SaveToDisk();
+            ReleaseChunk(chunk);
+            return;
+        }
     }
 
-    return success;
-}
+    // Set chunk state and submit I/O job
+    chunk->SetState(ChunkState::SAVING);
 
-//----------------------------------------------------------------------------------------------------
-bool World::PlaceBlockAtCameraPosition(Vec3 const&   cameraPos,
-                                       uint8_t const blockType)
-{
-    // Find highest non-air block at or below camera position
-    IntVec3 highestBlock = FindHighestNonAirBlockAtOrBelow(cameraPos);
+    ChunkSaveJob* job = new ChunkSaveJob(chunk);
 
-    // Check if we found a valid foundation block
-    if (highestBlock.x == INT_MAX || highestBlock.y == INT_MAX || highestBlock.z == INT_MAX)
+    // Add chunk to non-active chunks (being processed by I/O worker thread)
     {
-        return false; // No foundation block found
+        std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
+        m_nonActiveChunks.insert(chunk);
     }
 
-    // Place block directly above the highest non-air block
-    IntVec3 placePos = IntVec3(highestBlock.x, highestBlock.y, highestBlock.z + 1);
+    // Add job to tracking lists
+    {
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        m_chunkSaveJobs.insert(job);
+    }
 
-    // Check if the target position is valid (within world bounds)
-    if (placePos.z >= CHUNK_SIZE_Z)
+    g_jobSystem->SubmitJob(job);
+    chunk->SetIsMeshDirty(false);
+}
+
+//----------------------------------------------------------------------------------------------------
+void World::SubmitChunkForMeshGeneration(Chunk* chunk)
+{
+    if (!chunk)
     {
-        return false; // Would place block above world height limit
+        return;
     }
 
-    // Check if target position is already occupied by a non-air block
-    uint8_t existingBlock = GetBlockTypeAtGlobalCoords(placePos);
-    if (existingBlock != 0) // 0 = BLOCK_AIR
+    if (g_jobSystem == nullptr) return;
+
+    // Check if we've reached the maximum number of pending mesh jobs
     {
-        return false; // Position already occupied
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        if ((int)m_chunkMeshJobs.size() >= MAX_PENDING_MESH_JOBS)
+        {
+            return; // Too many jobs in flight, try again next frame
+        }
     }
 
-    // Place the new block
-    bool success = SetBlockAtGlobalCoords(placePos, blockType);
+    // Assignment 5 Phase 0 FIX: Pass World pointer for cross-chunk neighbor access
+    // This enables BlockIterator::GetNeighbor() to properly navigate across chunk boundaries
+    ChunkMeshJob* job = new ChunkMeshJob(chunk, this);
 
-    if (success)
+    // Add job to tracking lists
     {
-        DebuggerPrintf("Placed block type %d at (%d,%d,%d)\n", blockType, placePos.x, placePos.y, placePos.z);
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        m_chunkMeshJobs.insert(job);
     }
 
-    return success;
+    // CRITICAL FIX: Mark chunk as clean IMMEDIATELY to prevent re-queuing while job is in flight
+    // This fixes the oscillation bug where chunks alternate between bright/dark
+    chunk->SetIsMeshDirty(false);
+
+    g_jobSystem->SubmitJob(job);
 }
 
 //----------------------------------------------------------------------------------------------------
-// Asynchronous job processing methods
-//----------------------------------------------------------------------------------------------------
-
+// DispatchScheduledChunkJobs - Re-score parked generate/load jobs and fill the free in-flight slots
+//
+// Parked chunks are still ACTIVATING and owned by the scheduler, so cancelling one is just handing it
+// back to the pool. Jobs are cancelled past CHUNK_DEACTIVATION_RANGE (not the activation range) so a
+// chunk at the edge does not flicker between queued and cancelled while the player walks back and forth.
 //----------------------------------------------------------------------------------------------------
-void World::ProcessCompletedJobs()
+void World::DispatchScheduledChunkJobs(Vec3 const& cameraPos)
 {
+    // A camera jump no movement mode can produce in one frame is a teleport: time the first visible chunk
+    if (m_hasDispatchCameraPos)
+    {
+        float const jumpX = cameraPos.x - m_lastDispatchCameraPos.x;
+        float const jumpY = cameraPos.y - m_lastDispatchCameraPos.y;
+        if (jumpX * jumpX + jumpY * jumpY > TELEPORT_DETECT_DISTANCE * TELEPORT_DETECT_DISTANCE)
+        {
+            m_isTimingTeleport  = true;
+            m_teleportStartTime = std::chrono::high_resolution_clock::now();
+        }
+    }
+    m_lastDispatchCameraPos = cameraPos;
+    m_hasDispatchCameraPos  = true;
+
+    ChunkJobViewpoint viewpoint;
+    viewpoint.m_position = cameraPos;
+    viewpoint.m_forward  = GetCameraForward();
+    viewpoint.m_velocity = GetPlayerVelocity();
+
+    std::vector<ScheduledChunkJob> cancelledJobs;
+    m_chunkJobScheduler.Reprioritize(viewpoint, (float)CHUNK_DEACTIVATION_RANGE, cancelledJobs);
+    for (ScheduledChunkJob const& job : cancelledJobs)
+    {
+        m_activationFrontier.SetSlotState(job.m_chunkCoords, ChunkSlotState::MISSING);
+        ReleaseChunk(job.m_chunk);  // Null for a fresh activation: nothing was allocated
+    }
+    m_cancelledChunkJobCount += (int)cancelledJobs.size();
+
     if (g_jobSystem == nullptr) return;
 
-    // Retrieve all completed jobs from JobSystem ONCE
-    std::vector<Job*> completedJobs = g_jobSystem->RetrieveAllCompletedJobs();
+    // Fresh activations get their chunk only now that a worker slot is free for it
+    auto const getJobChunk = [this](ScheduledChunkJob const& job)
+    {
+        if (job.m_chunk != nullptr)
+        {
+            return job.m_chunk;
+        }
 
-    // Process each completed job
-    for (Job* completedJob : completedJobs)
+        Chunk* const chunk = AcquireChunk(job.m_chunkCoords);
+        chunk->SetState(ChunkState::ACTIVATING);
+        return chunk;
+    };
+
+    std::vector<ScheduledChunkJob> jobsToSubmit;
+    m_chunkJobScheduler.TakeNext(ChunkJobKind::LOAD, MAX_PENDING_LOAD_JOBS - GetPendingLoadJobCount(), jobsToSubmit);
+    for (ScheduledChunkJob const& job : jobsToSubmit)
     {
-        ChunkGenerateJob* job      = nullptr;
-        int               jobIndex = -1;
+        Chunk* const chunk = getJobChunk(job);
 
-        // Find the corresponding ChunkGenerateJob in our tracking list
+        // Refused while still ACTIVATING: park it again (its frontier slot stays PENDING), else it never loads
+        if (!SubmitChunkForLoading(chunk) && chunk->GetState() == ChunkState::ACTIVATING)
         {
-            std::lock_guard<std::mutex> lock(m_jobListsMutex);
-            for (int i = 0; i < (int)m_chunkGenerationJobs.size(); ++i)
-            {
-                if (m_chunkGenerationJobs[i] == completedJob)
-                {
-                    job      = m_chunkGenerationJobs[i];
-                    jobIndex = i;
-                    break;
-                }
-            }
+            m_chunkJobScheduler.Enqueue(chunk, ChunkJobKind::LOAD);
         }
+    }
+
+    jobsToSubmit.clear();
+    m_chunkJobScheduler.TakeNext(ChunkJobKind::GENERATE, MAX_PENDING_GENERATE_JOBS - GetPendingGenerateJobCount(), jobsToSubmit);
+    for (ScheduledChunkJob const& job : jobsToSubmit)
+    {
+        Chunk* const chunk = getJobChunk(job);
+        SubmitChunkForGeneration(chunk);
 
-        // If not a generation job, check if it's a load job
-        if (job == nullptr)
+        // Refused as a duplicate (same coordinates already generating): this copy is not needed
+        if (chunk->GetState() == ChunkState::ACTIVATING)
         {
-            // BUGFIX: Store chunk pointer before releasing mutex to prevent deadlock
-            // when calling SubmitChunkForGeneration() which also needs m_jobListsMutex
-            Chunk*        chunkToGenerate = nullptr;
-            ChunkLoadJob* loadJobToDelete = nullptr;
+            ReleaseChunk(chunk);
+        }
+    }
+}
 
-            {
-                std::lock_guard<std::mutex> lock(m_jobListsMutex);
-                for (int i = 0; i < (int)m_chunkLoadJobs.size(); ++i)
-                {
-                    if (m_chunkLoadJobs[i] == completedJob)
-                    {
-                        ChunkLoadJob* loadJob = m_chunkLoadJobs[i];
-                        Chunk*        chunk   = loadJob->GetChunk();
+//----------------------------------------------------------------------------------------------------
+void World::OnChunkMeshUploaded(Chunk const* chunk)
+{
+    if (!m_isTimingTeleport || chunk == nullptr)
+    {
+        return;
+    }
 
-                        if (chunk)
-                        {
-                            IntVec2 chunkCoords = chunk->GetChunkCoords();
+    if (GetDistanceToChunkCenter(chunk->GetChunkCoords(), GetCameraPosition()) > TELEPORT_VISIBLE_DISTANCE)
+    {
+        return;     // Leftover work from before the teleport, or the far side of the new area
+    }
 
-                            if (loadJob->WasSuccessful() && chunk->GetState() == ChunkState::LOAD_COMPLETE)
-                            {
-                                chunk->SetState(ChunkState::COMPLETE);
-                                chunk->SetDebugDraw(m_globalChunkDebugDraw); // Inherit global debug state
+    auto const teleportEndTime = std::chrono::high_resolution_clock::now();
+    m_lastTeleportFirstVisibleMs = std::chrono::duration<float, std::milli>(teleportEndTime - m_teleportStartTime).count();
+    m_isTimingTeleport           = false;
+
+    DebuggerPrintf("[CHUNK SCHEDULER] Teleport: first chunk visible after %.1f ms (%d jobs cancelled so far)\n",
+                   m_lastTeleportFirstVisibleMs, m_cancelledChunkJobCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Flood fill light engine; the channel rules (GetLightSourceLevel() etc.) are shared with ChunkLightJob
+//----------------------------------------------------------------------------------------------------
+int constexpr LIGHT_STEPS_PER_TIME_CHECK = 64;     // Power of two
+
+static IntVec3 const LIGHT_NEIGHBOR_OFFSETS[6] = {
+    IntVec3(1, 0, 0),   // East
+    IntVec3(-1, 0, 0),  // West
+    IntVec3(0, 1, 0),   // North
+    IntVec3(0, -1, 0),  // South
+    IntVec3(0, 0, 1),   // Up
+    IntVec3(0, 0, -1)   // Down
+};
 
-                                {
-                                    std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
-                                    m_nonActiveChunks.erase(chunk);
-                                }
+//----------------------------------------------------------------------------------------------------
+static uint8_t GetChannelLight(BlockPtr const& block, LightChannel const channel)
+{
+    return (channel == LightChannel::OUTDOOR) ? block->GetOutdoorLight() : block->GetIndoorLight();
+}
 
-                                {
-                                    std::lock_guard<std::mutex> activeLock(m_activeChunksMutex);
-                                    m_activeChunks[chunkCoords] = chunk;
-                                }
+//----------------------------------------------------------------------------------------------------
+// Writes the nibble directly: the removal BFS clears outdoor light by design, which SetOutdoorLight()'s
+// bug-hunt log would report for every block
+//----------------------------------------------------------------------------------------------------
+static void SetChannelLight(BlockPtr const& block, LightChannel const channel, uint8_t const light)
+{
+    uint8_t& lightingData = block->m_lightingData;
+    if (channel == LightChannel::OUTDOOR)
+    {
+        lightingData = (uint8_t)((lightingData & 0x0F) | ((light & 0x0F) << 4));
+    }
+    else
+    {
+        lightingData = (uint8_t)((lightingData & 0xF0) | (light & 0x0F));
+    }
+}
 
-                                UpdateNeighborPointers(chunkCoords);
+//----------------------------------------------------------------------------------------------------
+// Assignment 5 Phase 4: Add block to dirty light queue for recalculation
+//----------------------------------------------------------------------------------------------------
+void World::AddToDirtyLightQueue(BlockIterator const& blockIter)
+{
+    if (!blockIter.IsValid()) return;
 
-                                // Assignment 5 Phase 6: Trigger cross-chunk lighting propagation
-                                chunk->OnActivate(this);  // CRITICAL: Re-enabled for loaded chunks
+    // Assignment 5 Phase 7: duplicate detection prevents infinite propagation loops
+    // Add to back of queue (FIFO order), unless the block already carries BLOCK_FLAG_LIGHT_QUEUED
+    m_dirtyLightQueue.Push(blockIter.GetChunk(), blockIter.GetBlockIndex());
+}
 
-                                // NOTE: Do NOT call SetIsMeshDirty(true) here!
-                                // The deferred mesh rebuild system will mark this chunk dirty
-                                // AFTER lighting stabilizes via ProcessDirtyChunkMeshes()
-                            }
-                            else
-                            {
-                                {
-                                    std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
-                                    m_nonActiveChunks.erase(chunk);
-                                }
-
-                                chunk->SetState(ChunkState::ACTIVATING);
-                                // Store chunk for generation AFTER releasing mutex
-                                chunkToGenerate = chunk;
-                            }
-                        }
+//----------------------------------------------------------------------------------------------------
+// Assignment 5 Phase 4: Process dirty light queue with time budget
+//
+// Flood fill engine (default). Each step takes the first available of:
+// 1. Removal BFS  - a cleared block clears the neighbors it lit; neighbors lit from elsewhere and light
+//                   sources become the addition frontier
+// 2. Dirty block  - brighter than its neighbors and sources allow: clear it and start a removal;
+//                   darker: raise it and start an addition
+// 3. Addition BFS - raise darker neighbors that can receive light, one level dimmer
+// Removals run before additions, so light refilled from the frontier is never cleared again, and each
+// block is visited once per change instead of re-evaluated until its neighborhood stops changing.
+// With the flood fill disabled, dirty blocks go through RecalculateBlockLighting() (influence map).
+// With parallel lighting, dirty blocks are handed to ChunkLightJobs instead (DispatchChunkLightJobs());
+// the loop below then only finishes flood fills that were already running on the main thread.
+// The queues persist across frames; HasPendingLightWork() stays true until all of them are empty.
+//----------------------------------------------------------------------------------------------------
+void World::ProcessDirtyLighting(float const maxTimeSeconds)
+{
+    if (!HasPendingLightWork()) return;
 
-                        m_chunkLoadJobs.erase(m_chunkLoadJobs.begin() + i);
-                        loadJobToDelete = loadJob;
-                        job = reinterpret_cast<ChunkGenerateJob*>(1); // Mark as processed
-                        break;
-                    }
-                }
-            } // Release m_jobListsMutex here
+    // Start timer
+    double const startTime = Clock::GetSystemClock().GetTotalSeconds();
 
-            // BUGFIX: Call SubmitChunkForGeneration AFTER releasing mutex
-            // to prevent deadlock (SubmitChunkForGeneration also locks m_jobListsMutex)
-            if (chunkToGenerate != nullptr)
-            {
-                SubmitChunkForGeneration(chunkToGenerate);
-            }
+    // Mesh rebuild tracking restarts every call (ProcessDirtyChunkMeshes may have consumed the set since)
+    m_lastLightChangedChunk = nullptr;
 
-            // Clean up after mutex is released
-            if (loadJobToDelete != nullptr)
-            {
-                delete loadJobToDelete;
-            }
-        }
+    if (m_useFloodFillLighting && m_useParallelLighting && g_jobSystem != nullptr)
+    {
+        DispatchChunkLightJobs();
+    }
+    else if (!m_pendingChunkLight.empty())
+    {
+        ReturnPendingChunkLightToQueue();
+    }
 
-        // If not a load job either, check if it's a mesh job
-        if (job == nullptr)
+    int stepCount = 0;
+    while (HasQueuedLightWork())
+    {
+        // Check time budget (every few steps: a flood fill step costs less than reading the clock)
+        if ((stepCount++ & (LIGHT_STEPS_PER_TIME_CHECK - 1)) == 0)
         {
-            std::lock_guard<std::mutex> lock(m_jobListsMutex);
-            for (int i = 0; i < (int)m_chunkMeshJobs.size(); ++i)
+            double const elapsedTime = Clock::GetSystemClock().GetTotalSeconds() - startTime;
+            if (elapsedTime >= maxTimeSeconds)
             {
-                if (m_chunkMeshJobs[i] == completedJob)
-                {
-                    ChunkMeshJob* meshJob = m_chunkMeshJobs[i];
-                    Chunk*        chunk   = meshJob->GetChunk();
-
-                    if (meshJob->WasSuccessful())
-                    {
-                        // Apply mesh data on main thread (CPU data only)
-                        meshJob->ApplyMeshDataToChunk();
-
-                        // Now perform DirectX operations on main thread
-                        chunk->UpdateVertexBuffer();
-                        chunk->SetMeshClean();
-                    }
-
-                    m_chunkMeshJobs.erase(m_chunkMeshJobs.begin() + i);
-                    delete meshJob;
-                    job = reinterpret_cast<ChunkGenerateJob*>(1); // Mark as processed
-                    break;
-                }
+                break;  // Time budget exhausted
             }
         }
 
-        // If not a mesh job either, check if it's a save job
-        if (job == nullptr)
+        // 1. Removal BFS
+        bool didRemoval = false;
+        for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT && !didRemoval; ++channelIndex)
         {
-            std::lock_guard<std::mutex> lock(m_jobListsMutex);
-            for (int i = 0; i < (int)m_chunkSaveJobs.size(); ++i)
+            std::deque<LightRemovalNode>& removalQueue = m_lightRemovalQueues[channelIndex];
+            if (!removalQueue.empty())
             {
-                if (m_chunkSaveJobs[i] == completedJob)
-                {
-                    ChunkSaveJob* saveJob = m_chunkSaveJobs[i];
-                    Chunk*        chunk   = saveJob->GetChunk();
-
-                    if (chunk)
-                    {
-                        {
-                            std::lock_guard<std::mutex> nonActiveLock(m_nonActiveChunksMutex);
-                            m_nonActiveChunks.erase(chunk);
-                        }
-
-                        delete chunk;
-                    }
-
-                    m_chunkSaveJobs.erase(m_chunkSaveJobs.begin() + i);
-                    delete saveJob;
-                    job = reinterpret_cast<ChunkGenerateJob*>(1); // Mark as processed
-                    break;
-                }
+                LightRemovalNode const node = removalQueue.front();
+                removalQueue.pop_front();
+                ProcessLightRemoval((LightChannel)channelIndex, node);
+                didRemoval = true;
             }
         }
+        if (didRemoval) continue;
 
-        if (job == nullptr)
+        // 2. Dirty block (FIFO order)
+        Chunk* dirtyChunk      = nullptr;
+        int    dirtyBlockIndex = 0;
+        if (m_dirtyLightQueue.Pop(dirtyChunk, dirtyBlockIndex))
         {
-            continue; // Not any of our job types
-        }
-
-        // If job is a real ChunkGenerateJob pointer (not marker), process it
-        if (job != reinterpret_cast<ChunkGenerateJob*>(1))
-        {
-            Chunk* chunk = job->GetChunk();
-            if (!chunk)
-            {
-                // Clean up invalid job
-                {
-                    std::lock_guard<std::mutex> lock(m_jobListsMutex);
-                    m_chunkGenerationJobs.erase(m_chunkGenerationJobs.begin() + jobIndex);
-                }
-                delete job;
-                continue;
-            }
-
-            IntVec2 chunkCoords = chunk->GetChunkCoords();
+            BlockIterator const blockIter(dirtyChunk, dirtyBlockIndex, this);
 
-            // Verify the chunk is in the expected state
-            if (chunk->GetState() == ChunkState::LIGHTING_INITIALIZING)
+            if (m_useFloodFillLighting)
             {
-                // Job completed successfully - handle lighting initialization on main thread
-                // For now, just transition to COMPLETE state
-                chunk->SetState(ChunkState::COMPLETE);
-                chunk->SetDebugDraw(m_globalChunkDebugDraw); // Inherit global debug state
-
-                // Remove from non-active chunks, add to active chunks
-                {
-                    std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
-                    m_nonActiveChunks.erase(chunk);
-                }
-
-                {
-                    std::lock_guard<std::mutex> lock(m_activeChunksMutex);
-                    if (m_activeChunks.find(chunkCoords) == m_activeChunks.end())
-                    {
-                        m_activeChunks[chunkCoords] = chunk;
-                    }
-                }
-
-                // Update neighbor pointers (needs active chunks mutex, but UpdateNeighborPointers handles it)
-                UpdateNeighborPointers(chunkCoords);
-
-                // Remove from queued chunks
-                {
-                    std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
-                    m_queuedGenerateChunks.erase(chunkCoords);
-                }
-
-                // Assignment 5 Phase 6: Trigger cross-chunk lighting propagation FIRST
-                // This queues edge blocks for lighting propagation
-                chunk->OnActivate(this);
-
-                // NOTE: Do NOT call SetIsMeshDirty(true) here!
-                // The deferred mesh rebuild system will mark this chunk dirty
-                // AFTER lighting stabilizes via ProcessDirtyChunkMeshes()
+                SeedLightFloodFill(blockIter);
             }
             else
             {
-                // Job completed but chunk is in unexpected state - handle error
-                // This could happen if the job failed or chunk was modified externally
-                // For now, we'll clean up and let the chunk be retried later
-
-                // Remove from non-active chunks
-                {
-                    std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
-                    m_nonActiveChunks.erase(chunk);
-                }
-
-                // Remove from queued chunks
-                {
-                    std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
-                    m_queuedGenerateChunks.erase(chunkCoords);
-                }
-
-                // Reset chunk to ACTIVATING state so it can be retried
-                chunk->SetState(ChunkState::ACTIVATING);
+                // Assignment 5 Phase 5: Recalculate lighting for this block
+                RecalculateBlockLighting(blockIter);
             }
+            continue;
+        }
 
-            // Clean up the job
+        // 3. Addition BFS
+        for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
+        {
+            std::deque<BlockIterator>& additionQueue = m_lightAdditionQueues[channelIndex];
+            if (!additionQueue.empty())
             {
-                std::lock_guard<std::mutex> lock(m_jobListsMutex);
-                m_chunkGenerationJobs.erase(m_chunkGenerationJobs.begin() + jobIndex);
+                BlockIterator const blockIter = additionQueue.front();
+                additionQueue.pop_front();
+                ProcessLightAddition((LightChannel)channelIndex, blockIter);
+                break;
             }
-            delete job;
-        } // End if (job is real ChunkGenerateJob)
+        }
     }
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::ProcessDirtyChunkMeshes()
+bool World::HasPendingLightWork() const
 {
-    // CRITICAL FIX: Don't rebuild meshes while light propagation is in progress
-    // This prevents "progressive brightening" bug where chunks appear dark and gradually brighten
-    // as light propagates from neighboring chunks
-    if (!m_dirtyLightQueue.empty())
-    {
-        return;  // Don't rebuild any meshes until light queue is empty
-    }
+    return HasQueuedLightWork() || !m_pendingChunkLight.empty() || !m_lightJobByChunk.empty();
+}
 
-    // Assignment 5 Phase 10 FIX: Lighting queue is now empty (lighting has stabilized)
-    // Mark all chunks with changed lighting as mesh-dirty so they rebuild with correct lighting
-    // This fixes the "inconsistent nighttime lighting" bug where some chunks stay bright
+//----------------------------------------------------------------------------------------------------
+bool World::HasQueuedLightWork() const
+{
+    if (!m_dirtyLightQueue.IsEmpty()) return true;    // May hold only stale entries; the next Pop() discards them
+
+    for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
     {
-        std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
-        if (!m_chunksNeedingMeshRebuild.empty())
+        if (!m_lightRemovalQueues[channelIndex].empty() || !m_lightAdditionQueues[channelIndex].empty())
         {
-            for (Chunk* chunk : m_chunksNeedingMeshRebuild)
-            {
-                if (chunk)
-                {
-                    chunk->SetIsMeshDirty(true);
-                }
-            }
-            m_chunksNeedingMeshRebuild.clear();
+            return true;
         }
     }
+    return false;
+}
 
-    Vec3 cameraPos = GetCameraPosition();
+//----------------------------------------------------------------------------------------------------
+// DispatchChunkLightJobs - Bucket dirty blocks per chunk, then start a ChunkLightJob for every chunk
+// with pending seeds or border deltas and no job in flight
+//
+// A chunk whose job is still running keeps collecting; its next job snapshots the light the running one
+// committed. Neighboring chunks' jobs may run at the same time, so a job can read a halo that is one round
+// stale; the border deltas of the other job reach it in the next round and correct it. Light settles once
+// a round produces no deltas.
+//----------------------------------------------------------------------------------------------------
+void World::DispatchChunkLightJobs()
+{
+    Chunk* dirtyChunk      = nullptr;
+    int    dirtyBlockIndex = 0;
+    while (m_dirtyLightQueue.Pop(dirtyChunk, dirtyBlockIndex))
+    {
+        // Released chunks are skipped by Pop()
+        if (!dirtyChunk->IsComplete()) continue;
 
-    // Find up to 2 dirty chunks closest to camera
-    std::vector<std::pair<float, Chunk*>> dirtyChunksWithDistance;
+        m_pendingChunkLight[dirtyChunk].m_seedIndices.push_back(dirtyBlockIndex);
+    }
 
+    for (auto it = m_pendingChunkLight.begin(); it != m_pendingChunkLight.end();)
     {
-        std::lock_guard<std::mutex> lock(m_activeChunksMutex);
-        for (auto const& chunkPair : m_activeChunks)
+        if ((int)m_lightJobByChunk.size() >= MAX_PENDING_LIGHT_JOBS)
         {
-            Chunk* chunk = chunkPair.second;
-            if (chunk && chunk->GetIsMeshDirty() && chunk->GetState() == ChunkState::COMPLETE)
-            {
-                float distance = GetDistanceToChunkCenter(chunk->GetChunkCoords(), cameraPos);
-                dirtyChunksWithDistance.emplace_back(distance, chunk);
-            }
+            break;  // Too many jobs in flight, try again next frame
         }
-    }
-
-    // Sort by distance (closest first)
-    std::sort(dirtyChunksWithDistance.begin(), dirtyChunksWithDistance.end());
 
-    // Rebuild mesh for up to 2 closest dirty chunks
-    int meshesRebuilt = 0;
-    for (auto const& pair : dirtyChunksWithDistance)
-    {
-        if (meshesRebuilt >= 2)
+        Chunk* chunk = it->first;
+        if (m_lightJobByChunk.find(chunk) != m_lightJobByChunk.end())
         {
-            break;
+            ++it;
+            continue;
+        }
+        if (!chunk->IsComplete())
+        {
+            it = m_pendingChunkLight.erase(it);
+            continue;
         }
 
-        Chunk* chunk = pair.second;
+        ChunkLightJob* job = new ChunkLightJob(chunk, it->second.m_seedIndices, it->second.m_incomingDeltas);
+        it = m_pendingChunkLight.erase(it);
 
-        // Assignment 5 Phase 0 (Hidden Surface Removal): Only construct meshes for chunks with all 4 neighbors active
-        // This prevents rendering incomplete chunk edges (blackness underwater/underground)
-        // Reference: A5 specification line 97: "Only construct meshes for chunks with all 4 neighbors active"
-        IntVec2 chunkCoords = chunk->GetChunkCoords();
-        bool allNeighborsActive = true;
         {
-            std::lock_guard<std::mutex> lock(m_activeChunksMutex);
+            std::lock_guard<std::mutex> lock(m_jobListsMutex);
+            m_chunkLightJobs.insert(job);
+        }
+        m_lightJobByChunk[chunk] = job;
 
-            // Check all 4 horizontal neighbors (East, West, North, South)
-            IntVec2 neighborOffsets[4] = {
-                IntVec2(1, 0),   // East
-                IntVec2(-1, 0),  // West
-                IntVec2(0, 1),   // North
-                IntVec2(0, -1)   // South
-            };
+        g_jobSystem->SubmitJob(job);
+    }
+}
 
-            for (int i = 0; i < 4; ++i)
-            {
-                IntVec2 neighborCoords = chunkCoords + neighborOffsets[i];
-                auto iter = m_activeChunks.find(neighborCoords);
-                if (iter == m_activeChunks.end() || iter->second == nullptr ||
-                    iter->second->GetState() != ChunkState::COMPLETE)
-                {
-                    allNeighborsActive = false;
-                    break;
-                }
-            }
-        }
+//----------------------------------------------------------------------------------------------------
+// ReturnPendingChunkLightToQueue - Hand collected seeds and border deltas to the main-thread flood fill
+//
+// A border delta names a block next to light its neighbor's job already committed, so SeedLightFloodFill()
+// comparing that block against its neighborhood does the same work the delta would have started.
+//----------------------------------------------------------------------------------------------------
+void World::ReturnPendingChunkLightToQueue()
+{
+    for (auto const& pendingPair : m_pendingChunkLight)
+    {
+        Chunk* chunk = pendingPair.first;
+        if (!chunk->IsComplete()) continue;
 
-        // Only submit chunk for mesh generation if all 4 neighbors are active
-        if (allNeighborsActive)
+        for (int const blockIndex : pendingPair.second.m_seedIndices)
         {
-            // Submit mesh generation job instead of rebuilding on main thread
-            SubmitChunkForMeshGeneration(chunk);
-            ++meshesRebuilt;
+            AddToDirtyLightQueue(BlockIterator(chunk, blockIndex, this));
+        }
+        for (LightBorderDelta const& delta : pendingPair.second.m_incomingDeltas)
+        {
+            AddToDirtyLightQueue(BlockIterator(chunk, delta.m_blockIndex, this));
         }
-        // If neighbors not ready, leave chunk marked as dirty - it will be retried next frame
     }
+    m_pendingChunkLight.clear();
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::SubmitChunkForGeneration(Chunk* chunk)
+// HandleCompletedLightJob - Commit the job's light and route its border deltas to the neighbor chunks
+//----------------------------------------------------------------------------------------------------
+void World::HandleCompletedLightJob(ChunkLightJob* job)
 {
-    if (!chunk)
+    Chunk* chunk = job->GetChunk();
+
+    auto const jobIt = m_lightJobByChunk.find(chunk);
+    if (jobIt != m_lightJobByChunk.end() && jobIt->second == job)
+    {
+        m_lightJobByChunk.erase(jobIt);
+    }
+
+    // Cancelled: the chunk was deactivated (and may have been recycled) while the job ran
+    if (job->IsCancelled() || !chunk->IsComplete() || chunk->GetChunkCoords() != job->GetChunkCoords())
     {
+        delete job;
         return;
     }
 
-    if (g_jobSystem == nullptr) return;
+    job->ApplyLightToChunk();
+    if (!job->GetLightChanges().empty())
+    {
+        m_lightPropagationStats.m_changedLightCount += (int64_t)job->GetLightChanges().size();
 
-    IntVec2 chunkCoords = chunk->GetChunkCoords();
+        std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
+        m_chunksNeedingMeshRebuild.insert(chunk);
+    }
 
-    // Check if we've reached the maximum number of pending generation jobs
+    IntVec2 const borderOffsets[CHUNK_BORDER_COUNT] = {
+        IntVec2(1, 0),   // East
+        IntVec2(-1, 0),  // West
+        IntVec2(0, 1),   // North
+        IntVec2(0, -1)   // South
+    };
+    for (int borderIndex = 0; borderIndex < CHUNK_BORDER_COUNT; ++borderIndex)
     {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        if ((int)m_chunkGenerationJobs.size() >= MAX_PENDING_GENERATE_JOBS)
-        {
-            return; // Too many jobs in flight, try again next frame
-        }
+        std::vector<LightBorderDelta> const& deltas = job->GetOutgoingDeltas((ChunkBorder)borderIndex);
+        if (deltas.empty()) continue;
+
+        Chunk* neighbor = GetChunk(job->GetChunkCoords() + borderOffsets[borderIndex]);
+        if (neighbor == nullptr || !neighbor->IsComplete()) continue;
+
+        std::vector<LightBorderDelta>& incomingDeltas = m_pendingChunkLight[neighbor].m_incomingDeltas;
+        incomingDeltas.insert(incomingDeltas.end(), deltas.begin(), deltas.end());
+        m_lightPropagationStats.m_borderDeltaCount += (int64_t)deltas.size();
     }
 
-    // Check if chunk is already queued for generation (with mutex protection)
+    ++m_lightPropagationStats.m_lightJobCount;
+    m_lightPropagationStats.m_seedCount          += job->GetSeedCount();
+    m_lightPropagationStats.m_removalVisitCount  += job->GetRemovalVisitCount();
+    m_lightPropagationStats.m_additionVisitCount += job->GetAdditionVisitCount();
+    m_lightPropagationStats.m_lightJobSeconds    += job->GetExecuteSeconds();
+
+    delete job;
+}
+
+//----------------------------------------------------------------------------------------------------
+// DrainLightWork - Propagate until no light work is pending, waiting for in-flight ChunkLightJobs
+// Blocking (benchmarks only); other completed jobs are handled along the way
+//----------------------------------------------------------------------------------------------------
+void World::DrainLightWork()
+{
+    float constexpr UNLIMITED_SECONDS = 3600.f;
+
+    ProcessDirtyLighting(UNLIMITED_SECONDS);
+    while (HasPendingLightWork())
     {
-        std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
-        if (m_queuedGenerateChunks.find(chunkCoords) != m_queuedGenerateChunks.end())
-        {
-            return; // Already queued
-        }
+        std::this_thread::yield();
+        ProcessCompletedJobs();
+        ProcessDirtyLighting(UNLIMITED_SECONDS);
     }
+}
 
-    // Set chunk state and submit job
-    if (chunk->CompareAndSetState(ChunkState::ACTIVATING, ChunkState::TERRAIN_GENERATING))
+//----------------------------------------------------------------------------------------------------
+// SeedLightFloodFill - Compare a dirty block against what its sources and neighbors allow, per channel
+//
+// Darker than allowed: raise it, then spread from it. Brighter: its light may have come from a block
+// that changed, so clear it down to its own source light and start a removal with the old value.
+// Unchanged but lit: spread anyway, so a lit block next to a newly activated chunk fills its dark edge.
+//----------------------------------------------------------------------------------------------------
+void World::SeedLightFloodFill(BlockIterator const& blockIter)
+{
+    if (!blockIter.IsValid()) return;
+
+    // Queue entries can outlive their chunk's activation; pooled chunks are recycled in place
+    if (!blockIter.GetChunk()->IsComplete()) return;
+
+    BlockPtr block = blockIter.GetBlock();
+    if (!block) return;
+
+    sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
+    if (!blockDef) return;
+
+    ++m_lightPropagationStats.m_seedCount;
+
+    for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
     {
-        ChunkGenerateJob* job = new ChunkGenerateJob(chunk);
+        LightChannel const channel      = (LightChannel)channelIndex;
+        uint8_t const      currentLight = GetChannelLight(block, channel);
+        uint8_t const      localLight   = ComputeLocalLight(channel, blockIter, block);
 
-        // Add chunk to non-active chunks (being processed by worker thread)
+        if (localLight < currentLight)
         {
-            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
-            m_nonActiveChunks.insert(chunk);
-        }
+            uint8_t const sourceLight = GetLightSourceLevel(channel, blockDef, block->m_bitFlags);
+            SetChannelLight(block, channel, sourceLight);
+            NoteLightChanged(blockIter.GetChunk());
+            m_lightRemovalQueues[channelIndex].push_back(LightRemovalNode{blockIter, currentLight});
 
-        // Add job to tracking lists
+            if (sourceLight > 0)
+            {
+                m_lightAdditionQueues[channelIndex].push_back(blockIter);
+            }
+        }
+        else if (localLight > currentLight)
         {
-            std::lock_guard<std::mutex> lock(m_jobListsMutex);
-            m_chunkGenerationJobs.push_back(job);
+            SetChannelLight(block, channel, localLight);
+            NoteLightChanged(blockIter.GetChunk());
+            m_lightAdditionQueues[channelIndex].push_back(blockIter);
         }
-
-        // Mark as queued
+        else if (currentLight > 1)
         {
-            std::lock_guard<std::mutex> lock(m_queuedChunksMutex);
-            m_queuedGenerateChunks.insert(chunkCoords);
+            m_lightAdditionQueues[channelIndex].push_back(blockIter);
         }
-
-        g_jobSystem->SubmitJob(job);
     }
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::SubmitChunkForLoading(Chunk* chunk)
+// ProcessLightRemoval - Clear the neighbors that may have been lit through a cleared block
+//
+// A receiving neighbor dimmer than the cleared block's old light can have been lit through it, so it is
+// cleared and continues the removal. Anything at least as bright, and any light source, is lit from
+// elsewhere: it joins the addition frontier that refills the cleared region.
+//----------------------------------------------------------------------------------------------------
+void World::ProcessLightRemoval(LightChannel const channel, LightRemovalNode const& node)
 {
-    if (!chunk)
-    {
-        return;
-    }
+    if (!node.m_blockIter.IsValid() || !node.m_blockIter.GetChunk()->IsComplete()) return;
 
-    if (g_jobSystem == nullptr) return;
+    ++m_lightPropagationStats.m_removalVisitCount;
 
-    // Check if we've reached the maximum number of pending load jobs
+    for (IntVec3 const& neighborOffset : LIGHT_NEIGHBOR_OFFSETS)
     {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        if ((int)m_chunkLoadJobs.size() >= MAX_PENDING_LOAD_JOBS)
-        {
-            return; // Too many load jobs in flight, try again next frame
-        }
-    }
+        BlockIterator const neighborIter = node.m_blockIter.GetNeighbor(neighborOffset);
+        if (!neighborIter.IsValid() || !neighborIter.GetChunk()->IsComplete()) continue;
 
-    // Set chunk state and submit I/O job
-    if (chunk->CompareAndSetState(ChunkState::ACTIVATING, ChunkState::LOADING))
-    {
-        ChunkLoadJob* job = new ChunkLoadJob(chunk);
+        BlockPtr neighborBlock = neighborIter.GetBlock();
+        if (!neighborBlock) continue;
 
-        // Add chunk to non-active chunks (being processed by I/O worker thread)
+        uint8_t const neighborLight = GetChannelLight(neighborBlock, channel);
+        if (neighborLight == 0) continue;
+
+        sBlockDefinition const* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
+        if (!neighborDef) continue;
+
+        if (neighborLight < node.m_oldLight && CanBlockReceiveLight(channel, neighborDef, neighborBlock->m_bitFlags))
         {
-            std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
-            m_nonActiveChunks.insert(chunk);
+            SetChannelLight(neighborBlock, channel, 0);
+            NoteLightChanged(neighborIter.GetChunk());
+            m_lightRemovalQueues[(int)channel].push_back(LightRemovalNode{neighborIter, neighborLight});
         }
-
-        // Add job to tracking lists
+        else
         {
-            std::lock_guard<std::mutex> lock(m_jobListsMutex);
-            m_chunkLoadJobs.push_back(job);
+            m_lightAdditionQueues[(int)channel].push_back(neighborIter);
         }
-
-        g_jobSystem->SubmitJob(job);
     }
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::SubmitChunkForSaving(Chunk* chunk)
+// ProcessLightAddition - Raise receiving neighbors to one level below this block's light
+//
+// Light is read when the block is popped, not when it was queued: a removal that ran in between
+// has already cleared it and queued its own frontier.
+//----------------------------------------------------------------------------------------------------
+void World::ProcessLightAddition(LightChannel const channel, BlockIterator const& blockIter)
 {
-    if (!chunk)
-    {
-        return;
-    }
+    if (!blockIter.IsValid() || !blockIter.GetChunk()->IsComplete()) return;
 
-    if (g_jobSystem == nullptr)
-    {
-        // Can't save asynchronously, delete chunk
-        delete chunk;
-        return;
-    }
+    BlockPtr block = blockIter.GetBlock();
+    if (!block) return;
 
-    // Check if we've reached the maximum number of pending save jobs
-    {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        if ((int)m_chunkSaveJobs.size() >= MAX_PENDING_SAVE_JOBS)
-        {
-            // Too many save jobs in flight, save synchronously (fallback)
-            chunk->SaveToDisk();
-            delete chunk;
-            return;
-        }
-    }
+    ++m_lightPropagationStats.m_additionVisitCount;
 
-    // Set chunk state and submit I/O job
-    chunk->SetState(ChunkState::SAVING);
+    uint8_t const light = GetChannelLight(block, channel);
+    if (light <= 1) return;
 
-    ChunkSaveJob* job = new ChunkSaveJob(chunk);
+    sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
+    if (!blockDef || !CanBlockProvideLight(channel, blockDef)) return;
 
-    // Add chunk to non-active chunks (being processed by I/O worker thread)
+    uint8_t const propagatedLight = light - 1;
+    for (IntVec3 const& neighborOffset : LIGHT_NEIGHBOR_OFFSETS)
     {
-        std::lock_guard<std::mutex> lock(m_nonActiveChunksMutex);
-        m_nonActiveChunks.insert(chunk);
-    }
+        BlockIterator const neighborIter = blockIter.GetNeighbor(neighborOffset);
+        if (!neighborIter.IsValid() || !neighborIter.GetChunk()->IsComplete()) continue;
 
-    // Add job to tracking lists
-    {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        m_chunkSaveJobs.push_back(job);
-    }
+        BlockPtr neighborBlock = neighborIter.GetBlock();
+        if (!neighborBlock || GetChannelLight(neighborBlock, channel) >= propagatedLight) continue;
 
-    g_jobSystem->SubmitJob(job);
-    chunk->SetIsMeshDirty(false);
+        sBlockDefinition const* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
+        if (!neighborDef || !CanBlockReceiveLight(channel, neighborDef, neighborBlock->m_bitFlags)) continue;
+
+        SetChannelLight(neighborBlock, channel, propagatedLight);
+        NoteLightChanged(neighborIter.GetChunk());
+        m_lightAdditionQueues[(int)channel].push_back(neighborIter);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
-void World::SubmitChunkForMeshGeneration(Chunk* chunk)
+// ComputeLocalLight - The value RecalculateBlockLighting() would assign from the current neighbors
+//----------------------------------------------------------------------------------------------------
+uint8_t World::ComputeLocalLight(LightChannel const channel, BlockIterator const& blockIter, BlockPtr const& block) const
 {
-    if (!chunk)
+    sBlockDefinition const* blockDef = sBlockDefinition::GetDefinitionByIndex(block->m_typeIndex);
+    if (!blockDef) return 0;
+
+    if (!CanBlockReceiveLight(channel, blockDef, block->m_bitFlags))
     {
-        return;
+        return GetLightSourceLevel(channel, blockDef, block->m_bitFlags);
     }
 
-    if (g_jobSystem == nullptr) return;
-
-    // Check if we've reached the maximum number of pending mesh jobs
+    uint8_t localLight = 0;
+    for (IntVec3 const& neighborOffset : LIGHT_NEIGHBOR_OFFSETS)
     {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        if ((int)m_chunkMeshJobs.size() >= MAX_PENDING_MESH_JOBS)
+        BlockIterator const neighborIter = blockIter.GetNeighbor(neighborOffset);
+        if (!neighborIter.IsValid()) continue;
+
+        BlockPtr neighborBlock = neighborIter.GetBlock();
+        if (!neighborBlock) continue;
+
+        uint8_t const neighborLight = GetChannelLight(neighborBlock, channel);
+        if (neighborLight <= localLight + 1) continue;
+
+        sBlockDefinition const* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
+        if (neighborDef && CanBlockProvideLight(channel, neighborDef))
         {
-            return; // Too many jobs in flight, try again next frame
+            localLight = neighborLight - 1;
         }
     }
+    return localLight;
+}
 
-    // Assignment 5 Phase 0 FIX: Pass World pointer for cross-chunk neighbor access
-    // This enables BlockIterator::GetNeighbor() to properly navigate across chunk boundaries
-    ChunkMeshJob* job = new ChunkMeshJob(chunk, this);
-
-    // Add job to tracking lists
-    {
-        std::lock_guard<std::mutex> lock(m_jobListsMutex);
-        m_chunkMeshJobs.push_back(job);
-    }
+//----------------------------------------------------------------------------------------------------
+// NoteLightChanged - Defer the chunk's mesh rebuild until lighting settles (see m_chunksNeedingMeshRebuild)
+// Consecutive changes mostly hit the same chunk, so the set is only locked when the chunk changes
+//----------------------------------------------------------------------------------------------------
+void World::NoteLightChanged(Chunk* chunk)
+{
+    ++m_lightPropagationStats.m_changedLightCount;
 
-    // CRITICAL FIX: Mark chunk as clean IMMEDIATELY to prevent re-queuing while job is in flight
-    // This fixes the oscillation bug where chunks alternate between bright/dark
-    chunk->SetIsMeshDirty(false);
+    if (chunk == nullptr || chunk == m_lastLightChangedChunk) return;
+    m_lastLightChangedChunk = chunk;
 
-    g_jobSystem->SubmitJob(job);
+    std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
+    m_chunksNeedingMeshRebuild.insert(chunk);
 }
 
 //----------------------------------------------------------------------------------------------------
-// Assignment 5 Phase 4: Add block to dirty light queue for recalculation
+// DropChunkLightWork - Forget all light work of a chunk that leaves the active set (deactivated or restaged)
+//
+// Cancels its ChunkLightJob (the results are dropped on retrieval), and removes its collected seeds,
+// its dirty queue entries with their queued bits, and its flood fill entries.
 //----------------------------------------------------------------------------------------------------
-void World::AddToDirtyLightQueue(BlockIterator const& blockIter)
+void World::DropChunkLightWork(Chunk* chunk)
 {
-    if (!blockIter.IsValid()) return;
-
-    // Assignment 5 Phase 7: O(1) duplicate detection using std::unordered_set
-    // Check if block is already in the set - prevents infinite propagation loops
-    if (m_dirtyLightSet.find(blockIter) != m_dirtyLightSet.end())
+    auto const lightJobIt = m_lightJobByChunk.find(chunk);
+    if (lightJobIt != m_lightJobByChunk.end())
     {
-        return;  // Already queued, skip
+        lightJobIt->second->Cancel();
+        m_lightJobByChunk.erase(lightJobIt);
     }
+    m_pendingChunkLight.erase(chunk);
 
-    // Add to tracking set for O(1) duplicate detection
-    m_dirtyLightSet.insert(blockIter);
-
-    // Add to back of queue (FIFO order)
-    m_dirtyLightQueue.push_back(blockIter);
+    m_dirtyLightQueue.ReleaseChunk(chunk);
+    PurgeFloodFillQueues(chunk);
 }
 
 //----------------------------------------------------------------------------------------------------
-// Assignment 5 Phase 4: Process dirty light queue with time budget
+// PurgeFloodFillQueues - Drop the flood fill entries that point into a chunk leaving the world
+//
+// Entries hold the Chunk pointer, and a pooled chunk can come back COMPLETE at other coordinates
+// (ChunkCache restore), so IsComplete() alone cannot tell a stale entry from a live one.
 //----------------------------------------------------------------------------------------------------
-void World::ProcessDirtyLighting(float const maxTimeSeconds)
+void World::PurgeFloodFillQueues(Chunk const* chunk)
 {
-    if (m_dirtyLightQueue.empty()) return;
-
-    // Start timer
-    double const startTime = Clock::GetSystemClock().GetTotalSeconds();
-
-    // Process blocks until time budget exhausted or queue empty
-    while (!m_dirtyLightQueue.empty())
+    for (int channelIndex = 0; channelIndex < LIGHT_CHANNEL_COUNT; ++channelIndex)
     {
-        // Check time budget
-        double const currentTime = Clock::GetSystemClock().GetTotalSeconds();
-        double const elapsedTime = currentTime - startTime;
-
-        if (elapsedTime >= maxTimeSeconds)
-        {
-            break;  // Time budget exhausted
-        }
-
-        // Pop block from front of queue (FIFO order)
-        BlockIterator blockIter = m_dirtyLightQueue.front();
-        m_dirtyLightQueue.pop_front();
-
-        // Assignment 5 Phase 7: Remove from tracking set (block is now being processed)
-        m_dirtyLightSet.erase(blockIter);
-
-        // Assignment 5 Phase 5: Recalculate lighting for this block
-        RecalculateBlockLighting(blockIter);
+        std::erase_if(m_lightRemovalQueues[channelIndex], [chunk](LightRemovalNode const& node) { return node.m_blockIter.GetChunk() == chunk; });
+        std::erase_if(m_lightAdditionQueues[channelIndex], [chunk](BlockIterator const& blockIter) { return blockIter.GetChunk() == chunk; });
     }
 
-    // Assignment 5 Phase 7: Safety check - if queue is empty, set should also be empty
-    if (m_dirtyLightQueue.empty() && !m_dirtyLightSet.empty())
+    if (m_lastLightChangedChunk == chunk)
     {
-        m_dirtyLightSet.clear();
+        m_lastLightChangedChunk = nullptr;
     }
 }
 
@@ -2846,7 +4430,14 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
     if (!blockIter.IsValid())
         return;
 
-    Block* block = blockIter.GetBlock();
+    ++m_lightPropagationStats.m_legacyVisitCount;
+
+    // Queue entries can outlive their chunk's activation; pooled chunks are recycled in place,
+    // so only recalculate blocks of chunks that are currently live and complete
+    if (!blockIter.GetChunk()->IsComplete())
+        return;
+
+    BlockPtr block = blockIter.GetBlock();
     if (!block)
         return;
 
@@ -2859,6 +4450,9 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
     uint8_t const oldOutdoor = block->GetOutdoorLight();
     uint8_t const oldIndoor  = block->GetIndoorLight();
 
+    // Opacity from the chunk's opacity mask rather than the block definition
+    bool const isOpaque = blockIter.GetChunk()->IsBlockOpaque(blockIter.GetBlockIndex());
+
     //----------------------------------------------------------------------------------------------------
     // Calculate new outdoor light (skylight propagation)
     //----------------------------------------------------------------------------------------------------
@@ -2869,7 +4463,7 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
         // Direct skylight - always full brightness
         newOutdoor = 15;
     }
-    else if (!blockDef->IsOpaque())
+    else if (!isOpaque)
     {
         // A5 SPEC COMPLIANT: Only NON-OPAQUE blocks receive propagated outdoor light
         // Opaque blocks (including water/ice/leaves) ALWAYS get outdoor=0
@@ -2888,14 +4482,18 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
             BlockIterator neighborIter = blockIter.GetNeighbor(neighborOffsets[i]);
             if (neighborIter.IsValid())
             {
-                Block* neighborBlock = neighborIter.GetBlock();
+                BlockPtr neighborBlock = neighborIter.GetBlock();
                 if (neighborBlock)
                 {
                     // A5 SPEC: Take light FROM neighbor if neighbor is NOT opaque OR neighbor is emissive
                     // This allows emissive blocks (glowstone) to provide light even though they're opaque
                     // Reference implementation World.cpp line 762
-                    sBlockDefinition* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
-                    bool canProvideLight = neighborDef && (!neighborDef->IsOpaque() || neighborDef->IsEmissive());
+                    bool canProvideLight = !neighborIter.GetChunk()->IsBlockOpaque(neighborIter.GetBlockIndex());
+                    if (!canProvideLight)
+                    {
+                        sBlockDefinition* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
+                        canProvideLight               = neighborDef && neighborDef->IsEmissive();
+                    }
 
                     if (canProvideLight)
                     {
@@ -2928,7 +4526,7 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
         // Emissive blocks are light sources
         newIndoor = blockDef->GetEmissiveValue();
     }
-    else if (!blockDef->IsOpaque())
+    else if (!isOpaque)
     {
         // Transparent blocks: Find max neighbor indoor light - 1 (influence map)
         IntVec3 neighborOffsets[6] = {
@@ -2945,7 +4543,7 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
             BlockIterator neighborIter = blockIter.GetNeighbor(neighborOffsets[i]);
             if (neighborIter.IsValid())
             {
-                Block* neighborBlock = neighborIter.GetBlock();
+                BlockPtr neighborBlock = neighborIter.GetBlock();
                 if (neighborBlock)
                 {
                     uint8_t neighborLight = neighborBlock->GetIndoorLight();
@@ -2987,12 +4585,7 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
         // Instead, add chunk to tracking set. ProcessDirtyChunkMeshes() will mark them dirty
         // AFTER the lighting queue empties (lighting has stabilized).
         // This prevents mesh rebuild starvation while preserving "wait for stable lighting" behavior.
-        Chunk* chunk = blockIter.GetChunk();
-        if (chunk)
-        {
-            std::lock_guard<std::mutex> lock(m_meshRebuildSetMutex);
-            m_chunksNeedingMeshRebuild.insert(chunk);
-        }
+        NoteLightChanged(blockIter.GetChunk());
 
         // Add only NON-OPAQUE neighbors to dirty queue for propagation
         // Assignment 5 Phase 7: Mesh rendering reads neighbor light values for each face
@@ -3013,14 +4606,9 @@ void World::RecalculateBlockLighting(BlockIterator const& blockIter)
             if (neighborIter.IsValid())
             {
                 // Only add neighbor if it's non-opaque (can receive light)
-                Block* neighborBlock = neighborIter.GetBlock();
-                if (neighborBlock)
+                if (!neighborIter.GetChunk()->IsBlockOpaque(neighborIter.GetBlockIndex()))
                 {
-                    sBlockDefinition* neighborDef = sBlockDefinition::GetDefinitionByIndex(neighborBlock->m_typeIndex);
-                    if (neighborDef && !neighborDef->IsOpaque())
-                    {
-                        AddToDirtyLightQueue(neighborIter);
-                    }
+                    AddToDirtyLightQueue(neighborIter);
                 }
             }
         }
@@ -3047,3 +4635,430 @@ void World::MarkChunkForMeshRebuild(Chunk* chunk)
     // DO NOT call chunk->SetIsMeshDirty(true) here!
     // Let ProcessDirtyChunkMeshes() handle it after lighting queue empties
 }
+
+//----------------------------------------------------------------------------------------------------
+// RunLightingBenchmark - Place and remove a light source next to the camera under each light engine
+//
+// The source is the first emissive block type, placed in the first air block at or above the camera.
+// Each cycle places it and drains all light work, then restores air and drains again; blocks touched
+// (LightPropagationStats) and wall time are averaged per cycle. All engines settle on the same light,
+// which is compared in a cube around the source after placing and after removing; mismatches are
+// expected only if the area was still unsettled before the benchmark.
+//
+// The relight pass resets the chunks around the source with InitializeLighting() and re-seeds them with
+// OnActivate(), the work a freshly streamed area queues, then compares the main-thread flood fill with
+// ChunkLightJobs over every block of those chunks. Blocking, and other completed jobs are processed while
+// light jobs are awaited; the engine settings and the cumulative stats are restored afterwards, and the
+// touched chunks are re-meshed as after any edit.
+//----------------------------------------------------------------------------------------------------
+void World::RunLightingBenchmark()
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    int constexpr CYCLE_COUNT          = 8;
+    int constexpr ENGINE_COUNT         = 3;                 // 0: influence map (legacy), 1: flood fill, 2: flood fill on ChunkLightJobs
+    int constexpr SAMPLE_RADIUS        = MAX_LIGHT_LEVEL;   // Reach of the brightest source
+    int constexpr RELIGHT_CHUNK_RADIUS = 2;                 // (2 * radius + 1)^2 chunks
+
+    LightingBenchmarkResult result;
+    m_lightingBenchmarkResult = result;
+
+    uint8_t sourceTypeIndex = BLOCK_AIR;
+    for (size_t typeIndex = 0; typeIndex < sBlockDefinition::s_definitions.size(); ++typeIndex)
+    {
+        sBlockDefinition const* blockDef = sBlockDefinition::s_definitions[typeIndex];
+        if (blockDef && blockDef->IsEmissive())
+        {
+            sourceTypeIndex = (uint8_t)typeIndex;
+            break;
+        }
+    }
+    if (sourceTypeIndex == BLOCK_AIR)
+    {
+        DebuggerPrintf("[LIGHTING BENCHMARK] No emissive block type defined\n");
+        return;
+    }
+
+    Vec3 const cameraPos = GetCameraPosition();
+    IntVec3    site((int)floorf(cameraPos.x), (int)floorf(cameraPos.y), (std::max)((int)floorf(cameraPos.z), 0));
+    Chunk*     siteChunk = GetChunk(Chunk::GetChunkCoords(site));
+    while (site.z <= CHUNK_MAX_Z && GetBlockTypeAtGlobalCoords(site) != BLOCK_AIR)
+    {
+        ++site.z;
+    }
+    if (siteChunk == nullptr || !siteChunk->IsComplete() || site.z > CHUNK_MAX_Z)
+    {
+        DebuggerPrintf("[LIGHTING BENCHMARK] No loaded air block at or above the camera\n");
+        return;
+    }
+
+    // Light bytes of the cube around the site, 0 where no chunk is loaded
+    auto const sampleLight = [this, &site](std::vector<uint8_t>& outLight)
+    {
+        outLight.clear();
+        for (int offsetZ = -SAMPLE_RADIUS; offsetZ <= SAMPLE_RADIUS; ++offsetZ)
+        {
+            for (int offsetY = -SAMPLE_RADIUS; offsetY <= SAMPLE_RADIUS; ++offsetY)
+            {
+                for (int offsetX = -SAMPLE_RADIUS; offsetX <= SAMPLE_RADIUS; ++offsetX)
+                {
+                    IntVec3 const globalCoords(site.x + offsetX, site.y + offsetY, site.z + offsetZ);
+                    IntVec3 const localCoords = Chunk::GlobalCoordsToLocalCoords(globalCoords);
+                    Chunk*        chunk       = GetChunk(Chunk::GetChunkCoords(globalCoords));
+                    BlockPtr      block       = (chunk != nullptr) ? chunk->GetBlock(localCoords.x, localCoords.y, localCoords.z) : nullptr;
+                    outLight.push_back(block ? block->m_lightingData : (uint8_t)0);
+                }
+            }
+        }
+    };
+
+    auto const countMismatches = [](std::vector<uint8_t> const& lightA, std::vector<uint8_t> const& lightB)
+    {
+        int mismatchCount = 0;
+        for (size_t sampleIndex = 0; sampleIndex < lightA.size() && sampleIndex < lightB.size(); ++sampleIndex)
+        {
+            mismatchCount += (lightA[sampleIndex] != lightB[sampleIndex]) ? 1 : 0;
+        }
+        return mismatchCount;
+    };
+
+    bool const                  wasFloodFillLighting = m_useFloodFillLighting;
+    bool const                  wasParallelLighting  = m_useParallelLighting;
+    LightPropagationStats const savedStats           = m_lightPropagationStats;
+
+    // Start from settled light so the first cycle measures only the benchmark's own changes
+    DrainLightWork();
+
+    std::vector<uint8_t> placedLight[ENGINE_COUNT];
+    std::vector<uint8_t> removedLight[ENGINE_COUNT];
+    int64_t              touchedCounts[ENGINE_COUNT][2] = {};     // [engine][place, remove]
+    double               seconds[ENGINE_COUNT][2]       = {};
+
+    for (int engineIndex = 0; engineIndex < ENGINE_COUNT; ++engineIndex)
+    {
+        m_useFloodFillLighting = (engineIndex >= 1);
+        m_useParallelLighting  = (engineIndex == 2);
+
+        for (int cycleIndex = 0; cycleIndex < CYCLE_COUNT; ++cycleIndex)
+        {
+            for (int phaseIndex = 0; phaseIndex < 2; ++phaseIndex)
+            {
+                m_lightPropagationStats = LightPropagationStats();
+
+                BenchmarkClock::time_point const start = BenchmarkClock::now();
+                SetBlockAtGlobalCoords(site, (phaseIndex == 0) ? sourceTypeIndex : BLOCK_AIR);
+                DrainLightWork();
+                seconds[engineIndex][phaseIndex] += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+                touchedCounts[engineIndex][phaseIndex] += m_lightPropagationStats.GetTouchedBlockCount();
+
+                if (cycleIndex == 0)
+                {
+                    sampleLight((phaseIndex == 0) ? placedLight[engineIndex] : removedLight[engineIndex]);
+                }
+            }
+        }
+    }
+
+    // --- Relight: chunks around the site back to their initial light, re-seeded as on activation ---
+    std::vector<Chunk*> relightChunks;
+    IntVec2 const       siteChunkCoords = Chunk::GetChunkCoords(site);
+    for (int offsetY = -RELIGHT_CHUNK_RADIUS; offsetY <= RELIGHT_CHUNK_RADIUS; ++offsetY)
+    {
+        for (int offsetX = -RELIGHT_CHUNK_RADIUS; offsetX <= RELIGHT_CHUNK_RADIUS; ++offsetX)
+        {
+            Chunk* chunk = GetChunk(siteChunkCoords + IntVec2(offsetX, offsetY));
+            if (chunk != nullptr && chunk->IsComplete())
+            {
+                relightChunks.push_back(chunk);
+            }
+        }
+    }
+
+    std::vector<uint8_t> relitLight[2];         // [serial, parallel]
+    int64_t              relightTouched[2] = {};
+    double               relightSeconds[2] = {};
+    int64_t              relightJobCount   = 0;
+    for (int engineIndex = 0; engineIndex < 2; ++engineIndex)
+    {
+        m_useFloodFillLighting  = true;
+        m_useParallelLighting   = (engineIndex == 1);
+        m_lightPropagationStats = LightPropagationStats();
+
+        for (Chunk* chunk : relightChunks)
+        {
+            chunk->InitializeLighting();
+        }
+
+        BenchmarkClock::time_point const start = BenchmarkClock::now();
+        for (Chunk* chunk : relightChunks)
+        {
+            chunk->OnActivate(this);
+        }
+        DrainLightWork();
+        relightSeconds[engineIndex] = std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+        relightTouched[engineIndex] = m_lightPropagationStats.GetTouchedBlockCount();
+        if (engineIndex == 1)
+        {
+            relightJobCount = m_lightPropagationStats.m_lightJobCount;
+        }
+
+        for (Chunk* chunk : relightChunks)
+        {
+            uint8_t const* lightingData = chunk->GetBlockLightingData();
+            relitLight[engineIndex].insert(relitLight[engineIndex].end(), lightingData, lightingData + BLOCKS_PER_CHUNK);
+        }
+    }
+
+    m_useFloodFillLighting  = wasFloodFillLighting;
+    m_useParallelLighting   = wasParallelLighting;
+    m_lightPropagationStats = savedStats;
+
+    result.m_cycleCount             = CYCLE_COUNT;
+    result.m_legacyPlaceTouched     = touchedCounts[0][0] / CYCLE_COUNT;
+    result.m_legacyRemoveTouched    = touchedCounts[0][1] / CYCLE_COUNT;
+    result.m_legacyPlaceMs          = seconds[0][0] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_legacyRemoveMs         = seconds[0][1] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_floodFillPlaceTouched  = touchedCounts[1][0] / CYCLE_COUNT;
+    result.m_floodFillRemoveTouched = touchedCounts[1][1] / CYCLE_COUNT;
+    result.m_floodFillPlaceMs       = seconds[1][0] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_floodFillRemoveMs      = seconds[1][1] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_placeMismatchCount     = countMismatches(placedLight[0], placedLight[1]);
+    result.m_removeMismatchCount    = countMismatches(removedLight[0], removedLight[1]);
+    result.m_parallelPlaceTouched   = touchedCounts[2][0] / CYCLE_COUNT;
+    result.m_parallelRemoveTouched  = touchedCounts[2][1] / CYCLE_COUNT;
+    result.m_parallelPlaceMs        = seconds[2][0] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_parallelRemoveMs       = seconds[2][1] * 1000.0 / (double)CYCLE_COUNT;
+    result.m_parallelMismatchCount  = countMismatches(placedLight[1], placedLight[2]) + countMismatches(removedLight[1], removedLight[2]);
+    result.m_relightChunkCount      = (int)relightChunks.size();
+    result.m_relightSerialTouched   = relightTouched[0];
+    result.m_relightParallelTouched = relightTouched[1];
+    result.m_relightSerialMs        = relightSeconds[0] * 1000.0;
+    result.m_relightParallelMs      = relightSeconds[1] * 1000.0;
+    result.m_relightJobCount        = relightJobCount;
+    result.m_relightMismatchCount   = countMismatches(relitLight[0], relitLight[1]);
+    m_lightingBenchmarkResult       = result;
+
+    DebuggerPrintf("[LIGHTING BENCHMARK] Source type %d at (%d,%d,%d), %d cycles per engine\n",
+                   sourceTypeIndex, site.x, site.y, site.z, result.m_cycleCount);
+    DebuggerPrintf("[LIGHTING BENCHMARK] Place:  influence map %lld blocks %.3f ms, flood fill %lld blocks %.3f ms, %d mismatches\n",
+                   (long long)result.m_legacyPlaceTouched, result.m_legacyPlaceMs,
+                   (long long)result.m_floodFillPlaceTouched, result.m_floodFillPlaceMs, result.m_placeMismatchCount);
+    DebuggerPrintf("[LIGHTING BENCHMARK] Remove: influence map %lld blocks %.3f ms, flood fill %lld blocks %.3f ms, %d mismatches\n",
+                   (long long)result.m_legacyRemoveTouched, result.m_legacyRemoveMs,
+                   (long long)result.m_floodFillRemoveTouched, result.m_floodFillRemoveMs, result.m_removeMismatchCount);
+    DebuggerPrintf("[LIGHTING BENCHMARK] Light jobs: place %lld blocks %.3f ms, remove %lld blocks %.3f ms, %d mismatches vs flood fill\n",
+                   (long long)result.m_parallelPlaceTouched, result.m_parallelPlaceMs,
+                   (long long)result.m_parallelRemoveTouched, result.m_parallelRemoveMs, result.m_parallelMismatchCount);
+    DebuggerPrintf("[LIGHTING BENCHMARK] Relight %d chunks: flood fill %lld blocks %.1f ms, light jobs %lld blocks %.1f ms (%lld jobs), %d mismatches\n",
+                   result.m_relightChunkCount, (long long)result.m_relightSerialTouched, result.m_relightSerialMs,
+                   (long long)result.m_relightParallelTouched, result.m_relightParallelMs, (long long)result.m_relightJobCount,
+                   result.m_relightMismatchCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// RunSkylightInitBenchmark - Legacy per-column skylight initialization vs the heightmap-driven one
+//
+// Each loaded chunk around the camera is copied twice into scratch chunks outside the world with its
+// light and flags cleared, as after generation or a disk load, and initialized by each path. The live
+// chunks are untouched. Both must leave identical light bytes, flag bytes and surface heights, so any
+// mismatch is a bug. Blocking.
+//----------------------------------------------------------------------------------------------------
+void World::RunSkylightInitBenchmark()
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    int constexpr SAMPLE_CHUNK_RADIUS = 2;      // (2 * radius + 1)^2 chunks
+    int constexpr REPEAT_COUNT        = 4;
+
+    SkylightInitBenchmarkResult result;
+    result.m_repeatCount = REPEAT_COUNT;
+
+    Vec3 const    cameraPos    = GetCameraPosition();
+    IntVec2 const centerCoords = Chunk::GetChunkCoords(IntVec3((int)floorf(cameraPos.x), (int)floorf(cameraPos.y), 0));
+
+    Chunk                legacyChunk(centerCoords);
+    Chunk                heightmapChunk(centerCoords);
+    std::vector<uint8_t> typeIndices(BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> lightingData(BLOCKS_PER_CHUNK);
+    std::vector<uint8_t> bitFlags(BLOCKS_PER_CHUNK);
+    double               legacySeconds    = 0.0;
+    double               heightmapSeconds = 0.0;
+
+    for (int offsetY = -SAMPLE_CHUNK_RADIUS; offsetY <= SAMPLE_CHUNK_RADIUS; ++offsetY)
+    {
+        for (int offsetX = -SAMPLE_CHUNK_RADIUS; offsetX <= SAMPLE_CHUNK_RADIUS; ++offsetX)
+        {
+            Chunk const* liveChunk = GetChunk(centerCoords + IntVec2(offsetX, offsetY));
+            if (liveChunk == nullptr || !liveChunk->IsComplete()) continue;
+
+            liveChunk->CopyBlocksTo(typeIndices.data(), lightingData.data(), bitFlags.data());
+
+            for (int repeat = 0; repeat < REPEAT_COUNT; ++repeat)
+            {
+                for (Chunk* scratchChunk : { &legacyChunk, &heightmapChunk })
+                {
+                    scratchChunk->ResetForReuse(liveChunk->GetChunkCoords());
+                    memcpy(scratchChunk->GetBlockTypeIndices(), typeIndices.data(), (size_t)BLOCKS_PER_CHUNK);
+                    scratchChunk->RecalculateSectionOccupancy();
+                    scratchChunk->RecalculateBlockMasks();
+                    scratchChunk->RecalculateColumnHeights();
+                }
+
+                BenchmarkClock::time_point start = BenchmarkClock::now();
+                legacyChunk.InitializeLightingLegacy();
+                legacySeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+                start = BenchmarkClock::now();
+                heightmapChunk.InitializeLighting();
+                heightmapSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+            }
+
+            uint8_t const* legacyLight    = legacyChunk.GetBlockLightingData();
+            uint8_t const* heightmapLight = heightmapChunk.GetBlockLightingData();
+            uint8_t const* legacyFlags    = legacyChunk.GetBlockBitFlags();
+            uint8_t const* heightmapFlags = heightmapChunk.GetBlockBitFlags();
+            for (int blockIndex = 0; blockIndex < BLOCKS_PER_CHUNK; ++blockIndex)
+            {
+                result.m_mismatchCount += (legacyLight[blockIndex] != heightmapLight[blockIndex]) ? 1 : 0;
+                result.m_mismatchCount += (legacyFlags[blockIndex] != heightmapFlags[blockIndex]) ? 1 : 0;
+            }
+            for (int localY = 0; localY < CHUNK_SIZE_Y; ++localY)
+            {
+                for (int localX = 0; localX < CHUNK_SIZE_X; ++localX)
+                {
+                    result.m_mismatchCount += (legacyChunk.GetSurfaceHeight(localX, localY) != heightmapChunk.GetSurfaceHeight(localX, localY)) ? 1 : 0;
+                }
+            }
+
+            ++result.m_sampledChunkCount;
+        }
+    }
+
+    if (result.m_sampledChunkCount > 0)
+    {
+        double const initCount       = (double)(result.m_sampledChunkCount * REPEAT_COUNT);
+        result.m_legacyMsPerChunk    = legacySeconds * 1000.0 / initCount;
+        result.m_heightmapMsPerChunk = heightmapSeconds * 1000.0 / initCount;
+    }
+    m_skylightInitBenchmarkResult = result;
+
+    DebuggerPrintf("[SKYLIGHT INIT] %d chunks x %d: legacy %.3f ms/chunk, heightmap %.3f ms/chunk (%.1fx), %d mismatches\n",
+                   result.m_sampledChunkCount, result.m_repeatCount, result.m_legacyMsPerChunk, result.m_heightmapMsPerChunk,
+                   result.m_heightmapMsPerChunk > 0.0 ? result.m_legacyMsPerChunk / result.m_heightmapMsPerChunk : 0.0,
+                   result.m_mismatchCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// RunDirtyLightQueueBenchmark - Dirty light queue throughput: former set + deque vs DirtyLightQueue
+//
+// Both queues get the same pushes on scratch chunks outside the world: every block of the lowest
+// sections offered together with its +X, +Y and +Z neighbors, as propagation re-adds its neighborhood,
+// so three in four pushes are duplicates. Each queue is then drained. Throughput is popped blocks per
+// second of push + drain time. Both must pop the same blocks in the same order. The world's own queue
+// and chunks are untouched. Blocking.
+//----------------------------------------------------------------------------------------------------
+void World::RunDirtyLightQueueBenchmark()
+{
+    using BenchmarkClock = std::chrono::high_resolution_clock;
+
+    int constexpr SCRATCH_CHUNK_COUNT = 4;
+    int constexpr SECTIONS_PER_CHUNK  = 4;      // Lowest sections pushed in each chunk
+    int constexpr REPEAT_COUNT        = 4;
+    int constexpr PUSH_OFFSETS[]      = { 0, 1, CHUNK_SIZE_X, CHUNK_SIZE_X * CHUNK_SIZE_Y };
+    int constexpr PUSHED_BLOCK_END    = SECTIONS_PER_CHUNK * BLOCKS_PER_CHUNK_SECTION;
+
+    DirtyLightQueueBenchmarkResult result;
+    result.m_chunkCount  = SCRATCH_CHUNK_COUNT;
+    result.m_repeatCount = REPEAT_COUNT;
+
+    std::vector<std::unique_ptr<Chunk>> scratchChunks;
+    for (int chunkIndex = 0; chunkIndex < SCRATCH_CHUNK_COUNT; ++chunkIndex)
+    {
+        scratchChunks.push_back(std::make_unique<Chunk>(IntVec2(chunkIndex, 0)));
+    }
+
+    std::deque<BlockIterator>                 setQueue;
+    std::unordered_set<BlockIterator>         queuedSet;
+    DirtyLightQueue                           ringQueue;
+    std::vector<std::pair<Chunk const*, int>> setOrder;
+    std::vector<std::pair<Chunk const*, int>> ringOrder;
+    double                                    setSeconds  = 0.0;
+    double                                    ringSeconds = 0.0;
+
+    for (int repeat = 0; repeat < REPEAT_COUNT; ++repeat)
+    {
+        setOrder.clear();
+        ringOrder.clear();
+        result.m_offeredBlockCount = 0;
+
+        // --- std::deque<BlockIterator> + std::unordered_set<BlockIterator> (former AddToDirtyLightQueue) ---
+        BenchmarkClock::time_point start = BenchmarkClock::now();
+        for (std::unique_ptr<Chunk> const& chunk : scratchChunks)
+        {
+            for (int blockIndex = 0; blockIndex < PUSHED_BLOCK_END; ++blockIndex)
+            {
+                for (int const offset : PUSH_OFFSETS)
+                {
+                    if (blockIndex + offset >= PUSHED_BLOCK_END) continue;
+
+                    BlockIterator const blockIter(chunk.get(), blockIndex + offset, this);
+                    if (queuedSet.find(blockIter) != queuedSet.end()) continue;
+
+                    queuedSet.insert(blockIter);
+                    setQueue.push_back(blockIter);
+                }
+            }
+        }
+        while (!setQueue.empty())
+        {
+            BlockIterator const blockIter = setQueue.front();
+            setQueue.pop_front();
+            queuedSet.erase(blockIter);
+            setOrder.emplace_back(blockIter.GetChunk(), blockIter.GetBlockIndex());
+        }
+        setSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+
+        // --- DirtyLightQueue (in-block queued bit, chunked ring) ---
+        start = BenchmarkClock::now();
+        for (std::unique_ptr<Chunk> const& chunk : scratchChunks)
+        {
+            for (int blockIndex = 0; blockIndex < PUSHED_BLOCK_END; ++blockIndex)
+            {
+                for (int const offset : PUSH_OFFSETS)
+                {
+                    if (blockIndex + offset >= PUSHED_BLOCK_END) continue;
+
+                    ringQueue.Push(chunk.get(), blockIndex + offset);
+                    ++result.m_offeredBlockCount;
+                }
+            }
+        }
+        Chunk* poppedChunk      = nullptr;
+        int    poppedBlockIndex = 0;
+        while (ringQueue.Pop(poppedChunk, poppedBlockIndex))
+        {
+            ringOrder.emplace_back(poppedChunk, poppedBlockIndex);
+        }
+        ringSeconds += std::chrono::duration<double>(BenchmarkClock::now() - start).count();
+    }
+
+    result.m_queuedBlockCount = (int64_t)ringOrder.size();
+    result.m_ringPageCount    = ringQueue.GetPageCount();
+    result.m_mismatchCount    = (setOrder.size() != ringOrder.size()) ? 1 : 0;
+    for (size_t entryIndex = 0; entryIndex < setOrder.size() && entryIndex < ringOrder.size(); ++entryIndex)
+    {
+        result.m_mismatchCount += (setOrder[entryIndex] != ringOrder[entryIndex]) ? 1 : 0;
+    }
+
+    double const poppedCount = (double)(result.m_queuedBlockCount * REPEAT_COUNT);
+    result.m_setBlocksPerSecond  = (setSeconds > 0.0) ? poppedCount / setSeconds : 0.0;
+    result.m_ringBlocksPerSecond = (ringSeconds > 0.0) ? poppedCount / ringSeconds : 0.0;
+    m_dirtyLightQueueBenchmarkResult = result;
+
+    DebuggerPrintf("[LIGHT QUEUE] %d chunks x %d: %lld pushes -> %lld blocks, set %.1f M blocks/s, ring %.1f M blocks/s (%.1fx, %d pages), %d mismatches\n",
+                   result.m_chunkCount, result.m_repeatCount, (long long)result.m_offeredBlockCount, (long long)result.m_queuedBlockCount,
+                   result.m_setBlocksPerSecond / 1.0e6, result.m_ringBlocksPerSecond / 1.0e6,
+                   result.m_setBlocksPerSecond > 0.0 ? result.m_ringBlocksPerSecond / result.m_setBlocksPerSecond : 0.0,
+                   result.m_ringPageCount, result.m_mismatchCount);
+}
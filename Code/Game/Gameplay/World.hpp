@@ -11,20 +11,31 @@
 #include <map>
 #include <deque>
 #include <mutex>
+#include <chrono>
 
 #include "Engine/Core/Rgba8.hpp"
 #include "Engine/Math/Vec3.hpp"
 #include "Game/Framework/GameCommon.hpp"  // For DebugVisualizationMode
+#include "Game/Framework/BiomeRegionCache.hpp"
 #include "Game/Framework/BlockIterator.hpp"  // Assignment 5 Phase 4: Required for std::deque<BlockIterator>
+#include "Game/Framework/ChunkActivationFrontier.hpp"
+#include "Game/Framework/ChunkCache.hpp"
+#include "Game/Framework/ChunkGrid.hpp"
+#include "Game/Framework/ChunkJobScheduler.hpp"
+#include "Game/Framework/ChunkLightJob.hpp"     // LightChannel, LightBorderDelta
+#include "Game/Framework/DirtyLightQueue.hpp"
+#include "Game/Framework/WorldGenConfig.hpp"
 
 struct IntVec2;
 struct IntVec3;
 struct Vec3;
 struct Rgba8;
+class BlockPtr;
 class Camera;
 class Chunk;
 class Entity;
 class ChunkGenerateJob;
+class ChunkLightJob;
 class ChunkLoadJob;
 class ChunkMeshJob;
 class ChunkSaveJob;
@@ -67,6 +78,11 @@ constexpr int CHUNK_ACTIVATION_RADIUS_X = 1 + (CHUNK_ACTIVATION_RANGE / 16); //
 constexpr int CHUNK_ACTIVATION_RADIUS_Y = 1 + (CHUNK_ACTIVATION_RANGE / 16); // CHUNK_SIZE_Y
 // NOTE: MAX_ACTIVE_CHUNKS removed - deactivation at CHUNK_DEACTIVATION_RANGE provides natural memory limit
 
+// The toroidal lookup grid must be wider than the span of chunks that can be active at once
+static_assert(DEBUG_FIXED_WORLD_GEN ? (CHUNK_GRID_SIZE >= 2 * DEBUG_FIXED_WORLD_HALF_SIZE)
+                                    : (CHUNK_GRID_SIZE > 2 * (CHUNK_DEACTIVATION_RANGE / CHUNK_SIZE_X + 1) + 1),
+              "CHUNK_GRID_SIZE too small for the chunk deactivation range");
+
 //----------------------------------------------------------------------------------------------------
 // Chunk Preloading Constants (Phase 0, Task 0.7) - Smart directional preloading
 //----------------------------------------------------------------------------------------------------
@@ -93,11 +109,33 @@ constexpr int TOTAL_WORLD_CHUNKS  = WORLD_SIZE_CHUNKS_X * WORLD_SIZE_CHUNKS_Y;
 //----------------------------------------------------------------------------------------------------
 // Job Queue Limiting - Prevent overwhelming the worker threads
 //----------------------------------------------------------------------------------------------------
-constexpr int MAX_PENDING_GENERATE_JOBS = 128;  // Maximum chunk generation jobs in flight (increased from 16)
+// Jobs beyond these caps wait in World's ChunkJobScheduler, where they can still be reprioritized or
+// cancelled; submitted jobs cannot, so the generation cap only needs to keep the workers busy
+constexpr int MAX_PENDING_GENERATE_JOBS = 32;   // Maximum chunk generation jobs in flight (was 128 before scheduling)
 constexpr int MAX_PENDING_LOAD_JOBS     = 16;   // Maximum chunk load jobs in flight (increased from 4)
 constexpr int MAX_PENDING_MESH_JOBS     = 16;   // Maximum chunk mesh jobs in flight
+constexpr int MAX_PENDING_LIGHT_JOBS    = 16;   // Maximum chunk light jobs in flight (one per chunk at most)
 constexpr int MAX_PENDING_SAVE_JOBS     = 4;    // Maximum chunk save jobs in flight
 
+constexpr float TELEPORT_DETECT_DISTANCE  = 128.0f;   // Camera jump per frame (XY) that starts the time-to-first-visible clock
+constexpr float TELEPORT_VISIBLE_DISTANCE = 64.0f;    // A chunk mesh this close to the camera (XY, to chunk center) stops it
+
+//----------------------------------------------------------------------------------------------------
+// Palette Block Storage - Compress idle chunks outside the player's interaction radius
+//----------------------------------------------------------------------------------------------------
+constexpr float CHUNK_PACK_MIN_DISTANCE     = 160.0f; // Chunks closer than this (XY, to chunk center) keep flat storage
+constexpr int   MAX_CHUNKS_PACKED_PER_FRAME = 8;      // Bounds main-thread packing cost (~1 ms per chunk)
+
+//----------------------------------------------------------------------------------------------------
+// Chunk Pool - Recycle Chunk instances instead of new/delete on every activation/deactivation
+//----------------------------------------------------------------------------------------------------
+constexpr int MAX_POOLED_CHUNKS = 64;   // ~50 MB of ready-to-use chunks; enough to absorb fast-travel bursts
+
+//----------------------------------------------------------------------------------------------------
+// Chunk Cache - Compressed copies of recently deactivated chunks, checked before disk and generation
+//----------------------------------------------------------------------------------------------------
+constexpr size_t DEFAULT_CHUNK_CACHE_BYTE_BUDGET = 64ull * 1024ull * 1024ull;  // Typical entry is 20-60 KB (surface band palettes)
+
 //----------------------------------------------------------------------------------------------------
 // 4. World units: Each world unit is 1 meter.  Each block is 1.0 x 1.0 x 1.0 world units (meters) in size.
 //    This assumption (that blocks are each 1m x 1m x 1m) is fundamental and should be hard-coded (for purposes of speed and numerical precision).
@@ -120,6 +158,196 @@ struct RaycastResult
         : m_didImpact(didImpact), m_impactBlockCoords(blockCoords), m_impactDistance(distance) {}
 };
 
+//----------------------------------------------------------------------------------------------------
+// Block storage benchmark: flat Block[] vs palette-compressed sections over a sample of live chunks
+//----------------------------------------------------------------------------------------------------
+struct BlockStorageBenchmarkResult
+{
+    int    m_sampledChunkCount          = 0;
+    size_t m_flatBytes                  = 0;      // Resident bytes of sampled chunks as flat arrays
+    size_t m_paletteBytes               = 0;      // Resident bytes of sampled chunks as palettes
+    double m_flatSequentialNsPerRead    = 0.0;    // In-order full scan of m_typeIndex
+    double m_interleavedSeqNsPerRead    = 0.0;    // Same scan over an interleaved Block[] copy (pre-SoA layout)
+    double m_paletteSequentialNsPerRead = 0.0;
+    double m_flatRandomNsPerRead        = 0.0;    // Pseudo-random single block reads
+    double m_paletteRandomNsPerRead     = 0.0;
+    double m_packMsPerChunk             = 0.0;
+    double m_unpackMsPerChunk           = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Chunk lookup benchmark: GetChunk through the toroidal grid vs the mutex-guarded hash map
+//----------------------------------------------------------------------------------------------------
+struct ChunkLookupBenchmarkResult
+{
+    int    m_lookupCount     = 0;
+    int    m_hitCount        = 0;      // Lookups that found an active chunk (the rest probe unloaded coordinates)
+    double m_mapNsPerLookup  = 0.0;    // lock m_activeChunksMutex + unordered_map::find
+    double m_gridNsPerLookup = 0.0;    // ChunkGrid::Find
+};
+
+//----------------------------------------------------------------------------------------------------
+// Completed job dispatch: per-frame cost of ProcessCompletedJobs
+//----------------------------------------------------------------------------------------------------
+struct CompletedJobDispatchStats
+{
+    int    m_lastFrameJobCount = 0;      // Jobs retrieved from the JobSystem last frame
+    double m_lastFrameMs       = 0.0;    // ProcessCompletedJobs() total, handlers included
+    double m_peakFrameMs       = 0.0;    // Highest m_lastFrameMs since the last reset
+};
+
+//----------------------------------------------------------------------------------------------------
+// Generation stages: worker time per pipeline stage over the generate jobs completed since the last reset
+//----------------------------------------------------------------------------------------------------
+struct ChunkGenerationStageStats
+{
+    double m_totalSeconds[CHUNK_GENERATION_STAGE_COUNT] = {};
+    int    m_runCount[CHUNK_GENERATION_STAGE_COUNT]     = {};
+    int    m_jobCount                                   = 0;      // Completed generate jobs (one per stage when split)
+};
+
+//----------------------------------------------------------------------------------------------------
+// Job dispatch benchmark: finding a completed job by scanning the tracking vectors (previous code)
+// vs erasing it from the per-type hash set, each under m_jobListsMutex
+//----------------------------------------------------------------------------------------------------
+struct JobDispatchBenchmarkResult
+{
+    int    m_inFlightCount  = 0;      // Simulated jobs per type
+    double m_linearNsPerJob = 0.0;
+    double m_hashedNsPerJob = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Density lattice comparison: GenerateTerrain with the configured noise lattice vs exact per-block noise
+//----------------------------------------------------------------------------------------------------
+struct DensityLatticeComparisonResult
+{
+    int    m_sampledChunkCount    = 0;
+    int    m_latticeStepXY        = 1;      // Effective steps (after rounding to a power of two)
+    int    m_latticeStepZ         = 1;
+    double m_exactMsPerChunk      = 0.0;
+    double m_latticeMsPerChunk    = 0.0;
+    int    m_changedSolidityCount = 0;      // Blocks solid in one result and not in the other (all sampled chunks)
+    int    m_changedTypeCount     = 0;      // Blocks whose type differs at all
+    int    m_totalBlockCount      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Cave surface benchmark: legacy per-block upward surface search vs the per-column surface profile
+//----------------------------------------------------------------------------------------------------
+struct CaveSurfaceBenchmarkResult
+{
+    int    m_sampledChunkCount = 0;
+    double m_legacyMsPerChunk  = 0.0;
+    double m_profileMsPerChunk = 0.0;
+    int    m_changedBlockCount = 0;     // Must be 0: the profile reproduces the search exactly
+};
+
+//----------------------------------------------------------------------------------------------------
+// Biome region cache comparison: climate upsampled from region samples vs exact per-column climate noise
+//----------------------------------------------------------------------------------------------------
+struct BiomeRegionComparisonResult
+{
+    int    m_sampledChunkCount    = 0;
+    int    m_sampleStep           = 1;      // Effective step (after rounding to a power of two)
+    double m_exactMsPerChunk      = 0.0;
+    double m_cachedMsPerChunk     = 0.0;    // Starts from an empty cache, so region builds are included
+    float  m_maxClimateError      = 0.f;    // Largest |cached - exact| over the five climate layers
+    int    m_changedBiomeCount    = 0;      // Columns whose BiomeType differs
+    int    m_changedSolidityCount = 0;
+    int    m_changedTypeCount     = 0;
+    int    m_totalBlockCount      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Light propagation: the two light nibbles (LightChannel) each run their own removal / addition flood fill
+//----------------------------------------------------------------------------------------------------
+// Removal BFS entry: a block that was cleared, with the light it held before clearing
+struct LightRemovalNode
+{
+    BlockIterator m_blockIter;
+    uint8_t       m_oldLight = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Light propagation work counted by ProcessDirtyLighting, cumulative until reset (main thread only)
+//----------------------------------------------------------------------------------------------------
+struct LightPropagationStats
+{
+    int64_t m_seedCount          = 0;    // Dirty blocks taken from m_dirtyLightQueue
+    int64_t m_removalVisitCount  = 0;    // Removal BFS pops (both channels)
+    int64_t m_additionVisitCount = 0;    // Addition BFS pops (both channels)
+    int64_t m_legacyVisitCount   = 0;    // RecalculateBlockLighting() calls (legacy engine)
+    int64_t m_changedLightCount  = 0;    // Light nibble writes that changed a value
+    int64_t m_lightJobCount      = 0;    // ChunkLightJobs committed (parallel engine; their visits are counted above)
+    int64_t m_borderDeltaCount   = 0;    // Border deltas those jobs handed to a neighbor chunk
+    double  m_lightJobSeconds    = 0.0;  // Worker time spent in ChunkLightJob::Execute()
+
+    int64_t GetTouchedBlockCount() const { return m_seedCount + m_removalVisitCount + m_additionVisitCount + m_legacyVisitCount; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Lighting benchmark: place and remove a light source next to the camera, drained by each light engine,
+// then relight the chunks around it on the main thread and on ChunkLightJobs
+//----------------------------------------------------------------------------------------------------
+struct LightingBenchmarkResult
+{
+    int     m_cycleCount              = 0;      // Place + remove cycles per engine
+    int64_t m_legacyPlaceTouched      = 0;      // Blocks touched per cycle (see LightPropagationStats)
+    int64_t m_legacyRemoveTouched     = 0;
+    double  m_legacyPlaceMs           = 0.0;    // Wall time per cycle until no light work is pending
+    double  m_legacyRemoveMs          = 0.0;
+    int64_t m_floodFillPlaceTouched   = 0;
+    int64_t m_floodFillRemoveTouched  = 0;
+    double  m_floodFillPlaceMs        = 0.0;
+    double  m_floodFillRemoveMs       = 0.0;
+    int     m_placeMismatchCount      = 0;      // Blocks around the source lit differently by the two engines
+    int     m_removeMismatchCount     = 0;      // Same, after the source was removed again
+    int64_t m_parallelPlaceTouched    = 0;      // Flood fill on ChunkLightJobs (parallel lighting)
+    int64_t m_parallelRemoveTouched   = 0;
+    double  m_parallelPlaceMs         = 0.0;
+    double  m_parallelRemoveMs        = 0.0;
+    int     m_parallelMismatchCount   = 0;      // Place + remove samples lit differently than by the main-thread flood fill
+
+    // Relight: every chunk in a square around the camera reset by InitializeLighting() and re-seeded by OnActivate()
+    int     m_relightChunkCount       = 0;
+    int64_t m_relightSerialTouched    = 0;
+    int64_t m_relightParallelTouched  = 0;
+    double  m_relightSerialMs         = 0.0;
+    double  m_relightParallelMs       = 0.0;
+    int64_t m_relightJobCount         = 0;      // ChunkLightJobs until no border delta remained
+    int     m_relightMismatchCount    = 0;      // Blocks of the square lit differently by the two
+};
+
+//----------------------------------------------------------------------------------------------------
+// Skylight initialization benchmark: per-column scans (InitializeLightingLegacy) vs the heightmap-driven
+// row fills of InitializeLighting, on copies of the loaded chunks around the camera
+//----------------------------------------------------------------------------------------------------
+struct SkylightInitBenchmarkResult
+{
+    int    m_sampledChunkCount   = 0;
+    int    m_repeatCount         = 0;      // Initializations per chunk and path
+    double m_legacyMsPerChunk    = 0.0;
+    double m_heightmapMsPerChunk = 0.0;
+    int    m_mismatchCount       = 0;      // Must be 0: light bytes, flag bytes and surface heights that differ
+};
+
+//----------------------------------------------------------------------------------------------------
+// Dirty light queue benchmark: push with deduplication, then drain, through the former
+// std::deque<BlockIterator> + std::unordered_set<BlockIterator> pair and through DirtyLightQueue
+//----------------------------------------------------------------------------------------------------
+struct DirtyLightQueueBenchmarkResult
+{
+    int     m_chunkCount          = 0;
+    int     m_repeatCount         = 0;        // Fill / drain cycles per queue
+    int64_t m_offeredBlockCount   = 0;        // Pushes per cycle, duplicates included
+    int64_t m_queuedBlockCount    = 0;        // Blocks popped per cycle
+    double  m_setBlocksPerSecond  = 0.0;      // Popped blocks per second of push + drain time
+    double  m_ringBlocksPerSecond = 0.0;
+    int     m_ringPageCount       = 0;        // Pages the ring grew to
+    int     m_mismatchCount       = 0;        // Must be 0: popped blocks that differ in order or count
+};
+
 //----------------------------------------------------------------------------------------------------
 class World
 {
@@ -134,6 +362,8 @@ public:
     void    DeactivateChunk(IntVec2 const& chunkCoords, bool forceSynchronousSave = false);
     void    DeactivateAllChunks(bool forceSynchronousSave = false); // For debug F8 and shutdown
     void    RegenerateAllChunks(); // For ImGui "Regenerate Chunks" - forces fresh terrain generation
+    int     RestageActiveChunks(ChunkGenerationStage firstStage); // Re-run generation from firstStage on active chunks, returns the count
+    int     RegenerateChangedStages(); // Restage active chunks from the first stage reading a changed WorldGenConfig section
     void    ToggleGlobalChunkDebugDraw(); // For debug F2 key
 
     // Debug Visualization (Phase 0, Task 0.4)
@@ -141,6 +371,8 @@ public:
     DebugVisualizationMode GetDebugVisualizationMode() const { return m_debugVisualizationMode; }
     bool    SetBlockAtGlobalCoords(IntVec3 const& globalCoords, uint8_t blockTypeIndex); // Set block at world position
     uint8_t GetBlockTypeAtGlobalCoords(IntVec3 const& globalCoords) const; // Get block type at world position
+    int     GetHighestNonAirZ(int globalX, int globalY) const; // Column top from the chunk heightmap, -1 if none or not loaded
+    int     GetHighestOpaqueZ(int globalX, int globalY) const; // Highest opaque block in the column, -1 if none or not loaded
     bool    IsBlockSolid(IntVec3 const& globalCoords) const; // Assignment 6: Check if block is solid (for collision)
     bool    IsEntityOnGround(Entity const* entity) const;    // Assignment 6: 4-corner raycast ground detection
     void    PushEntityOutOfBlocks(Entity* entity);           // Assignment 6: Iterative collision resolution
@@ -156,6 +388,55 @@ public:
     int GetPendingGenerateJobCount() const;
     int GetPendingLoadJobCount() const;
     int GetPendingSaveJobCount() const;
+    int GetScheduledChunkJobCount(ChunkJobKind const kind) const { return m_chunkJobScheduler.GetQueuedCount(kind); }
+    int GetCancelledChunkJobCount() const { return m_cancelledChunkJobCount; }
+    float GetLastTeleportFirstVisibleMs() const { return m_lastTeleportFirstVisibleMs; }    // -1 until a teleport was measured
+    bool IsTimingTeleport() const { return m_isTimingTeleport; }
+    int GetPackedChunkCount() const;
+    size_t GetTotalResidentBlockBytes() const;
+    void GetSectionOccupancyCounts(int& outAllAir, int& outAllStone, int& outMixed) const;
+    int GetPooledChunkCount() const { return (int)m_chunkPool.size(); }
+    int GetChunkPoolHitCount() const { return m_chunkPoolHitCount; }
+    int GetChunkPoolMissCount() const { return m_chunkPoolMissCount; }
+    ChunkCache const& GetChunkCache() const { return m_chunkCache; }
+    void SetChunkCacheByteBudget(size_t const byteBudget) { m_chunkCache.SetByteBudget(byteBudget); }
+
+    // Palette block storage: compress idle chunks and measure flat vs palette cost (ImGui Performance tab)
+    void PackIdleChunks(Vec3 const& cameraPos);
+    void RunBlockStorageBenchmark();
+    BlockStorageBenchmarkResult const& GetBlockStorageBenchmarkResult() const { return m_blockStorageBenchmarkResult; }
+
+    // Chunk lookup: lock-free grid vs locked map throughput (ImGui Performance tab)
+    void RunChunkLookupBenchmark();
+    ChunkLookupBenchmarkResult const& GetChunkLookupBenchmarkResult() const { return m_chunkLookupBenchmarkResult; }
+    int GetChunkGridOverflowCount() const { return m_chunkGrid.GetOverflowCount(); }
+    ChunkActivationFrontier const& GetActivationFrontier() const { return m_activationFrontier; }
+
+    // Completed job dispatch: per-frame cost and a lookup benchmark at a given in-flight count (ImGui Performance tab)
+    CompletedJobDispatchStats const& GetCompletedJobDispatchStats() const { return m_completedJobDispatchStats; }
+    void ResetCompletedJobDispatchPeak() { m_completedJobDispatchStats.m_peakFrameMs = 0.0; }
+    void RunJobDispatchBenchmark(int inFlightCount);
+    JobDispatchBenchmarkResult const& GetJobDispatchBenchmarkResult() const { return m_jobDispatchBenchmarkResult; }
+
+    // Generation pipeline: per-stage worker time and retained post-surface snapshots (ImGui Performance tab)
+    ChunkGenerationStageStats const& GetGenerationStageStats() const { return m_generationStageStats; }
+    void ResetGenerationStageStats() { m_generationStageStats = ChunkGenerationStageStats(); }
+    size_t GetTotalSurfaceSnapshotBytes() const;
+    size_t GetTotalRetainedIntermediateBytes() const;
+
+    // Density noise lattice: generation speedup and terrain difference against the exact path (ImGui Density tab)
+    void RunDensityLatticeComparison();
+    DensityLatticeComparisonResult const& GetDensityLatticeComparisonResult() const { return m_densityLatticeComparisonResult; }
+
+    // Cave carving surface search: per-block upward search vs per-column profile (ImGui Caves tab)
+    void RunCaveSurfaceBenchmark();
+    CaveSurfaceBenchmarkResult const& GetCaveSurfaceBenchmarkResult() const { return m_caveSurfaceBenchmarkResult; }
+
+    // Biome region cache: shared by generation jobs, cleared on regeneration (ImGui Biome Noise tab)
+    BiomeRegionCache&       GetBiomeRegionCache() { return m_biomeRegionCache; }
+    BiomeRegionCache const& GetBiomeRegionCache() const { return m_biomeRegionCache; }
+    void RunBiomeRegionComparison();
+    BiomeRegionComparisonResult const& GetBiomeRegionComparisonResult() const { return m_biomeRegionComparisonResult; }
 
     // Digging and placing methods
     bool    DigBlockAtCameraPosition(Vec3 const& cameraPos); // LMB - dig highest non-air block at or below camera
@@ -177,8 +458,9 @@ public:
     // Chunk management helper methods
     Vec3    GetCameraPosition() const;
     Vec3    GetPlayerVelocity() const;  // For directional preloading (Task 0.7)
+    Vec3    GetCameraForward() const;
     float   GetDistanceToChunkCenter(IntVec2 const& chunkCoords, Vec3 const& cameraPos) const;
-    IntVec2 FindNearestMissingChunkInRange(Vec3 const& cameraPos) const;
+    IntVec2 FindNearestMissingChunkInRange(Vec3 const& cameraPos);
     IntVec2 FindFarthestActiveChunkOutsideDeactivationRange(Vec3 const& cameraPos) const;
     Chunk*  FindNearestDirtyChunk(Vec3 const& cameraPos) const;
 
@@ -187,16 +469,36 @@ public:
     void ProcessDirtyChunkMeshes();
     void SubmitChunkForGeneration(Chunk* chunk);
     void SubmitChunkForMeshGeneration(Chunk* chunk);
-    void SubmitChunkForLoading(Chunk* chunk);
+    bool SubmitChunkForLoading(Chunk* chunk);       // false if refused (no job system, load jobs full, not ACTIVATING)
     void SubmitChunkForSaving(Chunk* chunk);
+    void DispatchScheduledChunkJobs(Vec3 const& cameraPos);    // Reprioritize / cancel parked jobs, submit the best into free slots
+    void OnChunkMeshUploaded(Chunk const* chunk);               // Stops the teleport clock once a nearby chunk becomes visible
 
     // Assignment 5 Phase 4: Dirty light queue management
     void AddToDirtyLightQueue(BlockIterator const& blockIter);
     void ProcessDirtyLighting(float maxTimeSeconds);
+    bool HasPendingLightWork() const;   // Dirty blocks or unfinished flood fills; meshing and packing wait for it
 
-    // Assignment 5 Phase 5: Light propagation algorithm
+    // Assignment 5 Phase 5: Light propagation algorithm (legacy engine, kept as the benchmark reference)
     void RecalculateBlockLighting(BlockIterator const& blockIter);
 
+    // Light engine: two-phase removal / addition flood fill (default) or the per-block influence map
+    bool IsFloodFillLightingEnabled() const { return m_useFloodFillLighting; }
+    void SetFloodFillLightingEnabled(bool const isEnabled) { m_useFloodFillLighting = isEnabled; }
+    bool IsParallelLightingEnabled() const { return m_useParallelLighting; }      // Flood fill on ChunkLightJobs
+    void SetParallelLightingEnabled(bool const isEnabled) { m_useParallelLighting = isEnabled; }
+    int  GetPendingLightJobCount() const { return (int)m_lightJobByChunk.size(); }
+    int  GetPendingLightChunkCount() const { return (int)m_pendingChunkLight.size(); }
+    int  GetDirtyLightQueueEntryCount() const { return (int)m_dirtyLightQueue.GetEntryCount(); }
+    LightPropagationStats const& GetLightPropagationStats() const { return m_lightPropagationStats; }
+    void ResetLightPropagationStats() { m_lightPropagationStats = LightPropagationStats(); }
+    void RunLightingBenchmark();
+    LightingBenchmarkResult const& GetLightingBenchmarkResult() const { return m_lightingBenchmarkResult; }
+    void RunSkylightInitBenchmark();
+    SkylightInitBenchmarkResult const& GetSkylightInitBenchmarkResult() const { return m_skylightInitBenchmarkResult; }
+    void RunDirtyLightQueueBenchmark();
+    DirtyLightQueueBenchmarkResult const& GetDirtyLightQueueBenchmarkResult() const { return m_dirtyLightQueueBenchmarkResult; }
+
     // Assignment 5 Phase 10: Fast voxel raycast using Amanatides & Woo algorithm
     RaycastResult RaycastVoxel(Vec3 const& start, Vec3 const& direction, float maxDistance) const;
 
@@ -211,6 +513,10 @@ private:
     std::unordered_map<IntVec2, Chunk*> m_activeChunks;
     mutable std::mutex m_activeChunksMutex;  // Protects m_activeChunks from concurrent access
 
+    /// @brief Same chunks indexed by coordinates modulo CHUNK_GRID_SIZE; GetChunk() reads it without locking
+    ChunkGrid m_chunkGrid;
+    Chunk*    GetChunkFromMap(IntVec2 const& chunkCoords) const;   // Locked map lookup (grid overflow fallback)
+
     //----------------------------------------------------------------------------------------------------
     // Non-Active Chunks - Chunks being processed by worker threads (REQUIRED by assignment)
     //----------------------------------------------------------------------------------------------------
@@ -227,24 +533,114 @@ private:
     //----------------------------------------------------------------------------------------------------
     // Job Management - Track pending/executing jobs for asynchronous chunk operations
     //----------------------------------------------------------------------------------------------------
-    std::vector<ChunkGenerateJob*> m_chunkGenerationJobs;
-    std::vector<ChunkLoadJob*>     m_chunkLoadJobs;
-    std::vector<ChunkMeshJob*>     m_chunkMeshJobs;
-    std::vector<ChunkSaveJob*>     m_chunkSaveJobs;
-    mutable std::mutex m_jobListsMutex;  // Protects all job vectors from concurrent access
+    std::unordered_set<ChunkGenerateJob*> m_chunkGenerationJobs;
+    std::unordered_set<ChunkLoadJob*>     m_chunkLoadJobs;
+    std::unordered_set<ChunkMeshJob*>     m_chunkMeshJobs;
+    std::unordered_set<ChunkLightJob*>    m_chunkLightJobs;
+    std::unordered_set<ChunkSaveJob*>     m_chunkSaveJobs;
+    mutable std::mutex m_jobListsMutex;  // Protects all job sets from concurrent access
+
+    // Removes a completed job from its tracking set; false if World never submitted it
+    template <typename JobType>
+    bool UntrackJob(std::unordered_set<JobType*>& trackedJobs, JobType* job)
+    {
+        std::lock_guard<std::mutex> lock(m_jobListsMutex);
+        return trackedJobs.erase(job) > 0;
+    }
+
+    // Submits the job for the chunk's next generation stage(s); the chunk must be TERRAIN_GENERATING
+    void SubmitGenerateJob(Chunk* chunk);
+
+    // Per-type completion handlers (main thread, m_jobListsMutex not held); each deletes its job
+    void HandleCompletedGenerateJob(ChunkGenerateJob* job);
+    void HandleCompletedLoadJob(ChunkLoadJob* job);
+    void HandleCompletedMeshJob(ChunkMeshJob* job);
+    void HandleCompletedLightJob(ChunkLightJob* job);
+    void HandleCompletedSaveJob(ChunkSaveJob* job);
+
+    // ProcessCompletedJobs() cost (main thread only)
+    CompletedJobDispatchStats  m_completedJobDispatchStats;
+    JobDispatchBenchmarkResult m_jobDispatchBenchmarkResult;     // Last RunJobDispatchBenchmark() result
+
+    // Per-stage generation time, accumulated by HandleCompletedGenerateJob() (main thread only)
+    ChunkGenerationStageStats m_generationStageStats;
+
+    // Last RunDensityLatticeComparison() result (main thread only)
+    DensityLatticeComparisonResult m_densityLatticeComparisonResult;
+
+    // Last RunCaveSurfaceBenchmark() result (main thread only)
+    CaveSurfaceBenchmarkResult m_caveSurfaceBenchmarkResult;
+
+    // Low-frequency climate noise per 8x8 chunk region (shared by ChunkGenerateJob workers, internally locked)
+    BiomeRegionCache m_biomeRegionCache{DEFAULT_BIOME_REGION_CAPACITY};
+
+    // Config the active chunks were last (re)generated with, diffed by RegenerateChangedStages() (main thread only)
+    WorldGenConfig m_generatedConfig;
+
+    // Last RunBiomeRegionComparison() result (main thread only)
+    BiomeRegionComparisonResult m_biomeRegionComparisonResult;
 
     std::unordered_set<IntVec2> m_queuedGenerateChunks;  // Track which chunks are queued for generation
     mutable std::mutex m_queuedChunksMutex;  // Protects m_queuedGenerateChunks from concurrent access
 
+    // Active / pending / missing state of chunks around the camera, feeds FindNearestMissingChunkInRange (main thread only)
+    ChunkActivationFrontier m_activationFrontier;
+
+    // Generation / load jobs waiting for a free in-flight slot, best first (main thread only)
+    ChunkJobScheduler m_chunkJobScheduler;
+    int               m_cancelledChunkJobCount = 0;     // Parked jobs dropped because the camera left them behind
+
+    // Time from a detected teleport to the first visible chunk near the new position (main thread only)
+    Vec3                                           m_lastDispatchCameraPos      = Vec3::ZERO;
+    bool                                           m_hasDispatchCameraPos       = false;
+    bool                                           m_isTimingTeleport           = false;
+    std::chrono::high_resolution_clock::time_point m_teleportStartTime;
+    float                                          m_lastTeleportFirstVisibleMs = -1.f;
+
     std::vector<Chunk*> m_dirtyChunks;  // Chunks needing mesh rebuild (accessed only on main thread)
 
     // Assignment 5 Phase 4: Dirty light queue for lighting propagation (8ms budget per frame)
-    std::deque<BlockIterator> m_dirtyLightQueue;  // Blocks needing light recalculation (main thread only)
-
-    // Assignment 5 Phase 7: O(1) duplicate detection for lighting queue (fixes infinite propagation loop)
-    // Tracks which blocks are already in m_dirtyLightQueue to prevent duplicate additions
-    // Without this, blocks re-add each other infinitely and lighting queue never empties
-    std::unordered_set<BlockIterator> m_dirtyLightSet;  // Fast lookup for queued blocks (main thread only)
+    // Queued blocks carry BLOCK_FLAG_LIGHT_QUEUED, so a block is never queued twice
+    // (without deduplication, blocks re-add each other infinitely and the queue never empties)
+    DirtyLightQueue m_dirtyLightQueue;  // Blocks needing light recalculation (main thread only)
+
+    // Flood fill light engine: per channel, a removal BFS that clears light and records the frontier of
+    // blocks still lit from elsewhere, then an addition BFS that refills from that frontier (main thread only)
+    std::deque<LightRemovalNode> m_lightRemovalQueues[LIGHT_CHANNEL_COUNT];
+    std::deque<BlockIterator>    m_lightAdditionQueues[LIGHT_CHANNEL_COUNT];
+    bool                         m_useFloodFillLighting   = true;
+    Chunk*                       m_lastLightChangedChunk  = nullptr;    // Last chunk added to m_chunksNeedingMeshRebuild
+    LightPropagationStats        m_lightPropagationStats;
+    LightingBenchmarkResult      m_lightingBenchmarkResult;             // Last RunLightingBenchmark() result
+    SkylightInitBenchmarkResult  m_skylightInitBenchmarkResult;         // Last RunSkylightInitBenchmark() result
+
+    // Last RunDirtyLightQueueBenchmark() result (main thread only)
+    DirtyLightQueueBenchmarkResult m_dirtyLightQueueBenchmarkResult;
+
+    // Parallel lighting: the flood fill runs per chunk on ChunkLightJobs. Dirty blocks and the border deltas
+    // of finished jobs collect per chunk until that chunk has no job in flight (main thread only)
+    struct PendingChunkLight
+    {
+        std::vector<int>              m_seedIndices;        // Dirty blocks, Chunk::LocalCoordsToIndex()
+        std::vector<LightBorderDelta> m_incomingDeltas;     // From the neighbors' jobs
+    };
+    bool                                          m_useParallelLighting = true;     // Only with m_useFloodFillLighting
+    std::unordered_map<Chunk*, PendingChunkLight> m_pendingChunkLight;
+    std::unordered_map<Chunk*, ChunkLightJob*>    m_lightJobByChunk;                // Jobs in flight, one per chunk
+
+    bool HasQueuedLightWork() const;       // Main-thread queues only
+    void DispatchChunkLightJobs();
+    void ReturnPendingChunkLightToQueue();  // Parallel lighting switched off: seed the main-thread flood fill instead
+    void DrainLightWork();                  // Blocking; includes in-flight ChunkLightJobs
+    void DropChunkLightWork(Chunk* chunk);  // Chunk leaves the active set: cancel its job, drop its queued work
+
+    // Flood fill steps (main thread only)
+    void    SeedLightFloodFill(BlockIterator const& blockIter);
+    void    ProcessLightRemoval(LightChannel channel, LightRemovalNode const& node);
+    void    ProcessLightAddition(LightChannel channel, BlockIterator const& blockIter);
+    uint8_t ComputeLocalLight(LightChannel channel, BlockIterator const& blockIter, BlockPtr const& block) const;
+    void    NoteLightChanged(Chunk* chunk);
+    void    PurgeFloodFillQueues(Chunk const* chunk);     // Chunk leaves the world: drop its removal / addition entries
 
     // Assignment 5 Phase 10: Chunk mesh rebuild tracking (fixes inconsistent nighttime lighting)
     // When lighting changes, chunks are added to this set but NOT marked mesh-dirty immediately.
@@ -256,6 +652,20 @@ private:
     // Assignment 5: Track when initial world generation is complete
     bool m_initialWorldGenComplete = false;  // Set to true when all 256 chunks are activated
 
+    // Chunk pool: recycled chunks ready for AcquireChunk() (main thread only)
+    std::vector<Chunk*> m_chunkPool;
+    int                 m_chunkPoolHitCount  = 0;   // AcquireChunk() served from the pool
+    int                 m_chunkPoolMissCount = 0;   // AcquireChunk() had to allocate a new Chunk
+
+    // Recently deactivated chunks, compressed with their light (main thread only)
+    ChunkCache m_chunkCache{DEFAULT_CHUNK_CACHE_BYTE_BUDGET};
+
+    // Last RunBlockStorageBenchmark() result (main thread only)
+    BlockStorageBenchmarkResult m_blockStorageBenchmarkResult;
+
+    // Last RunChunkLookupBenchmark() result (main thread only)
+    ChunkLookupBenchmarkResult m_chunkLookupBenchmarkResult;
+
     //----------------------------------------------------------------------------------------------------
     // Game State
     //----------------------------------------------------------------------------------------------------
@@ -285,10 +695,15 @@ private:
     std::map<uint64_t, class Agent*> m_agents;  // agentID → Agent* (O(1) lookup for KADI tools)
     uint64_t m_nextAgentID = 1;  // Incrementing ID generator (starts at 1, 0 = invalid)
 
+    // Chunk pool helpers (replace new Chunk / delete chunk)
+    Chunk* AcquireChunk(IntVec2 const& chunkCoords);
+    void   ReleaseChunk(Chunk* chunk);
+
     // Chunk management helper methods
     bool ChunkExistsOnDisk(IntVec2 const& chunkCoords) const;
     bool LoadChunkFromDisk(Chunk* chunk) const;
     bool SaveChunkToDisk(Chunk* chunk) const;
+    void DeleteAllChunkFiles() const;     // Regeneration: stale saves would override the new terrain
     void UpdateNeighborPointers(IntVec2 const& chunkCoords);
     void ClearNeighborReferences(IntVec2 const& chunkCoords);
 };
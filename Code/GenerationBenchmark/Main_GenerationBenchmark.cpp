@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// Main_GenerationBenchmark.cpp - Console entry point running RunGenerationBenchmark() headless
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+#include "Game/Definition/BlockDefinition.hpp"
+#include "Game/Framework/BatchNoise.hpp"
+#include "Game/Framework/GenerationBenchmark.hpp"
+#include "Game/Framework/WorldGenConfig.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Usage: GenerationBenchmark [radius=4] [workers=<hardware threads>] [x=0] [y=0]
+//
+// Run from Run/ so the config and block definitions resolve like they do for the game. No App, window,
+// renderer or JobSystem is created: generation only needs g_worldGenConfig, the batch noise path and the
+// block definitions, and Chunk leaves its renderer and g_game paths alone when those are null.
+//----------------------------------------------------------------------------------------------------
+static bool ParseIntArg(char const* arg, char const* key, int& outValue)
+{
+    size_t const keyLength = strlen(key);
+    if (strncmp(arg, key, keyLength) != 0 || arg[keyLength] != '=')
+    {
+        return false;
+    }
+
+    outValue = atoi(arg + keyLength + 1);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+int main(int const argc, char** const argv)
+{
+    GenerationBenchmarkSettings settings;
+    settings.m_workerCount = (int)std::thread::hardware_concurrency();
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        char const* arg = argv[argIndex];
+        if (ParseIntArg(arg, "radius", settings.m_chunkRadius)) continue;
+        if (ParseIntArg(arg, "workers", settings.m_workerCount)) continue;
+        if (ParseIntArg(arg, "x", settings.m_centerChunkCoords.x)) continue;
+        if (ParseIntArg(arg, "y", settings.m_centerChunkCoords.y)) continue;
+
+        printf("Unknown argument '%s'\nUsage: GenerationBenchmark [radius=4] [workers=N] [x=0] [y=0]\n", arg);
+        return 1;
+    }
+
+    // Same generation setup as App::Startup() and Game::Game(), minus everything that needs a window
+    g_worldGenConfig = new WorldGenConfig();
+    g_worldGenConfig->LoadFromXML("Data/GameConfig.xml");
+    ValidateBatchNoise();
+    sBlockDefinition::InitializeDefinitionFromFile("Data/Definitions/BlockSpriteSheet_BlockDefinitions.xml");
+
+    GenerationBenchmarkResult const result = RunGenerationBenchmark(settings);
+
+    printf("%d chunks on %d workers: %.3f s (%.1f chunks/s)\n", result.m_chunkCount, result.m_workerCount,
+           result.m_wallSeconds, result.m_chunksPerSecond);
+    printf("Per chunk: terrain %.2f ms, lighting %.2f ms\n", result.m_terrainMsPerChunk, result.m_lightingMsPerChunk);
+    for (int stageIndex = 0; stageIndex < CHUNK_GENERATION_STAGE_COUNT; ++stageIndex)
+    {
+        printf("  %-8s %.2f ms\n", GetChunkGenerationStageName((ChunkGenerationStage)stageIndex), result.m_stageMsPerChunk[stageIndex]);
+    }
+    printf("Checksum: %016llx\n", (unsigned long long)result.m_checksum);
+
+    delete g_worldGenConfig;
+    g_worldGenConfig = nullptr;
+
+    return 0;
+}